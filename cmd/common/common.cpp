@@ -94,6 +94,31 @@ void add_option_private_api_address(CLI::App& cli, std::string& private_api_addr
                            "DO NOT EXPOSE TO THE INTERNET");
 }
 
+void add_option_metrics_address(CLI::App& cli, std::string& metrics_address) {
+    add_option_ip_endpoint(cli, "--metrics.addr", metrics_address,
+                           "Network address to serve Prometheus metrics at /metrics over HTTP\n"
+                           "An empty string means to not start the listener\n"
+                           "Use the endpoint form i.e. ip-address:port");
+}
+
+void add_profiling_options(CLI::App& cli, profiling::Settings& profiling_settings) {
+    std::map<std::string, profiling::TraceFormat> format_mapping{
+        {"chrome", profiling::TraceFormat::kChrome},
+        {"folded", profiling::TraceFormat::kFolded},
+    };
+    auto& profiling_opts = *cli.add_option_group("Profiling", "Profiling options");
+    profiling_opts.add_option("--profile.trace.file", profiling_settings.trace_file,
+                              "Record timed spans of sync stages and write them to given file name at exit\n"
+                              "An empty string means to not record spans");
+    profiling_opts.add_option("--profile.trace.format", profiling_settings.trace_format,
+                              "Trace file format: chrome (trace-event JSON) or folded (flame graph stacks) (default: chrome)")
+        ->transform(CLI::CheckedTransformer(format_mapping, CLI::ignore_case));
+    profiling_opts.add_option("--profile.trace.capacity", profiling_settings.ring_capacity,
+                              "Max number of most recent spans kept by each thread")
+        ->capture_default_str()
+        ->check(CLI::Range(size_t{1}, size_t{1} << 24));
+}
+
 void add_option_remote_sentry_addresses(CLI::App& cli, std::vector<std::string>& addresses, bool is_required) {
     cli.add_option("--sentry.remote.addr", addresses, "Remote Sentry gRPC API addresses (comma separated): <host>:<port>,<host2>:<port2>,...")
         ->delimiter(',')
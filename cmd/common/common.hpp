@@ -25,6 +25,7 @@
 #include <silkworm/buildinfo.h>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/concurrency/context_pool_settings.hpp>
+#include <silkworm/infra/profiling/span_profiler.hpp>
 
 namespace silkworm::cmd::common {
 
@@ -49,6 +50,12 @@ void add_option_etherbase(CLI::App& cli, std::string& etherbase_address);
 //! \brief Set up option for the IP address of Core private gRPC API
 void add_option_private_api_address(CLI::App& cli, std::string& private_api_address);
 
+//! \brief Set up option for the IP address of the Prometheus metrics HTTP endpoint
+void add_option_metrics_address(CLI::App& cli, std::string& metrics_address);
+
+//! \brief Set up options to populate span profiling settings after cli.parse()
+void add_profiling_options(CLI::App& cli, profiling::Settings& profiling_settings);
+
 //! \brief Set up option for the remote Sentry gRPC API address(es)
 void add_option_remote_sentry_addresses(CLI::App& cli, std::vector<std::string>& addresses, bool is_required);
 
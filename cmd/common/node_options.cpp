@@ -68,6 +68,11 @@ void add_node_options(CLI::App& cli, node::Settings& settings) {
         ->capture_default_str()
         ->check(CLI::Range(10u, 600u));
 
+    cli.add_option("--execution.prefetch.workers", settings.execution_prefetch_workers,
+                   "Sets the number of threads prefetching state ahead of execution (0 disables prefetching)")
+        ->capture_default_str()
+        ->check(CLI::Range(0u, 64u));
+
     cli.add_flag("--fakepow", settings.fake_pow, "Disables proof-of-work verification");
 
     add_option_private_api_address(cli, settings.server_settings.address_uri);
@@ -21,8 +21,11 @@
 
 #include <absl/strings/str_split.h>
 
+#include <silkworm/core/common/util.hpp>
 #include <silkworm/silkrpc/common/constants.hpp>
+#include <silkworm/silkrpc/common/execution_lanes.hpp>
 
+#include "human_size_parser_validator.hpp"
 #include "ip_endpoint_option.hpp"
 
 namespace silkworm::cmd::common {
@@ -71,6 +74,24 @@ struct ApiSpecValidator : public CLI::Validator {
     }
 };
 
+//! CLI11 validator for execution lane specification
+struct ExecutionLaneValidator : public CLI::Validator {
+    ExecutionLaneValidator() {
+        func_ = [](const std::string& value) -> std::string {
+            const auto lane_settings = silkworm::rpc::parse_execution_lane(value);
+            if (!lane_settings) {
+                return "Value " + value + " is not a valid execution lane: expected <namespace>:<workers>:<max_concurrency>:<max_queue_depth>:<max_queue_time_ms>";
+            }
+            const auto& ns = lane_settings->api_namespace;
+            if (std::find(kAllEth1Namespaces.cbegin(), kAllEth1Namespaces.cend(), ns) == kAllEth1Namespaces.cend() &&
+                ns != kEngineApiNamespace) {
+                return "Value " + ns + " is not a valid API namespace";
+            }
+            return {};
+        };
+    }
+};
+
 void add_rpcdaemon_options(CLI::App& cli, silkworm::rpc::DaemonSettings& settings) {
     add_option_ip_endpoint(cli, "--eth.addr", settings.eth_end_point,
                            "Execution Layer JSON RPC API local end-point as <address>:<port>");
@@ -91,6 +112,26 @@ void add_rpcdaemon_options(CLI::App& cli, silkworm::rpc::DaemonSettings& setting
         ->check(ApiSpecValidator())
         ->capture_default_str();
 
+    cli.add_option_function<std::vector<std::string>>(
+           "--api.lane",
+           [&settings](const std::vector<std::string>& lane_specs) {
+               for (const auto& lane_spec : lane_specs) {
+                   settings.execution_lanes.push_back(*silkworm::rpc::parse_execution_lane(lane_spec));
+               }
+           })
+        ->description(
+            "Execution lane isolating one JSON RPC API namespace as <namespace>:<workers>:<max_concurrency>:"
+            "<max_queue_depth>:<max_queue_time_ms> (0 workers means sharing --workers, 0 means unlimited concurrency "
+            "and no queue deadline), e.g. debug:4:8:64:5000. Requests exceeding the limits are shed. Can be repeated")
+        ->check(ExecutionLaneValidator());
+
+    cli.add_option_function<std::string>(
+           "--cache.blocks.size",
+           [&settings](const std::string& size) { settings.block_cache_size = *silkworm::parse_size(size); })
+        ->description("Max size of the blocks, receipts and total difficulties cached in memory and shared among requests")
+        ->default_str(silkworm::human_size(settings.block_cache_size))
+        ->check(HumanSizeParserValidator("1MB", {"64GB"}));
+
     cli.add_option("--jwt", settings.jwt_secret_file)
         ->description("JWT secret file to ensure safe connection between CL and EL as file path")
         ->capture_default_str();
@@ -107,6 +148,10 @@ void add_rpcdaemon_options(CLI::App& cli, silkworm::rpc::DaemonSettings& setting
     cli.add_flag("--erigon_compatibility", settings.erigon_json_rpc_compatibility)
         ->description("Flag indicating if strict compatibility with Erigon RpcDaemon is enabled")
         ->capture_default_str();
+
+    cli.add_flag("--ws", settings.ws_enabled)
+        ->description("Flag indicating if WebSocket upgrade (with eth_subscribe) is enabled on Execution Layer end-point")
+        ->capture_default_str();
 }
 
 }  // namespace silkworm::cmd::common
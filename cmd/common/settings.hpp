@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <string>
+
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/profiling/span_profiler.hpp>
 #include <silkworm/node/settings.hpp>
 #include <silkworm/node/snapshot/settings.hpp>
 #include <silkworm/sentry/settings.hpp>
@@ -30,6 +33,8 @@ struct SilkwormSettings {
     node::Settings node_settings;
     sentry::Settings sentry_settings;
     rpc::DaemonSettings rpcdaemon_settings;
+    std::string metrics_end_point;  // empty means metrics are not exported
+    profiling::Settings profiling_settings;
     bool force_pow{false};  // TODO(canepat) remove when PoS sync works
 };
 
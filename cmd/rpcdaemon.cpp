@@ -55,6 +55,7 @@ int main(int argc, char* argv[]) {
         add_option_data_dir(cli, settings.datadir);
         add_context_pool_options(cli, settings.context_pool_settings);
         add_rpcdaemon_options(cli, settings);
+        add_option_metrics_address(cli, settings.metrics_end_point);
         cli.parse(argc, argv);
 
         return Daemon::run(settings, {get_name_from_build_info(), get_library_versions()});
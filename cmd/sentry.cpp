@@ -15,6 +15,7 @@
 */
 
 #include <memory>
+#include <string>
 
 #include <CLI/CLI.hpp>
 #include <boost/asio/co_spawn.hpp>
@@ -26,6 +27,7 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/concurrency/awaitable_wait_for_one.hpp>
 #include <silkworm/infra/grpc/client/client_context_pool.hpp>
+#include <silkworm/infra/metrics/exporter.hpp>
 #include <silkworm/sentry/sentry.hpp>
 #include <silkworm/sentry/settings.hpp>
 
@@ -37,7 +39,7 @@ using namespace silkworm;
 using namespace silkworm::cmd::common;
 using namespace silkworm::sentry;
 
-Settings sentry_parse_cli_settings(int argc, char* argv[]) {
+Settings sentry_parse_cli_settings(int argc, char* argv[], std::string& metrics_end_point) {
     CLI::App cli{"Sentry - P2P proxy"};
 
     Settings settings;
@@ -48,6 +50,7 @@ Settings sentry_parse_cli_settings(int argc, char* argv[]) {
     add_option_chain(cli, settings.network_id);
     add_context_pool_options(cli, settings.context_pool_settings);
     add_sentry_options(cli, settings);
+    add_option_metrics_address(cli, metrics_end_point);
 
     try {
         cli.parse(argc, argv);
@@ -59,7 +62,7 @@ Settings sentry_parse_cli_settings(int argc, char* argv[]) {
     return settings;
 }
 
-void sentry_main(Settings settings) {
+void sentry_main(Settings settings, const std::string& metrics_end_point) {
     using namespace concurrency::awaitable_wait_for_one;
 
     log::init(settings.log_settings);
@@ -71,6 +74,12 @@ void sentry_main(Settings settings) {
 
     ShutdownSignal shutdown_signal{context_pool.any_executor()};
 
+    std::unique_ptr<metrics::Exporter> metrics_exporter;
+    if (!metrics_end_point.empty()) {
+        metrics_exporter = std::make_unique<metrics::Exporter>(metrics_end_point, context_pool.next_io_context());
+        metrics_exporter->start();
+    }
+
     Sentry sentry{std::move(settings), context_pool.as_executor_pool()};
 
     auto run_future = boost::asio::co_spawn(
@@ -89,6 +98,9 @@ void sentry_main(Settings settings) {
     // - sentry.run() exception, then it is rethrown here
     run_future.get();
 
+    if (metrics_exporter) {
+        metrics_exporter->stop();
+    }
     context_pool.stop();
     context_pool.join();
 
@@ -97,7 +109,9 @@ void sentry_main(Settings settings) {
 
 int main(int argc, char* argv[]) {
     try {
-        sentry_main(sentry_parse_cli_settings(argc, argv));
+        std::string metrics_end_point;
+        auto settings = sentry_parse_cli_settings(argc, argv, metrics_end_point);
+        sentry_main(std::move(settings), metrics_end_point);
     } catch (const CLI::ParseError& pe) {
         return -1;
     } catch (const std::exception& e) {
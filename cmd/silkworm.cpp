@@ -35,6 +35,8 @@
 #include <silkworm/infra/concurrency/awaitable_wait_for_all.hpp>
 #include <silkworm/infra/concurrency/awaitable_wait_for_one.hpp>
 #include <silkworm/infra/grpc/client/client_context_pool.hpp>
+#include <silkworm/infra/metrics/exporter.hpp>
+#include <silkworm/infra/profiling/span_profiler.hpp>
 #include <silkworm/node/db/eth_status_data_provider.hpp>
 #include <silkworm/node/node.hpp>
 #include <silkworm/sentry/sentry_client_factory.hpp>
@@ -69,8 +71,10 @@ using silkworm::cmd::common::add_logging_options;
 using silkworm::cmd::common::add_node_options;
 using silkworm::cmd::common::add_option_chain;
 using silkworm::cmd::common::add_option_data_dir;
+using silkworm::cmd::common::add_option_metrics_address;
 using silkworm::cmd::common::add_option_private_api_address;
 using silkworm::cmd::common::add_option_remote_sentry_addresses;
+using silkworm::cmd::common::add_profiling_options;
 using silkworm::cmd::common::add_rpcdaemon_options;
 using silkworm::cmd::common::add_sentry_options;
 using silkworm::cmd::common::add_snapshot_options;
@@ -163,6 +167,12 @@ void parse_silkworm_command_line(CLI::App& cli, int argc, char* argv[], Silkworm
     // Logging options
     add_logging_options(cli, settings.log_settings);
 
+    // Metrics options
+    add_option_metrics_address(cli, settings.metrics_end_point);
+
+    // Profiling options
+    add_profiling_options(cli, settings.profiling_settings);
+
     // RpcDaemon settings
     add_rpcdaemon_options(cli, settings.rpcdaemon_settings);
 
@@ -285,6 +295,19 @@ int main(int argc, char* argv[]) {
             settings.node_settings.server_settings.context_pool_settings,
         };
 
+        // Profiling: the span profiler recording sync stages timings, if enabled
+        const auto& profiling_settings{settings.profiling_settings};
+        if (!profiling_settings.trace_file.empty()) {
+            profiling::SpanProfiler::instance().enable(profiling_settings.ring_capacity);
+        }
+
+        // Metrics: the Prometheus endpoint exporting the process-wide metrics, if enabled
+        std::unique_ptr<metrics::Exporter> metrics_exporter;
+        if (!settings.metrics_end_point.empty()) {
+            metrics_exporter = std::make_unique<metrics::Exporter>(settings.metrics_end_point, context_pool.next_io_context());
+            metrics_exporter->start();
+        }
+
         // Sentry: the peer-2-peer proxy server
         settings.sentry_settings.data_dir_path = node_settings.data_directory->path();
         settings.sentry_settings.network_id = node_settings.network_id;
@@ -347,6 +370,11 @@ int main(int argc, char* argv[]) {
         // Wait for shutdown signal or an exception from tasks
         run_future.get();
 
+        // Persist the recorded spans (if any) before exiting
+        if (!profiling_settings.trace_file.empty()) {
+            profiling::SpanProfiler::instance().write_to_file(profiling_settings.trace_file, profiling_settings.trace_format);
+        }
+
         // Graceful exit after user shutdown signal
         sw_log::Info() << "Exiting Silkworm";
         return 0;
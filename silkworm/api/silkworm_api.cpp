@@ -26,7 +26,9 @@
 #include <silkworm/core/types/call_traces.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/concurrency/thread_pool.hpp>
+#include <silkworm/node/common/shared_analysis_cache.hpp>
 #include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/db/block_prefetcher.hpp>
 #include <silkworm/node/db/buffer.hpp>
 #include <silkworm/node/snapshot/index.hpp>
 
@@ -201,34 +203,50 @@ int silkworm_execute_blocks(SilkwormHandle* handle, MDBX_txn* mdbx_txn, uint64_t
         db::Buffer state_buffer{txn, /*prune_history_threshold=*/0};
         db::DataModel access_layer{txn};
 
-        static constexpr size_t kCacheSize{5'000};
-        AnalysisCache analysis_cache{kCacheSize};
+        AnalysisCache& analysis_cache{shared_analysis_cache()};
         ObjectPool<evmone::ExecutionState> state_pool;
 
         // Transform batch size limit into gas units (Ggas = Giga gas, Tgas = Tera gas)
         const size_t gas_max_history_size{batch_size * 1_Kibi / 2};  // 512MB -> 256Ggas roughly
         const size_t gas_max_batch_size{gas_max_history_size * 20};  // 256Ggas -> 5Tgas roughly
 
-        // Preload requested blocks in batches from storage, i.e. from MDBX database or snapshots
+        // Preload requested blocks from storage: frozen blocks are read from snapshots on a background thread, the
+        // remaining ones in batches from MDBX database on this thread (MDBX txn cannot be used by other threads)
         static constexpr size_t kMaxPrefetchedBlocks{10240};
+        const BlockNum max_frozen_block{db::DataModel::highest_frozen_block_number()};
+        std::unique_ptr<db::BlockPrefetcher> frozen_blocks;
+        if (max_frozen_block > 0 && start_block <= max_frozen_block) {
+            frozen_blocks = std::make_unique<db::BlockPrefetcher>(
+                start_block, std::min(max_block, max_frozen_block),
+                [](BlockNum n, Block& b) { return db::DataModel::read_block_from_snapshot(n, /*read_senders=*/true, b); },
+                kMaxPrefetchedBlocks);
+        }
         boost::circular_buffer<Block> prefetched_blocks{/*buffer_capacity=*/kMaxPrefetchedBlocks};
 
         size_t gas_history_size{0};
         size_t gas_batch_size{0};
+        Block block;
         for (BlockNum block_number{start_block}; block_number <= max_block; ++block_number) {
-            if (prefetched_blocks.empty()) {
-                const auto num_blocks{std::min(size_t(max_block - block_number + 1), kMaxPrefetchedBlocks)};
-                SILK_TRACE << "Prefetching " << num_blocks << " blocks start";
-                for (BlockNum n{block_number}; n < block_number + num_blocks; ++n) {
-                    prefetched_blocks.push_back();
-                    const bool success{access_layer.read_block(n, /*read_senders=*/true, prefetched_blocks.back())};
-                    if (!success) {
-                        return SILKWORM_BLOCK_NOT_FOUND;
+            if (frozen_blocks && block_number <= max_frozen_block) {
+                if (!frozen_blocks->next(block)) {
+                    return SILKWORM_BLOCK_NOT_FOUND;
+                }
+            } else {
+                if (prefetched_blocks.empty()) {
+                    const auto num_blocks{std::min(size_t(max_block - block_number + 1), kMaxPrefetchedBlocks)};
+                    SILK_TRACE << "Prefetching " << num_blocks << " blocks start";
+                    for (BlockNum n{block_number}; n < block_number + num_blocks; ++n) {
+                        prefetched_blocks.push_back();
+                        const bool success{access_layer.read_block(n, /*read_senders=*/true, prefetched_blocks.back())};
+                        if (!success) {
+                            return SILKWORM_BLOCK_NOT_FOUND;
+                        }
                     }
+                    SILK_TRACE << "Prefetching " << num_blocks << " blocks done";
                 }
-                SILK_TRACE << "Prefetching " << num_blocks << " blocks done";
+                block = std::move(prefetched_blocks.front());
+                prefetched_blocks.pop_front();
             }
-            const Block& block{prefetched_blocks.front()};
 
             const auto protocol_rule_set{protocol::rule_set_factory(*chain_config)};
             if (!protocol_rule_set) {
@@ -264,8 +282,6 @@ int silkworm_execute_blocks(SilkwormHandle* handle, MDBX_txn* mdbx_txn, uint64_t
                 SILK_INFO << "Blocks <= " << block.header.number << " executed";
             }
 
-            prefetched_blocks.pop_front();
-
             // Flush whole state buffer or just history if we've reached the target batch sizes in gas units
             if (gas_batch_size >= gas_max_batch_size) {
                 SILK_TRACE << log::Args{"buffer", "state", "size", human_size(state_buffer.current_batch_state_size())};
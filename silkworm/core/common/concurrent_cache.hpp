@@ -0,0 +1,257 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#ifndef __wasm__
+#include <mutex>
+#endif
+
+#include <silkworm/core/common/hash_maps.hpp>
+
+namespace silkworm {
+
+//! Weigher assigning the same unit weight to every entry, so that cache capacity is expressed in number of entries
+template <typename V>
+struct UnitWeigher {
+    size_t operator()(const V&) const noexcept { return 1; }
+};
+
+//! Statistics about the usage of a ConcurrentCache
+struct ConcurrentCacheStats {
+    size_t hits{0};
+    size_t misses{0};
+    size_t evictions{0};
+};
+
+//! \brief ConcurrentCache is a thread-safe bounded key/value cache split into independently locked shards.
+//! \details Each shard uses CLOCK eviction (second chance): lookups just mark the entry as referenced, so hits do not
+//! move any node around as in LRU and need no allocation. Entry slots live in a vector and freed slots are reused.
+//! Capacity is expressed in units of weight as computed by the Weigher (number of entries by default, bytes if the
+//! weigher returns the approximate entry size).
+template <typename K, typename V, typename Weigher = UnitWeigher<V>, typename Hash = std::hash<K>>
+class ConcurrentCache {
+  public:
+    static constexpr size_t kDefaultNumShards{16};
+
+    explicit ConcurrentCache(size_t capacity, size_t num_shards = kDefaultNumShards, Weigher weigher = {})
+        : capacity_{capacity},
+          num_shards_{std::bit_floor(std::clamp<size_t>(std::min(num_shards, capacity), 1, kMaxNumShards))},
+          shards_{std::make_unique<Shard[]>(num_shards_)},
+          weigher_{std::move(weigher)} {
+        // Split capacity evenly, spreading the remainder over the first shards
+        for (size_t i{0}; i < num_shards_; ++i) {
+            shards_[i].capacity = capacity_ / num_shards_ + (i < capacity_ % num_shards_ ? 1 : 0);
+        }
+    }
+
+    // Not copyable nor movable
+    ConcurrentCache(const ConcurrentCache&) = delete;
+    ConcurrentCache& operator=(const ConcurrentCache&) = delete;
+
+    //! \brief Insert or replace the value associated to key, evicting other entries if needed
+    //! \remarks Values heavier than the shard capacity are not cached at all
+    void put(const K& key, V value) {
+        const size_t weight{weigher_(value)};
+        Shard& shard{shard_for(key)};
+        Guard lock{shard.mutex};
+        if (auto it{shard.index.find(key)}; it != shard.index.end()) {
+            shard.remove_slot(it->second);
+            shard.index.erase(it);
+        }
+        if (weight > shard.capacity) {
+            return;
+        }
+        shard.make_room(weight);
+        const uint32_t slot_index{shard.acquire_slot()};
+        Slot& slot{shard.slots[slot_index]};
+        slot.key = key;
+        slot.value = std::move(value);
+        slot.weight = weight;
+        slot.occupied = true;
+        slot.referenced = false;
+        shard.weight += weight;
+        shard.index.emplace(key, slot_index);
+    }
+
+    //! \brief Lookup the value associated to key returning a copy of it, if any
+    std::optional<V> get_as_copy(const K& key) {
+        Shard& shard{shard_for(key)};
+        Guard lock{shard.mutex};
+        const auto it{shard.index.find(key)};
+        if (it == shard.index.end()) {
+            ++shard.stats.misses;
+            return std::nullopt;
+        }
+        ++shard.stats.hits;
+        Slot& slot{shard.slots[it->second]};
+        slot.referenced = true;
+        return slot.value;
+    }
+
+    bool remove(const K& key) {
+        Shard& shard{shard_for(key)};
+        Guard lock{shard.mutex};
+        const auto it{shard.index.find(key)};
+        if (it == shard.index.end()) {
+            return false;
+        }
+        shard.remove_slot(it->second);
+        shard.index.erase(it);
+        return true;
+    }
+
+    void clear() noexcept {
+        for (size_t i{0}; i < num_shards_; ++i) {
+            Shard& shard{shards_[i]};
+            Guard lock{shard.mutex};
+            shard.index.clear();
+            shard.slots.clear();
+            shard.free_slots.clear();
+            shard.clock_hand = 0;
+            shard.weight = 0;
+        }
+    }
+
+    //! \brief Number of entries currently in cache
+    [[nodiscard]] size_t size() const noexcept {
+        return accumulate([](const Shard& shard) { return shard.index.size(); });
+    }
+
+    //! \brief Total weight of the entries currently in cache
+    [[nodiscard]] size_t weight() const noexcept {
+        return accumulate([](const Shard& shard) { return shard.weight; });
+    }
+
+    [[nodiscard]] size_t max_size() const noexcept { return capacity_; }
+
+    [[nodiscard]] size_t num_shards() const noexcept { return num_shards_; }
+
+    [[nodiscard]] ConcurrentCacheStats stats() const noexcept {
+        ConcurrentCacheStats stats;
+        for (size_t i{0}; i < num_shards_; ++i) {
+            const Shard& shard{shards_[i]};
+            Guard lock{shard.mutex};
+            stats.hits += shard.stats.hits;
+            stats.misses += shard.stats.misses;
+            stats.evictions += shard.stats.evictions;
+        }
+        return stats;
+    }
+
+  private:
+    static constexpr size_t kMaxNumShards{256};
+
+#ifndef __wasm__
+    using Mutex = std::mutex;
+    using Guard = std::lock_guard<Mutex>;
+#else
+    struct Mutex {};
+    struct Guard {
+        explicit Guard(Mutex&) {}
+    };
+#endif
+
+    struct Slot {
+        K key{};
+        V value{};
+        size_t weight{0};
+        bool occupied{false};
+        bool referenced{false};
+    };
+
+    struct Shard {
+        mutable Mutex mutex;
+        FlatHashMap<K, uint32_t> index;
+        std::vector<Slot> slots;
+        std::vector<uint32_t> free_slots;
+        size_t clock_hand{0};
+        size_t capacity{0};
+        size_t weight{0};
+        ConcurrentCacheStats stats;
+
+        uint32_t acquire_slot() {
+            if (!free_slots.empty()) {
+                const uint32_t slot_index{free_slots.back()};
+                free_slots.pop_back();
+                return slot_index;
+            }
+            slots.emplace_back();
+            return static_cast<uint32_t>(slots.size() - 1);
+        }
+
+        void remove_slot(uint32_t slot_index) {
+            Slot& slot{slots[slot_index]};
+            weight -= slot.weight;
+            slot = Slot{};
+            free_slots.push_back(slot_index);
+        }
+
+        // Evict entries using CLOCK until there is room for the specified weight
+        void make_room(size_t required_weight) {
+            while (weight + required_weight > capacity && !index.empty()) {
+                if (clock_hand >= slots.size()) {
+                    clock_hand = 0;
+                }
+                Slot& slot{slots[clock_hand]};
+                if (slot.occupied) {
+                    if (slot.referenced) {
+                        slot.referenced = false;  // second chance
+                    } else {
+                        index.erase(slot.key);
+                        remove_slot(static_cast<uint32_t>(clock_hand));
+                        ++stats.evictions;
+                    }
+                }
+                ++clock_hand;
+            }
+        }
+    };
+
+    Shard& shard_for(const K& key) const noexcept {
+        // Use the high bits to decorrelate shard selection from the bucket selection within the shard
+        const size_t hash{Hash{}(key)};
+        return shards_[(hash ^ (hash >> (sizeof(size_t) * 4))) & (num_shards_ - 1)];
+    }
+
+    template <typename F>
+    size_t accumulate(F&& f) const noexcept {
+        size_t total{0};
+        for (size_t i{0}; i < num_shards_; ++i) {
+            const Shard& shard{shards_[i]};
+            Guard lock{shard.mutex};
+            total += f(shard);
+        }
+        return total;
+    }
+
+    const size_t capacity_;
+    const size_t num_shards_;
+    std::unique_ptr<Shard[]> shards_;
+    Weigher weigher_;
+};
+
+}  // namespace silkworm
@@ -0,0 +1,59 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/concurrent_cache.hpp>
+#include <silkworm/core/common/lru_cache.hpp>
+#include <silkworm/core/common/random_number.hpp>
+
+namespace {
+
+constexpr size_t kCacheCapacity{10'000};
+constexpr int kNumKeys{20'000};   // working set twice the capacity
+constexpr int kReadsPerWrite{8};  // read-mostly workload as for block and analysis caches
+
+// Caches are shared by all benchmark threads, so they must exist before any thread starts
+silkworm::lru_cache<int, int> lru_cache{kCacheCapacity, /*thread_safe=*/true};
+silkworm::ConcurrentCache<int, int> concurrent_cache{kCacheCapacity};
+
+template <typename Cache>
+void run_workload(benchmark::State& state, Cache& cache) {
+    silkworm::RandomNumber rnd{0, kNumKeys - 1};
+    for ([[maybe_unused]] auto _ : state) {
+        const auto key{static_cast<int>(rnd.generate_one())};
+        if (key % kReadsPerWrite == 0) {
+            cache.put(key, key);
+        } else {
+            benchmark::DoNotOptimize(cache.get_as_copy(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+static void benchmark_lru_cache_contention(benchmark::State& state) {
+    run_workload(state, lru_cache);
+}
+
+BENCHMARK(benchmark_lru_cache_contention)->ThreadRange(1, 16)->UseRealTime();
+
+static void benchmark_concurrent_cache_contention(benchmark::State& state) {
+    run_workload(state, concurrent_cache);
+}
+
+BENCHMARK(benchmark_concurrent_cache_contention)->ThreadRange(1, 16)->UseRealTime();
@@ -0,0 +1,127 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "concurrent_cache.hpp"
+
+#include <string>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+namespace silkworm {
+
+struct StringSizeWeigher {
+    size_t operator()(const std::string& s) const noexcept { return s.size(); }
+};
+
+TEST_CASE("ConcurrentCache: put and get", "[silkworm][core][common][concurrent_cache]") {
+    ConcurrentCache<int, int> cache{10};
+    CHECK(cache.max_size() == 10);
+    CHECK_FALSE(cache.get_as_copy(7));
+
+    cache.put(7, 777);
+    CHECK(cache.get_as_copy(7) == 777);
+    CHECK(cache.size() == 1);
+
+    cache.put(7, 778);
+    CHECK(cache.get_as_copy(7) == 778);
+    CHECK(cache.size() == 1);
+
+    const auto stats{cache.stats()};
+    CHECK(stats.hits == 2);
+    CHECK(stats.misses == 1);
+    CHECK(stats.evictions == 0);
+
+    CHECK(cache.remove(7));
+    CHECK_FALSE(cache.remove(7));
+    CHECK(cache.size() == 0);
+}
+
+TEST_CASE("ConcurrentCache: number of shards", "[silkworm][core][common][concurrent_cache]") {
+    CHECK(ConcurrentCache<int, int>{1}.num_shards() == 1);
+    CHECK(ConcurrentCache<int, int>{1000, 12}.num_shards() == 8);
+    CHECK(ConcurrentCache<int, int>{1000}.num_shards() == ConcurrentCache<int, int>::kDefaultNumShards);
+}
+
+TEST_CASE("ConcurrentCache: keeps all values within capacity", "[silkworm][core][common][concurrent_cache]") {
+    static constexpr int kNumRecords{100};
+    static constexpr int kCapacity{50};
+
+    ConcurrentCache<int, int> cache{kCapacity};
+    for (int i{0}; i < kNumRecords; ++i) {
+        cache.put(i, i);
+        CHECK(cache.size() <= kCapacity);
+    }
+    CHECK(cache.stats().evictions == kNumRecords - cache.size());
+}
+
+TEST_CASE("ConcurrentCache: CLOCK gives referenced entries a second chance", "[silkworm][core][common][concurrent_cache]") {
+    ConcurrentCache<int, int> cache{3, /*num_shards=*/1};
+    cache.put(1, 1);
+    cache.put(2, 2);
+    cache.put(3, 3);
+    CHECK(cache.get_as_copy(1));
+
+    cache.put(4, 4);
+    CHECK(cache.get_as_copy(1));
+    CHECK_FALSE(cache.get_as_copy(2));
+    CHECK(cache.get_as_copy(3));
+    CHECK(cache.get_as_copy(4));
+}
+
+TEST_CASE("ConcurrentCache: weight-based capacity", "[silkworm][core][common][concurrent_cache]") {
+    ConcurrentCache<int, std::string, StringSizeWeigher> cache{10, /*num_shards=*/1};
+    cache.put(1, "aaaaa");
+    cache.put(2, "bbbbb");
+    CHECK(cache.weight() == 10);
+
+    cache.put(3, "cc");
+    CHECK(cache.weight() <= 10);
+    CHECK(cache.get_as_copy(3) == "cc");
+
+    // Too heavy to be cached at all
+    cache.put(4, std::string(11, 'x'));
+    CHECK_FALSE(cache.get_as_copy(4));
+
+    cache.clear();
+    CHECK(cache.size() == 0);
+    CHECK(cache.weight() == 0);
+}
+
+TEST_CASE("ConcurrentCache: concurrent access", "[silkworm][core][common][concurrent_cache]") {
+    static constexpr int kNumThreads{4};
+    static constexpr int kNumOperations{10'000};
+    static constexpr size_t kCapacity{256};
+
+    ConcurrentCache<int, int> cache{kCapacity};
+    std::vector<std::thread> threads;
+    for (int t{0}; t < kNumThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i{0}; i < kNumOperations; ++i) {
+                cache.put(i % 512 + t, i);
+                (void)cache.get_as_copy(i % 384);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(cache.size() <= kCapacity);
+    const auto stats{cache.stats()};
+    CHECK(stats.hits + stats.misses == kNumThreads * kNumOperations);
+}
+
+}  // namespace silkworm
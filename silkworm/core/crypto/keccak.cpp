@@ -0,0 +1,117 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "keccak.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <ethash/keccak.hpp>
+
+#include <silkworm/core/common/assert.hpp>
+#include <silkworm/core/crypto/keccak_lanes.hpp>
+
+namespace silkworm {
+
+static KeccakImplementation detect_best_implementation() {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    // Also checks the OS saves the extended register state
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return KeccakImplementation::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return KeccakImplementation::kAvx2;
+    }
+#endif
+    return KeccakImplementation::kScalar;
+}
+
+KeccakImplementation keccak256_best_implementation() {
+    static const KeccakImplementation kBestImplementation{detect_best_implementation()};
+    return kBestImplementation;
+}
+
+static size_t full_blocks(ByteView input) { return input.size() / keccak::kRate; }
+
+//! Hash N messages at a time in lanes whenever they have the same number of full blocks, the others one by one
+template <size_t N, typename LanesFunction>
+static void keccak256_in_lanes(std::span<const ByteView> inputs, std::span<ethash::hash256> outputs,
+                               LanesFunction lanes_function) {
+    // Group messages by block count, unless they are already uniform (the most common case)
+    std::vector<size_t> order;
+    const bool uniform{std::all_of(inputs.begin(), inputs.end(), [&](ByteView input) {
+        return full_blocks(input) == full_blocks(inputs.front());
+    })};
+    if (!uniform) {
+        order.resize(inputs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            return full_blocks(inputs[lhs]) < full_blocks(inputs[rhs]);
+        });
+    }
+    const auto index_at = [&](size_t position) { return uniform ? position : order[position]; };
+
+    const uint8_t* lane_inputs[N];
+    size_t lane_lengths[N];
+    uint8_t* lane_outputs[N];
+    size_t position{0};
+    while (position < inputs.size()) {
+        // Sorted by block count: same count at both ends of the group means same count for all
+        if (position + N <= inputs.size() &&
+            full_blocks(inputs[index_at(position)]) == full_blocks(inputs[index_at(position + N - 1)])) {
+            for (size_t lane{0}; lane < N; ++lane) {
+                const size_t index{index_at(position + lane)};
+                lane_inputs[lane] = inputs[index].data();
+                lane_lengths[lane] = inputs[index].size();
+                lane_outputs[lane] = outputs[index].bytes;
+            }
+            lanes_function(lane_inputs, lane_lengths, lane_outputs);
+            position += N;
+        } else {
+            const size_t index{index_at(position)};
+            outputs[index] = ethash::keccak256(inputs[index].data(), inputs[index].size());
+            ++position;
+        }
+    }
+}
+
+void keccak256_many(std::span<const ByteView> inputs, std::span<ethash::hash256> outputs) {
+    keccak256_many(inputs, outputs, keccak256_best_implementation());
+}
+
+void keccak256_many(std::span<const ByteView> inputs, std::span<ethash::hash256> outputs,
+                    KeccakImplementation implementation) {
+    SILKWORM_ASSERT(outputs.size() >= inputs.size());
+    implementation = std::min(implementation, keccak256_best_implementation());
+    switch (implementation) {
+#if defined(__x86_64__) || defined(_M_X64)
+        case KeccakImplementation::kAvx512:
+            keccak256_in_lanes<8>(inputs, outputs, keccak::keccak256_x8_avx512);
+            return;
+        case KeccakImplementation::kAvx2:
+            keccak256_in_lanes<4>(inputs, outputs, keccak::keccak256_x4_avx2);
+            return;
+#endif
+        default:
+            for (size_t i{0}; i < inputs.size(); ++i) {
+                outputs[i] = ethash::keccak256(inputs[i].data(), inputs[i].size());
+            }
+    }
+}
+
+}  // namespace silkworm
@@ -0,0 +1,48 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <span>
+
+#include <ethash/hash_types.hpp>
+
+#include <silkworm/core/common/base.hpp>
+
+namespace silkworm {
+
+//! Keccak-256 implementations usable by keccak256_many, ordered by increasing number of lanes
+enum class KeccakImplementation {
+    kScalar,  // one message at a time (ethash)
+    kAvx2,    // 4 messages at a time
+    kAvx512,  // 8 messages at a time
+};
+
+//! The widest implementation supported by the running CPU, detected once
+KeccakImplementation keccak256_best_implementation();
+
+//! \brief Compute the Keccak-256 hashes of many messages at once i.e. outputs[i] = keccak256(inputs[i])
+//! \details Messages having the same number of 136-byte blocks are hashed 8 or 4 at a time in SIMD lanes when
+//! AVX-512F or AVX2 are available, any other message falls back to scalar. Best results are obtained with batches of
+//! similar-sized messages, like addresses, storage locations or transaction payloads.
+//! \pre outputs.size() >= inputs.size()
+void keccak256_many(std::span<const ByteView> inputs, std::span<ethash::hash256> outputs);
+
+//! Same as keccak256_many above using the specified implementation, or the best supported one if not available
+void keccak256_many(std::span<const ByteView> inputs, std::span<ethash::hash256> outputs,
+                    KeccakImplementation implementation);
+
+}  // namespace silkworm
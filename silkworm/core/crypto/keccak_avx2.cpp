@@ -0,0 +1,56 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+// This translation unit is compiled with AVX2 enabled (see CMakeLists.txt): its code must run only after checking
+// AVX2 is supported at runtime, which is done by keccak256_many dispatch.
+
+#include "keccak_lanes.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+namespace silkworm::keccak {
+
+namespace {
+
+    struct Avx2Lanes {
+        static constexpr size_t kCount{4};
+        using Vector = __m256i;
+        static Vector set1(uint64_t word) { return _mm256_set1_epi64x(static_cast<long long>(word)); }
+        static Vector load(const uint64_t* words) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words)); }
+        static void store(uint64_t* words, Vector v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(words), v); }
+        static Vector bxor(Vector a, Vector b) { return _mm256_xor_si256(a, b); }
+        static Vector andnot(Vector a, Vector b) { return _mm256_andnot_si256(a, b); }
+        template <int N>
+        static Vector rotl(Vector v) {
+            if constexpr (N == 0) {
+                return v;
+            } else {
+                return _mm256_or_si256(_mm256_slli_epi64(v, N), _mm256_srli_epi64(v, 64 - N));
+            }
+        }
+    };
+
+}  // namespace
+
+void keccak256_x4_avx2(const uint8_t* const inputs[4], const size_t lengths[4], uint8_t* const outputs[4]) {
+    keccak256_lanes<Avx2Lanes>(inputs, lengths, outputs);
+}
+
+}  // namespace silkworm::keccak
+
+#endif  // defined(__x86_64__) || defined(_M_X64)
@@ -0,0 +1,50 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+// This translation unit is compiled with AVX-512F enabled (see CMakeLists.txt): its code must run only after checking
+// AVX-512F is supported at runtime, which is done by keccak256_many dispatch.
+
+#include "keccak_lanes.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+namespace silkworm::keccak {
+
+namespace {
+
+    struct Avx512Lanes {
+        static constexpr size_t kCount{8};
+        using Vector = __m512i;
+        static Vector set1(uint64_t word) { return _mm512_set1_epi64(static_cast<long long>(word)); }
+        static Vector load(const uint64_t* words) { return _mm512_loadu_si512(words); }
+        static void store(uint64_t* words, Vector v) { _mm512_storeu_si512(words, v); }
+        static Vector bxor(Vector a, Vector b) { return _mm512_xor_si512(a, b); }
+        static Vector andnot(Vector a, Vector b) { return _mm512_andnot_si512(a, b); }
+        template <int N>
+        static Vector rotl(Vector v) { return _mm512_rol_epi64(v, N); }
+    };
+
+}  // namespace
+
+void keccak256_x8_avx512(const uint8_t* const inputs[8], const size_t lengths[8], uint8_t* const outputs[8]) {
+    keccak256_lanes<Avx512Lanes>(inputs, lengths, outputs);
+}
+
+}  // namespace silkworm::keccak
+
+#endif  // defined(__x86_64__) || defined(_M_X64)
@@ -0,0 +1,51 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/crypto/keccak.hpp>
+
+// Per-core throughput of keccak256_many: state.range(0) is the message size, state.range(1) the implementation
+static void keccak256_many_throughput(benchmark::State& state) {
+    using namespace silkworm;
+    const auto implementation{static_cast<KeccakImplementation>(state.range(1))};
+    if (implementation > keccak256_best_implementation()) {
+        state.SkipWithError("implementation not supported by this CPU");
+        return;
+    }
+
+    constexpr size_t kBatchSize{1024};
+    const auto message_size{static_cast<size_t>(state.range(0))};
+    std::vector<Bytes> messages;
+    for (size_t i{0}; i < kBatchSize; ++i) {
+        messages.emplace_back(message_size, static_cast<uint8_t>(i));
+    }
+    const std::vector<ByteView> inputs{messages.cbegin(), messages.cend()};
+    std::vector<ethash::hash256> outputs(kBatchSize);
+
+    for ([[maybe_unused]] auto _ : state) {
+        keccak256_many(inputs, outputs, implementation);
+        benchmark::DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kBatchSize));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * kBatchSize * message_size));
+}
+
+// 20-byte addresses, 32-byte storage locations and ~200-byte transaction payloads
+BENCHMARK(keccak256_many_throughput)->ArgsProduct({{20, 32, 200}, {0, 1, 2}});
@@ -0,0 +1,194 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+// Internal building blocks of the multi-lane Keccak-256 implementations, not to be included outside core/crypto.
+// This header is included by translation units compiled with specific instruction set flags (e.g. -mavx2): hence it
+// must not use any function with external linkage defined inline in other headers, because the linker could pick its
+// SIMD-compiled instance also for non-SIMD translation units.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <utility>
+
+namespace silkworm::keccak {
+
+//! Keccak-256 rate in bytes i.e. the size of one absorbed block
+inline constexpr size_t kRate{136};
+
+//! Keccak-256 digest size in bytes
+inline constexpr size_t kDigestSize{32};
+
+//! \brief Hash 4 messages in parallel using AVX2
+//! \pre all messages have the same number of full blocks i.e. length / kRate
+void keccak256_x4_avx2(const uint8_t* const inputs[4], const size_t lengths[4], uint8_t* const outputs[4]);
+
+//! \brief Hash 8 messages in parallel using AVX-512F
+//! \pre all messages have the same number of full blocks i.e. length / kRate
+void keccak256_x8_avx512(const uint8_t* const inputs[8], const size_t lengths[8], uint8_t* const outputs[8]);
+
+namespace {  // internal linkage on purpose, see above
+
+    constexpr uint64_t kRoundConstants[24]{
+        0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+        0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+        0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+        0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+        0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+        0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+    };
+
+    //! Rotation offsets of the rho step indexed by x + 5 * y
+    constexpr int kRotations[25]{
+        0, 1, 62, 28, 27,
+        36, 44, 6, 55, 20,
+        3, 10, 43, 25, 39,
+        41, 45, 15, 21, 8,
+        18, 2, 61, 56, 14,
+    };
+
+    //! Destination index of the pi step for the word at x + 5 * y i.e. y + 5 * ((2 * x + 3 * y) % 5)
+    constexpr size_t kPiDestinations[25]{
+        0, 10, 20, 5, 15,
+        16, 1, 11, 21, 6,
+        7, 17, 2, 12, 22,
+        23, 8, 18, 3, 13,
+        14, 24, 9, 19, 4,
+    };
+
+    //! \brief Keccak-f[1600] permutation applied to Lanes::kCount independent states at once
+    //! \details Lanes must provide: Vector type holding one 64-bit word per lane, set1, bxor, andnot (i.e. ~a & b)
+    //! and rotl<N> operations. Steps are fully unrolled through fold expressions so that all indices and rotation
+    //! offsets are compile-time constants.
+    template <typename Lanes>
+    inline void keccak_f1600(typename Lanes::Vector state[25]) {
+        using Vector = typename Lanes::Vector;
+        Vector c[5], d[5], b[25];
+        for (const uint64_t round_constant : kRoundConstants) {
+            // Theta
+            [&]<size_t... X>(std::index_sequence<X...>) {
+                ((c[X] = Lanes::bxor(Lanes::bxor(Lanes::bxor(state[X], state[X + 5]), Lanes::bxor(state[X + 10], state[X + 15])),
+                                     state[X + 20])),
+                 ...);
+                ((d[X] = Lanes::bxor(c[(X + 4) % 5], Lanes::template rotl<1>(c[(X + 1) % 5]))), ...);
+            }(std::make_index_sequence<5>{});
+            [&]<size_t... I>(std::index_sequence<I...>) {
+                ((state[I] = Lanes::bxor(state[I], d[I % 5])), ...);
+                // Rho and Pi
+                ((b[kPiDestinations[I]] = Lanes::template rotl<kRotations[I]>(state[I])), ...);
+                // Chi
+                ((state[I] = Lanes::bxor(b[I], Lanes::andnot(b[I / 5 * 5 + (I + 1) % 5], b[I / 5 * 5 + (I + 2) % 5]))), ...);
+            }(std::make_index_sequence<25>{});
+            // Iota
+            state[0] = Lanes::bxor(state[0], Lanes::set1(round_constant));
+        }
+    }
+
+    //! Load the little-endian 64-bit word at given position
+    inline uint64_t load_le64(const uint8_t* data) {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        return word;
+    }
+
+    //! Store the 64-bit word in little-endian order at given position
+    inline void store_le64(uint8_t* data, uint64_t word) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        memcpy(data, &word, sizeof(word));
+    }
+
+    //! XOR one block per lane into the state, blocks[i] pointing to kRate bytes
+    template <typename Lanes>
+    inline void absorb_block(typename Lanes::Vector state[25], const uint8_t* const blocks[Lanes::kCount]) {
+        uint64_t words[Lanes::kCount];
+        for (size_t i{0}; i < kRate / 8; ++i) {
+            for (size_t lane{0}; lane < Lanes::kCount; ++lane) {
+                words[lane] = load_le64(blocks[lane] + 8 * i);
+            }
+            state[i] = Lanes::bxor(state[i], Lanes::load(words));
+        }
+    }
+
+    //! \brief Keccak-256 of Lanes::kCount messages having the same number of full blocks
+    template <typename Lanes>
+    inline void keccak256_lanes(const uint8_t* const inputs[Lanes::kCount], const size_t lengths[Lanes::kCount],
+                                uint8_t* const outputs[Lanes::kCount]) {
+        constexpr size_t kCount{Lanes::kCount};
+        typename Lanes::Vector state[25];
+        for (auto& word : state) {
+            word = Lanes::set1(0);
+        }
+
+        // Absorb the full blocks, same number for all lanes
+        const size_t full_blocks{lengths[0] / kRate};
+        const uint8_t* blocks[kCount];
+        for (size_t block{0}; block < full_blocks; ++block) {
+            for (size_t lane{0}; lane < kCount; ++lane) {
+                blocks[lane] = inputs[lane] + block * kRate;
+            }
+            absorb_block<Lanes>(state, blocks);
+            keccak_f1600<Lanes>(state);
+        }
+
+        // Absorb the last padded block, different for each lane
+        uint8_t last_blocks[kCount][kRate];
+        for (size_t lane{0}; lane < kCount; ++lane) {
+            const size_t tail_length{lengths[lane] - full_blocks * kRate};
+            memset(last_blocks[lane], 0, kRate);
+            if (tail_length > 0) {
+                memcpy(last_blocks[lane], inputs[lane] + full_blocks * kRate, tail_length);
+            }
+            last_blocks[lane][tail_length] ^= 0x01;
+            last_blocks[lane][kRate - 1] ^= 0x80;
+            blocks[lane] = last_blocks[lane];
+        }
+        absorb_block<Lanes>(state, blocks);
+        keccak_f1600<Lanes>(state);
+
+        // Squeeze the digests
+        uint64_t words[kCount];
+        for (size_t i{0}; i < kDigestSize / 8; ++i) {
+            Lanes::store(words, state[i]);
+            for (size_t lane{0}; lane < kCount; ++lane) {
+                store_le64(outputs[lane] + 8 * i, words[lane]);
+            }
+        }
+    }
+
+    //! Portable single lane, used as reference implementation
+    struct ScalarLane {
+        static constexpr size_t kCount{1};
+        using Vector = uint64_t;
+        static Vector set1(uint64_t word) { return word; }
+        static Vector load(const uint64_t* words) { return words[0]; }
+        static void store(uint64_t* words, Vector v) { words[0] = v; }
+        static Vector bxor(Vector a, Vector b) { return a ^ b; }
+        static Vector andnot(Vector a, Vector b) { return ~a & b; }
+        template <int N>
+        static Vector rotl(Vector v) { return N == 0 ? v : (v << N) | (v >> ((64 - N) % 64)); }
+    };
+
+}  // namespace
+
+}  // namespace silkworm::keccak
@@ -0,0 +1,80 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "keccak.hpp"
+
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/crypto/keccak_lanes.hpp>
+
+namespace silkworm {
+
+static std::vector<ethash::hash256> hash_all(const std::vector<Bytes>& messages, KeccakImplementation implementation) {
+    const std::vector<ByteView> inputs{messages.cbegin(), messages.cend()};
+    std::vector<ethash::hash256> outputs(inputs.size());
+    keccak256_many(inputs, outputs, implementation);
+    return outputs;
+}
+
+TEST_CASE("keccak256_many known vectors", "[core][crypto]") {
+    const std::vector<Bytes> messages{Bytes{}, *from_hex("616263")};
+    for (const auto implementation : {KeccakImplementation::kScalar, KeccakImplementation::kAvx2, KeccakImplementation::kAvx512}) {
+        const auto hashes{hash_all(messages, implementation)};
+        CHECK(to_hex(hashes[0].bytes) == "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470");
+        CHECK(to_hex(hashes[1].bytes) == "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45");
+    }
+}
+
+TEST_CASE("keccak256_many matches keccak256", "[core][crypto]") {
+    // Mixed sizes around the block boundaries, so that some messages are hashed in lanes and some one by one
+    std::vector<Bytes> messages;
+    for (size_t length{0}; length < 3 * keccak::kRate + 10; length += 7) {
+        Bytes message(length, 0);
+        for (size_t i{0}; i < length; ++i) {
+            message[i] = static_cast<uint8_t>(i * 31 + length);
+        }
+        messages.push_back(message);
+        messages.push_back(Bytes(keccak::kRate - 1, static_cast<uint8_t>(length)));
+        messages.push_back(Bytes(keccak::kRate, static_cast<uint8_t>(length)));
+    }
+
+    for (const auto implementation : {KeccakImplementation::kScalar, KeccakImplementation::kAvx2, KeccakImplementation::kAvx512}) {
+        const auto hashes{hash_all(messages, implementation)};
+        for (size_t i{0}; i < messages.size(); ++i) {
+            CHECK(to_hex(hashes[i].bytes) == to_hex(keccak256(messages[i]).bytes));
+        }
+    }
+}
+
+TEST_CASE("keccak256_many empty batch", "[core][crypto]") {
+    std::vector<ethash::hash256> outputs;
+    CHECK_NOTHROW(keccak256_many({}, outputs));
+}
+
+TEST_CASE("keccak256 scalar lane", "[core][crypto]") {
+    const Bytes message(2 * keccak::kRate + 5, 0xab);
+    const uint8_t* input{message.data()};
+    const size_t length{message.size()};
+    ethash::hash256 hash;
+    uint8_t* output{hash.bytes};
+    keccak::keccak256_lanes<keccak::ScalarLane>(&input, &length, &output);
+    CHECK(to_hex(hash.bytes) == to_hex(keccak256(message).bytes));
+}
+
+}  // namespace silkworm
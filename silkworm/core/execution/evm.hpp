@@ -25,7 +25,7 @@
 #include <intx/intx.hpp>
 
 #include <silkworm/core/chain/config.hpp>
-#include <silkworm/core/common/lru_cache.hpp>
+#include <silkworm/core/common/concurrent_cache.hpp>
 #include <silkworm/core/common/object_pool.hpp>
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/state/intra_block_state.hpp>
@@ -62,7 +62,7 @@ class EvmTracer {
 
 using EvmTracers = std::vector<std::reference_wrapper<EvmTracer>>;
 
-using AnalysisCache = lru_cache<evmc::bytes32, std::shared_ptr<evmone::baseline::CodeAnalysis>>;
+using AnalysisCache = ConcurrentCache<evmc::bytes32, std::shared_ptr<evmone::baseline::CodeAnalysis>>;
 
 class EVM {
   public:
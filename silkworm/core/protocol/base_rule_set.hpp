@@ -46,6 +46,9 @@ class BaseRuleSet : public IRuleSet {
     //! \param [in] state: current state.
     ValidationResult validate_ommers(const Block& block, const BlockState& state) override;
 
+    //! \brief Seal validation results are not memoized by default
+    void forget_seal(const evmc::bytes32& /*header_hash*/) override {}
+
     //! \brief See [YP] Section 11.3 "Reward Application".
     //! \param [in] header: Current block to get beneficiary from
     evmc::address get_beneficiary(const BlockHeader& header) override;
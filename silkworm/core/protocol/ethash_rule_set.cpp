@@ -16,6 +16,8 @@
 
 #include "ethash_rule_set.hpp"
 
+#include <algorithm>
+
 #include <silkworm/core/chain/dao.hpp>
 #include <silkworm/core/common/endian.hpp>
 
@@ -23,22 +25,51 @@
 
 namespace silkworm::protocol {
 
+EthashRuleSet::EpochContextPtr EthashRuleSet::epoch_context(int epoch_number) {
+#ifndef __wasm__
+    std::scoped_lock lock{epoch_contexts_mutex_};
+#endif
+    const auto it{std::find_if(epoch_contexts_.begin(), epoch_contexts_.end(), [&](const auto& context) {
+        return context->epoch_number == epoch_number;
+    })};
+    if (it != epoch_contexts_.end()) {
+        EpochContextPtr context{*it};
+        epoch_contexts_.erase(it);
+        epoch_contexts_.push_back(context);
+        return context;
+    }
+    if (epoch_contexts_.size() == kMaxEpochContexts) {
+        epoch_contexts_.erase(epoch_contexts_.begin());  // Firstly release the least recently used context
+    }
+    EpochContextPtr context{ethash::create_epoch_context(epoch_number)};
+    epoch_contexts_.push_back(context);
+    return context;
+}
+
 // Ethash ProofOfWork verification
 ValidationResult EthashRuleSet::validate_seal(const BlockHeader& header) {
-    const int epoch_number{static_cast<int>(header.number / ethash::epoch_length)};
-    if (!epoch_context_ || epoch_context_->epoch_number != epoch_number) {
-        epoch_context_.reset();  // Firstly release the obsoleted context
-        epoch_context_ = ethash::create_epoch_context(epoch_number);
+    const auto header_hash{header.hash()};
+    if (const auto verified{verified_seals_.get_as_copy(header_hash)}) {
+        return *verified;
     }
 
+    const int epoch_number{static_cast<int>(header.number / ethash::epoch_length)};
+    const auto context{epoch_context(epoch_number)};
+
     const auto nonce{endian::load_big_u64(header.nonce.data())};
     const auto seal_hash(header.hash(/*for_sealing =*/true));
     const auto diff256{intx::be::store<ethash::hash256>(header.difficulty)};
     const auto sealh256{ethash::hash256_from_bytes(seal_hash.bytes)};
     const auto mixh256{ethash::hash256_from_bytes(header.prev_randao.bytes)};
 
-    const auto ec{ethash::verify_against_difficulty(*epoch_context_, sealh256, mixh256, nonce, diff256)};
-    return ec ? ValidationResult::kInvalidSeal : ValidationResult::kOk;
+    const auto ec{ethash::verify_against_difficulty(*context, sealh256, mixh256, nonce, diff256)};
+    const ValidationResult result{ec ? ValidationResult::kInvalidSeal : ValidationResult::kOk};
+    verified_seals_.put(header_hash, result);
+    return result;
+}
+
+void EthashRuleSet::forget_seal(const evmc::bytes32& header_hash) {
+    verified_seals_.remove(header_hash);
 }
 
 intx::uint256 EthashRuleSet::difficulty(const BlockHeader& header, const BlockHeader& parent) {
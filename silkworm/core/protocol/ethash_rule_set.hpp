@@ -16,10 +16,16 @@
 
 #pragma once
 
+#include <memory>
+#ifndef __wasm__
+#include <mutex>
+#endif
 #include <ostream>
+#include <vector>
 
 #include <ethash/ethash.hpp>
 
+#include <silkworm/core/common/lru_cache.hpp>
 #include <silkworm/core/protocol/base_rule_set.hpp>
 
 namespace silkworm::protocol {
@@ -30,8 +36,16 @@ class EthashRuleSet : public BaseRuleSet {
     explicit EthashRuleSet(const ChainConfig& chain_config) : BaseRuleSet(chain_config, /*prohibit_ommers=*/false) {}
 
     //! \brief Validates the seal of the header
+    //! \details Thread-safe: seals can be verified concurrently e.g. by the block downloader. Epoch contexts are cached
+    //! for the most recently used epochs and results are memoized by header hash, so that headers verified ahead of
+    //! time in parallel are not verified again by validate_block_header.
     ValidationResult validate_seal(const BlockHeader& header) override;
 
+    void forget_seal(const evmc::bytes32& header_hash) override;
+
+    //! \brief Number of memoized seal validation results
+    [[nodiscard]] size_t verified_seals() const { return verified_seals_.size(); }
+
     void initialize(EVM& evm) override;
 
     //! \brief See [YP] Section 11.3 "Reward Application".
@@ -52,7 +66,22 @@ class EthashRuleSet : public BaseRuleSet {
     intx::uint256 difficulty(const BlockHeader& header, const BlockHeader& parent) override;
 
   private:
-    ethash::epoch_context_ptr epoch_context_{nullptr, ethash_destroy_epoch_context};
+    using EpochContextPtr = std::shared_ptr<ethash::epoch_context>;
+
+    //! Get the context for the specified epoch, creating it if not already cached
+    EpochContextPtr epoch_context(int epoch_number);
+
+    //! Max number of epoch contexts kept in memory: the current epoch and the next/previous one at epoch boundaries
+    static constexpr size_t kMaxEpochContexts{2};
+
+    //! Max number of memoized seal verification results
+    static constexpr size_t kMaxVerifiedSeals{65'536};
+
+#ifndef __wasm__
+    std::mutex epoch_contexts_mutex_;
+#endif
+    std::vector<EpochContextPtr> epoch_contexts_;  // ordered from least to most recently used
+    lru_cache<evmc::bytes32, ValidationResult> verified_seals_{kMaxVerifiedSeals, /*thread_safe=*/true};
 };
 
 std::ostream& operator<<(std::ostream& out, const BlockReward& reward);
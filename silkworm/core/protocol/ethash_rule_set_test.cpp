@@ -18,6 +18,8 @@
 
 #include <catch2/catch.hpp>
 
+#include <silkworm/core/common/util.hpp>
+
 namespace silkworm::protocol {
 
 TEST_CASE("DifficultyTest34") {
@@ -32,4 +34,60 @@ TEST_CASE("DifficultyTest34") {
     CHECK(difficulty == 0x72772897b619876a);
 }
 
+// https://etherscan.io/block/1
+static BlockHeader mainnet_block1_header() {
+    const auto encoded_header{*from_hex(
+        "f90211a0d4e56740f876aef8c010b86a40d5f56745a118d0906a34e69aec8c0db1cb8fa3a01dcc4de8dec75d7aab85b567b6ccd41a"
+        "d312451b948a7413f0a142fd40d493479405a56e2d52c817161883f50c441c3228cfe54d9fa0d67e4d450343046425ae4271474353"
+        "857ab860dbc0a1dde64b41b5cd3a532bf3a056e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421a056e8"
+        "1f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421b901000000000000000000000000000000000000000000"
+        "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "0000000000000000000000000000000000000000000000008503ff80000001821388808455ba422499476574682f76312e302e302f"
+        "6c696e75782f676f312e342e32a0969b900de27b6ac6a67742365dd65f55a0526c41fd18e1b16f1a1215c2e66f5988539bd4979fef"
+        "1ec4")};
+    ByteView encoded_view{encoded_header};
+    BlockHeader header;
+    REQUIRE(rlp::decode(encoded_view, header));
+    return header;
+}
+
+TEST_CASE("EthashRuleSet memoized seal validation") {
+    BlockHeader valid_header{mainnet_block1_header()};
+    BlockHeader invalid_header{valid_header};
+    invalid_header.nonce[7] ^= 0x01;
+
+    EthashRuleSet rule_set{kMainnetConfig};
+    REQUIRE(rule_set.verified_seals() == 0);
+
+    SECTION("memo hit equals fresh computation") {
+        for (const auto& header : {valid_header, invalid_header}) {
+            const ValidationResult computed{rule_set.validate_seal(header)};
+            const ValidationResult memoized{rule_set.validate_seal(header)};
+            EthashRuleSet fresh_rule_set{kMainnetConfig};
+            CHECK(memoized == computed);
+            CHECK(fresh_rule_set.validate_seal(header) == computed);
+        }
+        CHECK(rule_set.validate_seal(valid_header) == ValidationResult::kOk);
+        CHECK(rule_set.validate_seal(invalid_header) == ValidationResult::kInvalidSeal);
+        CHECK(rule_set.verified_seals() == 2);
+    }
+
+    SECTION("forgotten seal is validated again") {
+        CHECK(rule_set.validate_seal(valid_header) == ValidationResult::kOk);
+        CHECK(rule_set.validate_seal(invalid_header) == ValidationResult::kInvalidSeal);
+        REQUIRE(rule_set.verified_seals() == 2);
+
+        rule_set.forget_seal(valid_header.hash());
+        CHECK(rule_set.verified_seals() == 1);
+        rule_set.forget_seal(valid_header.hash());  // no-op when not memoized
+        CHECK(rule_set.verified_seals() == 1);
+
+        CHECK(rule_set.validate_seal(valid_header) == ValidationResult::kOk);
+        CHECK(rule_set.verified_seals() == 2);
+    }
+}
+
 }  // namespace silkworm::protocol
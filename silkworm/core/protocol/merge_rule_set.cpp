@@ -72,6 +72,10 @@ ValidationResult MergeRuleSet::validate_seal(const BlockHeader& header) {
     return header.nonce == BlockHeader::NonceType{} ? ValidationResult::kOk : ValidationResult::kInvalidNonce;
 }
 
+void MergeRuleSet::forget_seal(const evmc::bytes32& header_hash) {
+    pre_merge_rule_set_->forget_seal(header_hash);
+}
+
 void MergeRuleSet::initialize(EVM& evm) {
     const BlockHeader& header{evm.block().header};
     if (header.difficulty != 0) {
@@ -35,6 +35,8 @@ class MergeRuleSet : public BaseRuleSet {
 
     ValidationResult validate_seal(const BlockHeader& header) override;
 
+    void forget_seal(const evmc::bytes32& header_hash) override;
+
     ValidationResult validate_ommers(const Block& block, const BlockState& state) override;
 
     void initialize(EVM& evm) override;
@@ -56,6 +56,10 @@ class IRuleSet {
     //! \brief Validates the seal of the header
     virtual ValidationResult validate_seal(const BlockHeader& header) = 0;
 
+    //! \brief Discards the seal validation result memoized for the header having the given hash, if any
+    //! \remarks To be called when the header is unwound or discarded
+    virtual void forget_seal(const evmc::bytes32& header_hash) = 0;
+
     //! \brief Performs validation of block ommers only.
     //! \brief See [YP] Sections 11.1 "Ommer Validation".
     //! \param [in] block: block to validate.
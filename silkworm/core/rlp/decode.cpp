@@ -103,6 +103,39 @@ DecodingResult decode(ByteView& from, Bytes& to, Leftover mode) noexcept {
     return {};
 }
 
+DecodingResult decode(ByteView& from, ByteView& to, Leftover mode) noexcept {
+    const auto h{decode_header(from)};
+    if (!h) {
+        return tl::unexpected{h.error()};
+    }
+    if (h->list) {
+        return tl::unexpected{DecodingError::kUnexpectedList};
+    }
+    to = from.substr(0, h->payload_length);
+    from.remove_prefix(h->payload_length);
+    if (mode != Leftover::kAllow && !from.empty()) {
+        return tl::unexpected{DecodingError::kInputTooLong};
+    }
+    return {};
+}
+
+DecodingResult decode_list_view(ByteView& from, ByteView& to, Leftover mode) noexcept {
+    const uint8_t* begin{from.data()};
+    const auto h{decode_header(from)};
+    if (!h) {
+        return tl::unexpected{h.error()};
+    }
+    if (!h->list) {
+        return tl::unexpected{DecodingError::kUnexpectedString};
+    }
+    from.remove_prefix(h->payload_length);
+    to = ByteView{begin, static_cast<size_t>(from.data() - begin)};
+    if (mode != Leftover::kAllow && !from.empty()) {
+        return tl::unexpected{DecodingError::kInputTooLong};
+    }
+    return {};
+}
+
 DecodingResult decode(ByteView& from, bool& to, Leftover mode) noexcept {
     uint64_t i{0};
     if (DecodingResult res{decode(from, i, mode)}; !res) {
@@ -45,6 +45,12 @@ enum class Leftover {
 
 DecodingResult decode(ByteView& from, Bytes& to, Leftover mode = Leftover::kProhibit) noexcept;
 
+// Decodes an RLP string into a view of its payload, i.e. without copying it out of the input.
+DecodingResult decode(ByteView& from, ByteView& to, Leftover mode = Leftover::kProhibit) noexcept;
+
+// Skips an RLP list returning a view of its whole encoding (header included), i.e. without decoding its items.
+DecodingResult decode_list_view(ByteView& from, ByteView& to, Leftover mode = Leftover::kProhibit) noexcept;
+
 template <UnsignedIntegral T>
 DecodingResult decode(ByteView& from, T& to, Leftover mode = Leftover::kProhibit) noexcept {
     const auto h{decode_header(from)};
@@ -50,21 +50,31 @@ StorageChangeDelta::StorageChangeDelta(const evmc::address& address, const evmc:
                                        const evmc::bytes32& previous) noexcept
     : address_{address}, key_{key}, previous_{previous} {}
 
-void StorageChangeDelta::revert(IntraBlockState& state) noexcept { state.storage_[address_].current[key_] = previous_; }
-
-StorageWipeDelta::StorageWipeDelta(const evmc::address& address, Storage storage) noexcept
-    : address_{address}, storage_{std::move(storage)} {}
-
-void StorageWipeDelta::revert(IntraBlockState& state) noexcept { state.storage_[address_] = storage_; }
-
-StorageCreateDelta::StorageCreateDelta(const evmc::address& address) noexcept : address_{address} {}
+void StorageChangeDelta::revert(IntraBlockState& state) noexcept {
+    state.set_current_storage(address_, key_, previous_);
+}
 
-void StorageCreateDelta::revert(IntraBlockState& state) noexcept { state.storage_.erase(address_); }
+StorageWipeDelta::StorageWipeDelta(const StorageSlot& slot) noexcept : slot_{slot} {}
+
+void StorageWipeDelta::revert(IntraBlockState& state) noexcept {
+    // Warm and transient markers are not affected by wiping, so restore just the values
+    StorageSlot& slot{state.storage_[state.storage_.find_or_insert(slot_.key)]};
+    slot.epoch = slot_.epoch;
+    slot.has_committed = slot_.has_committed;
+    slot.has_current = slot_.has_current;
+    slot.initial = slot_.initial;
+    slot.original = slot_.original;
+    slot.current = slot_.current;
+}
 
 StorageAccessDelta::StorageAccessDelta(const evmc::address& address, const evmc::bytes32& key) noexcept
     : address_{address}, key_{key} {}
 
-void StorageAccessDelta::revert(IntraBlockState& state) noexcept { state.accessed_storage_keys_[address_].erase(key_); }
+void StorageAccessDelta::revert(IntraBlockState& state) noexcept {
+    if (StorageSlot* slot{state.storage_.find({address_, key_})}; slot) {
+        slot->warm_generation = 0;
+    }
+}
 
 AccountAccessDelta::AccountAccessDelta(const evmc::address& address) noexcept : address_{address} {}
 
@@ -75,7 +85,7 @@ TransientStorageChangeDelta::TransientStorageChangeDelta(const evmc::address& ad
     : address_{address}, key_{key}, previous_{previous} {}
 
 void TransientStorageChangeDelta::revert(IntraBlockState& state) noexcept {
-    state.transient_storage_[address_][key_] = previous_;
+    state.set_transient_storage_value(address_, key_, previous_);
 }
 
 }  // namespace silkworm::state
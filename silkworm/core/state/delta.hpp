@@ -18,6 +18,7 @@
 
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/state/object.hpp>
+#include <silkworm/core/state/storage_table.hpp>
 
 namespace silkworm {
 
@@ -111,27 +112,16 @@ namespace state {
         evmc::bytes32 previous_;
     };
 
-    // Entire storage deleted.
+    // Storage slot of a wiped storage epoch cleared.
+    // Switching the account storage epoch is enough to hide the wiped slots, which are cleared lazily when overwritten.
     class StorageWipeDelta : public Delta {
       public:
-        StorageWipeDelta(const evmc::address& address, Storage storage) noexcept;
+        explicit StorageWipeDelta(const StorageSlot& slot) noexcept;
 
         void revert(IntraBlockState& state) noexcept override;
 
       private:
-        evmc::address address_;
-        Storage storage_;
-    };
-
-    // Storage created.
-    class StorageCreateDelta : public Delta {
-      public:
-        explicit StorageCreateDelta(const evmc::address& address) noexcept;
-
-        void revert(IntraBlockState& state) noexcept override;
-
-      private:
-        evmc::address address_;
+        StorageSlot slot_;
     };
 
     // Storage accessed (see EIP-2929).
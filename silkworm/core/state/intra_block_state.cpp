@@ -103,15 +103,11 @@ void IntraBlockState::create_contract(const evmc::address& address) noexcept {
 
     created.current->incarnation = *prev_incarnation + 1;
 
-    objects_[address] = created;
+    // Wipe the storage by switching to a brand-new epoch, reverting the object switches back to the previous one
+    // (slots of the previous epoch are saved by set_storage if overwritten in the meantime)
+    created.storage_epoch = ++last_storage_epoch_;
 
-    auto it{storage_.find(address)};
-    if (it == storage_.end()) {
-        journal_.emplace_back(new state::StorageCreateDelta{address});
-    } else {
-        journal_.emplace_back(new state::StorageWipeDelta{address, it->second});
-        storage_.erase(address);
-    }
+    objects_[address] = created;
 }
 
 void IntraBlockState::touch(const evmc::address& address) noexcept {
@@ -150,9 +146,9 @@ void IntraBlockState::destruct_touched_dead() {
 // Doesn't create a delta since it's called at the end of a transaction,
 // when we don't need snapshots anymore.
 void IntraBlockState::destruct(const evmc::address& address) {
-    storage_.erase(address);
     auto* obj{get_object(address)};
     if (obj) {
+        obj->storage_epoch = ++last_storage_epoch_;
         obj->current.reset();
     }
 }
@@ -247,8 +243,10 @@ evmc_access_status IntraBlockState::access_account(const evmc::address& address)
 }
 
 evmc_access_status IntraBlockState::access_storage(const evmc::address& address, const evmc::bytes32& key) noexcept {
-    const bool cold_read{accessed_storage_keys_[address].insert(key).second};
+    state::StorageSlot& slot{storage_[storage_.find_or_insert({address, key})]};
+    const bool cold_read{slot.warm_generation != substate_generation_};
     if (cold_read) {
+        slot.warm_generation = substate_generation_;
         journal_.emplace_back(new state::StorageAccessDelta{address, key});
     }
     return cold_read ? EVMC_ACCESS_COLD : EVMC_ACCESS_WARM;
@@ -271,18 +269,14 @@ evmc::bytes32 IntraBlockState::get_storage(const evmc::address& address, const e
         return {};
     }
 
-    state::Storage& storage{storage_[address]};
-
-    if (!original) {
-        auto it{storage.current.find(key)};
-        if (it != storage.current.end()) {
-            return it->second;
+    const state::StorageSlot* slot{storage_.find({address, key})};
+    if (slot && slot->epoch == obj->storage_epoch) {
+        if (!original && slot->has_current) {
+            return slot->current;
+        }
+        if (slot->has_committed) {
+            return slot->original;
         }
-    }
-
-    auto it{storage.committed.find(key)};
-    if (it != storage.committed.end()) {
-        return it->second.original;
     }
 
     uint64_t incarnation{obj->current->incarnation};
@@ -292,51 +286,96 @@ evmc::bytes32 IntraBlockState::get_storage(const evmc::address& address, const e
 
     evmc::bytes32 val{db_.read_storage(address, incarnation, key)};
 
-    state::CommittedValue& entry{storage_[address].committed[key]};
+    state::StorageSlot& entry{storage_[storage_slot(address, key)]};
+    entry.has_committed = true;
     entry.initial = val;
     entry.original = val;
 
     return val;
 }
 
+uint32_t IntraBlockState::storage_epoch(const evmc::address& address) const noexcept {
+    const auto it{objects_.find(address)};
+    return it != objects_.end() ? it->second.storage_epoch : 0;
+}
+
+uint32_t IntraBlockState::storage_slot(const evmc::address& address, const evmc::bytes32& key) const noexcept {
+    const uint32_t epoch{storage_epoch(address)};
+    const uint32_t index{storage_.find_or_insert({address, key})};
+    state::StorageSlot& slot{storage_[index]};
+    if (slot.epoch != epoch) {
+        slot.epoch = epoch;
+        slot.has_committed = false;
+        slot.has_current = false;
+        slot.initial = {};
+        slot.original = {};
+        slot.current = {};
+    }
+    return index;
+}
+
+void IntraBlockState::set_current_storage(const evmc::address& address, const evmc::bytes32& key,
+                                          const evmc::bytes32& value) noexcept {
+    const uint32_t index{storage_slot(address, key)};
+    state::StorageSlot& slot{storage_[index]};
+    if (!slot.has_current) {
+        slot.has_current = true;
+        dirty_storage_.push_back(index);
+    }
+    slot.current = value;
+}
+
 void IntraBlockState::set_storage(const evmc::address& address, const evmc::bytes32& key,
                                   const evmc::bytes32& value) noexcept {
     evmc::bytes32 prev{get_current_storage(address, key)};
     if (prev == value) {
         return;
     }
-    storage_[address].current[key] = value;
+    // A slot of a wiped storage epoch gets cleared now, but reverting the wipe must bring its values back
+    const state::StorageSlot* slot{storage_.find({address, key})};
+    if (slot && slot->epoch != storage_epoch(address) && (slot->has_committed || slot->has_current)) {
+        journal_.emplace_back(new state::StorageWipeDelta{*slot});
+    }
+    set_current_storage(address, key, value);
     journal_.emplace_back(new state::StorageChangeDelta{address, key, prev});
 }
 
 evmc::bytes32 IntraBlockState::get_transient_storage(const evmc::address& addr, const evmc::bytes32& key) {
-    return transient_storage_[addr][key];
+    const state::StorageSlot* slot{storage_.find({addr, key})};
+    return slot && slot->transient_generation == substate_generation_ ? slot->transient : evmc::bytes32{};
 }
 
 void IntraBlockState::set_transient_storage(const evmc::address& addr, const evmc::bytes32& key, const evmc::bytes32& value) {
-    auto& v = transient_storage_[addr][key];
-    const auto prev = v;
-    v = value;
+    const auto prev{get_transient_storage(addr, key)};
+    set_transient_storage_value(addr, key, value);
     journal_.emplace_back(std::make_unique<state::TransientStorageChangeDelta>(addr, key, prev));
 }
 
+void IntraBlockState::set_transient_storage_value(const evmc::address& address, const evmc::bytes32& key,
+                                                  const evmc::bytes32& value) noexcept {
+    state::StorageSlot& slot{storage_[storage_.find_or_insert({address, key})]};
+    slot.transient_generation = substate_generation_;
+    slot.transient = value;
+}
+
 void IntraBlockState::write_to_db(uint64_t block_number) {
     db_.begin_block(block_number);
 
-    for (const auto& [address, storage] : storage_) {
-        auto it1{objects_.find(address)};
+    for (const auto& slot : storage_.slots()) {
+        if (!slot.has_committed) {
+            continue;
+        }
+        auto it1{objects_.find(slot.key.address)};
         if (it1 == objects_.end()) {
             continue;
         }
         const state::Object& obj{it1->second};
-        if (!obj.current) {
+        if (!obj.current || obj.storage_epoch != slot.epoch) {
             continue;
         }
 
-        for (const auto& [key, val] : storage.committed) {
-            uint64_t incarnation{obj.current->incarnation};
-            db_.update_storage(address, incarnation, key, val.initial, val.original);
-        }
+        uint64_t incarnation{obj.current->incarnation};
+        db_.update_storage(slot.key.address, incarnation, slot.key.location, slot.initial, slot.original);
     }
 
     for (const auto& [address, obj] : objects_) {
@@ -375,13 +414,19 @@ void IntraBlockState::finalize_transaction(evmc_revision rev) {
     if (rev >= EVMC_SPURIOUS_DRAGON) {
         destruct_touched_dead();
     }
-    for (auto& x : storage_) {
-        state::Storage& storage{x.second};
-        for (const auto& [key, val] : storage.current) {
-            storage.committed[key].original = val;
+    for (const uint32_t index : dirty_storage_) {
+        state::StorageSlot& slot{storage_[index]};
+        if (!slot.has_current) {
+            continue;
+        }
+        if (!slot.has_committed) {
+            slot.has_committed = true;
+            slot.initial = {};
         }
-        storage.current.clear();
+        slot.original = slot.current;
+        slot.has_current = false;
     }
+    dirty_storage_.clear();
 }
 
 void IntraBlockState::clear_journal_and_substate() {
@@ -393,9 +438,9 @@ void IntraBlockState::clear_journal_and_substate() {
     touched_.clear();
     // EIP-2929
     accessed_addresses_.clear();
-    accessed_storage_keys_.clear();
 
-    transient_storage_.clear();
+    // EIP-2929 storage keys and EIP-1153 transient storage
+    ++substate_generation_;
 }
 
 void IntraBlockState::add_log(const Log& log) noexcept { logs_.push_back(log); }
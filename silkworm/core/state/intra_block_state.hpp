@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -27,6 +28,7 @@
 #include <silkworm/core/state/delta.hpp>
 #include <silkworm/core/state/object.hpp>
 #include <silkworm/core/state/state.hpp>
+#include <silkworm/core/state/storage_table.hpp>
 #include <silkworm/core/types/log.hpp>
 
 namespace silkworm {
@@ -125,13 +127,20 @@ class IntraBlockState {
     friend class state::TouchDelta;
     friend class state::StorageChangeDelta;
     friend class state::StorageWipeDelta;
-    friend class state::StorageCreateDelta;
     friend class state::StorageAccessDelta;
     friend class state::AccountAccessDelta;
     friend class state::TransientStorageChangeDelta;
 
     evmc::bytes32 get_storage(const evmc::address& address, const evmc::bytes32& key, bool original) const noexcept;
 
+    uint32_t storage_epoch(const evmc::address& address) const noexcept;
+
+    //! Index of the storage slot in the current storage epoch of the account, cleared if written in another epoch
+    uint32_t storage_slot(const evmc::address& address, const evmc::bytes32& key) const noexcept;
+
+    void set_current_storage(const evmc::address& address, const evmc::bytes32& key, const evmc::bytes32& value) noexcept;
+    void set_transient_storage_value(const evmc::address& address, const evmc::bytes32& key, const evmc::bytes32& value) noexcept;
+
     const state::Object* get_object(const evmc::address& address) const noexcept;
     state::Object* get_object(const evmc::address& address) noexcept;
 
@@ -140,7 +149,10 @@ class IntraBlockState {
     State& db_;
 
     mutable FlatHashMap<evmc::address, state::Object> objects_;
-    mutable FlatHashMap<evmc::address, state::Storage> storage_;
+    // Committed, current and transient storage values along with EIP-2929 access markers
+    mutable state::StorageTable storage_;
+    std::vector<uint32_t> dirty_storage_;  // slots written by the current transaction
+    uint32_t last_storage_epoch_{0};
 
     mutable FlatHashMap<evmc::bytes32, ByteView> existing_code_;
     FlatHashMap<evmc::bytes32, std::vector<uint8_t>> new_code_;
@@ -153,9 +165,8 @@ class IntraBlockState {
     FlatHashSet<evmc::address> touched_;
     // EIP-2929 substate
     FlatHashSet<evmc::address> accessed_addresses_;
-    FlatHashMap<evmc::address, FlatHashSet<evmc::bytes32>> accessed_storage_keys_;
-
-    FlatHashMap<evmc::address, FlatHashMap<evmc::bytes32, evmc::bytes32>> transient_storage_;
+    // Warm and transient storage markers of previous generations are stale
+    uint32_t substate_generation_{1};
 };
 
 }  // namespace silkworm
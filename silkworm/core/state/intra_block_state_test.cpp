@@ -99,4 +99,60 @@ TEST_CASE("Code view stability") {
     }
 }
 
+TEST_CASE("Storage wipe and revert") {
+    static constexpr evmc::address kContract{0x9ab6c9ff6ec19bd2e4bc7a1ad5338c4c1fc3e71c_address};
+    static constexpr evmc::bytes32 kLocation{0x01_bytes32};
+    static constexpr evmc::bytes32 kValue{0x2a_bytes32};
+
+    InMemoryState db;
+    const Account account{.nonce = 1, .incarnation = kDefaultIncarnation};
+    db.update_account(kContract, /*initial=*/std::nullopt, /*current=*/account);
+    db.update_storage(kContract, kDefaultIncarnation, kLocation, /*initial=*/{}, /*current=*/kValue);
+
+    IntraBlockState state{db};
+    CHECK(state.get_current_storage(kContract, kLocation) == kValue);
+    state.set_storage(kContract, kLocation, 0x2b_bytes32);
+
+    const auto snapshot{state.take_snapshot()};
+    state.create_contract(kContract);
+    CHECK(state.get_current_storage(kContract, kLocation) == evmc::bytes32{});
+    CHECK(state.get_original_storage(kContract, kLocation) == evmc::bytes32{});
+    state.set_storage(kContract, kLocation, 0x2c_bytes32);
+    CHECK(state.get_current_storage(kContract, kLocation) == 0x2c_bytes32);
+
+    state.revert_to_snapshot(snapshot);
+    CHECK(state.get_current_storage(kContract, kLocation) == 0x2b_bytes32);
+    CHECK(state.get_original_storage(kContract, kLocation) == kValue);
+
+    state.finalize_transaction(EVMC_SHANGHAI);
+    CHECK(state.get_original_storage(kContract, kLocation) == 0x2b_bytes32);
+
+    state.write_to_db(/*block_number=*/1);
+    CHECK(db.read_storage(kContract, kDefaultIncarnation, kLocation) == 0x2b_bytes32);
+}
+
+TEST_CASE("Storage access and transient storage are reset per transaction") {
+    static constexpr evmc::address kContract{0x9ab6c9ff6ec19bd2e4bc7a1ad5338c4c1fc3e71c_address};
+    static constexpr evmc::bytes32 kLocation{0x01_bytes32};
+
+    InMemoryState db;
+    IntraBlockState state{db};
+
+    CHECK(state.access_storage(kContract, kLocation) == EVMC_ACCESS_COLD);
+    CHECK(state.access_storage(kContract, kLocation) == EVMC_ACCESS_WARM);
+    state.set_transient_storage(kContract, kLocation, 0x2a_bytes32);
+    CHECK(state.get_transient_storage(kContract, kLocation) == 0x2a_bytes32);
+
+    const auto snapshot{state.take_snapshot()};
+    CHECK(state.access_storage(kContract, 0x02_bytes32) == EVMC_ACCESS_COLD);
+    state.set_transient_storage(kContract, kLocation, 0x2b_bytes32);
+    state.revert_to_snapshot(snapshot);
+    CHECK(state.access_storage(kContract, 0x02_bytes32) == EVMC_ACCESS_COLD);
+    CHECK(state.get_transient_storage(kContract, kLocation) == 0x2a_bytes32);
+
+    state.clear_journal_and_substate();
+    CHECK(state.access_storage(kContract, kLocation) == EVMC_ACCESS_COLD);
+    CHECK(state.get_transient_storage(kContract, kLocation) == evmc::bytes32{});
+}
+
 }  // namespace silkworm
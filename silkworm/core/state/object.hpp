@@ -16,10 +16,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <optional>
 
 #include <silkworm/core/common/base.hpp>
-#include <silkworm/core/common/hash_maps.hpp>
 #include <silkworm/core/types/account.hpp>
 
 namespace silkworm::state {
@@ -27,16 +27,9 @@ namespace silkworm::state {
 struct Object {
     std::optional<Account> initial;
     std::optional<Account> current;
-};
-
-struct CommittedValue {
-    evmc::bytes32 initial{};   // value at the beginning of the block
-    evmc::bytes32 original{};  // value at the beginning of the transaction; see EIP-2200
-};
 
-struct Storage {
-    FlatHashMap<evmc::bytes32, CommittedValue> committed;
-    FlatHashMap<evmc::bytes32, evmc::bytes32> current;
+    // Storage slots written in other epochs belong to a wiped storage (see StorageSlot)
+    uint32_t storage_epoch{0};
 };
 
 }  // namespace silkworm::state
@@ -0,0 +1,100 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "storage_table.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace silkworm::state {
+
+template <typename Word>
+static Word load_word(const uint8_t* bytes) noexcept {
+    Word word;
+    std::memcpy(&word, bytes, sizeof(word));
+    return word;
+}
+
+uint64_t StorageTable::hash(const StorageKey& key) noexcept {
+    // Locations are either small integers or Keccak hashes, so all their words must contribute
+    uint64_t h{load_word<uint64_t>(key.address.bytes)};
+    h ^= std::rotl(load_word<uint64_t>(key.address.bytes + 8), 21);
+    h ^= std::rotl(uint64_t{load_word<uint32_t>(key.address.bytes + 16)}, 42);
+    h ^= load_word<uint64_t>(key.location.bytes) * 0x9e3779b97f4a7c15;
+    h ^= load_word<uint64_t>(key.location.bytes + 8) * 0xc2b2ae3d27d4eb4f;
+    h ^= load_word<uint64_t>(key.location.bytes + 16) * 0x165667b19e3779f9;
+    h ^= load_word<uint64_t>(key.location.bytes + 24) * 0xd6e8feb86659fd93;
+    // MurmurHash3 finalizer
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccd;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53;
+    h ^= h >> 33;
+    return h;
+}
+
+size_t StorageTable::probe(const StorageKey& key, uint64_t hash) const noexcept {
+    const uint64_t tag{hash >> 32};
+    const size_t mask{index_.size() - 1};
+    size_t position{hash & mask};
+    while (true) {
+        const uint64_t entry{index_[position]};
+        if (entry == 0 || ((entry >> 32) == tag && slots_[(entry & 0xffffffff) - 1].key == key)) {
+            return position;
+        }
+        position = (position + 1) & mask;
+    }
+}
+
+StorageSlot* StorageTable::find(const StorageKey& key) noexcept {
+    const auto& self{*this};
+    return const_cast<StorageSlot*>(self.find(key));
+}
+
+const StorageSlot* StorageTable::find(const StorageKey& key) const noexcept {
+    if (slots_.empty()) {
+        return nullptr;
+    }
+    const uint64_t entry{index_[probe(key, hash(key))]};
+    return entry != 0 ? &slots_[(entry & 0xffffffff) - 1] : nullptr;
+}
+
+uint32_t StorageTable::find_or_insert(const StorageKey& key) noexcept {
+    // Keep load factor at most 1/2, index entries being small
+    if (2 * (slots_.size() + 1) > index_.size()) {
+        grow();
+    }
+    const uint64_t h{hash(key)};
+    const size_t position{probe(key, h)};
+    if (index_[position] != 0) {
+        return static_cast<uint32_t>((index_[position] & 0xffffffff) - 1);
+    }
+    const auto slot_index{static_cast<uint32_t>(slots_.size())};
+    slots_.push_back(StorageSlot{.key = key});
+    index_[position] = (h >> 32) << 32 | (slot_index + 1);
+    return slot_index;
+}
+
+void StorageTable::grow() noexcept {
+    index_.assign(std::max(2 * index_.size(), kMinIndexSize), 0);
+    for (size_t i{0}; i < slots_.size(); ++i) {
+        const uint64_t h{hash(slots_[i].key)};
+        index_[probe(slots_[i].key, h)] = (h >> 32) << 32 | (i + 1);
+    }
+}
+
+}  // namespace silkworm::state
@@ -0,0 +1,85 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <silkworm/core/common/base.hpp>
+
+namespace silkworm::state {
+
+struct StorageKey {
+    evmc::address address;
+    evmc::bytes32 location;
+
+    friend bool operator==(const StorageKey&, const StorageKey&) = default;
+};
+
+//! \brief StorageSlot gathers everything IntraBlockState knows about one storage location of one account
+//! \details Values belong to the account storage epoch they have been written in: when the account storage is wiped
+//! the epoch changes and the old values become invisible. Warm and transient markers are valid only within the
+//! substate generation (i.e. the transaction) they have been set in, so that they can be reset in constant time.
+struct StorageSlot {
+    StorageKey key;
+    uint32_t epoch{0};
+    uint32_t warm_generation{0};       // EIP-2929
+    uint32_t transient_generation{0};  // EIP-1153
+    bool has_committed{false};
+    bool has_current{false};
+    evmc::bytes32 initial{};    // value at the beginning of the block
+    evmc::bytes32 original{};   // value at the beginning of the transaction; see EIP-2200
+    evmc::bytes32 current{};    // value written by the current transaction, if has_current
+    evmc::bytes32 transient{};  // transient value, if transient_generation is the current one
+};
+
+//! \brief StorageTable is an open-addressing hash table of storage slots keyed by (address, location)
+//! \details Slots are stored densely in insertion order and never move, so they can be referred to by index. Lookups
+//! use linear probing over a compact index of 64-bit entries, each holding the slot index and some hash bits to skip
+//! most key comparisons.
+class StorageTable {
+  public:
+    [[nodiscard]] StorageSlot* find(const StorageKey& key) noexcept;
+    [[nodiscard]] const StorageSlot* find(const StorageKey& key) const noexcept;
+
+    //! Find the slot having the specified key or insert an empty one, returning its index
+    uint32_t find_or_insert(const StorageKey& key) noexcept;
+
+    StorageSlot& operator[](uint32_t index) noexcept { return slots_[index]; }
+    const StorageSlot& operator[](uint32_t index) const noexcept { return slots_[index]; }
+
+    [[nodiscard]] const std::vector<StorageSlot>& slots() const noexcept { return slots_; }
+
+    [[nodiscard]] size_t size() const noexcept { return slots_.size(); }
+
+    //! Hash of the whole key: all address and location bytes contribute
+    static uint64_t hash(const StorageKey& key) noexcept;
+
+  private:
+    static constexpr size_t kMinIndexSize{64};
+
+    //! Position in index of the entry having the specified key, if any, or of the empty entry where it belongs
+    [[nodiscard]] size_t probe(const StorageKey& key, uint64_t hash) const noexcept;
+
+    void grow() noexcept;
+
+    std::vector<StorageSlot> slots_;
+    std::vector<uint64_t> index_;  // 0 means empty, otherwise hash high bits << 32 | (slot index + 1)
+};
+
+}  // namespace silkworm::state
@@ -0,0 +1,200 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <bit>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/hash_maps.hpp>
+#include <silkworm/core/common/random_number.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/state/storage_table.hpp>
+
+namespace {
+
+using namespace silkworm;
+
+constexpr size_t kNumContracts{32};
+constexpr size_t kSlotsPerContract{512};
+constexpr size_t kTransactionsPerBlock{150};
+constexpr size_t kAccessesPerTransaction{100};
+constexpr size_t kAccessesPerStore{4};
+
+//! Storage-heavy block: each transaction accesses (i.e. SLOAD and sometimes SSTORE) hashed slots of a few contracts
+struct Workload {
+    struct Access {
+        evmc::address address;
+        evmc::bytes32 location;
+        bool store{false};
+    };
+
+    std::vector<std::vector<Access>> transactions;
+
+    Workload() {
+        RandomNumber rnd_contract{0, kNumContracts - 1};
+        RandomNumber rnd_slot{0, kSlotsPerContract - 1};
+        transactions.resize(kTransactionsPerBlock);
+        for (auto& accesses : transactions) {
+            for (size_t i{0}; i < kAccessesPerTransaction; ++i) {
+                Access& access{accesses.emplace_back()};
+                access.address.bytes[0] = static_cast<uint8_t>(rnd_contract.generate_one());
+                access.address.bytes[kAddressLength - 1] = 0x42;
+                const uint64_t slot{rnd_slot.generate_one()};
+                const ByteView slot_view{reinterpret_cast<const uint8_t*>(&slot), sizeof(slot)};
+                access.location = std::bit_cast<evmc_bytes32>(keccak256(slot_view));
+                access.store = i % kAccessesPerStore == 0;
+            }
+        }
+    }
+};
+
+//! The nested layout used by IntraBlockState before the flat storage table
+class NestedStorage {
+  public:
+    bool access(const evmc::address& address, const evmc::bytes32& key) {
+        return accessed_storage_keys_[address].insert(key).second;
+    }
+
+    evmc::bytes32 load(const evmc::address& address, const evmc::bytes32& key) {
+        Storage& storage{storage_[address]};
+        if (auto it{storage.current.find(key)}; it != storage.current.end()) {
+            return it->second;
+        }
+        if (auto it{storage.committed.find(key)}; it != storage.committed.end()) {
+            return it->second.original;
+        }
+        CommittedValue& entry{storage.committed[key]};
+        entry.initial = key;
+        entry.original = key;
+        return key;
+    }
+
+    void store(const evmc::address& address, const evmc::bytes32& key, const evmc::bytes32& value) {
+        storage_[address].current[key] = value;
+    }
+
+    void finalize_transaction() {
+        for (auto& [_, storage] : storage_) {
+            for (const auto& [key, val] : storage.current) {
+                storage.committed[key].original = val;
+            }
+            storage.current.clear();
+        }
+        accessed_storage_keys_.clear();
+    }
+
+  private:
+    struct CommittedValue {
+        evmc::bytes32 initial{};
+        evmc::bytes32 original{};
+    };
+
+    struct Storage {
+        FlatHashMap<evmc::bytes32, CommittedValue> committed;
+        FlatHashMap<evmc::bytes32, evmc::bytes32> current;
+    };
+
+    FlatHashMap<evmc::address, Storage> storage_;
+    FlatHashMap<evmc::address, FlatHashSet<evmc::bytes32>> accessed_storage_keys_;
+};
+
+//! The flat layout used by IntraBlockState, epochs left aside
+class FlatStorage {
+  public:
+    bool access(const evmc::address& address, const evmc::bytes32& key) {
+        state::StorageSlot& slot{table_[table_.find_or_insert({address, key})]};
+        const bool cold{slot.warm_generation != generation_};
+        slot.warm_generation = generation_;
+        return cold;
+    }
+
+    evmc::bytes32 load(const evmc::address& address, const evmc::bytes32& key) {
+        if (const state::StorageSlot* slot{table_.find({address, key})}; slot) {
+            if (slot->has_current) {
+                return slot->current;
+            }
+            if (slot->has_committed) {
+                return slot->original;
+            }
+        }
+        state::StorageSlot& slot{table_[table_.find_or_insert({address, key})]};
+        slot.has_committed = true;
+        slot.initial = key;
+        slot.original = key;
+        return key;
+    }
+
+    void store(const evmc::address& address, const evmc::bytes32& key, const evmc::bytes32& value) {
+        const uint32_t index{table_.find_or_insert({address, key})};
+        state::StorageSlot& slot{table_[index]};
+        if (!slot.has_current) {
+            slot.has_current = true;
+            dirty_.push_back(index);
+        }
+        slot.current = value;
+    }
+
+    void finalize_transaction() {
+        for (const uint32_t index : dirty_) {
+            state::StorageSlot& slot{table_[index]};
+            slot.has_committed = true;
+            slot.original = slot.current;
+            slot.has_current = false;
+        }
+        dirty_.clear();
+        ++generation_;
+    }
+
+  private:
+    state::StorageTable table_;
+    std::vector<uint32_t> dirty_;
+    uint32_t generation_{1};
+};
+
+template <typename Storage>
+void execute_block(benchmark::State& state) {
+    static const Workload workload;
+    for ([[maybe_unused]] auto _ : state) {
+        // IntraBlockState is created anew for each block
+        Storage storage;
+        for (const auto& accesses : workload.transactions) {
+            for (const auto& access : accesses) {
+                benchmark::DoNotOptimize(storage.access(access.address, access.location));
+                const evmc::bytes32 value{storage.load(access.address, access.location)};
+                if (access.store) {
+                    storage.store(access.address, access.location, evmc::bytes32{value.bytes[0] + 1u});
+                }
+            }
+            storage.finalize_transaction();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kTransactionsPerBlock * kAccessesPerTransaction));
+}
+
+}  // namespace
+
+static void benchmark_nested_storage_layout(benchmark::State& state) {
+    execute_block<NestedStorage>(state);
+}
+
+BENCHMARK(benchmark_nested_storage_layout);
+
+static void benchmark_flat_storage_layout(benchmark::State& state) {
+    execute_block<FlatStorage>(state);
+}
+
+BENCHMARK(benchmark_flat_storage_layout);
@@ -0,0 +1,95 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "storage_table.hpp"
+
+#include <set>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/common/endian.hpp>
+
+namespace silkworm::state {
+
+static StorageKey make_key(uint8_t address_byte, uint64_t location) {
+    StorageKey key;
+    key.address.bytes[kAddressLength - 1] = address_byte;
+    endian::store_big_u64(key.location.bytes + kHashLength - 8, location);
+    return key;
+}
+
+TEST_CASE("StorageTable") {
+    StorageTable table;
+    CHECK(table.size() == 0);
+    CHECK(table.find(make_key(1, 0)) == nullptr);
+
+    SECTION("insert and find") {
+        const uint32_t index{table.find_or_insert(make_key(1, 0))};
+        CHECK(table.size() == 1);
+        CHECK(table.find_or_insert(make_key(1, 0)) == index);
+        CHECK(table.size() == 1);
+
+        table[index].current = 0x01_bytes32;
+        const StorageSlot* slot{table.find(make_key(1, 0))};
+        REQUIRE(slot != nullptr);
+        CHECK(slot->key == make_key(1, 0));
+        CHECK(slot->current == 0x01_bytes32);
+        CHECK(table.find(make_key(2, 0)) == nullptr);
+        CHECK(table.find(make_key(1, 1)) == nullptr);
+    }
+
+    SECTION("indices are stable while growing") {
+        static constexpr uint64_t kNumLocations{10'000};
+        for (uint8_t a{0}; a < 4; ++a) {
+            for (uint64_t location{0}; location < kNumLocations; ++location) {
+                const uint32_t index{table.find_or_insert(make_key(a, location))};
+                CHECK(index == table.size() - 1);
+                table[index].initial = make_key(a, location).location;
+            }
+        }
+        CHECK(table.size() == 4 * kNumLocations);
+        for (uint8_t a{0}; a < 4; ++a) {
+            for (uint64_t location{0}; location < kNumLocations; ++location) {
+                const StorageSlot* slot{table.find(make_key(a, location))};
+                REQUIRE(slot != nullptr);
+                CHECK(slot->initial == make_key(a, location).location);
+                CHECK(static_cast<size_t>(slot - table.slots().data()) == a * kNumLocations + location);
+            }
+        }
+    }
+
+    SECTION("all address bytes are hashed") {
+        // Keys differing in a single address byte only
+        for (size_t i{0}; i < kAddressLength; ++i) {
+            StorageKey key{make_key(0, 0)};
+            key.address.bytes[i] = 0xff;
+            table.find_or_insert(key);
+        }
+        CHECK(table.size() == kAddressLength);
+        std::set<uint64_t> hashes{StorageTable::hash(make_key(0, 0))};
+        for (size_t i{0}; i < kAddressLength; ++i) {
+            StorageKey key{make_key(0, 0)};
+            key.address.bytes[i] = 0xff;
+            const StorageSlot* slot{table.find(key)};
+            REQUIRE(slot != nullptr);
+            CHECK(slot == &table[static_cast<uint32_t>(i)]);
+            hashes.insert(StorageTable::hash(key));
+        }
+        CHECK(hashes.size() == kAddressLength + 1);
+    }
+}
+
+}  // namespace silkworm::state
@@ -16,6 +16,7 @@
 
 #include "hash_builder.hpp"
 
+#include <algorithm>
 #include <bit>
 #include <cstring>
 #include <span>
@@ -167,7 +168,9 @@ void HashBuilder::gen_struct_step(ByteView current, const ByteView succeeding) {
         const ByteView short_node_key{current.substr(from)};
         if (!build_extensions) {
             if (const Bytes * leaf_value{std::get_if<Bytes>(&value_)}) {
-                stack_.push_back(node_ref(leaf_node_rlp(short_node_key, *leaf_value)));
+                const ByteView leaf_rlp{leaf_node_rlp(short_node_key, *leaf_value)};
+                retain_proof_node(current.substr(0, from), leaf_rlp);
+                stack_.push_back(node_ref(leaf_rlp));
             } else {
                 stack_.push_back(wrap_hash(std::get<evmc::bytes32>(value_).bytes));
                 if (node_collector) {
@@ -196,7 +199,9 @@ void HashBuilder::gen_struct_step(ByteView current, const ByteView succeeding) {
                 }
             }
 
-            stack_.back() = node_ref(extension_node_rlp(short_node_key, stack_.back()));
+            const ByteView extension_rlp{extension_node_rlp(short_node_key, stack_.back())};
+            retain_proof_node(current.substr(0, from), extension_rlp);
+            stack_.back() = node_ref(extension_rlp);
 
             hash_masks_.resize(from);
             tree_masks_.resize(from);
@@ -210,6 +215,7 @@ void HashBuilder::gen_struct_step(ByteView current, const ByteView succeeding) {
         // Close the immediately encompassing prefix group, if needed
         if (!succeeding.empty() || preceding_exists) {  // branch node
             std::vector<Bytes> child_hashes{branch_ref(groups_[len], hash_masks_[len])};
+            retain_proof_node(current.substr(0, len), rlp_buffer_);  // branch_ref leaves the branch RLP in rlp_buffer_
 
             // See node/silkworm/trie/intermediate_hashes.hpp
             if (node_collector) {
@@ -307,4 +313,22 @@ void HashBuilder::reset() {
     rlp_buffer_.clear();
 }
 
+void HashBuilder::set_proof_retainer(std::vector<Bytes> nibbled_keys, ProofCollector collector) {
+    std::sort(nibbled_keys.begin(), nibbled_keys.end());
+    proof_keys_ = std::move(nibbled_keys);
+    proof_collector_ = std::move(collector);
+}
+
+void HashBuilder::retain_proof_node(ByteView path, ByteView rlp) {
+    if (!proof_collector_ || (rlp.length() < kHashLength && !path.empty())) {
+        return;
+    }
+    // Keys are sorted, so the first key not less than path is the only candidate to start with path
+    const auto it{std::lower_bound(proof_keys_.cbegin(), proof_keys_.cend(), path,
+                                   [](const Bytes& key, ByteView p) { return ByteView{key} < p; })};
+    if (it != proof_keys_.cend() && ByteView{*it}.starts_with(path)) {
+        proof_collector_(path, rlp);
+    }
+}
+
 }  // namespace silkworm::trie
@@ -30,6 +30,9 @@ namespace silkworm::trie {
 // Erigon HashCollector2
 using NodeCollector = std::function<void(ByteView nibbled_key, const Node&)>;
 
+// Receives the RLP of one node along the path to a proof key
+using ProofCollector = std::function<void(ByteView nibbled_path, ByteView rlp)>;
+
 // Calculates root hash of a Modified Merkle Patricia Trie.
 // See Appendix D "Modified Merkle Patricia Trie" of the Yellow Paper
 // and https://eth.wiki/fundamentals/patricia-tree
@@ -61,6 +64,13 @@ class HashBuilder {
     //! \brief Pointer to function for collecting nodes in etl.
     NodeCollector node_collector{nullptr};
 
+    //! \brief Retains the nodes along the paths to the given keys, i.e. the ones making their Merkle proofs
+    //! \details The keys should be unpacked. Nodes are passed to the collector bottom-up as soon as they are built,
+    //! each one with its (unpacked) path. Only the root and the nodes referenced by hash are collected, because the
+    //! nodes shorter than 32 bytes are embedded in their parent.
+    //! \remarks Nodes along the paths must be built from leaves (i.e. not added by add_branch_node) to be collected
+    void set_proof_retainer(std::vector<Bytes> nibbled_keys, ProofCollector collector);
+
     //! \brief Resets the builder as newly created
     void reset();
 
@@ -78,6 +88,9 @@ class HashBuilder {
 
     ByteView extension_node_rlp(ByteView path, ByteView child_ref);
 
+    //! Pass the node RLP to the proof collector if the node is along the path to any proof key
+    void retain_proof_node(ByteView path, ByteView rlp);
+
     Bytes key_;                                 // unpacked – one nibble per byte
     std::variant<Bytes, evmc::bytes32> value_;  // leaf value or node hash
     bool is_in_db_trie_{false};
@@ -88,6 +101,9 @@ class HashBuilder {
     std::vector<Bytes> stack_;  // node references: hashes or embedded RLPs
 
     Bytes rlp_buffer_;
+
+    std::vector<Bytes> proof_keys_;  // sorted, unpacked
+    ProofCollector proof_collector_{nullptr};
 };
 
 }  // namespace silkworm::trie
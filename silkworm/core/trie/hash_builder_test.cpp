@@ -14,7 +14,10 @@
    limitations under the License.
 */
 
+#include <algorithm>
+#include <bit>
 #include <iterator>
+#include <map>
 
 #include <catch2/catch.hpp>
 #include <ethash/keccak.hpp>
@@ -191,6 +194,39 @@ TEST_CASE("HashBuilder3") {
 }
 */
 
+TEST_CASE("Proof retainer") {
+    std::vector<std::pair<Bytes, Bytes>> leaves;
+    for (uint64_t i{0}; i < 1'000; ++i) {
+        const ethash::hash256 hashed_key{keccak256(ByteView{reinterpret_cast<const uint8_t*>(&i), sizeof(i)})};
+        Bytes value;
+        rlp::encode(value, Bytes(40, static_cast<uint8_t>(i)));
+        leaves.emplace_back(unpack_nibbles(hashed_key.bytes), std::move(value));
+    }
+    std::sort(leaves.begin(), leaves.end());
+    const Bytes& proof_key{leaves[123].first};
+
+    std::map<Bytes, Bytes> proof_nodes;
+    HashBuilder hb;
+    hb.set_proof_retainer({proof_key}, [&](ByteView nibbled_path, ByteView rlp) {
+        CHECK(proof_key.starts_with(nibbled_path));
+        proof_nodes.emplace(nibbled_path, rlp);
+    });
+    for (const auto& [key, value] : leaves) {
+        hb.add_leaf(key, value);
+    }
+    const auto root{hb.root_hash()};
+
+    // The proof starts from the root and each node is referenced by hash in the previous one, down to the leaf
+    REQUIRE(proof_nodes.size() >= 2);
+    REQUIRE(proof_nodes.begin()->first.empty());
+    CHECK(std::bit_cast<evmc::bytes32>(keccak256(proof_nodes.begin()->second)) == root);
+    for (auto it{proof_nodes.begin()}; std::next(it) != proof_nodes.end(); ++it) {
+        const ethash::hash256 child_hash{keccak256(std::next(it)->second)};
+        CHECK(it->second.find(ByteView{child_hash.bytes, kHashLength}) != Bytes::npos);
+    }
+    CHECK(proof_nodes.rbegin()->second.ends_with(leaves[123].second));
+}
+
 TEST_CASE("Known root hash") {
     static constexpr auto root_hash{0x9fa752911d55c3a1246133fe280785afbdba41f357e9cae1131d5f5b0a078b9c_bytes32};
     HashBuilder hb;
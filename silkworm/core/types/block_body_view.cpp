@@ -0,0 +1,92 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_body_view.hpp"
+
+#include <silkworm/core/rlp/decode_vector.hpp>
+
+namespace silkworm {
+
+DecodingResult BlockBodyView::decode_transactions(std::vector<Transaction>& to) const noexcept {
+    ByteView from{transactions_rlp};
+    return rlp::decode(from, to);
+}
+
+DecodingResult BlockBodyView::decode_ommers(std::vector<BlockHeader>& to) const noexcept {
+    ByteView from{ommers_rlp};
+    return rlp::decode(from, to);
+}
+
+DecodingResult BlockBodyView::decode_withdrawals(std::optional<std::vector<Withdrawal>>& to) const noexcept {
+    if (!withdrawals_rlp) {
+        to = std::nullopt;
+        return {};
+    }
+    ByteView from{*withdrawals_rlp};
+    to.emplace();
+    return rlp::decode(from, *to);
+}
+
+DecodingResult BlockBodyView::to_block_body(BlockBody& to) const noexcept {
+    if (DecodingResult res{decode_transactions(to.transactions)}; !res) {
+        return res;
+    }
+    if (DecodingResult res{decode_ommers(to.ommers)}; !res) {
+        return res;
+    }
+    return decode_withdrawals(to.withdrawals);
+}
+
+namespace rlp {
+
+    DecodingResult decode(ByteView& from, BlockBodyView& to, Leftover mode) noexcept {
+        const auto rlp_head{decode_header(from)};
+        if (!rlp_head) {
+            return tl::unexpected{rlp_head.error()};
+        }
+        if (!rlp_head->list) {
+            return tl::unexpected{DecodingError::kUnexpectedString};
+        }
+        const uint64_t leftover{from.length() - rlp_head->payload_length};
+        if (mode != Leftover::kAllow && leftover) {
+            return tl::unexpected{DecodingError::kInputTooLong};
+        }
+
+        if (DecodingResult res{decode_list_view(from, to.transactions_rlp, Leftover::kAllow)}; !res) {
+            return res;
+        }
+        if (DecodingResult res{decode_list_view(from, to.ommers_rlp, Leftover::kAllow)}; !res) {
+            return res;
+        }
+
+        to.withdrawals_rlp = std::nullopt;
+        if (from.length() > leftover) {
+            ByteView withdrawals_rlp;
+            if (DecodingResult res{decode_list_view(from, withdrawals_rlp, Leftover::kAllow)}; !res) {
+                return res;
+            }
+            to.withdrawals_rlp = withdrawals_rlp;
+        }
+
+        if (from.length() != leftover) {
+            return tl::unexpected{DecodingError::kUnexpectedListElements};
+        }
+        return {};
+    }
+
+}  // namespace rlp
+
+}  // namespace silkworm
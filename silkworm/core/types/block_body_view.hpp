@@ -0,0 +1,80 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <silkworm/core/common/bytes.hpp>
+#include <silkworm/core/rlp/decode.hpp>
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/core/types/transaction_view.hpp>
+#include <silkworm/core/types/withdrawal.hpp>
+
+namespace silkworm {
+
+//! \brief BlockBodyView is a block body decoded without copying anything from the RLP-encoded input buffer.
+//! \details Only the outer list is decoded: transactions, ommers and withdrawals are kept as views into the input
+//! and decoded on demand, transactions one by one as TransactionView.
+//! \warning A BlockBodyView is valid only as long as the buffer it has been decoded from.
+struct BlockBodyView {
+    //! RLP encoding of the transaction list, list header included
+    ByteView transactions_rlp{};
+
+    //! RLP encoding of the ommer list, list header included
+    ByteView ommers_rlp{};
+
+    //! RLP encoding of the withdrawal list, list header included (EIP-4895)
+    std::optional<ByteView> withdrawals_rlp{std::nullopt};
+
+    //! \brief Decode the transactions in order as views, until the walker returns false or any error occurs
+    //! \param walker callable with signature bool(const TransactionView&)
+    template <typename Walker>
+    [[nodiscard]] DecodingResult for_each_transaction(Walker&& walker) const noexcept {
+        ByteView payload{transactions_rlp};
+        const auto h{rlp::decode_header(payload)};
+        if (!h) {
+            return tl::unexpected{h.error()};
+        }
+        if (!h->list) {
+            return tl::unexpected{DecodingError::kUnexpectedString};
+        }
+        TransactionView txn;
+        while (!payload.empty()) {
+            if (DecodingResult res{rlp::decode(payload, txn, rlp::Leftover::kAllow)}; !res) {
+                return res;
+            }
+            if (!walker(txn)) {
+                break;
+            }
+        }
+        return {};
+    }
+
+    [[nodiscard]] DecodingResult decode_transactions(std::vector<Transaction>& to) const noexcept;
+    [[nodiscard]] DecodingResult decode_ommers(std::vector<BlockHeader>& to) const noexcept;
+    [[nodiscard]] DecodingResult decode_withdrawals(std::optional<std::vector<Withdrawal>>& to) const noexcept;
+
+    //! \brief Materialize the full block body, decoding all the nested lists
+    [[nodiscard]] DecodingResult to_block_body(BlockBody& to) const noexcept;
+};
+
+namespace rlp {
+    DecodingResult decode(ByteView& from, BlockBodyView& to, Leftover mode = Leftover::kProhibit) noexcept;
+}  // namespace rlp
+
+}  // namespace silkworm
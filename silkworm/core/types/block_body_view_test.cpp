@@ -0,0 +1,92 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_body_view.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm {
+
+// Just for literals
+using namespace intx;
+
+TEST_CASE("BlockBodyView RLP", "[silkworm][core][types][block_body_view]") {
+    BlockBody body{};
+    body.transactions.resize(2);
+
+    body.transactions[0].nonce = 172339;
+    body.transactions[0].max_priority_fee_per_gas = 50 * kGiga;
+    body.transactions[0].max_fee_per_gas = 50 * kGiga;
+    body.transactions[0].gas_limit = 90'000;
+    body.transactions[0].to = 0xe5ef458d37212a06e3f59d40c454e76150ae7c32_address;
+    body.transactions[0].value = 1'027'501'080 * kGiga;
+    CHECK(body.transactions[0].set_v(27));
+    body.transactions[0].r = 0x48b55bfa915ac795c431978d8a6a992b628d557da5ff759b307d495a36649353_u256;
+    body.transactions[0].s = 0x1fffd310ac743f371de3b9f7f9cb56c0b28ad43601b4ab949f53faa07bd2c804_u256;
+
+    body.transactions[1].type = TransactionType::kDynamicFee;
+    body.transactions[1].nonce = 1;
+    body.transactions[1].max_priority_fee_per_gas = 5 * kGiga;
+    body.transactions[1].max_fee_per_gas = 30 * kGiga;
+    body.transactions[1].gas_limit = 1'000'000;
+    body.transactions[1].data = *from_hex("602a6000556101c960015560068060166000396000f3600035600055");
+    CHECK(body.transactions[1].set_v(37));
+    body.transactions[1].r = 0x52f8f61201b2b11a78d6e866abc9c3db2ae8631fa656bfe5cb53668255367afb_u256;
+    body.transactions[1].s = 0x52f8f61201b2b11a78d6e866abc9c3db2ae8631fa656bfe5cb53668255367afb_u256;
+
+    body.ommers.resize(1);
+    body.ommers[0].beneficiary = 0x0c729be7c39543c3d549282a40395299d987cec2_address;
+    body.ommers[0].difficulty = 12'555'442'155'599;
+    body.ommers[0].number = 13'000'013;
+
+    SECTION("without withdrawals") {}
+    SECTION("with withdrawals") {
+        body.withdrawals = {{.index = 1, .validator_index = 2, .address = 0x0c729be7c39543c3d549282a40395299d987cec2_address, .amount = 3}};
+    }
+
+    Bytes rlp;
+    rlp::encode(rlp, body);
+
+    ByteView view{rlp};
+    BlockBodyView body_view;
+    REQUIRE(rlp::decode(view, body_view));
+    CHECK(view.empty());
+    CHECK(body_view.withdrawals_rlp.has_value() == body.withdrawals.has_value());
+
+    std::vector<evmc::bytes32> hashes;
+    REQUIRE(body_view.for_each_transaction([&](const TransactionView& txn) {
+        hashes.push_back(txn.hash());
+        return true;
+    }));
+    REQUIRE(hashes.size() == 2);
+    CHECK(hashes[0] == body.transactions[0].hash());
+    CHECK(hashes[1] == body.transactions[1].hash());
+
+    size_t visited{0};
+    REQUIRE(body_view.for_each_transaction([&](const TransactionView&) {
+        ++visited;
+        return false;
+    }));
+    CHECK(visited == 1);
+
+    BlockBody decoded;
+    REQUIRE(body_view.to_block_body(decoded));
+    CHECK(decoded == body);
+}
+
+}  // namespace silkworm
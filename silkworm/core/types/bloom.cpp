@@ -19,25 +19,37 @@
 #include <ethash/keccak.hpp>
 
 #include <silkworm/core/common/util.hpp>
+#include <silkworm/core/crypto/keccak.hpp>
 
 namespace silkworm {
 
-void m3_2048(Bloom& bloom, ByteView x) {
-    ethash::hash256 hash{keccak256(x)};
+static void add_hash(Bloom& bloom, const ethash::hash256& hash) {
     for (unsigned i{0}; i < 6; i += 2) {
         unsigned bit{static_cast<unsigned>(hash.bytes[i + 1] + (hash.bytes[i] << 8)) & 0x7FFu};
         bloom[kBloomByteLength - 1 - bit / 8] |= 1 << (bit % 8);
     }
 }
 
+void m3_2048(Bloom& bloom, ByteView x) {
+    add_hash(bloom, keccak256(x));
+}
+
 Bloom logs_bloom(const std::vector<Log>& logs) {
-    Bloom bloom{};  // zero initialization
+    // Addresses and topics all fit in one Keccak block, so they are hashed together in SIMD lanes
+    std::vector<ByteView> inputs;
     for (const Log& log : logs) {
-        m3_2048(bloom, log.address.bytes);
+        inputs.emplace_back(log.address.bytes);
         for (const auto& topic : log.topics) {
-            m3_2048(bloom, topic.bytes);
+            inputs.emplace_back(topic.bytes);
         }
     }
+    std::vector<ethash::hash256> hashes(inputs.size());
+    keccak256_many(inputs, hashes);
+
+    Bloom bloom{};  // zero initialization
+    for (const auto& hash : hashes) {
+        add_hash(bloom, hash);
+    }
     return bloom;
 }
 
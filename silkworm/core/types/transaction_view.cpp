@@ -0,0 +1,293 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "transaction_view.hpp"
+
+#include <bit>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/rlp/decode_vector.hpp>
+#include <silkworm/core/rlp/encode.hpp>
+#include <silkworm/core/types/evmc_bytes32.hpp>
+
+#include "y_parity_and_chain_id.hpp"
+
+namespace silkworm {
+
+evmc::bytes32 TransactionView::hash() const {
+    return std::bit_cast<evmc_bytes32>(keccak256(encoded));
+}
+
+void TransactionView::encode_for_signing(Bytes& into) const {
+    if (type == TransactionType::kLegacy) {
+        rlp::Header h{.list = true, .payload_length = unsigned_payload.length()};
+        if (chain_id) {
+            h.payload_length += rlp::length(*chain_id) + 2;
+        }
+        rlp::encode_header(into, h);
+        into.append(unsigned_payload);
+        if (chain_id) {
+            rlp::encode(into, *chain_id);
+            rlp::encode(into, 0u);
+            rlp::encode(into, 0u);
+        }
+    } else {
+        into.push_back(static_cast<uint8_t>(type));
+        rlp::encode_header(into, {.list = true, .payload_length = unsigned_payload.length()});
+        into.append(unsigned_payload);
+    }
+}
+
+DecodingResult TransactionView::decode_access_list(std::vector<AccessListEntry>& to) const noexcept {
+    if (access_list_rlp.empty()) {
+        to.clear();
+        return {};
+    }
+    ByteView from{access_list_rlp};
+    return rlp::decode(from, to);
+}
+
+DecodingResult TransactionView::decode_blob_versioned_hashes(std::vector<Hash>& to) const noexcept {
+    if (blob_versioned_hashes_rlp.empty()) {
+        to.clear();
+        return {};
+    }
+    ByteView from{blob_versioned_hashes_rlp};
+    return rlp::decode(from, to);
+}
+
+DecodingResult TransactionView::to_transaction(Transaction& txn) const noexcept {
+    txn.type = type;
+    txn.chain_id = chain_id;
+    txn.nonce = nonce;
+    txn.max_priority_fee_per_gas = max_priority_fee_per_gas;
+    txn.max_fee_per_gas = max_fee_per_gas;
+    txn.gas_limit = gas_limit;
+    txn.to = to;
+    txn.value = value;
+    txn.data = data;
+    txn.max_fee_per_blob_gas = max_fee_per_blob_gas;
+    txn.odd_y_parity = odd_y_parity;
+    txn.r = r;
+    txn.s = s;
+    txn.from.reset();
+    if (DecodingResult res{decode_access_list(txn.access_list)}; !res) {
+        return res;
+    }
+    return decode_blob_versioned_hashes(txn.blob_versioned_hashes);
+}
+
+namespace rlp {
+
+    static DecodingResult decode_recipient(ByteView& from, std::optional<evmc::address>& to) noexcept {
+        if (from.empty()) {
+            return tl::unexpected{DecodingError::kInputTooShort};
+        }
+        if (from[0] == kEmptyStringCode) {
+            to = std::nullopt;
+            from.remove_prefix(1);
+            return {};
+        }
+        to = evmc::address{};
+        return decode(from, to->bytes, Leftover::kAllow);
+    }
+
+    // Decodes the list payload of a legacy transaction
+    static DecodingResult legacy_decode_items(ByteView& from, TransactionView& to) noexcept {
+        const uint8_t* unsigned_begin{from.data()};
+
+        if (DecodingResult res{decode_items(from, to.nonce, to.max_priority_fee_per_gas, to.gas_limit)}; !res) {
+            return res;
+        }
+        to.max_fee_per_gas = to.max_priority_fee_per_gas;
+
+        if (DecodingResult res{decode_recipient(from, to.to)}; !res) {
+            return res;
+        }
+        if (DecodingResult res{decode(from, to.value, Leftover::kAllow)}; !res) {
+            return res;
+        }
+        if (DecodingResult res{decode(from, to.data, Leftover::kAllow)}; !res) {
+            return res;
+        }
+        to.unsigned_payload = ByteView{unsigned_begin, static_cast<size_t>(from.data() - unsigned_begin)};
+
+        intx::uint256 v;
+        if (DecodingResult res{decode(from, v, Leftover::kAllow)}; !res) {
+            return res;
+        }
+        const std::optional<YParityAndChainId> parity_and_id{v_to_y_parity_and_chain_id(v)};
+        if (!parity_and_id) {
+            return tl::unexpected{DecodingError::kInvalidVInSignature};
+        }
+        to.odd_y_parity = parity_and_id->odd;
+        to.chain_id = parity_and_id->chain_id;
+
+        return decode_items(from, to.r, to.s);
+    }
+
+    // Decodes the RLP list following the type byte of an EIP-2718 transaction
+    static DecodingResult eip2718_decode(ByteView& from, TransactionView& to) noexcept {
+        if (to.type != TransactionType::kAccessList &&
+            to.type != TransactionType::kDynamicFee &&
+            to.type != TransactionType::kBlob) {
+            return tl::unexpected{DecodingError::kUnsupportedTransactionType};
+        }
+
+        const auto h{decode_header(from)};
+        if (!h) {
+            return tl::unexpected{h.error()};
+        }
+        if (!h->list) {
+            return tl::unexpected{DecodingError::kUnexpectedString};
+        }
+        ByteView payload{from.substr(0, h->payload_length)};
+        from.remove_prefix(h->payload_length);
+
+        const uint8_t* unsigned_begin{payload.data()};
+
+        intx::uint256 chain_id;
+        if (DecodingResult res{decode_items(payload, chain_id, to.nonce, to.max_priority_fee_per_gas)}; !res) {
+            return res;
+        }
+        to.chain_id = chain_id;
+
+        if (to.type == TransactionType::kAccessList) {
+            to.max_fee_per_gas = to.max_priority_fee_per_gas;
+        } else if (DecodingResult res{decode(payload, to.max_fee_per_gas, Leftover::kAllow)}; !res) {
+            return res;
+        }
+
+        if (DecodingResult res{decode(payload, to.gas_limit, Leftover::kAllow)}; !res) {
+            return res;
+        }
+        if (DecodingResult res{decode_recipient(payload, to.to)}; !res) {
+            return res;
+        }
+        if (DecodingResult res{decode(payload, to.value, Leftover::kAllow)}; !res) {
+            return res;
+        }
+        if (DecodingResult res{decode(payload, to.data, Leftover::kAllow)}; !res) {
+            return res;
+        }
+        if (DecodingResult res{decode_list_view(payload, to.access_list_rlp, Leftover::kAllow)}; !res) {
+            return res;
+        }
+
+        if (to.type == TransactionType::kBlob) {
+            if (DecodingResult res{decode(payload, to.max_fee_per_blob_gas, Leftover::kAllow)}; !res) {
+                return res;
+            }
+            if (DecodingResult res{decode_list_view(payload, to.blob_versioned_hashes_rlp, Leftover::kAllow)}; !res) {
+                return res;
+            }
+        }
+        to.unsigned_payload = ByteView{unsigned_begin, static_cast<size_t>(payload.data() - unsigned_begin)};
+
+        if (DecodingResult res{decode_items(payload, to.odd_y_parity, to.r, to.s)}; !res) {
+            return res;
+        }
+        if (!payload.empty()) {
+            return tl::unexpected{DecodingError::kUnexpectedListElements};
+        }
+        return {};
+    }
+
+    DecodingResult decode_transaction(ByteView& from, TransactionView& to, Eip2718Wrapping allowed,
+                                      Leftover mode) noexcept {
+        to = TransactionView{};
+
+        if (from.empty()) {
+            return tl::unexpected{DecodingError::kInputTooShort};
+        }
+
+        if (0 < from[0] && from[0] < kEmptyStringCode) {  // Raw serialization of a typed transaction
+            if (allowed == Eip2718Wrapping::kString) {
+                return tl::unexpected{DecodingError::kUnexpectedEip2718Serialization};
+            }
+
+            const uint8_t* begin{from.data()};
+            to.type = static_cast<TransactionType>(from[0]);
+            from.remove_prefix(1);
+
+            if (DecodingResult res{eip2718_decode(from, to)}; !res) {
+                return res;
+            }
+            to.encoded = ByteView{begin, static_cast<size_t>(from.data() - begin)};
+
+            if (mode != Leftover::kAllow && !from.empty()) {
+                return tl::unexpected{DecodingError::kInputTooLong};
+            }
+            return {};
+        }
+
+        const uint8_t* begin{from.data()};
+        const auto h{decode_header(from)};
+        if (!h) {
+            return tl::unexpected{h.error()};
+        }
+
+        if (h->list) {  // Legacy transaction
+            to.type = TransactionType::kLegacy;
+
+            ByteView payload{from.substr(0, h->payload_length)};
+            from.remove_prefix(h->payload_length);
+            to.encoded = ByteView{begin, static_cast<size_t>(from.data() - begin)};
+
+            if (DecodingResult res{legacy_decode_items(payload, to)}; !res) {
+                return res;
+            }
+            if (!payload.empty()) {
+                return tl::unexpected{DecodingError::kUnexpectedListElements};
+            }
+            if (mode != Leftover::kAllow && !from.empty()) {
+                return tl::unexpected{DecodingError::kInputTooLong};
+            }
+            return {};
+        }
+
+        // String-wrapped typed transaction
+
+        if (allowed == Eip2718Wrapping::kNone) {
+            return tl::unexpected{DecodingError::kUnexpectedEip2718Serialization};
+        }
+
+        if (h->payload_length == 0) {
+            return tl::unexpected{DecodingError::kInputTooShort};
+        }
+
+        to.encoded = from.substr(0, h->payload_length);
+        from.remove_prefix(h->payload_length);
+
+        to.type = static_cast<TransactionType>(to.encoded[0]);
+        ByteView eip2718_view{to.encoded.substr(1)};
+
+        if (DecodingResult res{eip2718_decode(eip2718_view, to)}; !res) {
+            return res;
+        }
+        if (!eip2718_view.empty()) {
+            return tl::unexpected{DecodingError::kUnexpectedListElements};
+        }
+
+        if (mode != Leftover::kAllow && !from.empty()) {
+            return tl::unexpected{DecodingError::kInputTooLong};
+        }
+        return {};
+    }
+
+}  // namespace rlp
+
+}  // namespace silkworm
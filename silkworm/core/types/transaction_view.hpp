@@ -0,0 +1,91 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <evmc/evmc.hpp>
+#include <intx/intx.hpp>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/bytes.hpp>
+#include <silkworm/core/rlp/decode.hpp>
+#include <silkworm/core/types/hash.hpp>
+#include <silkworm/core/types/transaction.hpp>
+
+namespace silkworm {
+
+//! \brief TransactionView is a transaction decoded without copying anything from the RLP-encoded input buffer.
+//! \details Fixed-size fields are decoded eagerly, whilst variable-length fields (data, access list and blob versioned
+//! hashes) are kept as views into the input and decoded only on demand.
+//! \warning A TransactionView is valid only as long as the buffer it has been decoded from, e.g. an MDBX page within
+//! the same transaction or a snapshot word.
+struct TransactionView {
+    TransactionType type{TransactionType::kLegacy};
+
+    std::optional<intx::uint256> chain_id{std::nullopt};  // nullopt means a pre-EIP-155 transaction
+
+    uint64_t nonce{0};
+    intx::uint256 max_priority_fee_per_gas{0};  // EIP-1559
+    intx::uint256 max_fee_per_gas{0};
+    uint64_t gas_limit{0};
+    std::optional<evmc::address> to{std::nullopt};
+    intx::uint256 value{0};
+    ByteView data{};
+
+    intx::uint256 max_fee_per_blob_gas{0};  // EIP-4844
+
+    bool odd_y_parity{false};
+    intx::uint256 r{0}, s{0};  // signature
+
+    //! EIP-2718 encoding: either the legacy RLP list or the type byte followed by the RLP list (never string-wrapped)
+    ByteView encoded{};
+
+    //! RLP encoding of the fields covered by signature (i.e. all fields but y parity/v, r and s), without list header
+    ByteView unsigned_payload{};
+
+    //! RLP encoding of the access list (EIP-2930), list header included (empty for legacy transactions)
+    ByteView access_list_rlp{};
+
+    //! RLP encoding of the blob versioned hashes (EIP-4844), list header included (empty for non-blob transactions)
+    ByteView blob_versioned_hashes_rlp{};
+
+    //! \brief Transaction hash computed directly from the encoded input, i.e. without any re-encoding
+    [[nodiscard]] evmc::bytes32 hash() const;
+
+    //! \brief Same as UnsignedTransaction::encode_for_signing but reusing the encoded fields
+    void encode_for_signing(Bytes& into) const;
+
+    [[nodiscard]] DecodingResult decode_access_list(std::vector<AccessListEntry>& to) const noexcept;
+    [[nodiscard]] DecodingResult decode_blob_versioned_hashes(std::vector<Hash>& to) const noexcept;
+
+    //! \brief Materialize the full transaction, copying variable-length fields and decoding the nested ones
+    //! \remarks The sender is not populated, being not part of the transaction encoding
+    [[nodiscard]] DecodingResult to_transaction(Transaction& txn) const noexcept;
+};
+
+namespace rlp {
+    DecodingResult decode_transaction(ByteView& from, TransactionView& to, Eip2718Wrapping accepted_typed_txn_wrapping,
+                                      Leftover mode = Leftover::kProhibit) noexcept;
+
+    inline DecodingResult decode(ByteView& from, TransactionView& to, Leftover mode = Leftover::kProhibit) noexcept {
+        return decode_transaction(from, to, Eip2718Wrapping::kString, mode);
+    }
+}  // namespace rlp
+
+}  // namespace silkworm
@@ -0,0 +1,149 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "transaction_view.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm {
+
+static const std::vector<AccessListEntry> kAccessList{
+    {0xde0b295669a9fd93d5f28d9ec85e40f4cb697bae_address,
+     {
+         0x0000000000000000000000000000000000000000000000000000000000000003_bytes32,
+         0x0000000000000000000000000000000000000000000000000000000000000007_bytes32,
+     }},
+    {0xbb9bc244d798123fde783fcc1c72d3bb8c189413_address, {}},
+};
+
+static Transaction sample_transaction(TransactionType type) {
+    Transaction txn{
+        {.type = type,
+         .chain_id = 5,
+         .nonce = 7,
+         .max_priority_fee_per_gas = 10000000000,
+         .max_fee_per_gas = 30000000000,
+         .gas_limit = 5748100,
+         .to = 0x811a752c8cd697e3cb27279c330ed1ada745a8d7_address,
+         .value = 2 * kEther,
+         .data = *from_hex("6ebaf477f83e051589c1188bcc6ddccd")},
+        true,                                                                                                    // odd_y_parity
+        intx::from_string<intx::uint256>("0x36b241b061a36a32ab7fe86c7aa9eb592dd59018cd0443adc0903590c16b02b0"),  // r
+        intx::from_string<intx::uint256>("0x5edcc541b4741c5cc6dd347c5ed9577ef293a62787b4510465fadbfe39ee4094"),  // s
+    };
+    if (type == TransactionType::kLegacy || type == TransactionType::kAccessList) {
+        txn.max_priority_fee_per_gas = txn.max_fee_per_gas;
+    }
+    if (type != TransactionType::kLegacy) {
+        txn.access_list = kAccessList;
+    }
+    if (type == TransactionType::kBlob) {
+        txn.max_fee_per_blob_gas = 123;
+        txn.blob_versioned_hashes = {
+            0xc6bdd1de713471bd6cfa62dd8b5a5b42969ed09e26212d3377f3f8426d8ec210_bytes32,
+            0x8aaeccaf3873d07cef005aca28c39f8a9f8bdb1ec8d79ffc25afc0a4fa2ab736_bytes32,
+        };
+    }
+    return txn;
+}
+
+TEST_CASE("TransactionView RLP", "[silkworm][core][types][transaction_view]") {
+    const auto type = GENERATE(TransactionType::kLegacy, TransactionType::kAccessList,
+                               TransactionType::kDynamicFee, TransactionType::kBlob);
+    const Transaction txn{sample_transaction(type)};
+
+    Bytes encoded;
+    rlp::encode(encoded, txn);
+
+    TransactionView txn_view;
+    ByteView view{encoded};
+    REQUIRE(rlp::decode(view, txn_view));
+    CHECK(view.empty());
+
+    CHECK(txn_view.type == txn.type);
+    CHECK(txn_view.chain_id == txn.chain_id);
+    CHECK(txn_view.nonce == txn.nonce);
+    CHECK(txn_view.max_priority_fee_per_gas == txn.max_priority_fee_per_gas);
+    CHECK(txn_view.max_fee_per_gas == txn.max_fee_per_gas);
+    CHECK(txn_view.gas_limit == txn.gas_limit);
+    CHECK(txn_view.to == txn.to);
+    CHECK(txn_view.value == txn.value);
+    CHECK(Bytes{txn_view.data} == txn.data);
+    CHECK(txn_view.odd_y_parity == txn.odd_y_parity);
+    CHECK(txn_view.r == txn.r);
+    CHECK(txn_view.s == txn.s);
+
+    // Variable-length fields must point into the encoded buffer
+    CHECK(txn_view.data.data() >= encoded.data());
+    CHECK(txn_view.data.data() + txn_view.data.size() <= encoded.data() + encoded.size());
+
+    std::vector<AccessListEntry> access_list;
+    REQUIRE(txn_view.decode_access_list(access_list));
+    CHECK(access_list == txn.access_list);
+
+    std::vector<Hash> blob_versioned_hashes;
+    REQUIRE(txn_view.decode_blob_versioned_hashes(blob_versioned_hashes));
+    CHECK(blob_versioned_hashes == txn.blob_versioned_hashes);
+
+    CHECK(txn_view.hash() == txn.hash());
+
+    Bytes signing_rlp, expected_signing_rlp;
+    txn_view.encode_for_signing(signing_rlp);
+    txn.encode_for_signing(expected_signing_rlp);
+    CHECK(signing_rlp == expected_signing_rlp);
+
+    Transaction decoded;
+    REQUIRE(txn_view.to_transaction(decoded));
+    CHECK(decoded == txn);
+}
+
+TEST_CASE("TransactionView EIP-2718 wrapping", "[silkworm][core][types][transaction_view]") {
+    const Transaction txn{sample_transaction(TransactionType::kDynamicFee)};
+
+    Bytes encoded_raw;
+    rlp::encode(encoded_raw, txn, /*wrap_eip2718_into_string=*/false);
+    Bytes encoded_wrapped;
+    rlp::encode(encoded_wrapped, txn, /*wrap_eip2718_into_string=*/true);
+
+    TransactionView txn_view;
+    ByteView view{encoded_raw};
+    CHECK(rlp::decode_transaction(view, txn_view, rlp::Eip2718Wrapping::kString) ==
+          tl::unexpected{DecodingError::kUnexpectedEip2718Serialization});
+    view = encoded_raw;
+    REQUIRE(rlp::decode_transaction(view, txn_view, rlp::Eip2718Wrapping::kNone));
+    CHECK(view.empty());
+    CHECK(txn_view.encoded == ByteView{encoded_raw});
+
+    view = encoded_wrapped;
+    CHECK(rlp::decode_transaction(view, txn_view, rlp::Eip2718Wrapping::kNone) ==
+          tl::unexpected{DecodingError::kUnexpectedEip2718Serialization});
+    view = encoded_wrapped;
+    REQUIRE(rlp::decode_transaction(view, txn_view, rlp::Eip2718Wrapping::kBoth));
+    CHECK(view.empty());
+    CHECK(txn_view.encoded == ByteView{encoded_raw});  // hash preimage never includes the string wrapping
+
+    // Trailing bytes
+    encoded_wrapped.push_back(0x01);
+    view = encoded_wrapped;
+    CHECK(rlp::decode(view, txn_view) == tl::unexpected{DecodingError::kInputTooLong});
+    view = encoded_wrapped;
+    REQUIRE(rlp::decode(view, txn_view, rlp::Leftover::kAllow));
+    CHECK(view.size() == 1);
+}
+
+}  // namespace silkworm
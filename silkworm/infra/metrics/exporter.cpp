@@ -0,0 +1,111 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "exporter.hpp"
+
+#include <string_view>
+#include <utility>
+
+#include <absl/strings/str_cat.h>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::metrics {
+
+using boost::asio::use_awaitable;
+
+//! Max size of the request head (request line plus headers) accepted
+static constexpr size_t kMaxRequestHeadSize{8 * 1024};
+
+static boost::asio::ip::tcp::endpoint resolve_endpoint(boost::asio::io_context& io_context, const std::string& end_point) {
+    const auto separator{end_point.rfind(':')};
+    const auto host{end_point.substr(0, separator)};
+    const auto port{separator == std::string::npos ? std::string{} : end_point.substr(separator + 1)};
+    boost::asio::ip::tcp::resolver resolver{io_context};
+    return *resolver.resolve(host, port).begin();
+}
+
+Exporter::Exporter(const std::string& end_point, boost::asio::io_context& io_context, Registry& registry)
+    : io_context_{io_context}, acceptor_{io_context}, registry_{registry} {
+    const auto endpoint{resolve_endpoint(io_context, end_point)};
+    acceptor_.open(endpoint.protocol());
+    acceptor_.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+    acceptor_.bind(endpoint);
+    acceptor_.listen();
+}
+
+void Exporter::start() {
+    log::Info("Metrics exporter", {"endpoint", acceptor_.local_endpoint().address().to_string() + ":" +
+                                                   std::to_string(acceptor_.local_endpoint().port())});
+    boost::asio::co_spawn(io_context_, run(), boost::asio::detached);
+}
+
+void Exporter::stop() {
+    boost::system::error_code ec;
+    acceptor_.close(ec);
+}
+
+Task<void> Exporter::run() {
+    try {
+        while (acceptor_.is_open()) {
+            auto socket = co_await acceptor_.async_accept(use_awaitable);
+            boost::asio::co_spawn(io_context_, handle_connection(std::move(socket)), boost::asio::detached);
+        }
+    } catch (const boost::system::system_error& se) {
+        if (se.code() != boost::asio::error::operation_aborted) {
+            log::Error("Metrics exporter", {"error", se.what()});
+        }
+    }
+}
+
+Task<void> Exporter::handle_connection(boost::asio::ip::tcp::socket socket) {
+    try {
+        std::string request;
+        co_await boost::asio::async_read_until(socket, boost::asio::dynamic_buffer(request, kMaxRequestHeadSize),
+                                               "\r\n\r\n", use_awaitable);
+
+        const std::string_view request_line{request.data(), request.find("\r\n")};
+        const bool is_metrics_request{request_line.starts_with("GET /metrics ") || request_line == "GET /metrics"};
+
+        std::string body;
+        const char* status{"404 Not Found"};
+        if (is_metrics_request) {
+            registry_.collect(body);
+            status = "200 OK";
+        }
+
+        std::string reply{absl::StrCat("HTTP/1.1 ", status, "\r\n",
+                                       "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n",
+                                       "Content-Length: ", body.size(), "\r\n",
+                                       "Connection: close\r\n\r\n")};
+        reply += body;
+        co_await boost::asio::async_write(socket, boost::asio::buffer(reply), use_awaitable);
+
+        boost::system::error_code ec;
+        socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+    } catch (const boost::system::system_error& se) {
+        SILK_DEBUG << "Metrics exporter connection error: " << se.what();
+    }
+}
+
+}  // namespace silkworm::metrics
@@ -0,0 +1,56 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include <silkworm/infra/metrics/metrics.hpp>
+
+namespace silkworm::metrics {
+
+//! \brief Exporter serves the metrics of a Registry over HTTP at /metrics in Prometheus text format
+//! \details This is intentionally a minimal HTTP/1.1 server: one request per connection, no keep-alive.
+class Exporter {
+  public:
+    //! Construct the exporter to listen on the specified local TCP end-point (i.e. <ip-address>:<port>)
+    Exporter(const std::string& end_point, boost::asio::io_context& io_context, Registry& registry = Registry::instance());
+
+    Exporter(const Exporter&) = delete;
+    Exporter& operator=(const Exporter&) = delete;
+
+    void start();
+
+    void stop();
+
+    //! The local end-point actually bound (useful when binding to port 0)
+    [[nodiscard]] boost::asio::ip::tcp::endpoint local_endpoint() const { return acceptor_.local_endpoint(); }
+
+  private:
+    Task<void> run();
+    Task<void> handle_connection(boost::asio::ip::tcp::socket socket);
+
+    boost::asio::io_context& io_context_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    Registry& registry_;
+};
+
+}  // namespace silkworm::metrics
@@ -0,0 +1,69 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "exporter.hpp"
+
+#include <string>
+#include <thread>
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <catch2/catch.hpp>
+
+namespace silkworm::metrics {
+
+static std::string http_get(const boost::asio::ip::tcp::endpoint& endpoint, const std::string& target) {
+    boost::asio::io_context io_context;
+    boost::asio::ip::tcp::socket socket{io_context};
+    socket.connect(endpoint);
+    const std::string request{"GET " + target + " HTTP/1.1\r\nHost: localhost\r\n\r\n"};
+    boost::asio::write(socket, boost::asio::buffer(request));
+    std::string response;
+    boost::system::error_code ec;
+    boost::asio::read(socket, boost::asio::dynamic_buffer(response), ec);  // until EOF
+    return response;
+}
+
+TEST_CASE("Exporter", "[silkworm][infra][metrics]") {
+    Registry registry;
+    registry.counter("test_exported_total", "Exported counter").increment(42);
+
+    boost::asio::io_context io_context;
+    Exporter exporter{"127.0.0.1:0", io_context, registry};
+    exporter.start();
+    std::thread io_thread{[&]() { io_context.run(); }};
+
+    const auto endpoint{exporter.local_endpoint()};
+
+    SECTION("metrics") {
+        const auto response{http_get(endpoint, "/metrics")};
+        CHECK(response.starts_with("HTTP/1.1 200 OK\r\n"));
+        CHECK(response.find("Content-Type: text/plain; version=0.0.4") != std::string::npos);
+        CHECK(response.find("test_exported_total 42\n") != std::string::npos);
+    }
+
+    SECTION("not found") {
+        const auto response{http_get(endpoint, "/")};
+        CHECK(response.starts_with("HTTP/1.1 404 Not Found\r\n"));
+    }
+
+    boost::asio::post(io_context, [&]() { exporter.stop(); });
+    io_thread.join();
+}
+
+}  // namespace silkworm::metrics
@@ -0,0 +1,228 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "metrics.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+#include <absl/strings/str_cat.h>
+
+namespace silkworm::metrics {
+
+namespace detail {
+    size_t this_thread_shard() noexcept {
+        static std::atomic<size_t> next_shard{0};
+        thread_local const size_t shard{next_shard.fetch_add(1, std::memory_order_relaxed) % kNumShards};
+        return shard;
+    }
+}  // namespace detail
+
+uint64_t Counter::value() const noexcept {
+    uint64_t total{0};
+    for (const auto& shard : shards_) {
+        total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+// Number of bits needed to index the sub-buckets within each power-of-two range
+static constexpr unsigned kSubBucketBits{std::countr_zero(Histogram::kSubBuckets)};
+static_assert(std::has_single_bit(Histogram::kSubBuckets));
+
+Histogram::Histogram(double export_scale, unsigned max_exponent)
+    : export_scale_{export_scale},
+      num_buckets_{std::clamp(max_exponent, kSubBucketBits, 63u) * kSubBuckets} {
+    for (auto& shard : shards_) {
+        shard.buckets = std::make_unique<std::atomic<uint64_t>[]>(num_buckets_);
+    }
+}
+
+size_t Histogram::bucket_index(uint64_t value) noexcept {
+    if (value < kSubBuckets) {
+        return static_cast<size_t>(value);
+    }
+    const auto exponent{static_cast<unsigned>(std::bit_width(value) - 1)};
+    const unsigned shift{exponent - kSubBucketBits};
+    const auto sub_bucket{static_cast<size_t>(value >> shift) - kSubBuckets};
+    return (shift + 1) * kSubBuckets + sub_bucket;
+}
+
+uint64_t Histogram::bucket_upper_bound(size_t index) noexcept {
+    if (index < kSubBuckets) {
+        return index;
+    }
+    const size_t shift{index / kSubBuckets - 1};
+    const uint64_t sub_bucket{index % kSubBuckets};
+    return ((kSubBuckets + sub_bucket + 1) << shift) - 1;
+}
+
+void Histogram::observe(uint64_t value) noexcept {
+    Shard& shard{shards_[detail::this_thread_shard()]};
+    const size_t index{std::min(bucket_index(value), num_buckets_ - 1)};
+    shard.buckets[index].fetch_add(1, std::memory_order_relaxed);
+    shard.count.fetch_add(1, std::memory_order_relaxed);
+    shard.sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+Histogram::Snapshot Histogram::snapshot() const {
+    Snapshot snapshot;
+    snapshot.buckets.resize(num_buckets_, 0);
+    for (const auto& shard : shards_) {
+        for (size_t i{0}; i < num_buckets_; ++i) {
+            snapshot.buckets[i] += shard.buckets[i].load(std::memory_order_relaxed);
+        }
+        snapshot.count += shard.count.load(std::memory_order_relaxed);
+        snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+Registry& Registry::instance() {
+    static Registry registry;
+    return registry;
+}
+
+Registry::Family& Registry::family(const std::string& name, const std::string& help, Type type) {
+    auto [it, inserted] = families_.try_emplace(name, Family{.type = type, .help = help});
+    if (!inserted && it->second.type != type) {
+        throw std::invalid_argument{"metric " + name + " already registered with different type"};
+    }
+    return it->second;
+}
+
+Counter& Registry::counter(const std::string& name, const std::string& help, const Labels& labels) {
+    std::scoped_lock lock{mutex_};
+    auto& metric{family(name, help, Type::kCounter).counters[labels]};
+    if (!metric) {
+        metric = std::make_unique<Counter>();
+    }
+    return *metric;
+}
+
+Gauge& Registry::gauge(const std::string& name, const std::string& help, const Labels& labels) {
+    std::scoped_lock lock{mutex_};
+    auto& metric{family(name, help, Type::kGauge).gauges[labels]};
+    if (!metric) {
+        metric = std::make_unique<Gauge>();
+    }
+    return *metric;
+}
+
+Histogram& Registry::histogram(const std::string& name, const std::string& help, const Labels& labels,
+                               double export_scale) {
+    std::scoped_lock lock{mutex_};
+    auto& metric{family(name, help, Type::kHistogram).histograms[labels]};
+    if (!metric) {
+        metric = std::make_unique<Histogram>(export_scale);
+    }
+    return *metric;
+}
+
+static void append_escaped(std::string& out, const std::string& value, bool escape_quotes) {
+    for (const char c : value) {
+        if (c == '\\') {
+            out += "\\\\";
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (c == '"' && escape_quotes) {
+            out += "\\\"";
+        } else {
+            out += c;
+        }
+    }
+}
+
+// Append the sample name followed by its labels plus an optional extra label (i.e. histogram bucket boundary)
+static void append_sample_name(std::string& out, const std::string& name, const Labels& labels,
+                               const char* extra_name = nullptr, const std::string& extra_value = {}) {
+    out += name;
+    if (labels.empty() && !extra_name) {
+        return;
+    }
+    out += '{';
+    bool first{true};
+    for (const auto& [label_name, label_value] : labels) {
+        if (!first) out += ',';
+        first = false;
+        absl::StrAppend(&out, label_name, "=\"");
+        append_escaped(out, label_value, /*escape_quotes=*/true);
+        out += '"';
+    }
+    if (extra_name) {
+        if (!first) out += ',';
+        absl::StrAppend(&out, extra_name, "=\"", extra_value, "\"");
+    }
+    out += '}';
+}
+
+static std::string format_scaled(uint64_t value, double scale) {
+    if (scale == 1.0) {
+        return absl::StrCat(value);
+    }
+    return absl::StrCat(static_cast<double>(value) * scale);
+}
+
+void Registry::collect(std::string& out) const {
+    std::scoped_lock lock{mutex_};
+    for (const auto& [name, family] : families_) {
+        absl::StrAppend(&out, "# HELP ", name, " ");
+        append_escaped(out, family.help, /*escape_quotes=*/false);
+        out += '\n';
+        switch (family.type) {
+            case Type::kCounter:
+                absl::StrAppend(&out, "# TYPE ", name, " counter\n");
+                for (const auto& [labels, counter] : family.counters) {
+                    append_sample_name(out, name, labels);
+                    absl::StrAppend(&out, " ", counter->value(), "\n");
+                }
+                break;
+            case Type::kGauge:
+                absl::StrAppend(&out, "# TYPE ", name, " gauge\n");
+                for (const auto& [labels, gauge] : family.gauges) {
+                    append_sample_name(out, name, labels);
+                    absl::StrAppend(&out, " ", gauge->value(), "\n");
+                }
+                break;
+            case Type::kHistogram:
+                absl::StrAppend(&out, "# TYPE ", name, " histogram\n");
+                for (const auto& [labels, histogram] : family.histograms) {
+                    const auto snapshot{histogram->snapshot()};
+                    const double scale{histogram->export_scale()};
+                    // Export cumulative counts at power-of-two boundaries only, the last range being open-ended
+                    uint64_t cumulative{0};
+                    for (size_t i{0}; i < snapshot.buckets.size(); ++i) {
+                        cumulative += snapshot.buckets[i];
+                        if ((i + 1) % Histogram::kSubBuckets == 0 && i + 1 < snapshot.buckets.size()) {
+                            append_sample_name(out, name + "_bucket", labels, "le",
+                                               format_scaled(Histogram::bucket_upper_bound(i), scale));
+                            absl::StrAppend(&out, " ", cumulative, "\n");
+                        }
+                    }
+                    append_sample_name(out, name + "_bucket", labels, "le", "+Inf");
+                    absl::StrAppend(&out, " ", cumulative, "\n");
+                    append_sample_name(out, name + "_sum", labels);
+                    absl::StrAppend(&out, " ", format_scaled(snapshot.sum, scale), "\n");
+                    append_sample_name(out, name + "_count", labels);
+                    absl::StrAppend(&out, " ", cumulative, "\n");
+                }
+                break;
+        }
+    }
+}
+
+}  // namespace silkworm::metrics
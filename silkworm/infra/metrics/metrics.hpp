@@ -0,0 +1,195 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace silkworm::metrics {
+
+//! Metric labels as (name, value) pairs, exported in the given order
+using Labels = std::vector<std::pair<std::string, std::string>>;
+
+namespace detail {
+    //! Number of per-thread shards used by counters and histograms
+    inline constexpr size_t kNumShards{16};
+
+    //! Index of the shard assigned to the calling thread (assigned round-robin at first use)
+    size_t this_thread_shard() noexcept;
+
+    struct alignas(64) PaddedCounter {
+        std::atomic<uint64_t> value{0};
+    };
+}  // namespace detail
+
+//! \brief Counter is a monotonically increasing value
+//! \details Increments are spread over per-thread cache-line padded shards, so that hot counters updated by many
+//! threads do not bounce the same cache line around. Reading the value sums up all the shards.
+class Counter {
+  public:
+    Counter() = default;
+    Counter(const Counter&) = delete;
+    Counter& operator=(const Counter&) = delete;
+
+    void increment(uint64_t delta = 1) noexcept {
+        shards_[detail::this_thread_shard()].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t value() const noexcept;
+
+  private:
+    std::array<detail::PaddedCounter, detail::kNumShards> shards_;
+};
+
+//! \brief Gauge is a value that can arbitrarily go up and down
+class Gauge {
+  public:
+    Gauge() = default;
+    Gauge(const Gauge&) = delete;
+    Gauge& operator=(const Gauge&) = delete;
+
+    void set(int64_t value) noexcept { value_.store(value, std::memory_order_relaxed); }
+    void increment(int64_t delta = 1) noexcept { value_.fetch_add(delta, std::memory_order_relaxed); }
+    void decrement(int64_t delta = 1) noexcept { value_.fetch_sub(delta, std::memory_order_relaxed); }
+
+    [[nodiscard]] int64_t value() const noexcept { return value_.load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<int64_t> value_{0};
+};
+
+//! \brief Histogram is an HDR-style log-linear histogram of unsigned integer samples (e.g. durations in nanoseconds)
+//! \details Each power-of-two range [2^e, 2^(e+1)) is split into kSubBuckets linear sub-buckets, so that the relative
+//! error is bounded by 1/kSubBuckets whatever the magnitude. Samples are recorded into per-thread shards of atomic
+//! buckets with no locking. Samples exceeding 2^(max_exponent+1) are recorded into the last bucket.
+class Histogram {
+  public:
+    static constexpr size_t kSubBuckets{4};
+    static constexpr unsigned kDefaultMaxExponent{40};
+
+    //! \param export_scale the factor applied to bucket boundaries and sum when exported (e.g. 1e-9 for ns to seconds)
+    //! \param max_exponent the exponent of the highest power-of-two range tracked
+    explicit Histogram(double export_scale = 1.0, unsigned max_exponent = kDefaultMaxExponent);
+
+    Histogram(const Histogram&) = delete;
+    Histogram& operator=(const Histogram&) = delete;
+
+    void observe(uint64_t value) noexcept;
+
+    struct Snapshot {
+        std::vector<uint64_t> buckets;  // not cumulative
+        uint64_t count{0};
+        uint64_t sum{0};
+    };
+
+    //! \brief Merge all shards into a consistent-enough view (shards are read without stopping writers)
+    [[nodiscard]] Snapshot snapshot() const;
+
+    [[nodiscard]] size_t num_buckets() const noexcept { return num_buckets_; }
+    [[nodiscard]] double export_scale() const noexcept { return export_scale_; }
+
+    //! \brief Index of the bucket the specified value falls into (ignoring max exponent)
+    static size_t bucket_index(uint64_t value) noexcept;
+
+    //! \brief The highest value (inclusive) falling into the bucket at the specified index
+    static uint64_t bucket_upper_bound(size_t index) noexcept;
+
+  private:
+    struct alignas(64) Shard {
+        std::unique_ptr<std::atomic<uint64_t>[]> buckets;
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> sum{0};
+    };
+
+    double export_scale_;
+    size_t num_buckets_;
+    std::array<Shard, detail::kNumShards> shards_;
+};
+
+//! \brief ScopedTimer records the nanoseconds elapsed from construction to destruction into a histogram, if any
+class ScopedTimer {
+  public:
+    explicit ScopedTimer(Histogram* histogram) noexcept
+        : histogram_{histogram}, start_{histogram ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{}} {}
+    ~ScopedTimer() {
+        if (histogram_) {
+            const auto elapsed{std::chrono::steady_clock::now() - start_};
+            histogram_->observe(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+  private:
+    Histogram* histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+//! \brief Registry owns the metrics and renders them in Prometheus text exposition format
+//! \details Metrics are registered once (typically at component construction) and the returned references stay valid
+//! for the Registry lifetime, so updating them never requires the registry lock. Registering again the same name and
+//! labels returns the existing metric.
+class Registry {
+  public:
+    //! The process-wide registry exported by the metrics endpoint
+    static Registry& instance();
+
+    Registry() = default;
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    //! \throws std::invalid_argument if name is already registered with a different metric type
+    Counter& counter(const std::string& name, const std::string& help, const Labels& labels = {});
+    Gauge& gauge(const std::string& name, const std::string& help, const Labels& labels = {});
+    Histogram& histogram(const std::string& name, const std::string& help, const Labels& labels = {},
+                         double export_scale = 1.0);
+
+    //! \brief Append all metrics in Prometheus text format (version 0.0.4) to the specified output
+    void collect(std::string& out) const;
+
+  private:
+    enum class Type {
+        kCounter,
+        kGauge,
+        kHistogram,
+    };
+
+    struct Family {
+        Type type;
+        std::string help;
+        std::map<Labels, std::unique_ptr<Counter>> counters;
+        std::map<Labels, std::unique_ptr<Gauge>> gauges;
+        std::map<Labels, std::unique_ptr<Histogram>> histograms;
+    };
+
+    Family& family(const std::string& name, const std::string& help, Type type);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Family> families_;
+};
+
+}  // namespace silkworm::metrics
@@ -0,0 +1,132 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "metrics.hpp"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace silkworm::metrics {
+
+TEST_CASE("Counter", "[silkworm][infra][metrics]") {
+    Counter counter;
+    CHECK(counter.value() == 0);
+    counter.increment();
+    counter.increment(9);
+    CHECK(counter.value() == 10);
+
+    SECTION("multiple threads") {
+        std::vector<std::thread> threads;
+        for (size_t t{0}; t < 4; ++t) {
+            threads.emplace_back([&]() {
+                for (size_t i{0}; i < 1'000; ++i) {
+                    counter.increment();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        CHECK(counter.value() == 4'010);
+    }
+}
+
+TEST_CASE("Gauge", "[silkworm][infra][metrics]") {
+    Gauge gauge;
+    gauge.set(5);
+    gauge.increment(3);
+    gauge.decrement(10);
+    CHECK(gauge.value() == -2);
+}
+
+TEST_CASE("Histogram buckets", "[silkworm][infra][metrics]") {
+    for (uint64_t v{0}; v < 4; ++v) {
+        CHECK(Histogram::bucket_index(v) == v);
+        CHECK(Histogram::bucket_upper_bound(v) == v);
+    }
+    CHECK(Histogram::bucket_index(4) == 4);
+    CHECK(Histogram::bucket_index(7) == 7);
+    CHECK(Histogram::bucket_index(8) == 8);
+    CHECK(Histogram::bucket_index(9) == 8);
+    CHECK(Histogram::bucket_index(10) == 9);
+    CHECK(Histogram::bucket_upper_bound(8) == 9);
+    CHECK(Histogram::bucket_upper_bound(11) == 15);
+
+    // Every value falls into the bucket whose bounds contain it
+    for (uint64_t v : {5ull, 100ull, 1'000ull, 123'456'789ull, 1ull << 40}) {
+        const size_t index{Histogram::bucket_index(v)};
+        CHECK(v <= Histogram::bucket_upper_bound(index));
+        CHECK(v > Histogram::bucket_upper_bound(index - 1));
+    }
+}
+
+TEST_CASE("Histogram observe", "[silkworm][infra][metrics]") {
+    Histogram histogram{/*export_scale=*/1.0, /*max_exponent=*/10};
+    CHECK(histogram.num_buckets() == 40);
+
+    histogram.observe(1);
+    histogram.observe(100);
+    histogram.observe(1'000'000);  // beyond max exponent, clamped into last bucket
+
+    const auto snapshot{histogram.snapshot()};
+    CHECK(snapshot.count == 3);
+    CHECK(snapshot.sum == 1'000'101);
+    CHECK(snapshot.buckets[1] == 1);
+    CHECK(snapshot.buckets[Histogram::bucket_index(100)] == 1);
+    CHECK(snapshot.buckets.back() == 1);
+}
+
+TEST_CASE("Registry", "[silkworm][infra][metrics]") {
+    Registry registry;
+
+    auto& counter{registry.counter("test_requests_total", "Number of requests", {{"method", "eth_call"}})};
+    CHECK(&counter == &registry.counter("test_requests_total", "Number of requests", {{"method", "eth_call"}}));
+    CHECK(&counter != &registry.counter("test_requests_total", "Number of requests", {{"method", "eth_getLogs"}}));
+    CHECK_THROWS_AS(registry.gauge("test_requests_total", "Wrong type"), std::invalid_argument);
+
+    counter.increment(2);
+    registry.gauge("test_peers", "Number of peers").set(7);
+    registry.histogram("test_duration_seconds", "Duration", {}, /*export_scale=*/0.5).observe(4);
+
+    std::string out;
+    registry.collect(out);
+    CHECK(out.find("# HELP test_requests_total Number of requests\n") != std::string::npos);
+    CHECK(out.find("# TYPE test_requests_total counter\n") != std::string::npos);
+    CHECK(out.find("test_requests_total{method=\"eth_call\"} 2\n") != std::string::npos);
+    CHECK(out.find("test_requests_total{method=\"eth_getLogs\"} 0\n") != std::string::npos);
+    CHECK(out.find("# TYPE test_peers gauge\ntest_peers 7\n") != std::string::npos);
+    CHECK(out.find("# TYPE test_duration_seconds histogram\n") != std::string::npos);
+    CHECK(out.find("test_duration_seconds_bucket{le=\"1.5\"} 0\n") != std::string::npos);
+    CHECK(out.find("test_duration_seconds_bucket{le=\"3.5\"} 1\n") != std::string::npos);
+    CHECK(out.find("test_duration_seconds_bucket{le=\"+Inf\"} 1\n") != std::string::npos);
+    CHECK(out.find("test_duration_seconds_sum 2\n") != std::string::npos);
+    CHECK(out.find("test_duration_seconds_count 1\n") != std::string::npos);
+}
+
+TEST_CASE("Registry label escaping", "[silkworm][infra][metrics]") {
+    Registry registry;
+    registry.counter("test_escaped", "Help with \\ and\nnewline", {{"path", "a\"b\\c"}}).increment();
+
+    std::string out;
+    registry.collect(out);
+    CHECK(out.find("# HELP test_escaped Help with \\\\ and\\nnewline\n") != std::string::npos);
+    CHECK(out.find("test_escaped{path=\"a\\\"b\\\\c\"} 1\n") != std::string::npos);
+}
+
+}  // namespace silkworm::metrics
@@ -0,0 +1,258 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "span_profiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <stdexcept>
+
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::profiling {
+
+static int64_t steady_nanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static std::string frame_name(const Span& span) {
+    std::string frame{span.scope ? std::string{span.scope} + "::" : ""};
+    frame.append(span.name ? span.name : "?");
+    return frame;
+}
+
+//! Write the string as JSON string literal escaping the characters that need it
+static void write_json_string(std::ostream& out, std::string_view value) {
+    out << '"';
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+SpanProfiler& SpanProfiler::instance() {
+    static SpanProfiler profiler;
+    return profiler;
+}
+
+void SpanProfiler::enable(size_t ring_capacity) {
+    ring_capacity_.store(std::max(ring_capacity, size_t{1}), std::memory_order_relaxed);
+    uint64_t no_origin{0};
+    if (origin_ticks_.compare_exchange_strong(no_origin, read_ticks())) {
+        origin_nanos_.store(steady_nanos());
+    }
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+SpanProfiler::ThreadRing& SpanProfiler::this_thread_ring() {
+    thread_local std::shared_ptr<ThreadRing> thread_ring;
+    if (!thread_ring) {
+        static std::atomic<uint64_t> next_thread_id{1};
+        thread_ring = std::make_shared<ThreadRing>();
+        thread_ring->thread_id = next_thread_id.fetch_add(1, std::memory_order_relaxed);
+        thread_ring->thread_name = log::get_thread_name();
+        thread_ring->thread_name.erase(thread_ring->thread_name.find_last_not_of(' ') + 1);
+
+        std::scoped_lock lock{rings_mutex_};
+        rings_.push_back(thread_ring);
+    }
+    return *thread_ring;
+}
+
+void SpanProfiler::record(const char* scope, const char* name, uint64_t start_ticks, uint64_t end_ticks) noexcept {
+    try {
+        ThreadRing& ring{this_thread_ring()};
+        std::scoped_lock lock{ring.mutex};
+        const size_t capacity{ring_capacity_.load(std::memory_order_relaxed)};
+        if (ring.spans.size() != capacity) {
+            ring.spans.resize(capacity);
+            ring.next = 0;
+            ring.total = 0;
+        }
+        ring.spans[ring.next] = Span{scope, name, start_ticks, end_ticks};
+        ring.next = (ring.next + 1) % capacity;
+        ++ring.total;
+    } catch (...) {
+        // Profiling must never interfere with the profiled code
+    }
+}
+
+void SpanProfiler::clear() {
+    std::scoped_lock rings_lock{rings_mutex_};
+    for (const auto& ring : rings_) {
+        std::scoped_lock lock{ring->mutex};
+        ring->next = 0;
+        ring->total = 0;
+    }
+}
+
+std::vector<SpanProfiler::ThreadSpans> SpanProfiler::snapshot() const {
+    std::vector<ThreadSpans> snapshot;
+    std::scoped_lock rings_lock{rings_mutex_};
+    for (const auto& ring : rings_) {
+        std::scoped_lock lock{ring->mutex};
+        if (ring->total == 0) {
+            continue;
+        }
+        ThreadSpans& thread_spans = snapshot.emplace_back();
+        thread_spans.thread_id = ring->thread_id;
+        thread_spans.thread_name = ring->thread_name;
+        if (ring->total < ring->spans.size()) {
+            thread_spans.spans.assign(ring->spans.cbegin(), ring->spans.cbegin() + static_cast<std::ptrdiff_t>(ring->next));
+        } else {
+            thread_spans.spans = ring->spans;
+        }
+        // Spans are recorded at the end of their scope, so nested ones come before their parent: order them by start
+        std::sort(thread_spans.spans.begin(), thread_spans.spans.end(), [](const Span& lhs, const Span& rhs) {
+            return lhs.start_ticks < rhs.start_ticks || (lhs.start_ticks == rhs.start_ticks && lhs.end_ticks > rhs.end_ticks);
+        });
+    }
+    return snapshot;
+}
+
+std::vector<Span> SpanProfiler::spans() const {
+    std::vector<Span> spans;
+    for (auto& thread_spans : snapshot()) {
+        spans.insert(spans.end(), thread_spans.spans.cbegin(), thread_spans.spans.cend());
+    }
+    return spans;
+}
+
+uint64_t SpanProfiler::dropped_spans() const {
+    uint64_t dropped{0};
+    std::scoped_lock rings_lock{rings_mutex_};
+    for (const auto& ring : rings_) {
+        std::scoped_lock lock{ring->mutex};
+        if (ring->total > ring->spans.size()) {
+            dropped += ring->total - ring->spans.size();
+        }
+    }
+    return dropped;
+}
+
+double SpanProfiler::nanos_per_tick() const {
+    // Calibrate the tick counter against the steady clock over the whole profiling session
+    const uint64_t origin_ticks{origin_ticks_.load()};
+    const uint64_t elapsed_ticks{read_ticks() - origin_ticks};
+    const int64_t elapsed_nanos{steady_nanos() - origin_nanos_.load()};
+    if (origin_ticks == 0 || elapsed_ticks == 0 || elapsed_nanos <= 0) {
+        return 1.0;
+    }
+    return static_cast<double>(elapsed_nanos) / static_cast<double>(elapsed_ticks);
+}
+
+void SpanProfiler::write_chrome_trace(std::ostream& out) const {
+    const auto threads{snapshot()};
+    const double micros_per_tick{nanos_per_tick() / 1'000};
+    const uint64_t origin_ticks{origin_ticks_.load()};
+
+    out << std::fixed << std::setprecision(3);
+    out << R"({"displayTimeUnit":"ms","traceEvents":[)";
+    bool first{true};
+    for (const auto& thread : threads) {
+        if (!first) out << ',';
+        first = false;
+        out << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << thread.thread_id << R"(,"args":{"name":)";
+        write_json_string(out, thread.thread_name);
+        out << "}}";
+        for (const auto& span : thread.spans) {
+            const auto start_ticks{span.start_ticks > origin_ticks ? span.start_ticks - origin_ticks : 0};
+            const auto duration_ticks{span.end_ticks > span.start_ticks ? span.end_ticks - span.start_ticks : 0};
+            out << R"(,{"name":)";
+            write_json_string(out, frame_name(span));
+            out << R"(,"cat":)";
+            write_json_string(out, span.scope ? span.scope : "silkworm");
+            out << R"(,"ph":"X","pid":1,"tid":)" << thread.thread_id
+                << R"(,"ts":)" << static_cast<double>(start_ticks) * micros_per_tick
+                << R"(,"dur":)" << static_cast<double>(duration_ticks) * micros_per_tick << '}';
+        }
+    }
+    out << "]}\n";
+}
+
+void SpanProfiler::write_folded_stacks(std::ostream& out) const {
+    const auto threads{snapshot()};
+    const double micros_per_tick{nanos_per_tick() / 1'000};
+
+    // Accumulate the self time of each distinct stack, i.e. span duration minus the duration of its nested spans
+    std::map<std::string, uint64_t> self_ticks_by_stack;
+    struct Frame {
+        std::string stack;
+        uint64_t end_ticks{0};
+        uint64_t duration_ticks{0};
+        uint64_t children_ticks{0};
+    };
+    for (const auto& thread : threads) {
+        std::string root{thread.thread_name.empty() ? "thread-" + std::to_string(thread.thread_id) : thread.thread_name};
+        std::replace(root.begin(), root.end(), ';', '_');
+        std::vector<Frame> frames;
+        const auto pop_frame = [&]() {
+            const Frame& frame{frames.back()};
+            self_ticks_by_stack[frame.stack] += frame.duration_ticks - std::min(frame.children_ticks, frame.duration_ticks);
+            const uint64_t duration_ticks{frame.duration_ticks};
+            frames.pop_back();
+            if (!frames.empty()) {
+                frames.back().children_ticks += duration_ticks;
+            }
+        };
+        for (const auto& span : thread.spans) {
+            while (!frames.empty() && frames.back().end_ticks <= span.start_ticks) {
+                pop_frame();
+            }
+            std::string name{frame_name(span)};
+            std::replace(name.begin(), name.end(), ';', '_');
+            const auto& parent_stack{frames.empty() ? root : frames.back().stack};
+            frames.push_back({parent_stack + ";" + name,
+                              span.end_ticks,
+                              span.end_ticks > span.start_ticks ? span.end_ticks - span.start_ticks : 0});
+        }
+        while (!frames.empty()) {
+            pop_frame();
+        }
+    }
+
+    for (const auto& [stack, self_ticks] : self_ticks_by_stack) {
+        const auto self_micros{static_cast<uint64_t>(static_cast<double>(self_ticks) * micros_per_tick)};
+        if (self_micros > 0) {
+            out << stack << ' ' << self_micros << '\n';
+        }
+    }
+}
+
+void SpanProfiler::write_to_file(const std::filesystem::path& file_path, TraceFormat format) const {
+    std::ofstream out{file_path, std::ios::out | std::ios::trunc};
+    if (!out) {
+        throw std::runtime_error{"cannot open trace file " + file_path.string()};
+    }
+    if (format == TraceFormat::kChrome) {
+        write_chrome_trace(out);
+    } else {
+        write_folded_stacks(out);
+    }
+    if (const auto dropped{dropped_spans()}; dropped > 0) {
+        log::Warning("SpanProfiler", {"dropped_spans", std::to_string(dropped), "file", file_path.string()});
+    }
+}
+
+}  // namespace silkworm::profiling
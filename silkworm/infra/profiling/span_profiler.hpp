@@ -0,0 +1,173 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif
+
+namespace silkworm::profiling {
+
+//! \brief Read the current value of the cheapest available monotonic tick counter
+//! \details On x86 this is the time-stamp counter (invariant on any CPU we care about), on ARM64 the virtual counter
+//! and elsewhere the steady clock in nanoseconds. Ticks are converted into wall time only when exporting spans.
+inline uint64_t read_ticks() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    asm volatile("mrs %0, cntvct_el0"
+                 : "=r"(ticks));
+    return ticks;
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+//! One timed region of code executed by one thread
+struct Span {
+    const char* scope{nullptr};  // static string identifying the component (e.g. stage name), may be null
+    const char* name{nullptr};   // static string identifying the operation within scope
+    uint64_t start_ticks{0};
+    uint64_t end_ticks{0};
+};
+
+//! Default number of spans retained by each thread before overwriting the oldest ones
+inline constexpr size_t kDefaultSpanRingCapacity{1 << 16};
+
+//! Supported output formats for recorded spans
+enum class TraceFormat {
+    kChrome,  // Chrome trace-event JSON, to be opened in chrome://tracing, Perfetto or speedscope
+    kFolded,  // Folded stacks with self time in microseconds, as consumed by flamegraph.pl or speedscope
+};
+
+//! Profiling settings
+struct Settings {
+    std::string trace_file;  // empty means profiling is disabled
+    TraceFormat trace_format{TraceFormat::kChrome};
+    size_t ring_capacity{kDefaultSpanRingCapacity};
+};
+
+//! \brief SpanProfiler collects the timed spans recorded by any thread into per-thread ring buffers
+//! \details Profiling is disabled by default: a disabled profiler costs one relaxed atomic load per span. When enabled,
+//! recording a span costs two tick counter reads plus an uncontended lock on the calling thread ring.
+class SpanProfiler {
+  public:
+    static SpanProfiler& instance();
+
+    SpanProfiler(const SpanProfiler&) = delete;
+    SpanProfiler& operator=(const SpanProfiler&) = delete;
+
+    //! Start recording spans, each thread keeping at most ring_capacity most recent ones
+    void enable(size_t ring_capacity = kDefaultSpanRingCapacity);
+
+    //! Stop recording spans, already recorded ones are kept
+    void disable() noexcept { enabled_.store(false, std::memory_order_relaxed); }
+
+    [[nodiscard]] bool enabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+    //! Record one span executed by the calling thread
+    void record(const char* scope, const char* name, uint64_t start_ticks, uint64_t end_ticks) noexcept;
+
+    //! Drop all the recorded spans
+    void clear();
+
+    //! Get a copy of the spans currently retained by all threads
+    [[nodiscard]] std::vector<Span> spans() const;
+
+    //! Number of spans overwritten because some thread ring was full
+    [[nodiscard]] uint64_t dropped_spans() const;
+
+    void write_chrome_trace(std::ostream& out) const;
+    void write_folded_stacks(std::ostream& out) const;
+
+    //! Write all the recorded spans to the specified file in the specified format
+    void write_to_file(const std::filesystem::path& file_path, TraceFormat format) const;
+
+  private:
+    SpanProfiler() = default;
+
+    struct ThreadRing {
+        std::mutex mutex;
+        std::vector<Span> spans;
+        size_t next{0};      // position of the next span to write
+        uint64_t total{0};   // total number of spans ever recorded
+        uint64_t thread_id{0};
+        std::string thread_name;
+    };
+
+    //! The spans retained by one thread, in chronological order of start
+    struct ThreadSpans {
+        uint64_t thread_id{0};
+        std::string thread_name;
+        std::vector<Span> spans;
+    };
+
+    ThreadRing& this_thread_ring();
+    [[nodiscard]] std::vector<ThreadSpans> snapshot() const;
+    [[nodiscard]] double nanos_per_tick() const;
+
+    std::atomic_bool enabled_{false};
+    std::atomic<size_t> ring_capacity_{kDefaultSpanRingCapacity};
+    std::atomic<uint64_t> origin_ticks_{0};
+    std::atomic<int64_t> origin_nanos_{0};
+
+    mutable std::mutex rings_mutex_;
+    std::vector<std::shared_ptr<ThreadRing>> rings_;
+};
+
+//! \brief ScopedSpan records the lifetime of the enclosing scope as one span, if profiling is enabled
+class ScopedSpan {
+  public:
+    ScopedSpan(const char* scope, const char* name) noexcept
+        : scope_{scope}, name_{name}, start_ticks_{SpanProfiler::instance().enabled() ? read_ticks() : 0} {}
+    ~ScopedSpan() {
+        if (start_ticks_ != 0) {
+            SpanProfiler::instance().record(scope_, name_, start_ticks_, read_ticks());
+        }
+    }
+
+    ScopedSpan(const ScopedSpan&) = delete;
+    ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+  private:
+    const char* scope_;
+    const char* name_;
+    uint64_t start_ticks_;
+};
+
+}  // namespace silkworm::profiling
+
+#define SILKWORM_PROFILE_CONCAT_IMPL(x, y) x##y
+#define SILKWORM_PROFILE_CONCAT(x, y) SILKWORM_PROFILE_CONCAT_IMPL(x, y)
+
+//! Record the enclosing scope as one span named scope::name (both must be static strings)
+#define SILKWORM_PROFILE_SPAN(scope, name) \
+    const ::silkworm::profiling::ScopedSpan SILKWORM_PROFILE_CONCAT(profile_span_, __LINE__) { scope, name }
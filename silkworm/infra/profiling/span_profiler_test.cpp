@@ -0,0 +1,108 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "span_profiler.hpp"
+
+#include <sstream>
+#include <string_view>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+namespace silkworm::profiling {
+
+//! Restore the profiler disabled and empty at the end of each test
+struct SpanProfilerGuard {
+    ~SpanProfilerGuard() {
+        SpanProfiler::instance().disable();
+        SpanProfiler::instance().clear();
+    }
+};
+
+TEST_CASE("read_ticks is monotonic", "[infra][profiling]") {
+    const auto ticks1{read_ticks()};
+    const auto ticks2{read_ticks()};
+    CHECK(ticks2 >= ticks1);
+}
+
+TEST_CASE("SpanProfiler disabled", "[infra][profiling]") {
+    SpanProfilerGuard guard;
+    auto& profiler{SpanProfiler::instance()};
+    CHECK_FALSE(profiler.enabled());
+    {
+        SILKWORM_PROFILE_SPAN("Test", "disabled");
+    }
+    CHECK(profiler.spans().empty());
+}
+
+TEST_CASE("SpanProfiler records nested spans", "[infra][profiling]") {
+    SpanProfilerGuard guard;
+    auto& profiler{SpanProfiler::instance()};
+    profiler.enable();
+    {
+        SILKWORM_PROFILE_SPAN("Test", "outer");
+        {
+            SILKWORM_PROFILE_SPAN("Test", "inner");
+        }
+    }
+    const auto spans{profiler.spans()};
+    REQUIRE(spans.size() == 2);
+    CHECK(std::string_view{spans[0].name} == "outer");
+    CHECK(std::string_view{spans[1].name} == "inner");
+    CHECK(spans[0].start_ticks <= spans[1].start_ticks);
+    CHECK(spans[1].end_ticks <= spans[0].end_ticks);
+
+    SECTION("chrome trace") {
+        std::stringstream out;
+        profiler.write_chrome_trace(out);
+        const auto trace{out.str()};
+        CHECK(trace.starts_with(R"({"displayTimeUnit":"ms","traceEvents":[)"));
+        CHECK(trace.find(R"("name":"Test::outer","cat":"Test","ph":"X")") != std::string::npos);
+        CHECK(trace.find(R"("name":"Test::inner","cat":"Test","ph":"X")") != std::string::npos);
+        CHECK(trace.find(R"("ph":"M")") != std::string::npos);
+    }
+
+    SECTION("folded stacks") {
+        // Make a tick-accurate trace independent of actual timings
+        profiler.clear();
+        profiler.record("Test", "inner", 2'000'000, 3'000'000);
+        profiler.record("Test", "outer", 1'000'000, 4'000'000);
+        std::stringstream out;
+        profiler.write_folded_stacks(out);
+        const auto folded{out.str()};
+        CHECK(folded.find(";Test::outer;Test::inner ") != std::string::npos);
+        CHECK(folded.find(";Test::outer ") != std::string::npos);
+    }
+}
+
+TEST_CASE("SpanProfiler keeps one ring per thread", "[infra][profiling]") {
+    SpanProfilerGuard guard;
+    auto& profiler{SpanProfiler::instance()};
+    profiler.enable(/*ring_capacity=*/2);
+    std::thread worker{[]() {
+        for (int i{0}; i < 3; ++i) {
+            SILKWORM_PROFILE_SPAN("Test", "worker");
+        }
+    }};
+    worker.join();
+    {
+        SILKWORM_PROFILE_SPAN("Test", "main");
+    }
+    CHECK(profiler.spans().size() == 3);
+    CHECK(profiler.dropped_spans() == 1);
+}
+
+}  // namespace silkworm::profiling
@@ -96,15 +96,15 @@ void BackEndKvServer::register_kv_request_calls(agrpc::GrpcContext* grpc_context
     auto& backend = backend_;
 
     // Register one requested call repeatedly for each RPC: asio-grpc will take care of re-registration on any incoming call
-    request_repeatedly(*grpc_context, service, &remote::KV::AsyncService::RequestVersion,
+    request_repeatedly(*grpc_context, service, &KvAsyncService::RequestVersion,
                        [&backend](auto&&... args) -> Task<void> {
                            co_await KvVersionCall{std::forward<decltype(args)>(args)...}(backend);
                        });
-    request_repeatedly(*grpc_context, service, &remote::KV::AsyncService::RequestTx,
+    request_repeatedly(*grpc_context, service, &KvAsyncService::RequestTx,
                        [&backend, grpc_context](auto&&... args) -> Task<void> {
                            co_await TxCall{*grpc_context, std::forward<decltype(args)>(args)...}(backend);
                        });
-    request_repeatedly(*grpc_context, service, &remote::KV::AsyncService::RequestStateChanges,
+    request_repeatedly(*grpc_context, service, &KvAsyncService::RequestStateChanges,
                        [&backend](auto&&... args) -> Task<void> {
                            co_await StateChangesCall{std::forward<decltype(args)>(args)...}(backend);
                        });
@@ -24,6 +24,7 @@
 #include <silkworm/interfaces/remote/ethbackend.grpc.pb.h>
 #include <silkworm/interfaces/remote/kv.grpc.pb.h>
 #include <silkworm/node/backend/ethereum_backend.hpp>
+#include <silkworm/node/backend/remote/grpc/kv_calls.hpp>
 
 namespace silkworm::rpc {
 
@@ -52,7 +53,7 @@ class BackEndKvServer : public Server {
     remote::ETHBACKEND::AsyncService backend_async_service_;
 
     //! \warning The gRPC service must exist for the lifetime of the gRPC server it is registered on.
-    remote::KV::AsyncService kv_async_service_;
+    KvAsyncService kv_async_service_;
 };
 
 }  // namespace silkworm::rpc
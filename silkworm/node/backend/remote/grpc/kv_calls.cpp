@@ -654,24 +654,30 @@ void TxCall::throw_with_error(grpc::Status&& status) {
 }
 
 Task<void> StateChangesCall::operator()(const EthereumBackEnd& backend) {
-    SILK_TRACE << "StateChangesCall w/ storage: " << request_.with_storage() << " w/ txs: " << request_.with_transactions() << " START";
+    remote::StateChangeRequest request;
+    if (!grpc::SerializationTraits<remote::StateChangeRequest>::Deserialize(&request_, &request).ok()) {
+        SILK_ERROR << "StateChanges peer: " << peer() << " invalid request";
+        co_await agrpc::finish(responder_, grpc::Status{grpc::StatusCode::INVALID_ARGUMENT, "invalid StateChangeRequest"});
+        co_return;
+    }
+    SILK_TRACE << "StateChangesCall w/ storage: " << request.with_storage() << " w/ txs: " << request.with_transactions() << " START";
     auto source = backend.state_change_source();
 
     // Create a never-expiring timer whose cancellation will notify our async waiting is completed
     auto coroutine_executor = co_await boost::asio::this_coro::executor;
     auto notifying_timer = steady_timer{coroutine_executor};
 
-    std::optional<remote::StateChangeBatch> incoming_batch;
+    StateChangeBatchPtr incoming_batch;
 
     // Register subscription to receive state change batch notifications
-    StateChangeConsumer state_change_consumer = [&](std::optional<remote::StateChangeBatch> batch) {
+    StateChangeConsumer state_change_consumer = [&](StateChangeBatchPtr batch) {
         // Make the batch handling logic execute on the scheduler associated to the RPC
         boost::asio::dispatch(coroutine_executor, [&, batch = std::move(batch)]() {
             incoming_batch = batch;
             notifying_timer.cancel();
         });
     };
-    StateChangeFilter filter{request_.with_storage(), request_.with_transactions()};
+    StateChangeFilter filter{request.with_storage(), request.with_transactions()};
     const auto token = source->subscribe(state_change_consumer, filter);
 
     // The assigned token ID must be valid.
@@ -694,9 +700,10 @@ Task<void> StateChangesCall::operator()(const EthereumBackEnd& backend) {
         if (ec == boost::asio::error::operation_aborted) {
             // Notifying timer cancelled => incoming batch available
             if (incoming_batch) {
-                const auto block_height = incoming_batch->change_batch(0).block_height();
+                const auto block_height = incoming_batch->message().change_batch(0).block_height();
                 SILK_DEBUG << "Sending state change batch for block: " << block_height;
-                const bool write_ok = co_await agrpc::write(responder_, *incoming_batch);
+                // Write the shared serialized batch: the byte buffer copy just references its slices
+                const bool write_ok = co_await agrpc::write(responder_, incoming_batch->serialized());
                 SILK_DEBUG << "State change batch for block: " << block_height << " sent [write_ok=" << write_ok << "]";
                 if (!write_ok) done = true;
             } else {
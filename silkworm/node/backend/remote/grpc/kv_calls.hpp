@@ -149,8 +149,15 @@ class TxCall : public server::BidiStreamingCall<remote::Cursor, remote::Pair> {
     uint32_t last_cursor_id_{0};
 };
 
+//! The 'kv' async service having StateChanges as raw method, so that state change batches are written pre-serialized.
+using KvAsyncService = remote::KV::WithAsyncMethod_Version<remote::KV::WithAsyncMethod_Tx<remote::KV::WithRawMethod_StateChanges<
+    remote::KV::WithAsyncMethod_Snapshots<remote::KV::WithAsyncMethod_Range<remote::KV::WithAsyncMethod_DomainGet<
+        remote::KV::WithAsyncMethod_HistoryGet<remote::KV::WithAsyncMethod_IndexRange<remote::KV::WithAsyncMethod_HistoryRange<
+            remote::KV::WithAsyncMethod_DomainRange<remote::KV::Service>>>>>>>>>>;
+
 //! Server-streaming RPC for StateChanges method of 'kv' gRPC protocol.
-class StateChangesCall : public server::ServerStreamingCall<remote::StateChangeRequest, remote::StateChangeBatch> {
+//! The request is decoded from raw bytes and each batch is written as already serialized by StateChangeCollection.
+class StateChangesCall : public server::ServerStreamingCall<grpc::ByteBuffer, grpc::ByteBuffer> {
   public:
     using Base::ServerStreamingCall;
 
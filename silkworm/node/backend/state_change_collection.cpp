@@ -16,6 +16,8 @@
 
 #include "state_change_collection.hpp"
 
+#include <grpcpp/impl/codegen/proto_utils.h>
+
 #include <silkworm/core/common/assert.hpp>
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
@@ -25,6 +27,18 @@
 
 namespace silkworm {
 
+FrozenStateChangeBatch::FrozenStateChangeBatch(std::unique_ptr<google::protobuf::Arena> arena,
+                                               remote::StateChangeBatch* batch)
+    : arena_{std::move(arena)}, batch_{batch} {
+    bool own_buffer{false};
+    const auto status = grpc::SerializationTraits<remote::StateChangeBatch>::Serialize(*batch_, &serialized_, &own_buffer);
+    SILKWORM_ASSERT(status.ok());
+}
+
+StateChangeCollection::StateChangeCollection() {
+    reset(0);
+}
+
 std::optional<StateChangeToken> StateChangeCollection::subscribe(StateChangeConsumer consumer,
                                                                  StateChangeFilter /*filter*/) {
     std::unique_lock consumers_lock{consumers_mutex_};
@@ -41,7 +55,10 @@ bool StateChangeCollection::unsubscribe(StateChangeToken token) {
 
 void StateChangeCollection::reset(uint64_t tx_id) {
     tx_id_ = tx_id;
-    state_changes_.clear_change_batch();
+    // Always start over with a new arena: if the previous one has not been handed over to any consumer, dropping it
+    // is the only way to free the submessages it owns (clearing the batch would keep them allocated in the arena)
+    arena_ = std::make_unique<google::protobuf::Arena>();
+    state_changes_ = google::protobuf::Arena::CreateMessage<remote::StateChangeBatch>(arena_.get());
     latest_change_ = nullptr;
     account_change_index_.clear();
     storage_change_index_.clear();
@@ -54,7 +71,7 @@ void StateChangeCollection::start_new_batch(BlockNum block_height, const evmc::b
 
     SILKWORM_ASSERT(latest_change_ == nullptr);
 
-    latest_change_ = state_changes_.add_change_batch();
+    latest_change_ = state_changes_->add_change_batch();
     latest_change_->set_block_height(block_height);
     latest_change_->set_allocated_block_hash(rpc::H256_from_bytes32(block_hash).release());
     latest_change_->set_direction(unwind ? remote::Direction::UNWIND : remote::Direction::FORWARD);
@@ -200,17 +217,19 @@ void StateChangeCollection::notify_batch(uint64_t pending_base_fee, uint64_t gas
     SILK_TRACE << "StateChangeCollection::notify_batch " << this << " pending_base_fee: " << pending_base_fee
                << " gas_limit:" << gas_limit << " START";
 
-    state_changes_.set_pending_block_base_fee(pending_base_fee);
-    state_changes_.set_block_gas_limit(gas_limit);
-    state_changes_.set_state_version_id(tx_id_);
+    state_changes_->set_pending_block_base_fee(pending_base_fee);
+    state_changes_->set_block_gas_limit(gas_limit);
+    state_changes_->set_state_version_id(tx_id_);
 
     std::unique_lock consumers_lock{consumers_mutex_};
-    for (const auto& [_, batch_callback] : consumers_) {
-        // Make a copy of state change batch for every consumer because lifecycle is independent
-        const std::optional<remote::StateChangeBatch> frozen_batch = state_changes_;
-        SILK_DEBUG << "Notify callback=" << &batch_callback << " batch=" << &frozen_batch;
-        batch_callback(frozen_batch);
-        SILK_DEBUG << "Notify callback=" << &batch_callback << " done";
+    if (!consumers_.empty()) {
+        // Freeze the batch just once and share it among all consumers, handing over its arena
+        const auto frozen_batch = std::make_shared<const FrozenStateChangeBatch>(std::move(arena_), state_changes_);
+        for (const auto& [_, batch_callback] : consumers_) {
+            SILK_DEBUG << "Notify callback=" << &batch_callback << " batch=" << frozen_batch.get();
+            batch_callback(frozen_batch);
+            SILK_DEBUG << "Notify callback=" << &batch_callback << " done";
+        }
     }
     reset(0);
 
@@ -221,7 +240,7 @@ void StateChangeCollection::close() {
     std::unique_lock consumers_lock{consumers_mutex_};
     for (const auto& [_, batch_callback] : consumers_) {
         SILK_DEBUG << "Notify close to callback=" << &batch_callback;
-        batch_callback(std::nullopt);
+        batch_callback(nullptr);
         SILK_DEBUG << "Notify close to callback=" << &batch_callback << " done";
     }
     reset(0);
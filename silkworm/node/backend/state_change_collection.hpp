@@ -23,14 +23,41 @@
 #include <optional>
 
 #include <evmc/evmc.hpp>
+#include <google/protobuf/arena.h>
+#include <grpcpp/impl/codegen/byte_buffer.h>
 #include <gsl/pointers>
 
+#include <silkworm/core/common/hash_maps.hpp>
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/interfaces/remote/kv.pb.h>
 
 namespace silkworm {
 
-using StateChangeConsumer = std::function<void(std::optional<remote::StateChangeBatch>)>;
+//! \brief One batch of state changes, immutable and shared by all the consumers
+//! \details The batch message lives in its own arena and it is serialized just once in wire format, whose slices are
+//! reference-counted: streaming it to any number of subscribers never copies nor re-serializes the batch.
+class FrozenStateChangeBatch {
+  public:
+    FrozenStateChangeBatch(std::unique_ptr<google::protobuf::Arena> arena, remote::StateChangeBatch* batch);
+
+    FrozenStateChangeBatch(const FrozenStateChangeBatch&) = delete;
+    FrozenStateChangeBatch& operator=(const FrozenStateChangeBatch&) = delete;
+
+    [[nodiscard]] const remote::StateChangeBatch& message() const { return *batch_; }
+
+    //! The batch in wire format, to be written as is by raw gRPC streams
+    [[nodiscard]] const grpc::ByteBuffer& serialized() const { return serialized_; }
+
+  private:
+    std::unique_ptr<google::protobuf::Arena> arena_;
+    remote::StateChangeBatch* batch_;  // owned by arena_
+    grpc::ByteBuffer serialized_;
+};
+
+using StateChangeBatchPtr = std::shared_ptr<const FrozenStateChangeBatch>;
+
+//! The consumer of state change batches, notified with nullptr when the collection is closed
+using StateChangeConsumer = std::function<void(StateChangeBatchPtr)>;
 
 struct StateChangeFilter {
     bool with_storage{false};
@@ -52,7 +79,7 @@ class StateChangeSource {
 
 class StateChangeCollection : public StateChangeSource {
   public:
-    explicit StateChangeCollection() = default;
+    explicit StateChangeCollection();
 
     uint64_t tx_id() const { return tx_id_; }
 
@@ -79,6 +106,9 @@ class StateChangeCollection : public StateChangeSource {
     void close();
 
   protected:
+    //! The memory allocated by the arena of the current batch.
+    [[nodiscard]] uint64_t arena_space_used() const { return arena_->SpaceUsed(); }
+
     //! The token number for the next subscription.
     StateChangeToken next_token_{0};
 
@@ -86,17 +116,20 @@ class StateChangeCollection : public StateChangeSource {
     //! The database transaction ID associated with the state changes.
     uint64_t tx_id_{0};
 
-    //! The current batch of state changes.
-    remote::StateChangeBatch state_changes_;
+    //! The arena where the current batch is built, handed over to the consumers when notified or dropped otherwise.
+    std::unique_ptr<google::protobuf::Arena> arena_;
+
+    //! The current batch of state changes, owned by the arena.
+    remote::StateChangeBatch* state_changes_{nullptr};
 
     //! The latest state change in the batch.
     remote::StateChange* latest_change_{nullptr};
 
     //! The mapping between accounts and their change indexes.
-    std::map<evmc::address, std::size_t> account_change_index_;
+    FlatHashMap<evmc::address, std::size_t> account_change_index_;
 
     //! The mapping between account storage locations and their change indexes.
-    std::map<evmc::address, std::map<evmc::bytes32, std::size_t>> storage_change_index_;
+    FlatHashMap<evmc::address, FlatHashMap<evmc::bytes32, std::size_t>> storage_change_index_;
 
     //! The registered batch consumers.
     std::map<StateChangeToken, StateChangeConsumer> consumers_;
@@ -17,9 +17,11 @@
 #include "state_change_collection.hpp"
 
 #include <memory>
+#include <vector>
 
 #include <catch2/catch.hpp>
 #include <evmc/evmc.hpp>
+#include <grpcpp/impl/codegen/proto_utils.h>
 
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
@@ -102,11 +104,11 @@ TEST_CASE("StateChangeCollection::notify_batch", "[silkworm][rpc][state_change_c
 
     SECTION("OK: notifies batch w/o changes to single consumer") {
         uint32_t notification_count{0};
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->state_version_id() == 0);
-            CHECK(batch->change_batch_size() == 0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().state_version_id() == 0);
+            CHECK(batch->message().change_batch_size() == 0);
             ++notification_count;
         },
                       StateChangeFilter{});
@@ -116,25 +118,78 @@ TEST_CASE("StateChangeCollection::notify_batch", "[silkworm][rpc][state_change_c
 
     SECTION("OK: notifies batch w/o changes to multiple consumers") {
         uint32_t notification_count1{0}, notification_count2{0};
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->state_version_id() == 0);
-            CHECK(batch->change_batch_size() == 0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().state_version_id() == 0);
+            CHECK(batch->message().change_batch_size() == 0);
             ++notification_count1;
         },
                       StateChangeFilter{});
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->state_version_id() == 0);
-            CHECK(batch->change_batch_size() == 0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().state_version_id() == 0);
+            CHECK(batch->message().change_batch_size() == 0);
             ++notification_count2;
         },
                       StateChangeFilter{});
         scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
         CHECK((notification_count1 == 1 && notification_count2 == 1));
     }
+
+    SECTION("OK: notifies the same serialized batch to multiple consumers") {
+        std::vector<StateChangeBatchPtr> batches;
+        scc.subscribe([&](StateChangeBatchPtr batch) { batches.push_back(std::move(batch)); }, StateChangeFilter{});
+        scc.subscribe([&](StateChangeBatchPtr batch) { batches.push_back(std::move(batch)); }, StateChangeFilter{});
+        scc.start_new_batch(kTestBlockNumber, kTestBlockHash, sample_rlp_buffers(), /*unwind=*/false);
+        scc.change_account(kTestAddress, kTestIncarnation, kTestData1);
+        scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
+        REQUIRE(batches.size() == 2);
+        CHECK(batches[0] == batches[1]);
+
+        grpc::ByteBuffer serialized{batches[0]->serialized()};
+        remote::StateChangeBatch deserialized;
+        REQUIRE(grpc::SerializationTraits<remote::StateChangeBatch>::Deserialize(&serialized, &deserialized).ok());
+        CHECK(deserialized.SerializeAsString() == batches[0]->message().SerializeAsString());
+
+        // The notified batch is not affected by the next one
+        scc.start_new_batch(kTestBlockNumber + 1, kTestBlockHash, {}, /*unwind=*/false);
+        scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
+        REQUIRE(batches.size() == 4);
+        CHECK(batches[0]->message().change_batch(0).block_height() == kTestBlockNumber);
+        CHECK(batches[2]->message().change_batch(0).block_height() == kTestBlockNumber + 1);
+    }
+
+    SECTION("OK: memory stays bounded w/o consumers") {
+        class TestableStateChangeCollection : public StateChangeCollection {
+          public:
+            using StateChangeCollection::arena_space_used;
+        };
+        TestableStateChangeCollection collection;
+
+        const auto notify_sample_batch = [&](BlockNum block_number) {
+            collection.start_new_batch(block_number, kTestBlockHash, sample_rlp_buffers(), /*unwind=*/false);
+            collection.change_account(kTestAddress, kTestIncarnation, kTestData1);
+            collection.change_storage(kTestAddress, kTestIncarnation, kTestHashedLocation1, kTestData1);
+            collection.notify_batch(kTestPendingBaseFee, kTestGasLimit);
+        };
+
+        notify_sample_batch(kTestBlockNumber);
+        const auto space_used{collection.arena_space_used()};
+        for (BlockNum i{1}; i <= 1'000; ++i) {
+            notify_sample_batch(kTestBlockNumber + i);
+            CHECK(collection.arena_space_used() <= space_used);
+        }
+    }
+
+    SECTION("OK: notifies close to consumers") {
+        std::vector<StateChangeBatchPtr> batches;
+        scc.subscribe([&](StateChangeBatchPtr batch) { batches.push_back(std::move(batch)); }, StateChangeFilter{});
+        scc.close();
+        REQUIRE(batches.size() == 1);
+        CHECK(batches[0] == nullptr);
+    }
 }
 
 TEST_CASE("StateChangeCollection::reset", "[silkworm][rpc][state_change_collection]") {
@@ -142,15 +197,15 @@ TEST_CASE("StateChangeCollection::reset", "[silkworm][rpc][state_change_collecti
 
     SECTION("OK: notifies batch w/o changes with expected transaction ID") {
         REQUIRE(scc.tx_id() == 0);
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->state_version_id() == scc.tx_id());
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().state_version_id() == scc.tx_id());
         },
                       StateChangeFilter{});
         scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
         scc.reset(kTestDatabaseViewId);
         CHECK(scc.tx_id() == kTestDatabaseViewId);
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->state_version_id() == scc.tx_id());
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().state_version_id() == scc.tx_id());
         },
                       StateChangeFilter{});
         scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
@@ -162,12 +217,12 @@ TEST_CASE("StateChangeCollection::start_new_batch", "[silkworm][rpc][state_chang
 
     SECTION("OK: one new batch in FORWARD direction") {
         scc.start_new_batch(kTestBlockNumber, kTestBlockHash, std::vector<silkworm::Bytes>{}, /*unwind=*/false);
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->state_version_id() == 0);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().state_version_id() == 0);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
@@ -178,20 +233,20 @@ TEST_CASE("StateChangeCollection::start_new_batch", "[silkworm][rpc][state_chang
 
     SECTION("OK: two new batches in FORWARD and UNWIND directions") {
         scc.start_new_batch(kTestBlockNumber, kTestBlockHash, sample_rlp_buffers(), /*unwind=*/false);
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
             static int notifications{0};
             if (notifications == 0) {
-                CHECK(batch->state_version_id() == 0);
+                CHECK(batch->message().state_version_id() == 0);
                 CHECK(state_change.direction() == remote::Direction::FORWARD);
             } else if (notifications == 1) {
-                CHECK(batch->state_version_id() == kTestDatabaseViewId);
+                CHECK(batch->message().state_version_id() == kTestDatabaseViewId);
                 CHECK(state_change.direction() == remote::Direction::UNWIND);
             } else {
                 CHECK(false);  // too many notifications
@@ -210,15 +265,15 @@ TEST_CASE("StateChangeCollection::change_account", "[silkworm][rpc][state_change
     StateChangeCollection scc;
 
     SECTION("OK: change one account once") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
-            CHECK(batch->state_version_id() == 0);
+            CHECK(batch->message().state_version_id() == 0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.changes_size() == 1);
             const remote::AccountChange& account_change = state_change.changes(0);
@@ -236,15 +291,15 @@ TEST_CASE("StateChangeCollection::change_account", "[silkworm][rpc][state_change
     }
 
     SECTION("OK: change one account twice") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
-            CHECK(batch->state_version_id() == 0);
+            CHECK(batch->message().state_version_id() == 0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.changes_size() == 2);
             const remote::AccountChange& account_change0 = state_change.changes(0);
@@ -270,15 +325,15 @@ TEST_CASE("StateChangeCollection::change_account", "[silkworm][rpc][state_change
     }
 
     SECTION("OK: change account after changing code") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
-            CHECK(batch->state_version_id() == 0);
+            CHECK(batch->message().state_version_id() == 0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.changes_size() == 1);
             const remote::AccountChange& account_change = state_change.changes(0);
@@ -301,15 +356,15 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     StateChangeCollection scc;
 
     SECTION("OK: change code of one account once") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
-            CHECK(batch->state_version_id() == 0);
+            CHECK(batch->message().state_version_id() == 0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.changes_size() == 1);
             const remote::AccountChange& account_change = state_change.changes(0);
@@ -327,15 +382,15 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     }
 
     SECTION("OK: change code of one account twice") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
-            CHECK(batch->state_version_id() == 0);
+            CHECK(batch->message().state_version_id() == 0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.changes_size() == 2);
             const remote::AccountChange& account_change0 = state_change.changes(0);
@@ -361,15 +416,15 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     }
 
     SECTION("OK: change code after changing storage in new incarnation") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
-            CHECK(batch->state_version_id() == 0);
+            CHECK(batch->message().state_version_id() == 0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.changes_size() == 2);
             const remote::AccountChange& account_change0 = state_change.changes(0);
@@ -398,15 +453,15 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     }
 
     SECTION("OK: change code after changing storage in same incarnation") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
-            CHECK(batch->state_version_id() == 0);
+            CHECK(batch->message().state_version_id() == 0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.changes_size() == 1);
             const remote::AccountChange& account_change0 = state_change.changes(0);
@@ -428,15 +483,15 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     }
 
     SECTION("OK: change code after changing account in new incarnation") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
-            CHECK(batch->state_version_id() == 0);
+            CHECK(batch->message().state_version_id() == 0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.changes_size() == 2);
             const remote::AccountChange& account_change0 = state_change.changes(0);
@@ -463,15 +518,15 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     }
 
     SECTION("OK: change code after changing account in same incarnation") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
-            CHECK(batch->state_version_id() == 0);
+            CHECK(batch->message().state_version_id() == 0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.changes_size() == 1);
             const remote::AccountChange& account_change0 = state_change.changes(0);
@@ -495,15 +550,15 @@ TEST_CASE("StateChangeCollection::change_storage", "[silkworm][rpc][state_change
     StateChangeCollection scc;
 
     SECTION("OK: change storage of one account once") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
-            CHECK(batch->state_version_id() == 0);
+            CHECK(batch->message().state_version_id() == 0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.changes_size() == 1);
             const remote::AccountChange& account_change = state_change.changes(0);
@@ -524,15 +579,15 @@ TEST_CASE("StateChangeCollection::change_storage", "[silkworm][rpc][state_change
     }
 
     SECTION("OK: change storage of one account twice") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
             CHECK(state_change.txs_size() == 2);
-            CHECK(batch->state_version_id() == 0);
+            CHECK(batch->message().state_version_id() == 0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.changes_size() == 2);
             const remote::AccountChange& account_change0 = state_change.changes(0);
@@ -568,12 +623,12 @@ TEST_CASE("StateChangeCollection::delete_account", "[silkworm][rpc][state_change
     StateChangeCollection scc;
 
     SECTION("OK: delete one account once in forward direction") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
-            CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
-            CHECK(batch->block_gas_limit() == kTestGasLimit);
-            CHECK(batch->state_version_id() == 0);
-            CHECK(batch->change_batch_size() == 1);
-            const remote::StateChange& state_change = batch->change_batch(0);
+        scc.subscribe([&](StateChangeBatchPtr batch) {
+            CHECK(batch->message().pending_block_base_fee() == kTestPendingBaseFee);
+            CHECK(batch->message().block_gas_limit() == kTestGasLimit);
+            CHECK(batch->message().state_version_id() == 0);
+            CHECK(batch->message().change_batch_size() == 1);
+            const remote::StateChange& state_change = batch->message().change_batch(0);
             CHECK(state_change.direction() == remote::Direction::FORWARD);
             CHECK(state_change.block_height() == kTestBlockNumber);
             CHECK(bytes32_from_H256(state_change.block_hash()) == kTestBlockHash);
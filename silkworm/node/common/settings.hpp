@@ -52,6 +52,7 @@ struct NodeSettings {
     uint32_t sync_loop_log_interval_seconds{30};           // Interval for sync loop to emit logs
     std::string node_name;                                 // The node identifying name
     bool parallel_fork_tracking_enabled{false};            // Whether to track multiple parallel forks at head
+    uint32_t execution_prefetch_workers{4};                // Number of threads prefetching state for execution
 };
 
 }  // namespace silkworm
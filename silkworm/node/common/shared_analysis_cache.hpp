@@ -0,0 +1,33 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+#include <silkworm/core/execution/evm.hpp>
+
+namespace silkworm {
+
+//! Max number of code analyses kept in the process-wide cache
+inline constexpr size_t kSharedAnalysisCacheSize{32'000};
+
+//! \brief Process-wide thread-safe cache of EVM code analyses keyed by code hash
+//! \details The same instance is shared by Execution stage (including the pipelines of extending forks), C API block
+//! execution and RPC daemon, so that analyses of hot contracts survive across batches, forward cycles and requests
+AnalysisCache& shared_analysis_cache();
+
+}  // namespace silkworm
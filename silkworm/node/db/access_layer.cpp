@@ -21,6 +21,7 @@
 
 #include <silkworm/core/common/assert.hpp>
 #include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/rlp/decode_vector.hpp>
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/infra/common/decoding_exception.hpp>
 #include <silkworm/infra/common/ensure.hpp>
@@ -465,6 +466,45 @@ bool read_rlp_transactions(ROTxn& txn, BlockNum block_number, const evmc::bytes3
     return true;
 }
 
+void for_each_transaction_view(ROTxn& txn, uint64_t base_id, uint64_t count, const TransactionViewWalker& walker) {
+    if (count == 0) {
+        return;
+    }
+
+    const auto key{db::block_key(base_id)};
+    auto cursor = txn.ro_cursor(table::kBlockTransactions);
+    TransactionView txn_view;
+    uint64_t i{0};
+    for (auto data{cursor->find(to_slice(key), false)}; data.done && i < count;
+         data = cursor->to_next(/*throw_notfound = */ false), ++i) {
+        ByteView data_view{from_slice(data.value)};
+        success_or_throw(rlp::decode(data_view, txn_view));
+        if (!walker(txn_view)) {
+            return;
+        }
+    }
+    SILKWORM_ASSERT(i == count);
+}
+
+bool for_each_transaction_view(ROTxn& txn, BlockNum block_number, const evmc::bytes32& hash, const TransactionViewWalker& walker) {
+    const auto key{block_key(block_number, hash.bytes)};
+    auto cursor = txn.ro_cursor(table::kBlockBodies);
+    const auto data{cursor->find(to_slice(key), false)};
+    if (!data) return false;
+
+    // Just decode the transaction range, skipping ommers and withdrawals
+    ByteView data_view{from_slice(data.value)};
+    const auto header{rlp::decode_header(data_view)};
+    success_or_throw(header);
+    ensure(header->list, "unexpected body encoding for key=" + std::to_string(block_number));
+    uint64_t base_txn_id{0}, txn_count{0};
+    success_or_throw(rlp::decode_items(data_view, base_txn_id, txn_count));
+    ensure(txn_count > 1, "unexpected txn_count=" + std::to_string(txn_count) + " for key=" + std::to_string(block_number));
+    for_each_transaction_view(txn, base_txn_id + 1, txn_count - 2, walker);
+
+    return true;
+}
+
 bool read_body(ROTxn& txn, const evmc::bytes32& h, BlockBody& body) {
     auto block_num = read_block_number(txn, h);
     if (!block_num) {
@@ -969,6 +1009,17 @@ void DataModel::set_snapshot_repository(snapshot::SnapshotRepository* repository
     repository_ = repository;
 }
 
+void DataModel::reset_snapshot_repository() {
+    repository_ = nullptr;
+}
+
+BlockNum DataModel::highest_frozen_block_number() {
+    if (!repository_ || repository_->tx_snapshots_count() == 0) {
+        return 0;
+    }
+    return repository_->max_block_available();
+}
+
 DataModel::DataModel(ROTxn& txn) : txn_{txn} {}
 
 std::optional<ChainConfig> DataModel::read_chain_config() const {
@@ -1007,11 +1058,7 @@ std::optional<BlockHeader> DataModel::read_header(BlockNum block_number, HashAsA
 
 std::optional<BlockHeader> DataModel::read_header(BlockNum block_number, const Hash& block_hash) const {
     if (repository_ && block_number <= repository_->max_block_available()) {
-        auto header = read_header_from_snapshot(block_number);
-        if (header && header->hash() == block_hash) {  // reading using hash avoid this heavy hash calculation
-            return header;
-        }
-        return {};
+        return read_header_from_snapshot(block_number, block_hash);
     } else {
         return db::read_header(txn_, block_number, block_hash);
     }
@@ -1066,7 +1113,11 @@ std::vector<BlockHeader> DataModel::read_sibling_headers(BlockNum block_number)
 }
 
 bool DataModel::read_body(BlockNum height, HashAsArray hash, bool read_senders, BlockBody& body) const {
-    // Assume recent blocks are more probable: first lookup the block body in the db
+    if (read_header_from_snapshot(height, Hash{ByteView{hash, kHashLength}})) {
+        return read_body_from_snapshot(height, read_senders, body);
+    }
+
+    // Otherwise assume recent blocks are more probable: first lookup the block body in the db
     const bool found = db::read_body(txn_, height, hash, read_senders, body);
     if (found) return found;
 
@@ -1127,6 +1178,11 @@ bool DataModel::has_body(BlockNum height, const Hash& hash) const {
 }
 
 bool DataModel::read_block(HashAsSpan hash, BlockNum height, bool read_senders, Block& block) const {
+    if (auto header{read_header_from_snapshot(height, Hash{ByteView{hash.data(), hash.size()}})}) {
+        block.header = std::move(*header);
+        return read_body_from_snapshot(height, read_senders, block);
+    }
+
     const bool found = db::read_block(txn_, hash, height, read_senders, block);
     if (found) return found;
 
@@ -1134,6 +1190,11 @@ bool DataModel::read_block(HashAsSpan hash, BlockNum height, bool read_senders,
 }
 
 bool DataModel::read_block(const evmc::bytes32& hash, BlockNum height, Block& block) const {
+    if (auto header{read_header_from_snapshot(height, Hash{ByteView{hash.bytes, kHashLength}})}) {
+        block.header = std::move(*header);
+        return read_body_from_snapshot(height, /*read_senders=*/true, block);
+    }
+
     const bool found = db::read_block(txn_, hash, height, block);
     if (found) return found;
 
@@ -1184,6 +1245,11 @@ void DataModel::for_last_n_headers(size_t n, std::function<void(BlockHeader&&)>
 }
 
 bool DataModel::read_block(BlockNum number, bool read_senders, Block& block) const {
+    // Frozen blocks are read directly from snapshots, their canonical hashes may be missing in the db
+    if (repository_ && number <= repository_->max_block_available()) {
+        return read_block_from_snapshot(number, read_senders, block);
+    }
+
     const auto hash{db::read_canonical_hash(txn_, number)};
     if (!hash) {
         return false;
@@ -1218,6 +1284,19 @@ std::optional<BlockHeader> DataModel::read_header_from_snapshot(BlockNum height)
     return block_header;
 }
 
+std::optional<BlockHeader> DataModel::read_header_from_snapshot(BlockNum height, const Hash& hash) {
+    if (!repository_ || height > repository_->max_block_available()) {
+        return {};
+    }
+
+    // Snapshots contain just canonical blocks: any other block at the same height is not frozen
+    auto block_header{read_header_from_snapshot(height)};
+    if (block_header && block_header->hash() != hash) {
+        block_header.reset();
+    }
+    return block_header;
+}
+
 std::optional<BlockHeader> DataModel::read_header_from_snapshot(const Hash& hash) {
     if (!repository_) {
         return {};
@@ -1312,12 +1391,52 @@ bool DataModel::read_rlp_transactions_from_snapshot(BlockNum height, std::vector
 }
 
 bool DataModel::read_rlp_transactions(BlockNum height, const evmc::bytes32& hash, std::vector<Bytes>& transactions) const {
+    if (read_header_from_snapshot(height, Hash{ByteView{hash.bytes, kHashLength}})) {
+        return read_rlp_transactions_from_snapshot(height, transactions);
+    }
+
     bool found = db::read_rlp_transactions(txn_, height, hash, transactions);
     if (found) return true;
 
     return read_rlp_transactions_from_snapshot(height, transactions);
 }
 
+bool DataModel::for_each_transaction_view_from_snapshot(BlockNum height, const TransactionViewWalker& walker) {
+    if (!repository_) {
+        return false;
+    }
+
+    const auto body_snapshot = repository_->find_body_segment(height);
+    if (!body_snapshot) return false;
+
+    auto stored_body = body_snapshot->body_by_number(height);
+    if (!stored_body) return false;
+
+    // Skip first and last *system transactions* in block body
+    const auto base_txn_id{stored_body->base_txn_id + 1};
+    const auto txn_count{stored_body->txn_count >= 2 ? stored_body->txn_count - 2 : stored_body->txn_count};
+
+    if (txn_count == 0) return true;
+
+    const auto tx_snapshot = repository_->find_tx_segment(height);
+    if (!tx_snapshot) return false;
+
+    tx_snapshot->for_each_txn_view(base_txn_id, txn_count, walker);
+
+    return true;
+}
+
+bool DataModel::for_each_transaction_view(BlockNum height, const evmc::bytes32& hash, const TransactionViewWalker& walker) const {
+    if (read_header_from_snapshot(height, Hash{ByteView{hash.bytes, kHashLength}})) {
+        return for_each_transaction_view_from_snapshot(height, walker);
+    }
+
+    bool found = db::for_each_transaction_view(txn_, height, hash, walker);
+    if (found) return true;
+
+    return for_each_transaction_view_from_snapshot(height, walker);
+}
+
 std::optional<BlockNum> DataModel::read_tx_lookup(const evmc::bytes32& tx_hash) const {
     auto block_num = read_tx_lookup_from_db(tx_hash);
     if (block_num) {
@@ -30,6 +30,7 @@
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/core/types/hash.hpp>
 #include <silkworm/core/types/receipt.hpp>
+#include <silkworm/core/types/transaction_view.hpp>
 #include <silkworm/node/db/mdbx.hpp>
 #include <silkworm/node/db/util.hpp>
 #include <silkworm/node/snapshot/repository.hpp>
@@ -157,6 +158,17 @@ void read_transactions(ROCursor& txn_table, uint64_t base_id, uint64_t count, st
 
 bool read_rlp_transactions(ROTxn& txn, BlockNum height, const evmc::bytes32& hash, std::vector<Bytes>& out);
 
+//! \brief Visitor of transactions decoded as views, returning false to stop the iteration
+//! \remarks Any transaction view is valid only within the visitor invocation
+using TransactionViewWalker = std::function<bool(const TransactionView&)>;
+
+//! \brief Visit count transactions starting at base_id without copying them out of db pages
+void for_each_transaction_view(ROTxn& txn, uint64_t base_id, uint64_t count, const TransactionViewWalker& walker);
+
+//! \brief Visit the transactions of the block body identified by height and hash without copying them out of db pages
+//! \return false if the block body is not found, true otherwise
+bool for_each_transaction_view(ROTxn& txn, BlockNum height, const evmc::bytes32& hash, const TransactionViewWalker& walker);
+
 //! \brief Persist transactions into db's bucket table::kBlockTransactions.
 //! The key starts from base_id and is incremented by 1 for each transaction.
 //! \remarks Before calling this ensure you got a proper base_id by incrementing sequence for table::kBlockTransactions.
@@ -248,6 +260,16 @@ class DataModel {
   public:
     static void set_snapshot_repository(snapshot::SnapshotRepository* repository);
 
+    //! Detach the snapshot repository, so that only the db is accessed from now on
+    static void reset_snapshot_repository();
+
+    //! Get the highest block number whose headers, bodies and transactions are all in indexed snapshots (0 if none)
+    static BlockNum highest_frozen_block_number();
+
+    //! Read the block at specified height from snapshots only, returning false if not frozen
+    //! \remarks No db txn is involved, so it can be called from any thread
+    static bool read_block_from_snapshot(BlockNum height, bool read_senders, Block& block);
+
     explicit DataModel(db::ROTxn& txn);
     ~DataModel() = default;
 
@@ -311,6 +333,9 @@ class DataModel {
     //! Read the RLP encoded block transactions at specified height
     [[nodiscard]] bool read_rlp_transactions(BlockNum height, const evmc::bytes32& hash, std::vector<Bytes>& rlp_txs) const;
 
+    //! Visit the block transactions at specified height as views, returning false on missing block body
+    [[nodiscard]] bool for_each_transaction_view(BlockNum height, const evmc::bytes32& hash, const TransactionViewWalker& walker) const;
+
     [[nodiscard]] std::optional<BlockNum> read_tx_lookup(const evmc::bytes32& tx_hash) const;
 
     //! Read total difficulty at specified height
@@ -322,12 +347,15 @@ class DataModel {
     void for_last_n_headers(size_t n, std::function<void(BlockHeader&&)> callback) const;
 
   private:
-    static bool read_block_from_snapshot(BlockNum height, bool read_senders, Block& block);
     static std::optional<BlockHeader> read_header_from_snapshot(BlockNum height);
     static std::optional<BlockHeader> read_header_from_snapshot(const Hash& hash);
+    //! Read the header of the frozen block at specified height having the given hash, if any
+    //! \remarks Readers by height and hash use it to serve frozen blocks from snapshots, skipping the db lookup
+    static std::optional<BlockHeader> read_header_from_snapshot(BlockNum height, const Hash& hash);
     static bool read_body_from_snapshot(BlockNum height, bool read_senders, BlockBody& body);
     static bool is_body_in_snapshot(BlockNum height);
     static bool read_rlp_transactions_from_snapshot(BlockNum height, std::vector<Bytes>& rlp_txs);
+    static bool for_each_transaction_view_from_snapshot(BlockNum height, const TransactionViewWalker& walker);
     static bool read_transactions_from_snapshot(BlockNum height, uint64_t base_txn_id, uint64_t txn_count,
                                                 bool read_senders, std::vector<Transaction>& txs);
     [[nodiscard]] std::optional<BlockNum> read_tx_lookup_from_db(const evmc::bytes32& tx_hash) const;
@@ -32,6 +32,7 @@
 #include <silkworm/node/stagedsync/stages/stage.hpp>
 #include <silkworm/node/stagedsync/stages/stage_history_index.hpp>
 #include <silkworm/node/test/context.hpp>
+#include <silkworm/node/test/snapshots.hpp>
 
 namespace silkworm {
 
@@ -949,4 +950,79 @@ TEST_CASE("write and read body w/ withdrawals", "[silkworm][node][db][access_lay
     CHECK(body_out == body_in);
 }
 
+// https://etherscan.io/block/1500013
+TEST_CASE("DataModel serves frozen blocks from snapshots", "[silkworm][node][db][access_layer]") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    test::SampleSnapshotRepository snapshots;
+    test::Context context;
+    auto& txn{context.rw_txn()};
+
+    const BlockNum frozen_block_num{1'500'013};
+    const auto frozen_block_hash{0xbef48d7de01f2d7ea1a7e4d1ed401f73d6d0257a364f6770b25ba51a123ac35f_bytes32};
+    REQUIRE(frozen_block_num <= DataModel::highest_frozen_block_number());
+
+    // Store in db a different body for the frozen block: it must never be read because db lookup is skipped
+    BlockBody db_body{sample_block_body()};
+    CHECK_NOTHROW(write_body(txn, db_body, frozen_block_hash.bytes, frozen_block_num));
+
+    // Store in db a body for a non-canonical block at the same height, which is not frozen
+    BlockHeader fork_header;
+    fork_header.number = frozen_block_num;
+    fork_header.beneficiary = 0x09ab1303d3ccaf5f018cd511146b07a240c70294_address;
+    const auto fork_block_hash{fork_header.hash()};
+    CHECK_NOTHROW(write_header(txn, fork_header));
+    CHECK_NOTHROW(write_body(txn, db_body, fork_block_hash.bytes, frozen_block_num));
+
+    DataModel model{txn};
+
+    SECTION("read_body") {
+        BlockBody body;
+        REQUIRE(model.read_body(frozen_block_num, frozen_block_hash.bytes, /*read_senders=*/false, body));
+        CHECK(body.transactions.size() == 1);
+        CHECK(body.ommers.empty());
+
+        BlockBody fork_body;
+        REQUIRE(model.read_body(frozen_block_num, fork_block_hash.bytes, /*read_senders=*/false, fork_body));
+        CHECK(fork_body.transactions.size() == db_body.transactions.size());
+    }
+
+    SECTION("read_block") {
+        Block block;
+        REQUIRE(model.read_block(frozen_block_hash.bytes, frozen_block_num, /*read_senders=*/false, block));
+        CHECK(block.header.number == frozen_block_num);
+        CHECK(block.header.hash() == frozen_block_hash);
+        CHECK(block.header.gas_used == 21'000);
+        CHECK(block.transactions.size() == 1);
+
+        Block fork_block;
+        REQUIRE(model.read_block(fork_block_hash.bytes, frozen_block_num, /*read_senders=*/false, fork_block));
+        CHECK(fork_block.header.hash() == fork_block_hash);
+        CHECK(fork_block.transactions.size() == db_body.transactions.size());
+    }
+
+    SECTION("read_rlp_transactions") {
+        std::vector<Bytes> rlp_transactions;
+        REQUIRE(model.read_rlp_transactions(frozen_block_num, frozen_block_hash, rlp_transactions));
+        CHECK(rlp_transactions.size() == 1);
+
+        std::vector<Bytes> fork_rlp_transactions;
+        REQUIRE(model.read_rlp_transactions(frozen_block_num, fork_block_hash, fork_rlp_transactions));
+        CHECK(fork_rlp_transactions.size() == db_body.transactions.size());
+    }
+
+    SECTION("for_each_transaction_view") {
+        size_t count{0};
+        const auto walker = [&](const TransactionView&) {
+            ++count;
+            return true;
+        };
+        REQUIRE(model.for_each_transaction_view(frozen_block_num, frozen_block_hash, walker));
+        CHECK(count == 1);
+
+        count = 0;
+        REQUIRE(model.for_each_transaction_view(frozen_block_num, fork_block_hash, walker));
+        CHECK(count == db_body.transactions.size());
+    }
+}
+
 }  // namespace silkworm::db
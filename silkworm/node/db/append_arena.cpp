@@ -0,0 +1,66 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "append_arena.hpp"
+
+#include <algorithm>
+
+#include <silkworm/node/db/util.hpp>
+
+namespace silkworm::db {
+
+void AppendArena::add_entry(size_t offset, size_t key_length) {
+    Entry entry{
+        .offset = offset,
+        .key_length = static_cast<uint32_t>(key_length),
+        .value_length = static_cast<uint32_t>(data_.size() - offset - key_length),
+    };
+    if (sorted_ && !entries_.empty() && key(entries_.back()) >= key(entry)) {
+        sorted_ = false;
+    }
+    entries_.push_back(entry);
+}
+
+size_t AppendArena::flush(::mdbx::cursor& cursor) {
+    if (!sorted_) {
+        // Sort by key keeping insertion order among duplicates, then retain just the last value for each key
+        std::stable_sort(entries_.begin(), entries_.end(), [&](const Entry& lhs, const Entry& rhs) {
+            return key(lhs) < key(rhs);
+        });
+        auto last_by_key{[&](const Entry& lhs, const Entry& rhs) { return key(lhs) == key(rhs); }};
+        std::reverse(entries_.begin(), entries_.end());
+        entries_.erase(std::unique(entries_.begin(), entries_.end(), last_by_key), entries_.end());
+        std::reverse(entries_.begin(), entries_.end());
+    }
+
+    size_t written_size{0};
+    for (const auto& entry : entries_) {
+        auto k{to_slice(key(entry))};
+        auto v{to_slice(value(entry))};
+        ::mdbx::error::success_or_throw(cursor.put(k, &v, MDBX_APPEND));
+        written_size += k.length() + v.length();
+    }
+    clear();
+    return written_size;
+}
+
+void AppendArena::clear() noexcept {
+    data_.clear();
+    entries_.clear();
+    sorted_ = true;
+}
+
+}  // namespace silkworm::db
@@ -0,0 +1,91 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <silkworm/core/common/bytes.hpp>
+#include <silkworm/node/db/mdbx.hpp>
+
+namespace silkworm::db {
+
+//! \brief AppendArena is an append-only in-memory collection of key/value pairs destined to a single table.
+//! \details Keys and values are stored back-to-back in one growable buffer, so no allocation per item is needed and
+//! values can be encoded in place. Entries are expected to be appended in ascending key order (e.g. keys prefixed by
+//! monotonic block number) and get flushed using MDBX_APPEND: if this is not the case, they get sorted on flush
+//! and only the last value appended for each key is kept.
+class AppendArena {
+  public:
+    AppendArena() = default;
+
+    // Not copyable nor movable
+    AppendArena(const AppendArena&) = delete;
+    AppendArena& operator=(const AppendArena&) = delete;
+
+    //! \brief Appends a new entry whose value is written directly into the arena by the provided encoder
+    //! \param key: the entry key
+    //! \param encode_value: callable accepting the arena buffer as Bytes& and *appending* the encoded value to it
+    //! \return the number of bytes added to the arena
+    template <typename Encoder>
+    size_t append(ByteView key, Encoder&& encode_value) {
+        const size_t offset{data_.size()};
+        data_.append(key);
+        std::forward<Encoder>(encode_value)(data_);
+        add_entry(offset, key.size());
+        return data_.size() - offset;
+    }
+
+    //! \brief Appends a new entry with the given key and value
+    size_t append(ByteView key, ByteView value) {
+        return append(key, [&](Bytes& out) { out.append(value); });
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+    [[nodiscard]] size_t size() const noexcept { return entries_.size(); }
+    [[nodiscard]] size_t size_bytes() const noexcept { return data_.size(); }
+
+    //! \brief Writes all the entries into the table pointed by cursor using MDBX_APPEND, then clears the arena
+    //! \return the number of bytes written
+    size_t flush(::mdbx::cursor& cursor);
+
+    //! \brief Discards all the entries keeping the allocated memory for reuse
+    void clear() noexcept;
+
+  private:
+    struct Entry {
+        size_t offset;
+        uint32_t key_length;
+        uint32_t value_length;
+    };
+
+    [[nodiscard]] ByteView key(const Entry& entry) const noexcept {
+        return {data_.data() + entry.offset, entry.key_length};
+    }
+    [[nodiscard]] ByteView value(const Entry& entry) const noexcept {
+        return {data_.data() + entry.offset + entry.key_length, entry.value_length};
+    }
+
+    void add_entry(size_t offset, size_t key_length);
+
+    Bytes data_;
+    std::vector<Entry> entries_;
+    bool sorted_{true};
+};
+
+}  // namespace silkworm::db
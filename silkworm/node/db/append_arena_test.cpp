@@ -0,0 +1,84 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "append_arena.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/node/test/context.hpp>
+
+namespace silkworm::db {
+
+static std::vector<std::pair<Bytes, Bytes>> read_all(RWTxn& txn, const MapConfig& map_config) {
+    std::vector<std::pair<Bytes, Bytes>> entries;
+    auto cursor{txn.ro_cursor(map_config)};
+    for (auto data{cursor->to_first(/*throw_notfound=*/false)}; data; data = cursor->to_next(false)) {
+        entries.emplace_back(Bytes{from_slice(data.key)}, Bytes{from_slice(data.value)});
+    }
+    return entries;
+}
+
+TEST_CASE("AppendArena", "[silkworm][node][db][append_arena]") {
+    test::Context context;
+    auto& txn{context.rw_txn()};
+
+    AppendArena arena;
+    CHECK(arena.empty());
+
+    SECTION("ordered keys") {
+        CHECK(arena.append(block_key(1), *from_hex("0a0b")) == 10);
+        CHECK(arena.append(block_key(2), [](Bytes& out) { out.append(*from_hex("0c")); }) == 9);
+        CHECK(arena.size() == 2);
+        CHECK(arena.size_bytes() == 19);
+
+        auto cursor{open_cursor(txn, table::kBlockReceipts)};
+        CHECK(arena.flush(cursor) == 19);
+        CHECK(arena.empty());
+        CHECK(arena.size_bytes() == 0);
+
+        const auto entries{read_all(txn, table::kBlockReceipts)};
+        REQUIRE(entries.size() == 2);
+        CHECK(entries[0] == std::make_pair(block_key(1), *from_hex("0a0b")));
+        CHECK(entries[1] == std::make_pair(block_key(2), *from_hex("0c")));
+    }
+
+    SECTION("unordered and duplicate keys") {
+        arena.append(block_key(3), *from_hex("03"));
+        arena.append(block_key(1), *from_hex("01"));
+        arena.append(block_key(3), *from_hex("33"));
+        arena.append(block_key(2), *from_hex("02"));
+
+        auto cursor{open_cursor(txn, table::kBlockReceipts)};
+        arena.flush(cursor);
+
+        const auto entries{read_all(txn, table::kBlockReceipts)};
+        REQUIRE(entries.size() == 3);
+        CHECK(entries[0] == std::make_pair(block_key(1), *from_hex("01")));
+        CHECK(entries[1] == std::make_pair(block_key(2), *from_hex("02")));
+        CHECK(entries[2] == std::make_pair(block_key(3), *from_hex("33")));
+    }
+
+    SECTION("clear") {
+        arena.append(block_key(1), *from_hex("01"));
+        arena.clear();
+        CHECK(arena.empty());
+        CHECK(arena.size_bytes() == 0);
+    }
+}
+
+}  // namespace silkworm::db
@@ -0,0 +1,91 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_prefetcher.hpp"
+
+#include <utility>
+
+#include <silkworm/core/common/assert.hpp>
+
+namespace silkworm::db {
+
+BlockPrefetcher::BlockPrefetcher(BlockNum from, BlockNum to, BlockReader reader, size_t capacity)
+    : from_{from}, to_{to}, reader_{std::move(reader)}, capacity_{capacity} {
+    SILKWORM_ASSERT(capacity_ > 0);
+    thread_ = std::thread{[this]() { run(); }};
+}
+
+BlockPrefetcher::~BlockPrefetcher() {
+    {
+        std::scoped_lock lock{mutex_};
+        stopped_ = true;
+    }
+    not_full_.notify_one();
+    thread_.join();
+}
+
+bool BlockPrefetcher::next(Block& block) {
+    std::unique_lock lock{mutex_};
+    not_empty_.wait(lock, [&] { return !blocks_.empty() || done_; });
+    if (blocks_.empty()) {
+        if (error_) {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+        return false;
+    }
+    block = std::move(blocks_.front());
+    blocks_.pop_front();
+    lock.unlock();
+    not_full_.notify_one();
+    return true;
+}
+
+size_t BlockPrefetcher::size() const {
+    std::scoped_lock lock{mutex_};
+    return blocks_.size();
+}
+
+void BlockPrefetcher::run() {
+    try {
+        for (BlockNum block_number{from_}; block_number <= to_; ++block_number) {
+            // Decode outside the lock, so that the consumer can pop meanwhile
+            Block block;
+            if (!reader_(block_number, block)) {
+                break;
+            }
+
+            std::unique_lock lock{mutex_};
+            not_full_.wait(lock, [&] { return blocks_.size() < capacity_ || stopped_; });
+            if (stopped_) {
+                return;
+            }
+            blocks_.push_back(std::move(block));
+            lock.unlock();
+            not_empty_.notify_one();
+        }
+    } catch (...) {
+        std::scoped_lock lock{mutex_};
+        error_ = std::current_exception();
+    }
+
+    {
+        std::scoped_lock lock{mutex_};
+        done_ = true;
+    }
+    not_empty_.notify_one();
+}
+
+}  // namespace silkworm::db
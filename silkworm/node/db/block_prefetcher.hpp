@@ -0,0 +1,79 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/types/block.hpp>
+
+namespace silkworm::db {
+
+//! \brief BlockPrefetcher reads a range of blocks ahead of their consumer using one background thread, keeping at most
+//! capacity decoded blocks in a bounded queue, so that the consumer (e.g. execution) never waits on block decoding
+//! unless it is faster than reading.
+//! \remarks The block reader is invoked on the background thread, hence it must not use any db txn bound to the
+//! consumer thread: it is meant for sources like snapshots, which can be read from any thread
+class BlockPrefetcher {
+  public:
+    //! Read the block having the given number, return false if not found
+    using BlockReader = std::function<bool(BlockNum, Block&)>;
+
+    static constexpr size_t kDefaultCapacity{1024};
+
+    //! \brief Starts reading the blocks in [from, to] in the background
+    BlockPrefetcher(BlockNum from, BlockNum to, BlockReader reader, size_t capacity = kDefaultCapacity);
+    ~BlockPrefetcher();
+
+    // Not copyable nor movable
+    BlockPrefetcher(const BlockPrefetcher&) = delete;
+    BlockPrefetcher& operator=(const BlockPrefetcher&) = delete;
+
+    //! \brief Pops the next block in range order, waiting for it if not yet read
+    //! \return false if the range is over or the next block has not been found
+    //! \remarks Rethrows any exception thrown by the block reader
+    bool next(Block& block);
+
+    //! \brief The number of blocks read and not yet popped
+    [[nodiscard]] size_t size() const;
+
+  private:
+    void run();
+
+    const BlockNum from_;
+    const BlockNum to_;
+    BlockReader reader_;
+    const size_t capacity_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<Block> blocks_;
+    bool done_{false};     // no more blocks will be pushed
+    bool stopped_{false};  // consumer gone, background thread must exit
+    std::exception_ptr error_;
+
+    std::thread thread_;
+};
+
+}  // namespace silkworm::db
@@ -0,0 +1,95 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_prefetcher.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+namespace silkworm::db {
+
+using namespace std::chrono_literals;
+
+static bool read_fake_block(BlockNum block_number, Block& block) {
+    block.header.number = block_number;
+    return true;
+}
+
+TEST_CASE("BlockPrefetcher", "[silkworm][node][db][block_prefetcher]") {
+    SECTION("blocks popped in order") {
+        BlockPrefetcher prefetcher{10, 109, read_fake_block, /*capacity=*/8};
+        Block block;
+        for (BlockNum block_number{10}; block_number <= 109; ++block_number) {
+            REQUIRE(prefetcher.next(block));
+            CHECK(block.header.number == block_number);
+        }
+        CHECK(!prefetcher.next(block));
+    }
+
+    SECTION("empty range") {
+        BlockPrefetcher prefetcher{10, 9, read_fake_block};
+        Block block;
+        CHECK(!prefetcher.next(block));
+    }
+
+    SECTION("queue bounded by capacity") {
+        std::atomic_size_t read_count{0};
+        BlockPrefetcher prefetcher{1, 100, [&](BlockNum block_number, Block& block) {
+                                       ++read_count;
+                                       return read_fake_block(block_number, block);
+                                   },
+                                   /*capacity=*/4};
+        while (prefetcher.size() < 4) {
+            std::this_thread::sleep_for(1ms);
+        }
+        std::this_thread::sleep_for(10ms);
+        CHECK(prefetcher.size() == 4);
+        CHECK(read_count <= 5);  // the 5th block may be decoded while waiting for room
+    }
+
+    SECTION("block not found ends the range") {
+        BlockPrefetcher prefetcher{1, 100, [](BlockNum block_number, Block& block) {
+            return block_number < 3 && read_fake_block(block_number, block);
+        }};
+        Block block;
+        CHECK(prefetcher.next(block));
+        CHECK(prefetcher.next(block));
+        CHECK(!prefetcher.next(block));
+    }
+
+    SECTION("reader exception rethrown after the blocks read") {
+        BlockPrefetcher prefetcher{1, 100, [](BlockNum block_number, Block& block) {
+            if (block_number == 2) throw std::runtime_error{"decoding failed"};
+            return read_fake_block(block_number, block);
+        }};
+        Block block;
+        CHECK(prefetcher.next(block));
+        CHECK_THROWS_AS(prefetcher.next(block), std::runtime_error);
+        CHECK(!prefetcher.next(block));
+    }
+
+    SECTION("destroyed before the range is over") {
+        BlockPrefetcher prefetcher{1, 1'000'000, read_fake_block, /*capacity=*/2};
+        Block block;
+        CHECK(prefetcher.next(block));
+    }
+}
+
+}  // namespace silkworm::db
@@ -24,6 +24,7 @@
 #include <silkworm/core/common/endian.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
+#include <silkworm/infra/profiling/span_profiler.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/node/db/tables.hpp>
 #include <silkworm/node/types/log_cbor.hpp>
@@ -185,13 +186,7 @@ void Buffer::write_history_to_db(bool write_change_sets) {
 
     if (!receipts_.empty()) {
         auto receipt_table{db::open_cursor(txn_, table::kBlockReceipts)};
-        for (const auto& [block_key, receipts] : receipts_) {
-            auto k{to_slice(block_key)};
-            auto v{to_slice(receipts)};
-            mdbx::error::success_or_throw(receipt_table.put(k, &v, MDBX_APPEND));
-            written_size += k.length() + v.length();
-        }
-        receipts_.clear();
+        written_size = receipts_.flush(receipt_table);
         total_written_size += written_size;
         if (should_trace) {
             auto [_, duration]{sw.lap()};
@@ -202,13 +197,7 @@ void Buffer::write_history_to_db(bool write_change_sets) {
 
     if (!logs_.empty()) {
         auto log_table{db::open_cursor(txn_, table::kLogs)};
-        for (const auto& [log_key, value] : logs_) {
-            auto k{to_slice(log_key)};
-            auto v{to_slice(value)};
-            mdbx::error::success_or_throw(log_table.put(k, &v, MDBX_APPEND));
-            written_size += k.length() + v.length();
-        }
-        logs_.clear();
+        written_size = logs_.flush(log_table);
         total_written_size += written_size;
         if (should_trace) {
             auto [_, duration]{sw.lap()};
@@ -357,6 +346,7 @@ void Buffer::write_state_to_db() {
 }
 
 void Buffer::write_to_db(bool write_change_sets) {
+    SILKWORM_PROFILE_SPAN("Buffer", "write_to_db");
     write_history_to_db(write_change_sets);
 
     // This should be very last to be written so updated pages
@@ -366,23 +356,22 @@ void Buffer::write_to_db(bool write_change_sets) {
 
 // Erigon WriteReceipts in core/rawdb/accessors_chain.go
 void Buffer::insert_receipts(uint64_t block_number, const std::vector<Receipt>& receipts) {
+    // Keys are built on the stack and values are CBOR-encoded straight into the arenas
+    uint8_t key[sizeof(BlockNum) + sizeof(uint32_t)];
+    endian::store_big_u64(key, block_number);
+
     for (uint32_t i{0}; i < receipts.size(); ++i) {
         if (receipts[i].logs.empty()) {
             continue;
         }
 
-        Bytes key{log_key(block_number, i)};
-        Bytes value{cbor_encode(receipts[i].logs)};
-
-        if (logs_.insert_or_assign(key, value).second) {
-            batch_history_size_ += key.size() + value.size();
-        }
+        endian::store_big_u32(&key[sizeof(BlockNum)], i);
+        batch_history_size_ += logs_.append(ByteView{key, sizeof(key)},
+                                            [&](Bytes& out) { cbor_encode(receipts[i].logs, out); });
     }
 
-    Bytes key{block_key(block_number)};
-    Bytes value{cbor_encode(receipts)};
-    receipts_[key] = value;
-    batch_history_size_ += key.size() + value.size();
+    batch_history_size_ += receipts_.append(ByteView{key, sizeof(BlockNum)},
+                                            [&](Bytes& out) { cbor_encode(receipts, out); });
 }
 
 void Buffer::insert_call_traces(BlockNum block_number, const CallTraces& traces) {
@@ -479,7 +468,11 @@ std::optional<Account> Buffer::read_account(const evmc::address& address) const
     if (auto it{accounts_.find(address)}; it != accounts_.end()) {
         return it->second;
     }
-    auto db_account{db::read_account(txn_, address, historical_block_)};
+    std::optional<std::optional<Account>> prefetched;
+    if (prefetcher_ && !historical_block_) {
+        prefetched = prefetcher_->find_account(address);
+    }
+    auto db_account{prefetched ? *prefetched : db::read_account(txn_, address, historical_block_)};
     accounts_[address] = db_account;
     batch_state_size_ += kAddressLength + db_account.value_or(Account()).encoding_length_for_storage();
     return db_account;
@@ -509,7 +502,11 @@ evmc::bytes32 Buffer::read_storage(const evmc::address& address, uint64_t incarn
             }
         }
     }
-    auto db_storage{db::read_storage(txn_, address, incarnation, location, historical_block_)};
+    std::optional<evmc::bytes32> prefetched;
+    if (prefetcher_ && !historical_block_) {
+        prefetched = prefetcher_->find_storage(address, incarnation, location);
+    }
+    auto db_storage{prefetched ? *prefetched : db::read_storage(txn_, address, incarnation, location, historical_block_)};
     storage_[address][incarnation][location] = db_storage;
     batch_state_size_ += payload_length;
     return db_storage;
@@ -30,7 +30,9 @@
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/core/types/receipt.hpp>
 #include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/db/append_arena.hpp>
 #include <silkworm/node/db/mdbx.hpp>
+#include <silkworm/node/db/state_prefetcher.hpp>
 #include <silkworm/node/db/util.hpp>
 
 namespace silkworm::db {
@@ -115,6 +117,10 @@ class Buffer : public State {
         return block_storage_changes_;
     }
 
+    //! \brief Use the given prefetcher as lookaside for state reads missing in this buffer
+    //! \remarks prefetcher must outlive this buffer and must be reset whenever txn gets committed
+    void use_prefetcher(const StatePrefetcher* prefetcher) { prefetcher_ = prefetcher; }
+
     //! \brief Approximate size of accrued state in bytes.
     [[nodiscard]] size_t current_batch_state_size() const noexcept { return batch_state_size_; }
 
@@ -138,6 +144,7 @@ class Buffer : public State {
     db::DataModel access_layer_;
     uint64_t prune_history_threshold_;
     std::optional<uint64_t> historical_block_{};
+    const StatePrefetcher* prefetcher_{nullptr};
 
     absl::btree_map<Bytes, BlockHeader> headers_{};
     absl::btree_map<Bytes, BlockBody> bodies_{};
@@ -160,8 +167,8 @@ class Buffer : public State {
 
     absl::btree_map<BlockNum, AccountChanges> block_account_changes_;  // per block
     absl::btree_map<BlockNum, StorageChanges> block_storage_changes_;  // per block
-    absl::btree_map<Bytes, Bytes> receipts_;
-    absl::btree_map<Bytes, Bytes> logs_;
+    AppendArena receipts_;  // CBOR-encoded receipts keyed by block number
+    AppendArena logs_;      // CBOR-encoded logs keyed by block number and tx index
     absl::btree_map<BlockNum, absl::btree_set<Bytes>> call_traces_;
 
     mutable size_t batch_state_size_{0};    // Accounts in memory data for state
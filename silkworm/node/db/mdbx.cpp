@@ -18,6 +18,8 @@
 
 #include <stdexcept>
 
+#include <silkworm/infra/metrics/metrics.hpp>
+#include <silkworm/infra/profiling/span_profiler.hpp>
 #include <silkworm/node/db/util.hpp>
 
 namespace silkworm::db {
@@ -241,16 +243,29 @@ std::unique_ptr<RWCursorDupSort> RWTxn::rw_cursor_dup_sort(const MapConfig& conf
     return std::make_unique<PooledCursor>(*this, config);
 }
 
+// Shared by all read-write transactions, registered once at first use
+static metrics::Histogram& commit_duration() {
+    static metrics::Histogram& commit_duration{metrics::Registry::instance().histogram(
+        "silkworm_mdbx_commit_duration_seconds", "Duration of MDBX read-write transaction commits", {}, 1e-9)};
+    return commit_duration;
+}
+
 void RWTxnManaged::commit_and_renew() {
     if (!commit_disabled_) {
+        SILKWORM_PROFILE_SPAN("mdbx", "commit");
         mdbx::env env = db();
-        managed_txn_.commit();
+        {
+            metrics::ScopedTimer commit_timer{&commit_duration()};
+            managed_txn_.commit();
+        }
         managed_txn_ = env.start_write();  // renew transaction
     }
 }
 
 void RWTxnManaged::commit_and_stop() {
     if (!commit_disabled_) {
+        SILKWORM_PROFILE_SPAN("mdbx", "commit");
+        metrics::ScopedTimer commit_timer{&commit_duration()};
         managed_txn_.commit();
     }
 }
@@ -0,0 +1,150 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_prefetcher.hpp"
+
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/node/db/access_layer.hpp>
+
+namespace silkworm::db {
+
+StatePrefetcher::StatePrefetcher(mdbx::env env, uint32_t num_workers)
+    : env_{std::move(env)}, workers_{num_workers} {}
+
+StatePrefetcher::~StatePrefetcher() {
+    // Let any pending task complete as soon as possible
+    epoch_.fetch_add(1, std::memory_order_acq_rel);
+    workers_.wait_for_tasks();
+}
+
+StatePrefetcher::Shard& StatePrefetcher::shard_for(const evmc::address& address) const {
+    return shards_[std::hash<evmc::address>{}(address) % kNumShards];
+}
+
+void StatePrefetcher::schedule(const Block& block) {
+    pending_keys_.try_emplace(block.header.beneficiary);
+    for (const auto& txn : block.transactions) {
+        if (txn.from) {
+            pending_keys_.try_emplace(*txn.from);
+        }
+        if (txn.to) {
+            pending_keys_.try_emplace(*txn.to);
+        }
+        for (const auto& entry : txn.access_list) {
+            auto& locations{pending_keys_[entry.account]};
+            locations.insert(entry.storage_keys.cbegin(), entry.storage_keys.cend());
+        }
+    }
+    if (++pending_blocks_ == kBlocksPerTask) {
+        flush();
+    }
+}
+
+void StatePrefetcher::flush() {
+    pending_blocks_ = 0;
+    if (pending_keys_.empty()) return;
+
+    std::vector<AccountKeys> keys;
+    keys.reserve(pending_keys_.size());
+    for (auto& [address, locations] : pending_keys_) {
+        keys.push_back({address, {locations.cbegin(), locations.cend()}});
+    }
+    pending_keys_.clear();
+
+    const uint64_t epoch{epoch_.load(std::memory_order_acquire)};
+    workers_.push_task([this, epoch, task_keys = std::move(keys)]() mutable {
+        prefetch(std::move(task_keys), epoch);
+    });
+}
+
+void StatePrefetcher::prefetch(std::vector<AccountKeys> keys, uint64_t epoch) {
+    try {
+        ROTxnManaged txn{env_};
+        for (const auto& [address, locations] : keys) {
+            if (epoch_.load(std::memory_order_acquire) != epoch) {
+                return;  // Reset happened: values read from now on could be stale
+            }
+
+            const auto account{read_account(txn, address)};
+            std::vector<std::pair<StorageKey, evmc::bytes32>> storage;
+            if (account && account->incarnation > 0) {
+                storage.reserve(locations.size());
+                for (const auto& location : locations) {
+                    StorageKey key{address, account->incarnation, location};
+                    storage.emplace_back(key, read_storage(txn, address, account->incarnation, location));
+                }
+                if (account->code_hash != kEmptyHash) {
+                    // Just touch the code pages to warm up the OS page cache, code views are bound to this txn
+                    (void)read_code(txn, account->code_hash);
+                }
+            }
+
+            auto& shard{shard_for(address)};
+            std::scoped_lock lock{shard.mutex};
+            // Check again under lock: reset clears each shard *after* bumping the epoch
+            if (epoch_.load(std::memory_order_acquire) != epoch) {
+                return;
+            }
+            shard.accounts.try_emplace(address, account);
+            for (auto& [key, value] : storage) {
+                shard.storage.try_emplace(key, value);
+            }
+        }
+    } catch (const std::exception& ex) {
+        // Prefetching is just an optimization, execution will read from db anyway
+        log::Warning("StatePrefetcher", {"exception", ex.what()});
+    }
+}
+
+void StatePrefetcher::reset() {
+    pending_keys_.clear();
+    pending_blocks_ = 0;
+    epoch_.fetch_add(1, std::memory_order_acq_rel);
+    for (auto& shard : shards_) {
+        std::scoped_lock lock{shard.mutex};
+        shard.accounts.clear();
+        shard.storage.clear();
+    }
+}
+
+void StatePrefetcher::wait() {
+    workers_.wait_for_tasks();
+}
+
+std::optional<std::optional<Account>> StatePrefetcher::find_account(const evmc::address& address) const {
+    auto& shard{shard_for(address)};
+    std::scoped_lock lock{shard.mutex};
+    if (const auto it{shard.accounts.find(address)}; it != shard.accounts.cend()) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return it->second;
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+}
+
+std::optional<evmc::bytes32> StatePrefetcher::find_storage(const evmc::address& address, uint64_t incarnation,
+                                                           const evmc::bytes32& location) const {
+    auto& shard{shard_for(address)};
+    std::scoped_lock lock{shard.mutex};
+    if (const auto it{shard.storage.find(StorageKey{address, incarnation, location})}; it != shard.storage.cend()) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return it->second;
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+}
+
+}  // namespace silkworm::db
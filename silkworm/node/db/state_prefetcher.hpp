@@ -0,0 +1,119 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
+#include <silkworm/core/types/account.hpp>
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
+#include <silkworm/node/db/mdbx.hpp>
+
+namespace silkworm::db {
+
+//! \brief StatePrefetcher reads ahead of execution the plain state touched by a sequence of blocks (senders,
+//! recipients, beneficiaries and access-list entries) using helper threads, each one with its own read-only txn.
+//! Read values are kept in a sharded lookaside map which can be queried by the execution thread on cache miss.
+//! \remarks The values are valid only as long as the plain state seen by helper read-only txns is the same as
+//! the one seen by the execution txn: caller must invoke reset() whenever the latter changes (i.e. on commit)
+class StatePrefetcher {
+  public:
+    //! \brief Creates a new prefetcher for the given db environment using the specified number of helper threads
+    explicit StatePrefetcher(mdbx::env env, uint32_t num_workers);
+    ~StatePrefetcher();
+
+    // Not copyable nor movable
+    StatePrefetcher(const StatePrefetcher&) = delete;
+    StatePrefetcher& operator=(const StatePrefetcher&) = delete;
+
+    //! \brief Schedules the prefetch of the state accessed by the given block
+    //! \remarks Keys are extracted on the caller thread, so block can be safely discarded after this call returns.
+    //! Reads are submitted to helper threads every kBlocksPerTask blocks or upon flush()
+    void schedule(const Block& block);
+
+    //! \brief Submits the reads for any block scheduled but not yet submitted
+    void flush();
+
+    //! \brief Discards any prefetched value and any pending read, to be called when the db state has changed
+    void reset();
+
+    //! \brief Wait for all scheduled reads to complete (for testing purposes)
+    void wait();
+
+    //! \brief Lookup a prefetched account: an engaged result holds the account state (nullopt if missing in db)
+    [[nodiscard]] std::optional<std::optional<Account>> find_account(const evmc::address& address) const;
+
+    //! \brief Lookup a prefetched storage location value
+    [[nodiscard]] std::optional<evmc::bytes32> find_storage(const evmc::address& address, uint64_t incarnation,
+                                                            const evmc::bytes32& location) const;
+
+    [[nodiscard]] size_t hits() const { return hits_.load(std::memory_order_relaxed); }
+    [[nodiscard]] size_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+  private:
+    static constexpr size_t kNumShards{64};
+    static constexpr size_t kBlocksPerTask{16};
+
+    struct StorageKey {
+        evmc::address address;
+        uint64_t incarnation{0};
+        evmc::bytes32 location;
+
+        friend bool operator==(const StorageKey&, const StorageKey&) = default;
+
+        template <typename H>
+        friend H AbslHashValue(H h, const StorageKey& key) {
+            return H::combine(std::move(h), std::hash<evmc::address>{}(key.address), key.incarnation,
+                              std::hash<evmc::bytes32>{}(key.location));
+        }
+    };
+
+    //! Keys to be read for a single account
+    struct AccountKeys {
+        evmc::address address;
+        std::vector<evmc::bytes32> locations;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        absl::flat_hash_map<evmc::address, std::optional<Account>> accounts;
+        absl::flat_hash_map<StorageKey, evmc::bytes32> storage;
+    };
+
+    void prefetch(std::vector<AccountKeys> keys, uint64_t epoch);
+
+    Shard& shard_for(const evmc::address& address) const;
+
+    mdbx::env env_;
+    absl::flat_hash_map<evmc::address, absl::flat_hash_set<evmc::bytes32>> pending_keys_;
+    size_t pending_blocks_{0};
+    std::atomic_uint64_t epoch_{0};
+    mutable std::array<Shard, kNumShards> shards_;
+    mutable std::atomic_size_t hits_{0};
+    mutable std::atomic_size_t misses_{0};
+    ThreadPool workers_;
+};
+
+}  // namespace silkworm::db
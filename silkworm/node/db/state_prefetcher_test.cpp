@@ -0,0 +1,96 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_prefetcher.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/types/evmc_bytes32.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/db/buffer.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/test/context.hpp>
+
+namespace silkworm::db {
+
+TEST_CASE("StatePrefetcher", "[silkworm][node][db][state_prefetcher]") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    test::Context context;
+    auto& txn{context.rw_txn()};
+
+    const auto sender{0xb000000000000000000000000000000000000008_address};
+    const auto contract{0xc000000000000000000000000000000000000009_address};
+    const auto missing{0xd00000000000000000000000000000000000000a_address};
+    const auto location{0x000000000000000000000000000000000000a000000000000000000000000037_bytes32};
+    const auto value{0x00000000000000000000000000000000000000000000000000000000c9b131a4_bytes32};
+
+    const Account sender_account{.nonce = 7, .balance = 1 * kEther};
+    const Account contract_account{.nonce = 1, .incarnation = kDefaultIncarnation};
+
+    {
+        auto state{txn.rw_cursor_dup_sort(table::kPlainState)};
+        state->upsert(to_slice(ByteView{sender}), to_slice(sender_account.encode_for_storage()));
+        state->upsert(to_slice(ByteView{contract}), to_slice(contract_account.encode_for_storage()));
+        upsert_storage_value(*state, storage_prefix(contract, kDefaultIncarnation), location.bytes, value.bytes);
+    }
+    context.commit_and_renew_txn();
+
+    Block block;
+    block.transactions.resize(1);
+    block.transactions[0].from = sender;
+    block.transactions[0].to = missing;
+    block.transactions[0].access_list = {{contract, {location}}};
+
+    StatePrefetcher prefetcher{context.env(), /*num_workers=*/2};
+    CHECK_FALSE(prefetcher.find_account(sender));
+
+    prefetcher.schedule(block);
+    prefetcher.flush();
+    prefetcher.wait();
+
+    SECTION("lookup") {
+        const auto prefetched_sender{prefetcher.find_account(sender)};
+        REQUIRE(prefetched_sender);
+        REQUIRE(*prefetched_sender);
+        CHECK((*prefetched_sender)->nonce == sender_account.nonce);
+        CHECK((*prefetched_sender)->balance == sender_account.balance);
+
+        const auto prefetched_missing{prefetcher.find_account(missing)};
+        REQUIRE(prefetched_missing);
+        CHECK_FALSE(*prefetched_missing);
+
+        CHECK(prefetcher.find_storage(contract, kDefaultIncarnation, location) == value);
+        CHECK_FALSE(prefetcher.find_storage(contract, kDefaultIncarnation + 1, location));
+        CHECK(prefetcher.hits() == 3);
+        CHECK(prefetcher.misses() == 2);
+    }
+
+    SECTION("reset") {
+        prefetcher.reset();
+        CHECK_FALSE(prefetcher.find_account(sender));
+        CHECK_FALSE(prefetcher.find_storage(contract, kDefaultIncarnation, location));
+    }
+
+    SECTION("buffer lookaside") {
+        Buffer buffer{txn, 0};
+        buffer.use_prefetcher(&prefetcher);
+        CHECK(buffer.read_account(sender)->nonce == sender_account.nonce);
+        CHECK(buffer.read_storage(contract, kDefaultIncarnation, location) == value);
+        CHECK(prefetcher.hits() == 2);
+    }
+}
+
+}  // namespace silkworm::db
@@ -25,11 +25,33 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
 #include <silkworm/infra/concurrency/signal_handler.hpp>
+#include <silkworm/infra/metrics/metrics.hpp>
+#include <silkworm/infra/profiling/span_profiler.hpp>
 
 namespace silkworm::etl {
 
 namespace fs = std::filesystem;
 
+struct CollectorMetrics {
+    metrics::Counter& flushed_files;
+    metrics::Counter& flushed_bytes;
+    metrics::Counter& loaded_entries;
+    metrics::Histogram& flush_duration;
+};
+
+// Shared by all collectors, registered once at first use
+static CollectorMetrics& collector_metrics() {
+    auto& registry{metrics::Registry::instance()};
+    static CollectorMetrics collector_metrics{
+        .flushed_files = registry.counter("silkworm_etl_flushed_files_total", "Number of ETL buffers flushed to file"),
+        .flushed_bytes = registry.counter("silkworm_etl_flushed_bytes_total", "Number of bytes flushed to ETL files"),
+        .loaded_entries = registry.counter("silkworm_etl_loaded_entries_total", "Number of ETL entries loaded"),
+        .flush_duration = registry.histogram("silkworm_etl_flush_duration_seconds", "Duration of ETL buffer flushes",
+                                             {}, 1e-9),
+    };
+    return collector_metrics;
+}
+
 Collector::~Collector() {
     clear();  // Will ensure all files (if any) have been orderly closed and deleted
     if (work_path_managed_ && fs::exists(work_path_)) {
@@ -44,12 +66,17 @@ void Collector::flush_buffer() {
 
         /* Build a unique file name to pass FileProvider */
         fs::path new_file_path{
-            work_path_ / fs::path(std::to_string(unique_id_) + "-" + std::to_string(file_providers_.size()) + ".bin")};
+            work_path_ / fs::path(std::to_string(unique_id_) + "-" + std::to_string(instance_number_) + "-" +
+                              std::to_string(next_file_id_++) + ".bin")};
 
         file_providers_.emplace_back(new FileProvider(new_file_path.string(), file_providers_.size()));
         file_providers_.back()->flush(buffer_);
         buffer_.clear();
         const auto [_, duration]{sw.stop()};
+        auto& etl_metrics{collector_metrics()};
+        etl_metrics.flushed_files.increment();
+        etl_metrics.flushed_bytes.increment(file_providers_.back()->get_file_size());
+        etl_metrics.flush_duration.observe(static_cast<uint64_t>(duration.count()));
         log::Info("ETL collector flushed file", {"path", std::string(file_providers_.back()->get_file_name()),
                                                  "size", human_size(file_providers_.back()->get_file_size()),
                                                  "in", StopWatch::format(duration)});
@@ -74,7 +101,23 @@ void Collector::collect(Entry&& entry) {
     }
 }
 
+void Collector::merge(Collector& other) {
+    if (other.work_path_managed_) {
+        throw etl_error("Cannot merge collector owning a managed work path");
+    }
+    other.flush_buffer();
+    for (auto& file_provider : other.file_providers_) {
+        file_providers_.push_back(std::move(file_provider));
+    }
+    size_ += other.size_;
+    bytes_size_ += other.bytes_size_;
+    other.file_providers_.clear();
+    other.size_ = 0;
+    other.bytes_size_ = 0;
+}
+
 void Collector::load(db::RWCursorDupSort& target, const LoadFunc& load_func, MDBX_put_flags_t flags) {
+    SILKWORM_PROFILE_SPAN("etl::Collector", "load");
     using namespace std::chrono_literals;
     static const auto kLogInterval{5s};               // Updates processing key (for log purposes) every this time
     auto log_time{std::chrono::steady_clock::now()};  // To check if an update of key is needed
@@ -84,6 +127,7 @@ void Collector::load(db::RWCursorDupSort& target, const LoadFunc& load_func, MDB
     if (empty()) {
         return;
     }
+    collector_metrics().loaded_entries.increment(size_);
 
     if (file_providers_.empty()) {
         buffer_.sort();
@@ -125,9 +169,11 @@ void Collector::load(db::RWCursorDupSort& target, const LoadFunc& load_func, MDB
 
     // Read one "record" from each data_provider and let the queue
     // sort them. On top of the queue the smallest key
-    for (auto& file_provider : file_providers_) {
-        auto item{file_provider->read_entry()};
+    // Provider index is the position in file_providers_, which may differ from the provider id after a merge
+    for (size_t index{0}; index < file_providers_.size(); ++index) {
+        auto item{file_providers_[index]->read_entry()};
         if (item.has_value()) {
+            item->second = index;
             queue.push(std::move(*item));
         }
     }
@@ -161,6 +207,9 @@ void Collector::load(db::RWCursorDupSort& target, const LoadFunc& load_func, MDB
         // From the provider which has served the current key
         // read next "record"
         auto next{file_provider->read_entry()};
+        if (next.has_value()) {
+            next->second = provider_index;
+        }
 
         // At this point `current` has been processed.
         // We can remove it from the queue
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 
 #include <silkworm/node/common/settings.hpp>
@@ -55,6 +56,12 @@ class Collector {
     void collect(const Entry& entry);  // Store key-value pair in memory or on disk
     void collect(Entry&& entry);       // Store key-value pair in memory or on disk
 
+    //! \brief Takes over all the entries collected by other collector, which is left empty
+    //! \details Used to merge collectors filled in parallel: other's buffer is flushed to file and its files are then
+    //! merge-sorted along with the ones of this collector at load time
+    //! \remarks other must not own a managed temporary work path, otherwise its files would be deleted along with it
+    void merge(Collector& other);
+
     //! \brief Loads and optionally transforms collected entries into db
     //! \param [in] target : a cursor opened on target table and owned by caller (can be empty)
     //! \param [in] load_func : Pointer to function transforming collected entries. If NULL no transform is executed
@@ -109,11 +116,19 @@ class Collector {
      * If this object gets destroyed another object may get
      * the same address but in such case all dependant files
      * would be already destroyed too thus keeping file
-     * names uniqueness.
+     * names uniqueness. Files taken over by merge outlive their
+     * collector though, hence the sequence number.
      */
     uintptr_t unique_id_{reinterpret_cast<uintptr_t>(this)};
+    uint64_t instance_number_{next_instance_number()};
+
+    static uint64_t next_instance_number() {
+        static std::atomic<uint64_t> instance_count{0};
+        return instance_count.fetch_add(1, std::memory_order_relaxed);
+    }
 
     std::vector<std::unique_ptr<FileProvider>> file_providers_;  // Collection of file providers
+    size_t next_file_id_{0};                                     // Id of next flushed file (unique within collector)
     size_t size_{0};                                             // Count of total collected items
     size_t bytes_size_{0};                                       // Count of total collected bytes
     mutable std::mutex mutex_{};                                 // To sync loading_key_
@@ -16,6 +16,7 @@
 
 #include "collector.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <set>
 #include <thread>
@@ -118,4 +119,45 @@ TEST_CASE("collect_and_load") {
     });
 }
 
+TEST_CASE("collect_merge_and_load") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    test::Context context;
+
+    auto set{generate_entry_set(1000)};
+    Collector collector{context.dir().etl().path(), 1_Kibi};
+    Collector other1{context.dir().etl().path(), 1_Kibi};
+    Collector other2{context.dir().etl().path(), 1_Kibi};
+    for (size_t i{0}; i < set.size(); ++i) {
+        switch (i % 3) {
+            case 0:
+                collector.collect(set[i]);
+                break;
+            case 1:
+                other1.collect(set[i]);
+                break;
+            default:
+                other2.collect(set[i]);
+        }
+    }
+
+    collector.merge(other1);
+    collector.merge(other2);
+    CHECK(other1.empty());
+    CHECK(other2.empty());
+    CHECK(collector.size() == set.size());
+
+    // Collectors merged away can be reused without clashing with the files taken over
+    other1.collect(set[0]);
+    CHECK(other1.size() == 1);
+
+    std::vector<Bytes> loaded_keys;
+    db::PooledCursor to{context.rw_txn(), db::table::kHeaderNumbers};
+    collector.load(to, [&](const Entry& entry, auto&, MDBX_put_flags_t) {
+        loaded_keys.push_back(entry.key);
+    });
+    CHECK(loaded_keys.size() == set.size());
+    CHECK(std::is_sorted(loaded_keys.cbegin(), loaded_keys.cend()));
+    CHECK(collector.empty());
+}
+
 }  // namespace silkworm::etl
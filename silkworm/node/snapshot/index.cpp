@@ -209,7 +209,7 @@ void TransactionIndex::build() {
                     } else {
                         // Skip tx hash first byte plus address length for transaction decoding
                         constexpr int kTxFirstByteAndAddressLength{1 + kAddressLength};
-                        const Bytes tx_envelope{tx_buffer.substr(kTxFirstByteAndAddressLength)};
+                        const ByteView tx_envelope{ByteView{tx_buffer}.substr(kTxFirstByteAndAddressLength)};
                         ByteView tx_envelope_view{tx_envelope};
 
                         rlp::Header tx_header;
@@ -225,7 +225,7 @@ void TransactionIndex::build() {
                             SILK_DEBUG << "header.list: " << tx_header.list << " header.payload_length: " << tx_header.payload_length << " i: " << i;
                         }
 
-                        const Bytes tx_payload{tx_buffer.substr(kTxFirstByteAndAddressLength + tx_payload_offset)};
+                        const ByteView tx_payload{tx_envelope.substr(tx_payload_offset)};
                         const auto h256{keccak256(tx_payload)};
                         std::copy(std::begin(h256.bytes), std::begin(h256.bytes) + kHashLength, std::begin(tx_hash.bytes));
                         SILK_DEBUG << "type: " << int(tx_type) << " i: " << i << " payload: " << to_hex(tx_payload)
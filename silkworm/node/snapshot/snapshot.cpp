@@ -359,13 +359,27 @@ std::optional<Transaction> TransactionSnapshot::txn_by_hash(const Hash& txn_hash
     const auto txn_position = idx_txn_hash_->lookup(txn_hash);
     // Then, get the transaction offset in snapshot by using ordinal lookup
     const auto txn_offset = idx_txn_hash_->ordinal_lookup(txn_position);
-    // Finally, read the next transaction at specified offset
-    auto txn = next_txn(txn_offset, txn_hash);
+    // Finally, read the next data item at specified offset checking if it starts with txn hash first byte
+    const auto item = next_item(txn_offset, {txn_hash.bytes, 1});
+    if (!item) {
+        return {};
+    }
+    auto [senders_data, tx_rlp] = slice_tx_data(*item);
+    // Decode just a view of the transaction: this is enough to compute its hash directly from the encoded data
+    TransactionView txn_view;
+    if (!rlp::decode(tx_rlp, txn_view)) {
+        return {};
+    }
     // We *must* ensure that the retrieved txn hash matches because there is no way to know if key exists in MPHF
-    if (txn and txn->hash() != txn_hash) {
+    if (txn_view.hash() != txn_hash) {
         return {};
     }
-    return txn;
+    Transaction transaction;
+    if (!txn_view.to_transaction(transaction)) {
+        return {};
+    }
+    transaction.from = bytes_to_address(senders_data);
+    return transaction;
 }
 
 std::optional<Transaction> TransactionSnapshot::txn_by_id(uint64_t txn_id) const {
@@ -433,6 +447,17 @@ std::vector<Bytes> TransactionSnapshot::txn_rlp_range(uint64_t base_txn_id, uint
     return rlp_txs;
 }
 
+void TransactionSnapshot::for_each_txn_view(uint64_t base_txn_id, uint64_t txn_count, const ViewWalker& walker) const {
+    TransactionView txn_view;
+    for_each_txn(base_txn_id, txn_count, [&](uint64_t i, ByteView /*senders_data*/, ByteView tx_rlp) -> bool {
+        const auto decode_result = rlp::decode(tx_rlp, txn_view);
+        ensure(decode_result.has_value(),
+               "TransactionSnapshot: cannot decode tx: " + to_hex(tx_rlp) + " i: " + std::to_string(i) +
+                   " error: " + to_string(decode_result));
+        return walker(txn_view);
+    });
+}
+
 std::pair<ByteView, ByteView> TransactionSnapshot::slice_tx_data(const WordItem& item) {
     const auto& buffer{item.value};
     const auto buffer_size{buffer.size()};
@@ -27,6 +27,7 @@
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
 #include <silkworm/core/types/block.hpp>
+#include <silkworm/core/types/transaction_view.hpp>
 #include <silkworm/infra/common/os.hpp>
 #include <silkworm/node/db/util.hpp>
 #include <silkworm/node/huffman/decompressor.hpp>
@@ -183,6 +184,10 @@ class TransactionSnapshot : public Snapshot {
     [[nodiscard]] std::vector<Transaction> txn_range(uint64_t base_txn_id, uint64_t txn_count, bool read_senders) const;
     [[nodiscard]] std::vector<Bytes> txn_rlp_range(uint64_t base_txn_id, uint64_t txn_count) const;
 
+    //! Visit transactions in range decoded as views into the snapshot words, returning false to stop the iteration
+    using ViewWalker = std::function<bool(const TransactionView& txn)>;
+    void for_each_txn_view(uint64_t base_txn_id, uint64_t txn_count, const ViewWalker& walker) const;
+
     [[nodiscard]] std::optional<BlockNum> block_num_by_txn_hash(const Hash& txn_hash) const;
 
     void reopen_index() override;
@@ -27,7 +27,7 @@
 #include <boost/asio/io_context.hpp>
 
 #include <silkworm/core/common/as_range.hpp>
-#include <silkworm/core/common/lru_cache.hpp>
+#include <silkworm/core/common/concurrent_cache.hpp>
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/node/stagedsync/execution_pipeline.hpp>
 #include <silkworm/node/stagedsync/stages/stage.hpp>
@@ -99,7 +99,7 @@ class ExecutionEngine : public Stoppable {
     ForkContainer forks_;
 
     static constexpr size_t kDefaultCacheSize = 1000;
-    mutable lru_cache<Hash, std::shared_ptr<Block>> block_cache_;
+    mutable ConcurrentCache<Hash, std::shared_ptr<Block>> block_cache_;
 
     BlockNum block_progress_{0};
     bool fork_tracking_active_{false};
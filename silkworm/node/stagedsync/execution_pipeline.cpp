@@ -22,6 +22,8 @@
 #include <silkworm/infra/common/asio_timer.hpp>
 #include <silkworm/infra/common/environment.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
+#include <silkworm/infra/metrics/metrics.hpp>
+#include <silkworm/infra/profiling/span_profiler.hpp>
 #include <silkworm/node/stagedsync/stages/stage_blockhashes.hpp>
 #include <silkworm/node/stagedsync/stages/stage_bodies.hpp>
 #include <silkworm/node/stagedsync/stages/stage_execution.hpp>
@@ -68,6 +70,7 @@ ExecutionPipeline::ExecutionPipeline(silkworm::NodeSettings* node_settings)
     : node_settings_{node_settings},
       sync_context_{std::make_unique<SyncContext>()} {
     load_stages();
+    register_metrics();
 }
 
 BlockNum ExecutionPipeline::head_header_number() {
@@ -161,6 +164,22 @@ void ExecutionPipeline::load_stages() {
                                 });
 }
 
+void ExecutionPipeline::register_metrics() {
+    auto& registry{metrics::Registry::instance()};
+    for (const auto& [stage_id, _] : stages_) {
+        const metrics::Labels stage_labels{{"stage", stage_id}};
+        stages_metrics_.emplace(
+            stage_id,
+            StageMetrics{
+                .forward_duration = registry.histogram("silkworm_stage_forward_duration_seconds",
+                                                       "Duration of stage forward runs", stage_labels, 1e-9),
+                .forward_failures = registry.counter("silkworm_stage_forward_failures_total",
+                                                     "Number of failed stage forward runs", stage_labels),
+                .progress = registry.gauge("silkworm_stage_progress", "Block height reached by stage", stage_labels),
+            });
+    }
+}
+
 bool ExecutionPipeline::stop() {
     bool stopped{true};
     for (const auto& [_, stage] : stages_) {
@@ -204,9 +223,16 @@ Stage::Result ExecutionPipeline::forward(db::RWTxn& cycle_txn, BlockNum target_h
             log_timer.reset();  // Resets the interval for next log line from now
 
             // forward
-            const auto stage_result = current_stage_->second->forward(cycle_txn);
+            auto& stage_metrics{stages_metrics_.at(stage_id)};
+            Stage::Result stage_result;
+            {
+                metrics::ScopedTimer forward_timer{&stage_metrics.forward_duration};
+                SILKWORM_PROFILE_SPAN(stage_id, "forward");
+                stage_result = current_stage_->second->forward(cycle_txn);
+            }
 
             if (stage_result != Stage::Result::kSuccess) { /* clang-format off */
+                stage_metrics.forward_failures.increment();
                 auto result_description = std::string(magic_enum::enum_name<Stage::Result>(stage_result));
                 log::Error(get_log_prefix(), {"op", "Forward", "returned", result_description});
                 log::Error("ExecPipeline") << "Forward interrupted due to stage " << current_stage_->first << " failure";
@@ -214,6 +240,7 @@ Stage::Result ExecutionPipeline::forward(db::RWTxn& cycle_txn, BlockNum target_h
             } /* clang-format on */
 
             auto stage_head_number = db::stages::read_stage_progress(cycle_txn, current_stage_->first);
+            stage_metrics.progress.set(static_cast<int64_t>(stage_head_number));
             if (stage_head_number != target_height) {
                 throw std::logic_error("Sync pipeline: stage returned success with an height different from target=" +
                                        to_string(target_height) + " reached= " + to_string(stage_head_number));
@@ -270,7 +297,11 @@ Stage::Result ExecutionPipeline::unwind(db::RWTxn& cycle_txn, BlockNum unwind_po
             log_timer.reset();  // Resets the interval for next log line from now
 
             // Do unwind on current stage
-            const auto stage_result = current_stage_->second->unwind(cycle_txn);
+            Stage::Result stage_result;
+            {
+                SILKWORM_PROFILE_SPAN(stage_id, "unwind");
+                stage_result = current_stage_->second->unwind(cycle_txn);
+            }
             if (stage_result != Stage::Result::kSuccess) {
                 auto result_description = std::string(magic_enum::enum_name<Stage::Result>(stage_result));
                 log::Error(get_log_prefix(), {"op", "Unwind", "returned", result_description});
@@ -326,7 +357,11 @@ Stage::Result ExecutionPipeline::prune(db::RWTxn& cycle_txn) {
             current_stage_->second->set_log_prefix(get_log_prefix());
 
             log_timer.reset();  // Resets the interval for next log line from now
-            const auto stage_result{current_stage_->second->prune(cycle_txn)};
+            Stage::Result stage_result;
+            {
+                SILKWORM_PROFILE_SPAN(stage_id, "prune");
+                stage_result = current_stage_->second->prune(cycle_txn);
+            }
             if (stage_result != Stage::Result::kSuccess) {
                 log::Error(get_log_prefix(), {"op", "Prune", "returned",
                                               std::string(magic_enum::enum_name<Stage::Result>(stage_result))});
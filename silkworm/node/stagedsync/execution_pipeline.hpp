@@ -21,6 +21,7 @@
 #include <vector>
 
 #include <silkworm/core/types/hash.hpp>
+#include <silkworm/infra/metrics/metrics.hpp>
 #include <silkworm/node/stagedsync/stages/stage.hpp>
 
 namespace silkworm::stagedsync {
@@ -58,7 +59,15 @@ class ExecutionPipeline : public Stoppable {
     BlockNum head_header_number_{0};
     Hash head_header_hash_;
 
-    void load_stages();  // Fills the vector with stages
+    struct StageMetrics {
+        metrics::Histogram& forward_duration;
+        metrics::Counter& forward_failures;
+        metrics::Gauge& progress;
+    };
+    std::map<const char*, StageMetrics> stages_metrics_;
+
+    void load_stages();       // Fills the vector with stages
+    void register_metrics();  // Registers the metrics of each loaded stage
 
     std::string get_log_prefix() const;  // Returns the current log lines prefix on behalf of current stage
     class LogTimer;                      // Timer for async log scheduling
@@ -19,12 +19,15 @@
 #include <span>
 #include <stdexcept>
 
+#include <gsl/util>
 #include <magic_enum.hpp>
 
 #include <silkworm/core/common/endian.hpp>
 #include <silkworm/core/execution/processor.hpp>
 #include <silkworm/infra/common/decoding_exception.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
+#include <silkworm/infra/profiling/span_profiler.hpp>
+#include <silkworm/node/common/shared_analysis_cache.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/node/db/buffer.hpp>
 
@@ -89,12 +92,25 @@ Stage::Result Execution::forward(db::RWTxn& txn) {
             prune_receipts = std::min(prune_receipts, hashstate_stage_progress - 1);
         }
 
-        static constexpr size_t kCacheSize{5'000};
-        AnalysisCache analysis_cache{kCacheSize};
+        AnalysisCache& analysis_cache{shared_analysis_cache()};
         ObjectPool<evmone::ExecutionState> state_pool;
 
         prefetched_blocks_.clear();
 
+        // Prefetching state on helper read-only txns requires that they see the same state as txn. Not worth it
+        // for small segments or w/ commit disabled (i.e. helper txns could never see the changes made by txn)
+        const auto prefetch_workers{node_settings_->execution_prefetch_workers};
+        if (prefetch_workers > 0 && !txn.commit_disabled() && segment_width > db::stages::kSmallBlockSegmentWidth) {
+            // Helper txns see only committed state: if txn holds changes not committed yet (e.g. written by previous
+            // stages in this cycle) we must commit them to give helpers a fresh read view, otherwise prefetched
+            // values would be stale. When nothing is pending the commit is skipped, sparing a useless db sync
+            if (txn->get_info().txn_space_dirty > 0) {
+                txn.commit_and_renew();
+            }
+            state_prefetcher_ = std::make_unique<db::StatePrefetcher>(txn.db(), prefetch_workers);
+        }
+        [[maybe_unused]] auto prefetcher_guard = gsl::finally([&]() { state_prefetcher_.reset(); });
+
         while (block_num_ <= max_block_num) {
             throw_if_stopping();
             const auto execution_result{execute_batch(txn,
@@ -146,6 +162,7 @@ Stage::Result Execution::forward(db::RWTxn& txn) {
 }
 
 void Execution::prefetch_blocks(db::RWTxn& txn, const BlockNum from, const BlockNum to) {
+    SILKWORM_PROFILE_SPAN("Execution", "prefetch_blocks");
     std::unique_ptr<StopWatch> sw;
     if (log::test_verbosity(log::Level::kTrace)) {
         sw = std::make_unique<StopWatch>(/*auto_start=*/true);
@@ -179,10 +196,16 @@ void Execution::prefetch_blocks(db::RWTxn& txn, const BlockNum from, const Block
                                        /*read_senders=*/true, prefetched_blocks_.back())) {
                 throw std::runtime_error("Unable to read block " + std::to_string(block_num));
             }
+            if (state_prefetcher_) {
+                state_prefetcher_->schedule(prefetched_blocks_.back());
+            }
             ++block_num;
         }};
         num_read = db::cursor_for_count(*canonicals, walk_function, count);
     }
+    if (state_prefetcher_) {
+        state_prefetcher_->flush();
+    }
 
     if (num_read != count) {
         throw std::runtime_error("Missing block " + std::to_string(from + num_read));
@@ -197,6 +220,7 @@ void Execution::prefetch_blocks(db::RWTxn& txn, const BlockNum from, const Block
 Stage::Result Execution::execute_batch(db::RWTxn& txn, BlockNum max_block_num, AnalysisCache& analysis_cache,
                                        ObjectPool<evmone::ExecutionState>& state_pool, BlockNum prune_history_threshold,
                                        BlockNum prune_receipts_threshold) {
+    SILKWORM_PROFILE_SPAN("Execution", "execute_batch");
     Stage::Result ret{Stage::Result::kSuccess};
     using namespace std::chrono_literals;
     auto log_time{std::chrono::steady_clock::now()};
@@ -205,6 +229,16 @@ Stage::Result Execution::execute_batch(db::RWTxn& txn, BlockNum max_block_num, A
         db::Buffer buffer(txn, prune_history_threshold);
         std::vector<Receipt> receipts;
 
+        if (state_prefetcher_) {
+            // Previous batch (if any) has been committed: discard stale values and re-schedule remaining blocks
+            state_prefetcher_->reset();
+            for (const auto& block : prefetched_blocks_) {
+                state_prefetcher_->schedule(block);
+            }
+            state_prefetcher_->flush();
+            buffer.use_prefetcher(state_prefetcher_.get());
+        }
+
         // Transform batch_size limit into Ggas
         size_t gas_max_history_size{node_settings_->batch_size * 1_Kibi / 2};  // 512MB -> 256Ggas roughly
         size_t gas_max_batch_size{gas_max_history_size * 20};                  // 256Ggas -> 5Tgas roughly
@@ -20,6 +20,7 @@
 
 #include <silkworm/core/execution/evm.hpp>
 #include <silkworm/core/protocol/rule_set.hpp>
+#include <silkworm/node/db/state_prefetcher.hpp>
 #include <silkworm/node/stagedsync/stages/stage.hpp>
 
 namespace silkworm::stagedsync {
@@ -43,6 +44,7 @@ class Execution final : public Stage {
     protocol::RuleSetPtr rule_set_;
     BlockNum block_num_{0};
     boost::circular_buffer<Block> prefetched_blocks_{/*buffer_capacity=*/kMaxPrefetchedBlocks};
+    std::unique_ptr<db::StatePrefetcher> state_prefetcher_;
 
     //! \brief Prefetches blocks for processing
     //! \param [in] from: the first block to prefetch (inclusive)
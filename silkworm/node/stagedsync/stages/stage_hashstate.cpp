@@ -16,15 +16,23 @@
 
 #include "stage_hashstate.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 
 #include <magic_enum.hpp>
 
 #include <silkworm/core/common/cast.hpp>
 #include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/crypto/keccak.hpp>
 #include <silkworm/core/execution/address.hpp>
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/infra/common/decoding_exception.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 
 namespace silkworm::stagedsync {
@@ -173,104 +181,229 @@ Stage::Result HashState::prune(db::RWTxn&) {
     return Stage::Result::kSuccess;
 }
 
-Stage::Result HashState::hash_from_plainstate(db::RWTxn& txn) {
-    Stage::Result ret{Stage::Result::kSuccess};
-    try {
-        auto source = txn.ro_cursor_dup_sort(db::table::kPlainState);
-        auto data{source->to_first(/*throw_notfound=*/true)};
+//! Number of key ranges PlainState and PlainCodeHash are split into for parallel hashing (one per first key byte)
+static constexpr size_t kHashRangeCount{256};
 
-        /*
-         * This relies on the assumption previous execution stage has completed correctly,
-         * and we do nothing more than hashing keys already present in PlainState either
-         * to HashedAccount or to HashedStorage. We don't need to check an upper block
-         * limit as PlainState holds info up to the highest executed block.
-         */
+//! Number of plain records whose keys are hashed together in one batch
+static constexpr size_t kHashBatchSize{1024};
 
-        evmc::address last_address{};
-        ethash_hash256 address_hash{keccak256(last_address.bytes)};  // We might have all zeroed addresses ?
-
-        std::unique_lock log_lck(log_mtx_);
-        current_source_ = std::string(db::table::kPlainState.name);
-        current_key_ = to_hex(last_address.bytes, /*with_prefix=*/true);
-        log_lck.unlock();
+//! Compute the Keccak-256 hashes of all the given preimages: addresses and locations fit one block, so they are all
+//! hashed in SIMD lanes when available
+static void keccak256_batch(const std::vector<ByteView>& preimages, std::vector<ethash_hash256>& hashes) {
+    hashes.resize(preimages.size());
+    keccak256_many(preimages, hashes);
+}
 
-        // New Hashed Storage Entry Key (72 bytes)
-        // + Address hash  (32 bytes)
-        // + Incarnation   ( 8 bytes)
-        // + Location hash (32 bytes)
-        Bytes etl_storage_entry_key(72, '\0');
+//! \brief Hashes in batches the records read from PlainState or PlainCodeHash into HashedAccounts, HashedStorage or
+//! HashedCodeHash entries for the ETL collector
+class PlainRecordHasher {
+  public:
+    PlainRecordHasher(bool plain_state, etl::Collector& collector) : plain_state_{plain_state}, collector_{collector} {
+        records_.reserve(kHashBatchSize);
+    }
 
-        // Hash accounts
-        while (data) {
-            auto data_key_view{db::from_slice(data.key)};
+    //! Add one record to current batch: the views must stay valid until flush (i.e. the source txn must be open)
+    void add(ByteView key, ByteView value) {
+        records_.push_back({key, value});
+        if (records_.size() == kHashBatchSize) {
+            flush();
+        }
+    }
 
-            // We're reading PlainState which keys are ordered by address (always initial 20 bytes of key)
-            // Rehash the address only when changes
-            if (std::memcmp(data_key_view.data(), last_address.bytes, kAddressLength) != 0) {
-                throw_if_stopping();
-                last_address = bytes_to_address(data_key_view);
-                address_hash = keccak256(last_address.bytes);
-                log_lck.lock();
-                current_key_ = to_hex(last_address.bytes, /*with_prefix=*/true);
-                log_lck.unlock();
+    void flush() {
+        // Gather the preimages: the address once per run of records for the same address plus storage locations
+        preimages_.clear();
+        ByteView last_address;
+        for (const auto& record : records_) {
+            const ByteView address{record.key.substr(0, kAddressLength)};
+            if (address != last_address) {
+                preimages_.push_back(address);
+                last_address = address;
             }
+            if (is_storage(record)) {
+                preimages_.push_back(record.value.substr(0, kHashLength));
+            }
+        }
+        keccak256_batch(preimages_, hashes_);
+
+        // Walk the records in the same order to pick their hashes
+        size_t hash_index{0};
+        last_address = {};
+        for (const auto& record : records_) {
+            const ByteView address{record.key.substr(0, kAddressLength)};
+            if (address != last_address) {
+                address_hash_ = &hashes_[hash_index++];
+                last_address = address;
+            }
+            collect(record, is_storage(record) ? &hashes_[hash_index++] : nullptr);
+        }
+        records_.clear();
+    }
 
-            if (data.key.length() == kAddressLength) {
-                // Hash account
-                // data.key == Address
-                // data.value == Account encoded for storage (must exist)
-                if (!data.value.length()) {
-                    const std::string what("Unexpected empty value in PlainState for Account " + current_key_);
-                    throw StageError(Stage::Result::kUnexpectedError, what);
-                }
-
-                etl::Entry entry{Bytes(address_hash.bytes, kHashLength), Bytes{db::from_slice(data.value)}};
-                collector_->collect(std::move(entry));
-
-            } else if (data.key.length() == db::kPlainStoragePrefixLength) {
-                // Hash storage
-                // data.key           == Address + Incarnation
-                // data.value (multi) == Location + zeroless Value
-
-                // See above for allocation
-                std::memcpy(&etl_storage_entry_key[0], address_hash.bytes, kHashLength);
-                std::memcpy(&etl_storage_entry_key[kHashLength], &data_key_view[kAddressLength],
-                            db::kIncarnationLength);
-
-                // Iterate dupkeys only to avoid re-hashing of same address
-                while (data) {
-                    if (!(data.value.length() > kHashLength)) {
-                        const auto incarnation{endian::load_big_u64(&data_key_view[kAddressLength])};
-                        const std::string what("Unexpected empty value in PlainState for Account " + current_key_ +
-                                               " incarnation " + std::to_string(incarnation));
-                        throw StageError(Stage::Result::kUnexpectedError, what);
-                    }
+  private:
+    struct Record {
+        ByteView key;
+        ByteView value;
+    };
 
-                    /*
-                     * NOTE !
-                     * Destination table kHashedStorage is dup-sorted but as Collector implements sorting only on entry
-                     * key here we have to build the entry key as hashed address + incarnation + hashed storage location
-                     * eventually leaving entry value to only hashed storage value. This ensures entries are collected
-                     * and sorted properly and eventually the loader will move back hashed storage location in the value
-                     * part of the db record. This way we can reliably insert records using MDBX_APPENDDUP
-                     */
-
-                    auto data_value_view{db::from_slice(data.value)};
-                    std::memcpy(&etl_storage_entry_key[kHashLength + db::kIncarnationLength],
-                                keccak256(data_value_view.substr(0, kHashLength)).bytes, kHashLength);
-                    data_value_view.remove_prefix(kHashLength);
-                    etl::Entry entry{etl_storage_entry_key, Bytes{data_value_view}};
-                    collector_->collect(std::move(entry));
-                    data = source->to_current_next_multi(false);
-                }
+    [[nodiscard]] bool is_storage(const Record& record) const {
+        return plain_state_ && record.key.length() == db::kPlainStoragePrefixLength &&
+               record.value.length() > kHashLength;
+    }
 
-            } else {
-                std::string what{"Unexpected key length " + std::to_string(data.key.length())};
+    void collect(const Record& record, const ethash_hash256* location_hash) {
+        if (plain_state_ && record.key.length() == kAddressLength) {
+            // Hash account
+            // record.key == Address
+            // record.value == Account encoded for storage (must exist)
+            if (record.value.empty()) {
+                const std::string what("Unexpected empty value in PlainState for Account " + to_hex(record.key, true));
+                throw StageError(Stage::Result::kUnexpectedError, what);
+            }
+            collector_.collect(etl::Entry{Bytes(address_hash_->bytes, kHashLength), Bytes{record.value}});
+        } else if (plain_state_ && record.key.length() == db::kPlainStoragePrefixLength) {
+            // Hash storage
+            // record.key   == Address + Incarnation
+            // record.value == Location + zeroless Value
+            if (location_hash == nullptr) {
+                const auto incarnation{endian::load_big_u64(&record.key[kAddressLength])};
+                const std::string what("Unexpected empty value in PlainState for Account " +
+                                       to_hex(record.key.substr(0, kAddressLength), true) +
+                                       " incarnation " + std::to_string(incarnation));
                 throw StageError(Stage::Result::kUnexpectedError, what);
             }
 
-            data = source->to_next(/*throw_notfound=*/false);
+            /*
+             * NOTE !
+             * Destination table kHashedStorage is dup-sorted but as Collector implements sorting only on entry
+             * key here we have to build the entry key as hashed address + incarnation + hashed storage location
+             * eventually leaving entry value to only hashed storage value. This ensures entries are collected
+             * and sorted properly and eventually the loader will move back hashed storage location in the value
+             * part of the db record. This way we can reliably insert records using MDBX_APPENDDUP
+             */
+            Bytes key(db::kHashedStoragePrefixLength + kHashLength, '\0');
+            std::memcpy(&key[0], address_hash_->bytes, kHashLength);
+            std::memcpy(&key[kHashLength], &record.key[kAddressLength], db::kIncarnationLength);
+            std::memcpy(&key[db::kHashedStoragePrefixLength], location_hash->bytes, kHashLength);
+            collector_.collect(etl::Entry{std::move(key), Bytes{record.value.substr(kHashLength)}});
+        } else if (!plain_state_ && record.key.length() == db::kPlainStoragePrefixLength) {
+            // Hash code hash
+            // record.key   == Address + Incarnation
+            // record.value == Code hash
+            Bytes key(db::kHashedStoragePrefixLength, '\0');
+            std::memcpy(&key[0], address_hash_->bytes, kHashLength);
+            std::memcpy(&key[kHashLength], &record.key[kAddressLength], db::kIncarnationLength);
+            collector_.collect(etl::Entry{std::move(key), Bytes{record.value}});
+        } else {
+            std::string what{"Unexpected key length " + std::to_string(record.key.length())};
+            throw StageError(Stage::Result::kUnexpectedError, what);
+        }
+    }
+
+    bool plain_state_;
+    etl::Collector& collector_;
+    std::vector<Record> records_;
+    std::vector<ByteView> preimages_;
+    std::vector<ethash_hash256> hashes_;
+    const ethash_hash256* address_hash_{nullptr};
+};
+
+//! Hash all the records of PlainState or PlainCodeHash whose key starts with the given byte
+static void hash_plain_range(db::ROTxn& txn, const db::MapConfig& source_config, uint8_t first_key_byte,
+                             etl::Collector& collector, const std::function<void()>& throw_if_stopping) {
+    auto source = txn.ro_cursor(source_config);
+    const Bytes range_start(1, first_key_byte);
+    PlainRecordHasher hasher{std::string_view{source_config.name} == db::table::kPlainState.name, collector};
+    size_t count{0};
+    for (auto data{source->lower_bound(db::to_slice(range_start), /*throw_notfound=*/false)}; data;
+         data = source->to_next(/*throw_notfound=*/false)) {
+        const ByteView key{db::from_slice(data.key)};
+        if (key.empty() || key[0] != first_key_byte) {
+            break;
+        }
+        hasher.add(key, db::from_slice(data.value));
+        if (++count % (16 * kHashBatchSize) == 0) {
+            throw_if_stopping();
+        }
+    }
+    hasher.flush();
+}
+
+void HashState::collect_hashed_plain_table(db::RWTxn& txn, const db::MapConfig& source_config) {
+    const auto throw_if_stopping{[this]() { this->throw_if_stopping(); }};
+
+    if (txn.commit_disabled()) {
+        // Source table may hold uncommitted data invisible to other transactions: stick to the current one
+        for (size_t range{0}; range < kHashRangeCount; ++range) {
+            throw_if_stopping();
+            hash_plain_range(txn, source_config, static_cast<uint8_t>(range), *collector_, throw_if_stopping);
         }
+        return;
+    }
+
+    // Each worker processes the next available key range on its own read-only txn collecting into its own collector
+    const auto num_workers{std::max(std::thread::hardware_concurrency(), 1u)};
+    std::vector<std::unique_ptr<etl::Collector>> worker_collectors;
+    for (size_t i{0}; i < num_workers; ++i) {
+        worker_collectors.push_back(std::make_unique<etl::Collector>(node_settings_->data_directory->etl().path(),
+                                                                     node_settings_->etl_buffer_size / num_workers));
+    }
+    std::atomic<size_t> next_range{0};
+    std::mutex failure_mutex;
+    std::exception_ptr failure;  // first error raised by any worker, the others just stop
+    auto env{txn.db()};
+
+    ThreadPool worker_pool{num_workers};
+    for (size_t i{0}; i < num_workers; ++i) {
+        worker_pool.push_task([&, i]() {
+            try {
+                for (size_t range{next_range++}; range < kHashRangeCount; range = next_range++) {
+                    throw_if_stopping();
+                    if (std::scoped_lock lock{failure_mutex}; failure) {
+                        return;
+                    }
+                    {
+                        std::scoped_lock log_lck(log_mtx_);
+                        current_key_ = to_hex(Bytes(1, static_cast<uint8_t>(range)), /*with_prefix=*/true);
+                    }
+                    db::ROTxnManaged range_txn{env};
+                    hash_plain_range(range_txn, source_config, static_cast<uint8_t>(range), *worker_collectors[i],
+                                     throw_if_stopping);
+                }
+            } catch (...) {
+                std::scoped_lock lock{failure_mutex};
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+            }
+        });
+    }
+    worker_pool.wait_for_tasks();
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+
+    // Sorted worker outputs are merged into the stage collector and loaded all together
+    for (auto& worker_collector : worker_collectors) {
+        collector_->merge(*worker_collector);
+    }
+}
+
+Stage::Result HashState::hash_from_plainstate(db::RWTxn& txn) {
+    Stage::Result ret{Stage::Result::kSuccess};
+    try {
+        /*
+         * This relies on the assumption previous execution stage has completed correctly,
+         * and we do nothing more than hashing keys already present in PlainState either
+         * to HashedAccount or to HashedStorage. We don't need to check an upper block
+         * limit as PlainState holds info up to the highest executed block.
+         */
+        std::unique_lock log_lck(log_mtx_);
+        current_source_ = std::string(db::table::kPlainState.name);
+        current_key_.clear();
+        log_lck.unlock();
+
+        collect_hashed_plain_table(txn, db::table::kPlainState);
 
         throw_if_stopping();
 
@@ -339,44 +472,12 @@ Stage::Result HashState::hash_from_plainstate(db::RWTxn& txn) {
 Stage::Result HashState::hash_from_plaincode(db::RWTxn& txn) {
     Stage::Result ret{Stage::Result::kSuccess};
     try {
-        auto source = txn.ro_cursor(db::table::kPlainCodeHash);
-        auto data{source->to_first(/*throw_notfound=*/false)};
-
-        evmc::address last_address{};
-        Bytes new_key(db::kHashedStoragePrefixLength, '\0');
-
         std::unique_lock log_lck(log_mtx_);
         current_source_ = std::string(db::table::kPlainCodeHash.name);
-        current_key_ = to_hex(last_address.bytes, /*with_prefix=*/true);
+        current_key_.clear();
         log_lck.unlock();
 
-        while (data) {
-            if (data.key.length() != kAddressLength + db::kIncarnationLength) {
-                std::string what{"Unexpected key len " + std::to_string(data.key.length())};
-                throw StageError(Stage::Result::kUnexpectedError, what);
-            }
-
-            auto data_key_view{db::from_slice(data.key)};
-
-            // We're reading PlainCodeHash which keys are ordered by address (always initial 20 bytes of key)
-            // Rehash the address only when changes
-            if (std::memcmp(data_key_view.data(), last_address.bytes, kAddressLength) != 0) {
-                throw_if_stopping();
-                last_address = bytes_to_address(data_key_view);
-                log_lck.lock();
-                current_key_ = to_hex(last_address.bytes, /*with_prefix=*/true);
-                log_lck.unlock();
-
-                const auto address_hash{keccak256(last_address.bytes)};
-                std::memcpy(&new_key[0], address_hash.bytes, kHashLength);
-            }
-
-            std::memcpy(&new_key[kHashLength], &data_key_view[kAddressLength], db::kIncarnationLength);
-
-            etl::Entry entry{new_key, Bytes{db::from_slice(data.value)}};
-            collector_->collect(std::move(entry));
-            data = source->to_next(/*throw_notfound=*/false);
-        }
+        collect_hashed_plain_table(txn, db::table::kPlainCodeHash);
 
         throw_if_stopping();
 
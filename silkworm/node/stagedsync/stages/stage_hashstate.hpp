@@ -45,6 +45,11 @@ class HashState final : public Stage {
     //! \remarks To be used only if this is very first time HashState stage runs forward (i.e. forwarding from 0)
     Stage::Result hash_from_plaincode(db::RWTxn& txn);
 
+    //! \brief Hashes the keys of the whole PlainState or PlainCodeHash table into collector_
+    //! \details The key space is split into ranges processed in parallel, each one on its own read-only txn, by
+    //! workers having their own collectors which are eventually merged into collector_
+    void collect_hashed_plain_table(db::RWTxn& txn, const db::MapConfig& source_config);
+
     //! \brief Detects account changes from AccountChangeSet and hashes the changed keys
     //! \remarks Though it could be used for initial sync only is way slower and builds an index of changed accounts.
     Stage::Result hash_from_account_changeset(db::RWTxn& txn, BlockNum previous_progress, BlockNum to);
@@ -29,6 +29,7 @@
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/infra/common/decoding_exception.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
+#include <silkworm/infra/profiling/span_profiler.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 
 namespace silkworm::stagedsync {
@@ -204,6 +205,7 @@ Stage::Result InterHashes::prune(db::RWTxn&) { return Stage::Result::kSuccess; }
 
 trie::PrefixSet InterHashes::collect_account_changes(db::RWTxn& txn, BlockNum from, BlockNum to,
                                                      absl::btree_map<evmc::address, ethash_hash256>& hashed_addresses) {
+    SILKWORM_PROFILE_SPAN("InterHashes", "collect_account_changes");
     std::unique_ptr<StopWatch> sw;
     if (log::test_verbosity(log::Level::kTrace)) {
         sw = std::make_unique<StopWatch>(/*auto_start=*/true);
@@ -346,6 +348,7 @@ trie::PrefixSet InterHashes::collect_account_changes(db::RWTxn& txn, BlockNum fr
 
 trie::PrefixSet InterHashes::collect_storage_changes(db::RWTxn& txn, BlockNum from, BlockNum to,
                                                      absl::btree_map<evmc::address, ethash_hash256>& hashed_addresses) {
+    SILKWORM_PROFILE_SPAN("InterHashes", "collect_storage_changes");
     std::unique_ptr<StopWatch> sw;
     if (log::test_verbosity(log::Level::kTrace)) {
         sw = std::make_unique<StopWatch>(/*auto_start=*/true);
@@ -554,6 +557,7 @@ Stage::Result InterHashes::increment_intermediate_hashes(db::RWTxn& txn, BlockNu
 }
 
 void InterHashes::flush_collected_nodes(db::RWTxn& txn) {
+    SILKWORM_PROFILE_SPAN("InterHashes", "flush_collected_nodes");
     // Proceed with loading of newly generated nodes and deletion of obsolete ones.
     std::unique_lock log_lck(log_mtx_);
     trie_loader_.reset();
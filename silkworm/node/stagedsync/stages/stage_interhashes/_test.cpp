@@ -23,6 +23,7 @@
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/node/db/tables.hpp>
 #include <silkworm/node/etl/collector.hpp>
+#include <silkworm/node/stagedsync/stages/stage_interhashes/proof_loader.hpp>
 #include <silkworm/node/stagedsync/stages/stage_interhashes/trie_cursor.hpp>
 #include <silkworm/node/stagedsync/stages/stage_interhashes/trie_loader.hpp>
 #include <silkworm/node/test/context.hpp>
@@ -875,4 +876,89 @@ TEST_CASE("Trie Storage : incremental vs regeneration") {
     REQUIRE(fused_nodes == incremental_nodes);
 }
 
+//! Check that each node of the proof is referenced by hash from its parent, the first one being the root
+static void check_proof(const std::vector<Bytes>& proof, const evmc::bytes32& root, ByteView leaf_value) {
+    REQUIRE(!proof.empty());
+    CHECK(to_bytes32(silkworm::keccak256(proof.front()).bytes) == root);
+    for (size_t i{1}; i < proof.size(); ++i) {
+        const auto child_hash{silkworm::keccak256(proof[i])};
+        CHECK(ByteView{proof[i - 1]}.find(ByteView{child_hash.bytes}) != ByteView::npos);
+    }
+    CHECK(ByteView{proof.back()}.ends_with(leaf_value));
+}
+
+TEST_CASE("Proof loader") {
+    test::Context context;
+    auto& txn{context.rw_txn()};
+
+    static constexpr size_t n{2'000};
+
+    db::PooledCursor hashed_accounts{txn, db::table::kHashedAccounts};
+    db::PooledCursor hashed_storage{txn, db::table::kHashedStorage};
+
+    static constexpr auto contract_address{0x1000000000000000000000000000000000000000_address};
+    static constexpr Account contract{
+        1,                                                                           // nonce
+        2 * kEther,                                                                  // balance
+        0x5e3c5ae99a1c6785210d0d233641562557ad763e18907cca3a8d42bd0a0b4ecb_bytes32,  // code_hash
+        kDefaultIncarnation,                                                         // incarnation
+    };
+    const auto hashed_contract_address{keccak256(contract_address)};
+    hashed_accounts.upsert(db::to_slice(hashed_contract_address.bytes), db::to_slice(contract.encode_for_storage()));
+
+    // Plenty of other accounts, so that the proofs are made mostly of stored intermediate hashes
+    for (size_t i{0}; i < n; ++i) {
+        const Account account{i, i * kEther};
+        const auto hashed_address{silkworm::keccak256(int_to_bytes32(i).bytes)};
+        hashed_accounts.upsert(db::to_slice(hashed_address.bytes), db::to_slice(account.encode_for_storage()));
+    }
+
+    const Bytes storage_prefix{db::storage_prefix(hashed_contract_address.bytes, kDefaultIncarnation)};
+    for (size_t i{1}; i <= n; ++i) {
+        const auto hashed_location{silkworm::keccak256(int_to_bytes32(i).bytes)};
+        db::upsert_storage_value(hashed_storage, storage_prefix, hashed_location.bytes, int_to_bytes32(i * 7).bytes);
+    }
+
+    const auto state_root{regenerate_intermediate_hashes(txn, context.dir().etl().path())};
+    REQUIRE(db::PooledCursor{txn, db::table::kTrieOfAccounts}.size() > 0);
+    REQUIRE(db::PooledCursor{txn, db::table::kTrieOfStorage}.size() > 0);
+
+    ProofLoader proof_loader{txn};
+
+    SECTION("existing account and slots") {
+        const std::vector<evmc::bytes32> locations{int_to_bytes32(1), int_to_bytes32(n / 2), int_to_bytes32(n + 1)};
+        const auto account_proof{proof_loader.calculate_proof(contract_address, locations)};
+        CHECK(account_proof.state_root == state_root);
+        REQUIRE(account_proof.account == contract);
+        check_proof(account_proof.proof, state_root, contract.rlp(account_proof.storage_root));
+
+        REQUIRE(account_proof.storage_proofs.size() == locations.size());
+        for (size_t i{0}; i < 2; ++i) {
+            const auto& storage_proof{account_proof.storage_proofs[i]};
+            CHECK(storage_proof.location == locations[i]);
+            Bytes value_rlp;
+            rlp::encode(value_rlp, zeroless_view(storage_proof.value.bytes));
+            check_proof(storage_proof.proof, account_proof.storage_root, value_rlp);
+        }
+        CHECK(account_proof.storage_proofs[0].value == int_to_bytes32(7));
+        CHECK(account_proof.storage_proofs[1].value == int_to_bytes32(n / 2 * 7));
+
+        // Missing slot: the proof goes as far as the trie allows and the value is zero
+        CHECK(account_proof.storage_proofs[2].value == evmc::bytes32{});
+        CHECK(!account_proof.storage_proofs[2].proof.empty());
+    }
+
+    SECTION("missing account") {
+        const auto missing_address{0x2000000000000000000000000000000000000000_address};
+        const auto account_proof{proof_loader.calculate_proof(missing_address, {int_to_bytes32(1)})};
+        CHECK(account_proof.state_root == state_root);
+        CHECK(!account_proof.account);
+        CHECK(account_proof.storage_root == kEmptyRoot);
+        CHECK(!account_proof.proof.empty());
+        REQUIRE(account_proof.storage_proofs.size() == 1);
+        CHECK(account_proof.storage_proofs[0].value == evmc::bytes32{});
+        CHECK(account_proof.storage_proofs[0].proof.empty());
+    }
+}
+
 }  // namespace silkworm::trie
@@ -0,0 +1,183 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "proof_loader.hpp"
+
+#include <map>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/trie/hash_builder.hpp>
+#include <silkworm/core/trie/nibbles.hpp>
+#include <silkworm/core/trie/prefix_set.hpp>
+#include <silkworm/core/types/evmc_bytes32.hpp>
+#include <silkworm/infra/common/decoding_exception.hpp>
+#include <silkworm/infra/profiling/span_profiler.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/node/stagedsync/stages/stage_interhashes/trie_cursor.hpp>
+#include <silkworm/node/stagedsync/stages/stage_interhashes/trie_loader.hpp>
+
+namespace silkworm::trie {
+
+//! Collect the proof of the given key out of the retained nodes (keyed by path) i.e. the ones whose path is a prefix
+//! of the key, from the root down
+static std::vector<Bytes> proof_of(const std::map<Bytes, Bytes>& retained_nodes, ByteView nibbled_key) {
+    std::vector<Bytes> proof;
+    for (const auto& [path, rlp] : retained_nodes) {
+        if (nibbled_key.starts_with(path)) {
+            proof.push_back(rlp);
+        }
+    }
+    return proof;
+}
+
+AccountProof ProofLoader::calculate_proof(const evmc::address& address, const std::vector<evmc::bytes32>& locations) {
+    SILKWORM_PROFILE_SPAN("ProofLoader", "calculate_proof");
+
+    AccountProof account_proof{.address = address};
+
+    auto hashed_accounts = txn_.ro_cursor(db::table::kHashedAccounts);
+    auto hashed_storage = txn_.ro_cursor_dup_sort(db::table::kHashedStorage);
+    auto trie_accounts = txn_.ro_cursor(db::table::kTrieOfAccounts);
+    auto trie_storage = txn_.ro_cursor(db::table::kTrieOfStorage);
+
+    const auto hashed_address{keccak256(address.bytes)};
+    const ByteView hashed_address_view{hashed_address.bytes};
+    const Bytes nibbled_address{unpack_nibbles(hashed_address_view)};
+
+    if (const auto data{hashed_accounts->find(db::to_slice(hashed_address_view), false)}; data) {
+        const auto account{Account::from_encoded_storage(db::from_slice(data.value))};
+        success_or_throw(account);
+        account_proof.account = *account;
+    }
+
+    // Storage slots exist only for the current incarnation of a contract
+    Bytes storage_prefix{};
+    std::vector<Bytes> nibbled_locations;
+    nibbled_locations.reserve(locations.size());
+    for (const auto& location : locations) {
+        StorageProof storage_proof{.location = location};
+        const auto hashed_location{keccak256(location.bytes)};
+        nibbled_locations.push_back(unpack_nibbles(hashed_location.bytes));
+        if (account_proof.account && account_proof.account->incarnation) {
+            storage_prefix = db::storage_prefix(hashed_address_view, account_proof.account->incarnation);
+            const auto data{hashed_storage->lower_bound_multivalue(db::to_slice(storage_prefix),
+                                                                   db::to_slice(hashed_location.bytes), false)};
+            if (data) {
+                const ByteView value_view{db::from_slice(data.value)};
+                if (value_view.starts_with(hashed_location.bytes)) {
+                    storage_proof.value = to_bytes32(value_view.substr(kHashLength));
+                }
+            }
+        }
+        account_proof.storage_proofs.push_back(storage_proof);
+    }
+
+    // Mark the paths to prove as changed, so that the trie cursors descend along them instead of taking the stored
+    // hashes, while all the sibling subtries are taken from the stored hashes
+    PrefixSet account_changes;
+    account_changes.insert(nibbled_address);
+    PrefixSet storage_changes;
+    if (!storage_prefix.empty()) {
+        for (const auto& nibbled_location : nibbled_locations) {
+            Bytes key{storage_prefix};
+            key.append(nibbled_location);
+            storage_changes.insert(std::move(key));
+        }
+    }
+
+    std::map<Bytes, Bytes> account_nodes;
+    HashBuilder account_hash_builder;
+    account_hash_builder.set_proof_retainer({nibbled_address}, [&](ByteView nibbled_path, ByteView rlp) {
+        account_nodes.insert_or_assign(Bytes{nibbled_path}, Bytes{rlp});
+    });
+
+    std::map<Bytes, Bytes> storage_nodes;
+    HashBuilder storage_hash_builder;
+
+    TrieCursor trie_account_cursor(*trie_accounts, &account_changes);
+    TrieCursor trie_storage_cursor(*trie_storage, &storage_changes);
+
+    Bytes storage_prefix_buffer{};
+    storage_prefix_buffer.reserve(db::kHashedStoragePrefixLength);
+
+    // Same walk as TrieLoader::calculate_root, with no node collected into the tries
+    auto trie_account_data{trie_account_cursor.to_prefix({})};
+    while (true) {
+        if (trie_account_data.first_uncovered.has_value()) {
+            auto hashed_account_seek_slice{db::to_slice(trie_account_data.first_uncovered.value())};
+            auto hashed_account_data{hashed_account_seek_slice.empty()
+                                         ? hashed_accounts->to_first(false)
+                                         : hashed_accounts->lower_bound(hashed_account_seek_slice, false)};
+            while (hashed_account_data) {
+                auto hashed_account_data_key_view{db::from_slice(hashed_account_data.key)};
+                auto hashed_account_data_key_nibbled{unpack_nibbles(hashed_account_data_key_view)};
+                if (trie_account_data.key.has_value() &&
+                    trie_account_data.key.value() < hashed_account_data_key_nibbled) {
+                    break;
+                }
+
+                const auto account{Account::from_encoded_storage(db::from_slice(hashed_account_data.value))};
+                success_or_throw(account);
+
+                evmc::bytes32 storage_root{kEmptyRoot};
+                if (account->incarnation) {
+                    const bool is_proven_account{hashed_account_data_key_view == hashed_address_view};
+                    if (is_proven_account) {
+                        storage_hash_builder.set_proof_retainer(nibbled_locations, [&](ByteView nibbled_path, ByteView rlp) {
+                            storage_nodes.insert_or_assign(Bytes{nibbled_path}, Bytes{rlp});
+                        });
+                    }
+                    storage_prefix_buffer.assign(db::storage_prefix(hashed_account_data_key_view, account->incarnation));
+                    storage_root = TrieLoader::calculate_storage_root(trie_storage_cursor, storage_hash_builder,
+                                                                      *hashed_storage, storage_prefix_buffer);
+                    if (is_proven_account) {
+                        storage_hash_builder.set_proof_retainer({}, nullptr);
+                        account_proof.storage_root = storage_root;
+                    }
+                }
+
+                account_hash_builder.add_leaf(hashed_account_data_key_nibbled, account->rlp(storage_root));
+                hashed_account_data = hashed_accounts->to_next(false);
+            }
+        }
+
+        // Interrupt loop when no more keys to process
+        if (!trie_account_data.key.has_value()) {
+            break;
+        }
+
+        account_hash_builder.add_branch_node(trie_account_data.key.value(), trie_account_data.hash.value(),
+                                             trie_account_data.children_in_trie);
+
+        // If root node added we can exit
+        if (trie_account_data.key->empty()) {
+            break;
+        }
+
+        trie_account_data = trie_account_cursor.to_next();
+    }
+
+    account_proof.state_root = account_hash_builder.root_hash();
+    account_proof.proof = proof_of(account_nodes, nibbled_address);
+    for (size_t i{0}; i < account_proof.storage_proofs.size(); ++i) {
+        account_proof.storage_proofs[i].proof = proof_of(storage_nodes, nibbled_locations[i]);
+    }
+
+    return account_proof;
+}
+
+}  // namespace silkworm::trie
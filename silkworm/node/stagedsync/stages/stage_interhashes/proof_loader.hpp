@@ -0,0 +1,65 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/bytes.hpp>
+#include <silkworm/core/types/account.hpp>
+#include <silkworm/node/db/mdbx.hpp>
+
+namespace silkworm::trie {
+
+//! \brief Merkle proof of one storage slot, as per EIP-1186
+struct StorageProof {
+    evmc::bytes32 location{};
+    evmc::bytes32 value{};
+    std::vector<Bytes> proof;  // RLP of the nodes from the storage root down to the slot
+};
+
+//! \brief Merkle proof of one account and some of its storage slots, as per EIP-1186
+struct AccountProof {
+    evmc::address address{};
+    std::optional<Account> account;
+    evmc::bytes32 storage_root{kEmptyRoot};
+    std::vector<Bytes> proof;  // RLP of the nodes from the state root down to the account
+    std::vector<StorageProof> storage_proofs;
+    evmc::bytes32 state_root{};  // The state root the proofs refer to
+};
+
+//! \brief Builds Merkle proofs of the current state reusing the intermediate hashes in TrieOfAccounts and TrieOfStorage
+//! \details Only the nodes along the paths to the proven keys are rehashed from HashedAccounts and HashedStorage, any
+//! other subtrie is taken from its stored hash. The proofs hence refer to the state at the IntermediateHashes stage
+//! progress, which is also the one of HashState.
+class ProofLoader {
+  public:
+    explicit ProofLoader(db::ROTxn& txn) : txn_{txn} {}
+
+    //! \brief Computes the proof of the given account and of the given storage locations (not hashed) of it
+    //! \remark May throw
+    [[nodiscard]] AccountProof calculate_proof(const evmc::address& address,
+                                               const std::vector<evmc::bytes32>& locations);
+
+  private:
+    db::ROTxn& txn_;
+};
+
+}  // namespace silkworm::trie
@@ -0,0 +1,158 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/trie/hash_builder.hpp>
+#include <silkworm/core/trie/nibbles.hpp>
+#include <silkworm/core/types/account.hpp>
+#include <silkworm/infra/common/directories.hpp>
+#include <silkworm/node/db/mdbx.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/node/etl/collector.hpp>
+#include <silkworm/node/stagedsync/stages/stage_interhashes/proof_loader.hpp>
+#include <silkworm/node/stagedsync/stages/stage_interhashes/trie_loader.hpp>
+
+namespace {
+
+using namespace silkworm;
+
+constexpr size_t kNumAccounts{200'000};
+constexpr size_t kNumContractSlots{50'000};
+constexpr auto kContractAddress{0x1000000000000000000000000000000000000000_address};
+
+evmc::bytes32 number_to_bytes32(size_t i) {
+    evmc::bytes32 value;
+    endian::store_big_u64(value.bytes + kHashLength - sizeof(uint64_t), i);
+    return value;
+}
+
+//! Hashed state of kNumAccounts accounts plus one contract with kNumContractSlots storage slots, along with its
+//! intermediate hashes as written by the InterHashes stage
+std::shared_ptr<mdbx::env_managed> make_chaindata(const TemporaryDirectory& tmp_dir) {
+    auto chaindata_env{std::make_shared<mdbx::env_managed>(
+        db::open_env(db::EnvConfig{.path = tmp_dir.path().string(), .create = true, .in_memory = true}))};
+    db::RWTxnManaged txn{*chaindata_env};
+    db::table::check_or_create_chaindata_tables(txn);
+
+    auto hashed_accounts{txn.rw_cursor(db::table::kHashedAccounts)};
+    for (size_t i{0}; i < kNumAccounts; ++i) {
+        const Account account{i, i * kEther};
+        const auto hashed_address{keccak256(number_to_bytes32(i).bytes)};
+        hashed_accounts->upsert(db::to_slice(hashed_address.bytes), db::to_slice(account.encode_for_storage()));
+    }
+    const Account contract{1, kEther, kEmptyHash, kDefaultIncarnation};
+    const auto hashed_contract_address{keccak256(kContractAddress.bytes)};
+    hashed_accounts->upsert(db::to_slice(hashed_contract_address.bytes), db::to_slice(contract.encode_for_storage()));
+
+    auto hashed_storage{txn.rw_cursor_dup_sort(db::table::kHashedStorage)};
+    const Bytes storage_prefix{db::storage_prefix(hashed_contract_address.bytes, kDefaultIncarnation)};
+    for (size_t i{1}; i <= kNumContractSlots; ++i) {
+        const auto hashed_location{keccak256(number_to_bytes32(i).bytes)};
+        db::upsert_storage_value(*hashed_storage, storage_prefix, hashed_location.bytes, number_to_bytes32(i).bytes);
+    }
+
+    etl::Collector account_trie_node_collector{tmp_dir.path()};
+    etl::Collector storage_trie_node_collector{tmp_dir.path()};
+    trie::TrieLoader trie_loader{txn, nullptr, nullptr, &account_trie_node_collector, &storage_trie_node_collector};
+    (void)trie_loader.calculate_root();
+    auto trie_accounts{txn.rw_cursor_dup_sort(db::table::kTrieOfAccounts)};
+    account_trie_node_collector.load(*trie_accounts, nullptr, MDBX_put_flags_t::MDBX_APPEND);
+    auto trie_storage{txn.rw_cursor_dup_sort(db::table::kTrieOfStorage)};
+    storage_trie_node_collector.load(*trie_storage, nullptr, MDBX_put_flags_t::MDBX_APPEND);
+
+    txn.commit_and_stop();
+    return chaindata_env;
+}
+
+std::vector<evmc::bytes32> proven_locations() {
+    return {number_to_bytes32(1), number_to_bytes32(kNumContractSlots / 2), number_to_bytes32(kNumContractSlots)};
+}
+
+//! Proof of the contract and some of its slots rebuilding the whole state trie from the hashed state, i.e. what
+//! eth_getProof would cost without the intermediate hashes
+size_t calculate_proof_by_full_rehash(db::ROTxn& txn) {
+    const auto nibbled_address{trie::unpack_nibbles(keccak256(kContractAddress.bytes).bytes)};
+    std::vector<Bytes> nibbled_locations;
+    for (const auto& location : proven_locations()) {
+        nibbled_locations.push_back(trie::unpack_nibbles(keccak256(location.bytes).bytes));
+    }
+
+    size_t proof_nodes{0};
+    const auto count_node{[&](ByteView, ByteView) { ++proof_nodes; }};
+    trie::HashBuilder account_hash_builder;
+    account_hash_builder.set_proof_retainer({nibbled_address}, count_node);
+    trie::HashBuilder storage_hash_builder;
+    storage_hash_builder.set_proof_retainer(nibbled_locations, count_node);
+
+    auto hashed_accounts{txn.ro_cursor(db::table::kHashedAccounts)};
+    auto hashed_storage{txn.ro_cursor_dup_sort(db::table::kHashedStorage)};
+    Bytes value_rlp;
+    for (auto account_data{hashed_accounts->to_first(false)}; account_data; account_data = hashed_accounts->to_next(false)) {
+        const ByteView hashed_address{db::from_slice(account_data.key)};
+        const auto account{Account::from_encoded_storage(db::from_slice(account_data.value))};
+        evmc::bytes32 storage_root{kEmptyRoot};
+        if (account->incarnation) {
+            const Bytes storage_prefix{db::storage_prefix(hashed_address, account->incarnation)};
+            for (auto storage_data{hashed_storage->find(db::to_slice(storage_prefix), false)}; storage_data;
+                 storage_data = hashed_storage->to_current_next_multi(false)) {
+                const ByteView value{db::from_slice(storage_data.value)};
+                value_rlp.clear();
+                rlp::encode(value_rlp, value.substr(kHashLength));
+                storage_hash_builder.add_leaf(trie::unpack_nibbles(value.substr(0, kHashLength)), value_rlp);
+            }
+            storage_root = storage_hash_builder.root_hash();
+            storage_hash_builder.reset();
+        }
+        account_hash_builder.add_leaf(trie::unpack_nibbles(hashed_address), account->rlp(storage_root));
+    }
+    benchmark::DoNotOptimize(account_hash_builder.root_hash());
+    return proof_nodes;
+}
+
+}  // namespace
+
+static void proof_loader_calculate_proof(benchmark::State& state) {
+    TemporaryDirectory tmp_dir;
+    const auto chaindata_env{make_chaindata(tmp_dir)};
+    db::ROTxnManaged txn{*chaindata_env};
+    trie::ProofLoader proof_loader{txn};
+    const auto locations{proven_locations()};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(proof_loader.calculate_proof(kContractAddress, locations));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(proof_loader_calculate_proof)->Unit(benchmark::kMillisecond);
+
+static void proof_by_full_rehash(benchmark::State& state) {
+    TemporaryDirectory tmp_dir;
+    const auto chaindata_env{make_chaindata(tmp_dir)};
+    db::ROTxnManaged txn{*chaindata_env};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(calculate_proof_by_full_rehash(txn));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(proof_by_full_rehash)->Unit(benchmark::kMillisecond);
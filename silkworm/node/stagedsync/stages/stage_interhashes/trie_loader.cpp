@@ -22,6 +22,7 @@
 #include <silkworm/core/types/account.hpp>
 #include <silkworm/infra/common/decoding_exception.hpp>
 #include <silkworm/infra/concurrency/signal_handler.hpp>
+#include <silkworm/infra/profiling/span_profiler.hpp>
 #include <silkworm/node/db/tables.hpp>
 
 namespace silkworm::trie {
@@ -43,6 +44,7 @@ TrieLoader::TrieLoader(db::ROTxn& txn, PrefixSet* account_changes, PrefixSet* st
 }
 
 evmc::bytes32 TrieLoader::calculate_root() {
+    SILKWORM_PROFILE_SPAN("TrieLoader", "calculate_root");
     using namespace std::chrono_literals;
     auto log_time{std::chrono::steady_clock::now()};
 
@@ -148,7 +150,7 @@ evmc::bytes32 TrieLoader::calculate_storage_root(TrieCursor& trie_storage_cursor
     using namespace std::chrono_literals;
     auto log_time{std::chrono::steady_clock::now()};
 
-    static Bytes rlp_buffer{};
+    thread_local Bytes rlp_buffer{};
 
     const auto db_storage_prefix_slice{db::to_slice(db_storage_prefix)};
     auto trie_storage_data{trie_storage_cursor.to_prefix(db_storage_prefix)};
@@ -41,6 +41,15 @@ class TrieLoader {
         return log_key_;
     }
 
+    //! \brief (re)calculates storage root hash on behalf of collected hashed changes and existing data in
+    //! TrieOfStorage bucket
+    //! \return The computed hash
+    //! \remark May throw
+    [[nodiscard]] static evmc::bytes32 calculate_storage_root(TrieCursor& trie_storage_cursor,
+                                                              HashBuilder& storage_hash_builder,
+                                                              db::ROCursorDupSort& hashed_storage,
+                                                              const Bytes& db_storage_prefix);
+
   private:
     db::ROTxn& txn_;
     PrefixSet* account_changes_;
@@ -50,14 +59,5 @@ class TrieLoader {
 
     std::string log_key_{};         // To export logging key
     mutable std::mutex log_mtx_{};  // Guards async logging
-
-    //! \brief (re)calculates storage root hash on behalf of collected hashed changes and existing data in
-    //! TrieOfStorage bucket
-    //! \return The computed hash
-    //! \remark May throw
-    [[nodiscard]] static evmc::bytes32 calculate_storage_root(TrieCursor& trie_storage_cursor,
-                                                              HashBuilder& storage_hash_builder,
-                                                              db::ROCursorDupSort& hashed_storage,
-                                                              const Bytes& db_storage_prefix);
 };
 }  // namespace silkworm::trie
@@ -19,11 +19,13 @@
 #include <algorithm>
 #include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include <gsl/util>
 #include <magic_enum.hpp>
 
 #include <silkworm/core/crypto/ecdsa.h>
+#include <silkworm/core/crypto/keccak.hpp>
 #include <silkworm/core/crypto/secp256k1n.hpp>
 #include <silkworm/core/protocol/validation.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
@@ -294,8 +296,15 @@ Stage::Result Senders::parallel_recover(db::RWTxn& txn) {
             auto current_hash = db::read_canonical_hash(txn, current_block_num);
             if (!current_hash) throw StageError(Stage::Result::kBadChainSequence,
                                                 "Canonical hash at height " + std::to_string(current_block_num) + " not found");
-            BlockBody block_body;
-            auto found = data_model.read_body(*current_hash, current_block_num, block_body);
+
+            // Transactions are visited as views into db pages (or snapshot words): just the signing payload is copied
+            const auto block_hash{std::make_shared<Hash>(*current_hash)};
+            uint32_t block_txn_count{0};
+            Stage::Result batch_result{Stage::Result::kSuccess};
+            auto found = data_model.for_each_transaction_view(current_block_num, *current_hash, [&](const TransactionView& transaction) {
+                batch_result = add_to_batch(current_block_num, block_hash, block_txn_count++, transaction);
+                return batch_result == Stage::Result::kSuccess;
+            });
             if (!found) throw StageError(Stage::Result::kBadChainSequence,
                                          "Canonical block at height " + std::to_string(current_block_num) + " not found");
 
@@ -304,14 +313,14 @@ Stage::Result Senders::parallel_recover(db::RWTxn& txn) {
                 throw StageError(Stage::Result::kAborted);
             }
 
-            // Get the body and its transactions
-            if (block_body.transactions.empty()) {
+            if (block_txn_count == 0) {
                 ++total_empty_blocks;
                 continue;
             }
 
-            total_collected_senders += block_body.transactions.size();
-            success_or_throw(add_to_batch(current_block_num, std::make_shared<Hash>(*current_hash), std::move(block_body.transactions)));
+            success_or_throw(batch_result);
+            increment_total_processed_blocks();
+            total_collected_senders += block_txn_count;
 
             // Process batch in parallel if max size has been reached
             if (batch_->size() >= max_batch_size_) {
@@ -363,7 +372,8 @@ Stage::Result Senders::parallel_recover(db::RWTxn& txn) {
     return ret;
 }
 
-Stage::Result Senders::add_to_batch(BlockNum block_num, std::shared_ptr<Hash> block_hash, std::vector<Transaction>&& transactions) {
+Stage::Result Senders::add_to_batch(BlockNum block_num, const std::shared_ptr<Hash>& block_hash, uint32_t tx_id,
+                                    const TransactionView& transaction) {
     if (is_stopping()) {
         return Stage::Result::kAborted;
     }
@@ -373,43 +383,37 @@ Stage::Result Senders::add_to_batch(BlockNum block_num, std::shared_ptr<Hash> bl
     const bool has_homestead{rev >= EVMC_HOMESTEAD};
     const bool has_spurious_dragon{rev >= EVMC_SPURIOUS_DRAGON};
 
-    uint32_t tx_id{0};
-    for (const auto& transaction : transactions) {
-        if (!protocol::transaction_type_is_supported(transaction.type, rev)) {
-            log::Error(log_prefix_) << "Transaction type " << magic_enum::enum_name<TransactionType>(transaction.type)
-                                    << " for transaction #" << tx_id << " in block #" << block_num << " before it's supported";
-            return Stage::Result::kInvalidTransaction;
-        }
+    if (!protocol::transaction_type_is_supported(transaction.type, rev)) {
+        log::Error(log_prefix_) << "Transaction type " << magic_enum::enum_name<TransactionType>(transaction.type)
+                                << " for transaction #" << tx_id << " in block #" << block_num << " before it's supported";
+        return Stage::Result::kInvalidTransaction;
+    }
 
-        if (!is_valid_signature(transaction.r, transaction.s, has_homestead)) {
-            log::Error(log_prefix_) << "Got invalid signature for transaction #" << tx_id << " in block #" << block_num;
-            return Stage::Result::kInvalidTransaction;
-        }
+    if (!is_valid_signature(transaction.r, transaction.s, has_homestead)) {
+        log::Error(log_prefix_) << "Got invalid signature for transaction #" << tx_id << " in block #" << block_num;
+        return Stage::Result::kInvalidTransaction;
+    }
 
-        if (transaction.chain_id.has_value()) {
-            if (!has_spurious_dragon) {
-                log::Error(log_prefix_) << "EIP-155 signature for transaction #" << tx_id << " in block #" << block_num
-                                        << " before Spurious Dragon";
-                return Stage::Result::kInvalidTransaction;
-            } else if (transaction.chain_id.value() != node_settings_->chain_config->chain_id) {
-                log::Error(log_prefix_) << "EIP-155 invalid signature for transaction #" << tx_id << " in block #" << block_num;
-                return Stage::Result::kInvalidTransaction;
-            }
+    if (transaction.chain_id.has_value()) {
+        if (!has_spurious_dragon) {
+            log::Error(log_prefix_) << "EIP-155 signature for transaction #" << tx_id << " in block #" << block_num
+                                    << " before Spurious Dragon";
+            return Stage::Result::kInvalidTransaction;
+        } else if (transaction.chain_id.value() != node_settings_->chain_config->chain_id) {
+            log::Error(log_prefix_) << "EIP-155 invalid signature for transaction #" << tx_id << " in block #" << block_num;
+            return Stage::Result::kInvalidTransaction;
         }
+    }
 
-        Bytes rlp{};
-        transaction.encode_for_signing(rlp);
-
-        batch_->push_back(AddressRecovery{block_num, block_hash, transaction.odd_y_parity});
-        intx::be::unsafe::store(batch_->back().tx_signature, transaction.r);
-        intx::be::unsafe::store(batch_->back().tx_signature + kHashLength, transaction.s);
-        batch_->back().rlp = std::move(rlp);
+    Bytes rlp{};
+    transaction.encode_for_signing(rlp);
 
-        ++tx_id;
-    }
-    increment_total_processed_blocks();
+    batch_->push_back(AddressRecovery{block_num, block_hash, transaction.odd_y_parity});
+    intx::be::unsafe::store(batch_->back().tx_signature, transaction.r);
+    intx::be::unsafe::store(batch_->back().tx_signature + kHashLength, transaction.s);
+    batch_->back().rlp = std::move(rlp);
 
-    return is_stopping() ? Stage::Result::kAborted : Stage::Result::kSuccess;
+    return Stage::Result::kSuccess;
 }
 
 void Senders::recover_batch(ThreadPool& worker_pool, secp256k1_context* context) {
@@ -430,13 +434,22 @@ void Senders::recover_batch(ThreadPool& worker_pool, secp256k1_context* context)
     ready_batch->reserve(max_batch_size_);
     ready_batch.swap(batch_);
     auto batch_result = worker_pool.submit([=]() {
-        std::for_each(ready_batch->begin(), ready_batch->end(), [&](auto& package) {
-            const auto tx_hash{keccak256(package.rlp)};
-            const bool ok = silkworm_recover_address(package.tx_from.bytes, tx_hash.bytes, package.tx_signature, package.odd_y_parity, context);
+        // Hash all the signing payloads of the batch at once, so that similar-sized ones share the SIMD lanes
+        std::vector<ByteView> payloads;
+        payloads.reserve(ready_batch->size());
+        for (const auto& package : *ready_batch) {
+            payloads.emplace_back(package.rlp);
+        }
+        std::vector<ethash::hash256> tx_hashes(payloads.size());
+        keccak256_many(payloads, tx_hashes);
+
+        for (size_t i{0}; i < ready_batch->size(); ++i) {
+            auto& package{(*ready_batch)[i]};
+            const bool ok = silkworm_recover_address(package.tx_from.bytes, tx_hashes[i].bytes, package.tx_signature, package.odd_y_parity, context);
             if (!ok) {
                 throw std::runtime_error("Unable to recover from address in block " + std::to_string(package.block_num));
             }
-        });
+        }
         return ready_batch;
     });
     results_.emplace_back(std::move(batch_result));
@@ -27,6 +27,7 @@
 
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
+#include <silkworm/core/types/transaction_view.hpp>
 #include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/node/etl/collector.hpp>
 #include <silkworm/node/stagedsync/stages/stage.hpp>
@@ -58,7 +59,8 @@ class Senders final : public Stage {
   private:
     Stage::Result parallel_recover(db::RWTxn& txn);
 
-    Stage::Result add_to_batch(BlockNum block_num, std::shared_ptr<Hash> block_hash, std::vector<Transaction>&& transactions);
+    Stage::Result add_to_batch(BlockNum block_num, const std::shared_ptr<Hash>& block_hash, uint32_t tx_id,
+                               const TransactionView& transaction);
     void recover_batch(ThreadPool& worker_pool, secp256k1_context* context);
     void collect_senders();
     void collect_senders(std::shared_ptr<AddressRecoveryBatch>& batch);
@@ -16,11 +16,19 @@
 
 #include "stage_tx_lookup.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 
 #include <magic_enum.hpp>
 
 #include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/crypto/keccak.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 
 namespace silkworm::stagedsync {
@@ -60,6 +68,15 @@ Stage::Result TxLookup::forward(db::RWTxn& txn) {
         if (!previous_progress && node_settings_->prune_mode->tx_index().enabled())
             previous_progress = node_settings_->prune_mode->tx_index().value_from_head(target_progress);
 
+        // Transactions in snapshots are found through their tx-hash index, so they need no TxLookup entries at all
+        const auto frozen_block_num{db::DataModel::highest_frozen_block_number()};
+        if (previous_progress < frozen_block_num) {
+            log::Info(log_prefix_, {"op", "skip frozen",
+                                    "from", std::to_string(previous_progress),
+                                    "to", std::to_string(std::min(frozen_block_num, target_progress))});
+            previous_progress = std::min(frozen_block_num, target_progress);
+        }
+
         if (previous_progress < target_progress)
             forward_impl(txn, previous_progress, target_progress);
 
@@ -313,51 +330,134 @@ void TxLookup::prune_impl(db::RWTxn& txn, BlockNum from, BlockNum to) {
     log_lck.unlock();
 }
 
-void TxLookup::collect_transaction_hashes_from_canonical_bodies(db::RWTxn& txn,
-                                                                const BlockNum from, const BlockNum to,
-                                                                const bool for_deletion) {
-    using namespace std::chrono_literals;
-    auto log_time{std::chrono::steady_clock::now()};
-
-    db::DataModel data_model{txn};
-
-    BlockNum target_block_num{std::max(from, to)};
-    BlockNum start_block_num{std::min(from, to) + 1};
+//! Number of transactions whose hashes are computed together in one batch
+static constexpr size_t kTxHashBatchSize{1024};
+
+//! \brief Collects the hashes of the transactions in canonical blocks [first, last] reading bodies from given txn
+//! \details Transactions are visited as views into db pages, which stay valid while txn is open: hence they are
+//! hashed in batches, so that similar-sized ones share the SIMD lanes
+static void collect_range_transaction_hashes(db::ROTxn& txn, BlockNum first, BlockNum last, bool for_deletion,
+                                             etl::Collector& collector,
+                                             const std::function<void(BlockNum)>& on_block_done) {
+    std::vector<ByteView> encoded_txns;
+    std::vector<BlockNum> block_numbers;
+    std::vector<ethash::hash256> txn_hashes(kTxHashBatchSize);
+    encoded_txns.reserve(kTxHashBatchSize);
+    block_numbers.reserve(kTxHashBatchSize);
 
     Bytes etl_value{};
+    const auto flush = [&]() {
+        keccak256_many(encoded_txns, txn_hashes);
+        for (size_t i{0}; i < encoded_txns.size(); ++i) {
+            // The same loop is used for forward and for unwind
+            // In the latter two records must be deleted hence we set etl_value only if deletion is not required
+            if (!for_deletion) {
+                Bytes block_num_as_bytes(sizeof(BlockNum), '\0');
+                endian::store_big_u64(block_num_as_bytes.data(), block_numbers[i]);
+                etl_value.assign(zeroless_view(block_num_as_bytes));
+            }
+            collector.collect({Bytes{txn_hashes[i].bytes, kHashLength}, etl_value});
+        }
+        encoded_txns.clear();
+        block_numbers.clear();
+    };
 
-    for (BlockNum current_block_num = start_block_num; current_block_num <= target_block_num; ++current_block_num) {
+    for (BlockNum current_block_num{first}; current_block_num <= last; ++current_block_num) {
         auto current_hash = db::read_canonical_hash(txn, current_block_num);
         if (!current_hash) throw StageError(Stage::Result::kBadChainSequence,
                                             "Canonical hash at height " + std::to_string(current_block_num) + " not found");
-        std::vector<Bytes> rlp_encoded_txs;
-        auto found = data_model.read_rlp_transactions(current_block_num, *current_hash, rlp_encoded_txs);
+
+        auto found = db::for_each_transaction_view(txn, current_block_num, *current_hash, [&](const TransactionView& txn_view) {
+            encoded_txns.push_back(txn_view.encoded);
+            block_numbers.push_back(current_block_num);
+            return true;
+        });
         if (!found) throw StageError(Stage::Result::kBadChainSequence,
                                      "Canonical block at height " + std::to_string(current_block_num) + " not found");
 
-        // Log and abort check
-        if (const auto now{std::chrono::steady_clock::now()}; log_time <= now) {
+        if (encoded_txns.size() >= kTxHashBatchSize) {
+            flush();
+        }
+        on_block_done(current_block_num);
+    }
+    flush();
+}
+
+void TxLookup::collect_transaction_hashes_from_canonical_bodies(db::RWTxn& txn,
+                                                                const BlockNum from, const BlockNum to,
+                                                                const bool for_deletion) {
+    using namespace std::chrono_literals;
+
+    // Transactions in snapshots have no TxLookup entries (see forward), so their bodies must not be read from db
+    const BlockNum target_block_num{std::max(from, to)};
+    const BlockNum start_block_num{std::max(std::min(from, to), db::DataModel::highest_frozen_block_number()) + 1};
+    if (start_block_num > target_block_num) {
+        return;
+    }
+
+    // Log and abort check, invoked by any worker after each block
+    std::atomic<std::chrono::steady_clock::rep> log_time{std::chrono::steady_clock::now().time_since_epoch().count()};
+    const auto on_block_done = [&](BlockNum block_num) {
+        const auto now{std::chrono::steady_clock::now()};
+        auto next_log_time{log_time.load()};
+        if (next_log_time <= now.time_since_epoch().count() &&
+            log_time.compare_exchange_strong(next_log_time, (now + 5s).time_since_epoch().count())) {
             throw_if_stopping();
             std::unique_lock log_lck(sl_mutex_);
-            current_key_ = std::to_string(current_block_num);
-            log_time = now + 5s;
+            current_key_ = std::to_string(block_num);
         }
+    };
 
-        if (rlp_encoded_txs.empty()) continue;
+    if (txn.commit_disabled()) {
+        // Bodies may be uncommitted data invisible to other transactions: stick to the current one
+        collect_range_transaction_hashes(txn, start_block_num, target_block_num, for_deletion, *collector_, on_block_done);
+        return;
+    }
 
-        // The same loop is used for forward and for unwind
-        // In the latter two records must be deleted hence we set etl_value only if deletion is not required
-        if (!for_deletion) {
-            Bytes block_num_as_bytes(sizeof(BlockNum), '\0');
-            endian::store_big_u64(block_num_as_bytes.data(), current_block_num);
-            etl_value.assign(zeroless_view(block_num_as_bytes));
-        }
+    // Each worker processes the next available block range on its own read-only txn collecting into its own collector
+    const BlockNum range_count{(target_block_num - start_block_num) / blocks_per_range_ + 1};
+    const size_t max_workers{max_workers_ ? max_workers_ : std::max(std::thread::hardware_concurrency(), 1u)};
+    const auto num_workers{static_cast<size_t>(std::min<BlockNum>(max_workers, range_count))};
+    std::vector<std::unique_ptr<etl::Collector>> worker_collectors;
+    for (size_t i{0}; i < num_workers; ++i) {
+        worker_collectors.push_back(std::make_unique<etl::Collector>(node_settings_->data_directory->etl().path(),
+                                                                     node_settings_->etl_buffer_size / num_workers));
+    }
+    std::atomic<BlockNum> next_range{0};
+    std::mutex failure_mutex;
+    std::exception_ptr failure;  // first error raised by any worker, the others just stop
+    auto env{txn.db()};
+
+    ThreadPool worker_pool{num_workers};
+    for (size_t i{0}; i < num_workers; ++i) {
+        worker_pool.push_task([&, i]() {
+            try {
+                for (BlockNum range{next_range++}; range < range_count; range = next_range++) {
+                    if (std::scoped_lock lock{failure_mutex}; failure) {
+                        return;
+                    }
+                    const BlockNum first{start_block_num + range * blocks_per_range_};
+                    const BlockNum last{std::min(first + blocks_per_range_ - 1, target_block_num)};
+                    db::ROTxnManaged range_txn{env};
+                    collect_range_transaction_hashes(range_txn, first, last, for_deletion, *worker_collectors[i],
+                                                     on_block_done);
+                }
+            } catch (...) {
+                std::scoped_lock lock{failure_mutex};
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+            }
+        });
+    }
+    worker_pool.wait_for_tasks();
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
 
-        for (auto& rlp_encoded_tx : rlp_encoded_txs) {
-            // Hash transaction rlp
-            auto transaction_hash = keccak256(rlp_encoded_tx);  // see Transaction::hash()
-            collector_->collect({Bytes(transaction_hash.bytes, kHashLength), etl_value});
-        }
+    // Sorted worker outputs are merged into the stage collector and loaded all together
+    for (auto& worker_collector : worker_collectors) {
+        collector_->merge(*worker_collector);
     }
 }
 
@@ -23,8 +23,16 @@ namespace silkworm::stagedsync {
 
 class TxLookup : public Stage {
   public:
-    explicit TxLookup(NodeSettings* node_settings, SyncContext* sync_context)
-        : Stage(sync_context, db::stages::kTxLookupKey, node_settings){};
+    //! Default number of consecutive blocks processed by one worker task
+    static constexpr BlockNum kDefaultBlocksPerRange{10'000};
+
+    //! \param max_workers: max number of worker threads collecting transaction hashes (0 means hardware concurrency)
+    //! \param blocks_per_range: number of consecutive blocks processed by one worker task
+    explicit TxLookup(NodeSettings* node_settings, SyncContext* sync_context,
+                      size_t max_workers = 0, BlockNum blocks_per_range = kDefaultBlocksPerRange)
+        : Stage(sync_context, db::stages::kTxLookupKey, node_settings),
+          max_workers_{max_workers},
+          blocks_per_range_{blocks_per_range} {}
     ~TxLookup() override = default;
 
     Stage::Result forward(db::RWTxn& txn) final;
@@ -33,6 +41,9 @@ class TxLookup : public Stage {
     std::vector<std::string> get_log_progress() final;
 
   private:
+    size_t max_workers_;
+    BlockNum blocks_per_range_;
+
     std::unique_ptr<etl::Collector> collector_{nullptr};
 
     std::atomic_bool loading_{false};  // Whether we're in ETL loading phase
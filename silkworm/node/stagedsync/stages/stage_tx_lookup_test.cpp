@@ -14,6 +14,10 @@
    limitations under the License.
 */
 
+#include <bit>
+#include <optional>
+#include <vector>
+
 #include <catch2/catch.hpp>
 
 #include <silkworm/core/common/test_util.hpp>
@@ -21,6 +25,7 @@
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/node/stagedsync/stages/stage_tx_lookup.hpp>
 #include <silkworm/node/test/context.hpp>
+#include <silkworm/node/test/snapshots.hpp>
 
 using namespace evmc::literals;
 
@@ -147,4 +152,130 @@ TEST_CASE("Stage Transaction Lookups") {
     }
 }
 
+//! Write canonical blocks [first, last] holding one transaction each, returning the transaction hashes
+static std::vector<evmc::bytes32> write_sample_blocks(db::RWTxn& txn, BlockNum first, BlockNum last) {
+    db::PooledCursor bodies_table(txn, db::table::kBlockBodies);
+    db::PooledCursor transactions_table(txn, db::table::kBlockTransactions);
+
+    Transaction transaction{test::sample_transactions()[0]};
+    db::detail::BlockBodyForStorage body{};
+    body.base_txn_id = 1;
+    body.txn_count = 1 + 2;  // + 2: 2 system txs (1 at the beginning and 1 at the end)
+
+    std::vector<evmc::bytes32> tx_hashes;
+    for (BlockNum block_num{first}; block_num <= last; ++block_num) {
+        transaction.nonce = block_num;
+        Bytes tx_rlp{};
+        rlp::encode(tx_rlp, transaction);
+        tx_hashes.push_back(std::bit_cast<evmc_bytes32>(keccak256(tx_rlp)));
+
+        const evmc::bytes32 block_hash{block_num};
+        transactions_table.upsert(db::to_slice(db::block_key(body.base_txn_id + 1)), db::to_slice(tx_rlp));
+        bodies_table.upsert(db::to_slice(db::block_key(block_num, block_hash.bytes)), db::to_slice(body.encode()));
+        db::write_canonical_header_hash(txn, block_hash.bytes, block_num);
+        body.base_txn_id += body.txn_count;
+    }
+
+    db::stages::write_stage_progress(txn, db::stages::kBlockBodiesKey, last);
+    db::stages::write_stage_progress(txn, db::stages::kBlockHashesKey, last);
+    db::stages::write_stage_progress(txn, db::stages::kExecutionKey, last);
+    return tx_hashes;
+}
+
+//! Block number indexed in TxLookup for the specified transaction hash, if any
+static std::optional<BlockNum> read_tx_lookup(db::ROTxn& txn, const evmc::bytes32& tx_hash) {
+    db::PooledCursor lookup_table(txn, db::table::kTxLookup);
+    const auto lookup_data{lookup_table.find(db::to_slice(tx_hash.bytes), false)};
+    BlockNum block_num{0};
+    if (!lookup_data.done || !endian::from_big_compact(db::from_slice(lookup_data.value), block_num)) {
+        return std::nullopt;
+    }
+    return block_num;
+}
+
+static void set_tx_index_prune_before(NodeSettings& node_settings, BlockNum block_num) {
+    db::PruneDistance olderHistory, olderReceipts, olderSenders, olderTxIndex, olderCallTraces;
+    db::PruneThreshold beforeHistory, beforeReceipts, beforeSenders, beforeTxIndex, beforeCallTraces;
+    beforeTxIndex.emplace(block_num);
+    node_settings.prune_mode =
+        db::parse_prune_mode("t", olderHistory, olderReceipts, olderSenders, olderTxIndex, olderCallTraces,
+                             beforeHistory, beforeReceipts, beforeSenders, beforeTxIndex, beforeCallTraces);
+}
+
+TEST_CASE("Stage Transaction Lookups with multiple workers") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+
+    test::Context context;
+    db::RWTxn& txn{context.rw_txn()};  // commit enabled, so that workers can read blocks on their own txns
+
+    const auto tx_hashes{write_sample_blocks(txn, 1, 10)};
+    txn.commit_and_renew();
+
+    stagedsync::SyncContext sync_context{};
+    stagedsync::TxLookup stage_tx_lookup(&context.node_settings(), &sync_context,
+                                         /*max_workers=*/4, /*blocks_per_range=*/2);
+    REQUIRE(stage_tx_lookup.forward(txn) == stagedsync::Stage::Result::kSuccess);
+    CHECK(db::PooledCursor{txn, db::table::kTxLookup}.size() == 10);
+    for (size_t i{0}; i < tx_hashes.size(); ++i) {
+        CHECK(read_tx_lookup(txn, tx_hashes[i]) == i + 1);
+    }
+
+    SECTION("Unwind") {
+        sync_context.unwind_point.emplace(4);
+        REQUIRE(stage_tx_lookup.unwind(txn) == stagedsync::Stage::Result::kSuccess);
+        CHECK(db::PooledCursor{txn, db::table::kTxLookup}.size() == 4);
+        for (size_t i{0}; i < tx_hashes.size(); ++i) {
+            CHECK(read_tx_lookup(txn, tx_hashes[i]) == (i < 4 ? std::optional<BlockNum>{i + 1} : std::nullopt));
+        }
+    }
+
+    SECTION("Prune") {
+        set_tx_index_prune_before(context.node_settings(), 6);  // Will delete any transaction before block 6
+        REQUIRE(stage_tx_lookup.prune(txn) == stagedsync::Stage::Result::kSuccess);
+        CHECK(db::PooledCursor{txn, db::table::kTxLookup}.size() == 5);
+        for (size_t i{0}; i < tx_hashes.size(); ++i) {
+            CHECK(read_tx_lookup(txn, tx_hashes[i]) == (i >= 5 ? std::optional<BlockNum>{i + 1} : std::nullopt));
+        }
+    }
+}
+
+TEST_CASE("Stage Transaction Lookups skip frozen blocks") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+
+    test::SampleSnapshotRepository snapshots;
+    const BlockNum frozen_block_num{db::DataModel::highest_frozen_block_number()};
+    REQUIRE(frozen_block_num > 10);
+
+    test::Context context;
+    db::RWTxn& txn{context.rw_txn()};
+
+    // Frozen blocks are not in db, so any attempt to read them fails
+    const auto tx_hashes{write_sample_blocks(txn, frozen_block_num + 1, frozen_block_num + 6)};
+    txn.commit_and_renew();
+
+    stagedsync::SyncContext sync_context{};
+    stagedsync::TxLookup stage_tx_lookup(&context.node_settings(), &sync_context,
+                                         /*max_workers=*/2, /*blocks_per_range=*/2);
+    REQUIRE(stage_tx_lookup.forward(txn) == stagedsync::Stage::Result::kSuccess);
+    CHECK(db::PooledCursor{txn, db::table::kTxLookup}.size() == 6);
+    for (size_t i{0}; i < tx_hashes.size(); ++i) {
+        CHECK(read_tx_lookup(txn, tx_hashes[i]) == frozen_block_num + 1 + i);
+    }
+
+    SECTION("Unwind below frozen blocks") {
+        sync_context.unwind_point.emplace(frozen_block_num - 10);
+        REQUIRE(stage_tx_lookup.unwind(txn) == stagedsync::Stage::Result::kSuccess);
+        CHECK(db::PooledCursor{txn, db::table::kTxLookup}.size() == 0);
+    }
+
+    SECTION("Prune across frozen blocks") {
+        set_tx_index_prune_before(context.node_settings(), frozen_block_num + 3);
+        REQUIRE(stage_tx_lookup.prune(txn) == stagedsync::Stage::Result::kSuccess);
+        CHECK(db::PooledCursor{txn, db::table::kTxLookup}.size() == 4);
+        CHECK_FALSE(read_tx_lookup(txn, tx_hashes[0]));
+        CHECK_FALSE(read_tx_lookup(txn, tx_hashes[1]));
+        CHECK(read_tx_lookup(txn, tx_hashes[2]) == frozen_block_num + 3);
+    }
+}
+
 }  // namespace silkworm
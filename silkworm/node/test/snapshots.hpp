@@ -21,6 +21,8 @@
 
 #include <silkworm/core/common/endian.hpp>
 #include <silkworm/core/common/util.hpp>
+#include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/snapshot/index.hpp>
 #include <silkworm/node/snapshot/repository.hpp>
 #include <silkworm/node/test/files.hpp>
 
@@ -411,4 +413,38 @@ class SampleTransactionSnapshotPath : public SampleSnapshotPath {
         : SampleSnapshotPath(std::move(path), 1'500'012, 1'500'014, SnapshotType::transactions) {}
 };
 
+//! \brief SampleSnapshotRepository holds the sample snapshot files along with their indexes in a temporary directory
+//! \details It is the snapshot repository of db::DataModel for its whole lifetime, so that sample blocks are frozen
+class SampleSnapshotRepository {
+  public:
+    SampleSnapshotRepository()
+        : header_snapshot_{tmp_dir_.path()},
+          body_snapshot_{tmp_dir_.path()},
+          txn_snapshot_{tmp_dir_.path()},
+          repository_{snapshot::SnapshotSettings{tmp_dir_.path()}} {
+        snapshot::HeaderIndex header_index{SampleHeaderSnapshotPath{header_snapshot_.path()}};
+        header_index.build();
+        snapshot::BodyIndex body_index{SampleBodySnapshotPath{body_snapshot_.path()}};
+        body_index.build();
+        snapshot::TransactionIndex txn_index{SampleTransactionSnapshotPath{txn_snapshot_.path()}};
+        txn_index.build();
+        repository_.reopen_folder();
+        db::DataModel::set_snapshot_repository(&repository_);
+    }
+    ~SampleSnapshotRepository() { db::DataModel::reset_snapshot_repository(); }
+
+    // Not copyable nor movable
+    SampleSnapshotRepository(const SampleSnapshotRepository&) = delete;
+    SampleSnapshotRepository& operator=(const SampleSnapshotRepository&) = delete;
+
+    [[nodiscard]] snapshot::SnapshotRepository& repository() { return repository_; }
+
+  private:
+    TemporaryDirectory tmp_dir_;
+    SampleHeaderSnapshotFile header_snapshot_;
+    SampleBodySnapshotFile body_snapshot_;
+    SampleTransactionSnapshotFile txn_snapshot_;
+    snapshot::SnapshotRepository repository_;
+};
+
 }  // namespace silkworm::test
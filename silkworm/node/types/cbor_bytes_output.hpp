@@ -16,32 +16,25 @@
 
 #pragma once
 
-#include <cstddef>
-#include <memory>
+#include <cbor/output.h>
 
-#include <evmc/evmc.hpp>
-
-#include <silkworm/core/common/base.hpp>
-#include <silkworm/core/common/lru_cache.hpp>
-#include <silkworm/core/types/block.hpp>
+#include <silkworm/core/common/bytes.hpp>
 
 namespace silkworm {
 
-class BlockCache {
+//! CBOR output appending the encoded data to an externally owned buffer, which can be reused across encodings
+class CborBytesOutput : public cbor::output {
   public:
-    explicit BlockCache(std::size_t capacity = 1024, bool shared_cache = true)
-        : block_cache_(capacity, shared_cache) {}
+    explicit CborBytesOutput(Bytes& bytes) : bytes_{bytes} {}
 
-    std::optional<std::shared_ptr<BlockWithHash>> get(const evmc::bytes32& key) {
-        return block_cache_.get_as_copy(key);
-    }
+    unsigned char* data() override { return bytes_.data(); }
+    unsigned int size() override { return static_cast<unsigned int>(bytes_.size()); }
 
-    void insert(const evmc::bytes32& key, const std::shared_ptr<BlockWithHash>& block) {
-        block_cache_.put(key, block);
-    }
+    void put_byte(unsigned char value) override { bytes_.push_back(value); }
+    void put_bytes(const unsigned char* data, int size) override { bytes_.append(data, static_cast<size_t>(size)); }
 
   private:
-    lru_cache<evmc::bytes32, std::shared_ptr<BlockWithHash>> block_cache_;
+    Bytes& bytes_;
 };
 
 }  // namespace silkworm
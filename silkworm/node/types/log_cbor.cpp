@@ -22,14 +22,20 @@
 #include <cbor/decoder.h>
 #include <cbor/encoder.h>
 #include <cbor/input.h>
-#include <cbor/output_dynamic.h>
 
 #include <silkworm/infra/common/ensure.hpp>
+#include <silkworm/node/types/cbor_bytes_output.hpp>
 
 namespace silkworm {
 
 Bytes cbor_encode(const std::vector<Log>& v) {
-    cbor::output_dynamic output{};
+    Bytes encoded;
+    cbor_encode(v, encoded);
+    return encoded;
+}
+
+void cbor_encode(const std::vector<Log>& v, Bytes& out) {
+    CborBytesOutput output{out};
     cbor::encoder encoder{output};
 
     encoder.write_array(static_cast<int>(v.size()));
@@ -43,8 +49,6 @@ Bytes cbor_encode(const std::vector<Log>& v) {
         }
         encoder.write_bytes(l.data.data(), static_cast<unsigned>(l.data.size()));
     }
-
-    return Bytes{output.data(), output.size()};
 }
 
 //! LogCborListener is a *stateful* CBOR consumer suitable for parsing a CBOR-encoded sequence of Logs
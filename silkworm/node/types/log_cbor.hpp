@@ -27,6 +27,9 @@ namespace silkworm {
 // See core/types/log.go
 Bytes cbor_encode(const std::vector<Log>& v);
 
+//! \brief Same as above but appending the encoded data to the given buffer, which can be reused
+void cbor_encode(const std::vector<Log>& v, Bytes& out);
+
 //! LogCborConsumer is the interface to implement for parsing a CBOR-encoded sequence of Logs
 struct LogCborConsumer {
     virtual ~LogCborConsumer() = default;
@@ -17,12 +17,19 @@
 #include "receipt_cbor.hpp"
 
 #include <cbor/encoder.h>
-#include <cbor/output_dynamic.h>
+
+#include <silkworm/node/types/cbor_bytes_output.hpp>
 
 namespace silkworm {
 
 Bytes cbor_encode(const std::vector<Receipt>& v) {
-    cbor::output_dynamic output{};
+    Bytes encoded;
+    cbor_encode(v, encoded);
+    return encoded;
+}
+
+void cbor_encode(const std::vector<Receipt>& v, Bytes& out) {
+    CborBytesOutput output{out};
     cbor::encoder encoder{output};
 
     if (v.empty()) {
@@ -41,8 +48,6 @@ Bytes cbor_encode(const std::vector<Receipt>& v) {
 
         // Bloom filter and logs are omitted, same as in Erigon
     }
-
-    return Bytes{output.data(), output.size()};
 }
 
 }  // namespace silkworm
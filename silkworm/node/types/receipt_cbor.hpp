@@ -24,4 +24,7 @@ namespace silkworm {
 // See core/types/receipt.go and migrations/receipt_cbor.go
 Bytes cbor_encode(const std::vector<Receipt>& v);
 
+//! \brief Same as above but appending the encoded data to the given buffer, which can be reused
+void cbor_encode(const std::vector<Receipt>& v, Bytes& out);
+
 }  // namespace silkworm
@@ -23,6 +23,7 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/concurrency/awaitable_wait_for_all.hpp>
 #include <silkworm/infra/concurrency/co_spawn_sw.hpp>
+#include <silkworm/infra/metrics/metrics.hpp>
 #include <silkworm/sentry/common/random.hpp>
 #include <silkworm/sentry/common/sleep.hpp>
 
@@ -166,19 +167,43 @@ void PeerManager::add_observer(std::weak_ptr<PeerManagerObserver> observer) {
     return observers;
 }
 
+struct PeerManagerMetrics {
+    metrics::Gauge& peers;
+    metrics::Counter& peers_added;
+    metrics::Counter& peers_removed;
+    metrics::Counter& connect_errors;
+};
+
+// Shared by all peer managers, registered once at first use
+static PeerManagerMetrics& peer_manager_metrics() {
+    auto& registry{metrics::Registry::instance()};
+    static PeerManagerMetrics peer_manager_metrics{
+        .peers = registry.gauge("silkworm_sentry_peers", "Number of connected peers past handshake"),
+        .peers_added = registry.counter("silkworm_sentry_peers_added_total", "Number of peers added after handshake"),
+        .peers_removed = registry.counter("silkworm_sentry_peers_removed_total", "Number of peers removed"),
+        .connect_errors = registry.counter("silkworm_sentry_peer_connect_errors_total", "Number of failed peer connections"),
+    };
+    return peer_manager_metrics;
+}
+
 void PeerManager::on_peer_added(const std::shared_ptr<rlpx::Peer>& peer) {
+    peer_manager_metrics().peers.increment();
+    peer_manager_metrics().peers_added.increment();
     for (auto& observer : observers()) {
         observer->on_peer_added(peer);
     }
 }
 
 void PeerManager::on_peer_removed(const std::shared_ptr<rlpx::Peer>& peer) {
+    peer_manager_metrics().peers.decrement();
+    peer_manager_metrics().peers_removed.increment();
     for (auto& observer : observers()) {
         observer->on_peer_removed(peer);
     }
 }
 
 void PeerManager::on_peer_connect_error(const EnodeUrl& peer_url) {
+    peer_manager_metrics().connect_errors.increment();
     for (auto& observer : observers()) {
         observer->on_peer_connect_error(peer_url);
     }
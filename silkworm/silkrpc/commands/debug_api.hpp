@@ -22,7 +22,7 @@
 #include <boost/asio/thread_pool.hpp>
 #include <nlohmann/json.hpp>
 
-#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
@@ -168,7 +168,7 @@ Task<void> ErigonRpcApi::handle_erigon_get_block_by_timestamp(const nlohmann::js
             co_await tx->close();  // RAII not (yet) available with coroutines
             co_return;
         }
-        const auto total_difficulty = co_await chain_storage->read_total_difficulty(block_with_hash->hash, block_number);
+        const auto total_difficulty = co_await core::read_total_difficulty(*block_cache_, *chain_storage, block_with_hash->hash, block_number);
         const Block extended_block{*block_with_hash, *total_difficulty, full_tx};
 
         reply = make_json_content(request["id"], extended_block);
@@ -211,7 +211,7 @@ Task<void> ErigonRpcApi::handle_erigon_get_block_receipts_by_block_hash(const nl
             co_await tx->close();  // RAII not (yet) available with coroutines
             co_return;
         }
-        auto receipts{co_await core::get_receipts(tx_database, *block_with_hash)};
+        auto receipts{co_await core::get_receipts(*tx, tx_database, *chain_storage, workers_, *block_cache_, *block_with_hash)};
         SILK_TRACE << "#receipts: " << receipts.size();
 
         const auto block{block_with_hash->block};
@@ -364,7 +364,7 @@ Task<void> ErigonRpcApi::handle_erigon_get_latest_logs(const nlohmann::json& req
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        LogsWalker logs_walker(backend_, *block_cache_, tx_database);
+        LogsWalker logs_walker(backend_, *block_cache_, tx_database, database_, &workers_);
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
         if (start == end && start == std::numeric_limits<std::uint64_t>::max()) {
             auto error_msg = "invalid eth_getLogs filter block_hash: " + filter.block_hash.value();
@@ -423,7 +423,7 @@ Task<void> ErigonRpcApi::handle_erigon_get_logs_by_hash(const nlohmann::json& re
             co_await tx->close();  // RAII not (yet) available with coroutines
             co_return;
         }
-        const auto receipts{co_await core::get_receipts(tx_database, *block_with_hash)};
+        const auto receipts{co_await core::get_receipts(*tx, tx_database, *chain_storage, workers_, *block_cache_, *block_with_hash)};
         SILK_DEBUG << "receipts.size(): " << receipts.size();
         std::vector<Logs> logs{};
         logs.reserve(receipts.size());
@@ -532,7 +532,7 @@ Task<void> ErigonRpcApi::handle_erigon_watch_the_burn(const nlohmann::json& requ
             issuance.total_burnt = "0x" + intx::hex(total_burnt);
             intx::uint256 tips = 0;
             if (block_with_hash->block.header.base_fee_per_gas) {
-                const auto receipts{co_await core::get_receipts(tx_database, *block_with_hash)};
+                const auto receipts{co_await core::get_receipts(*tx, tx_database, *chain_storage, workers_, *block_cache_, *block_with_hash)};
                 const auto block{block_with_hash->block};
                 for (size_t i{0}; i < block.transactions.size(); i++) {
                     auto tip = block.transactions[i].effective_gas_price(block.header.base_fee_per_gas.value_or(0));
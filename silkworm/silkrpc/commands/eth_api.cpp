@@ -35,7 +35,10 @@
 #include <silkworm/core/types/transaction.hpp>
 #include <silkworm/infra/common/ensure.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/db/stages.hpp>
 #include <silkworm/node/db/util.hpp>
+#include <silkworm/node/stagedsync/stages/stage_interhashes/proof_loader.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
 #include <silkworm/silkrpc/core/blocks.hpp>
 #include <silkworm/silkrpc/core/cached_chain.hpp>
@@ -50,6 +53,7 @@
 #include <silkworm/silkrpc/core/receipts.hpp>
 #include <silkworm/silkrpc/core/state_reader.hpp>
 #include <silkworm/silkrpc/ethdb/kv/cached_database.hpp>
+#include <silkworm/silkrpc/json/buffer_writer.hpp>
 #include <silkworm/silkrpc/stagedsync/stages.hpp>
 
 namespace silkworm::rpc::commands {
@@ -161,7 +165,7 @@ Task<void> EthereumRpcApi::handle_eth_gas_price(const nlohmann::json& request, n
             return core::read_block_by_number(*block_cache_, *chain_storage, block_number);
         };
 
-        GasPriceOracle gas_price_oracle{block_provider};
+        GasPriceOracle gas_price_oracle{block_provider, fee_summary_cache_};
         auto gas_price = co_await gas_price_oracle.suggested_price(latest_block_number);
 
         const auto block_with_hash = co_await block_provider(latest_block_number);
@@ -185,12 +189,12 @@ Task<void> EthereumRpcApi::handle_eth_gas_price(const nlohmann::json& request, n
 }
 
 // https://eth.wiki/json-rpc/API#eth_getblockbyhash
-Task<void> EthereumRpcApi::handle_eth_get_block_by_hash(const nlohmann::json& request, nlohmann::json& reply) {
+Task<void> EthereumRpcApi::handle_eth_get_block_by_hash(const nlohmann::json& request, std::string& reply) {
     auto params = request["params"];
     if (params.size() != 2) {
         auto error_msg = "invalid eth_getBlockByHash params: " + params.dump();
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], 100, error_msg);
+        make_glaze_json_error(reply, request["id"], 100, error_msg);
         co_return;
     }
     auto block_hash = params[0].get<evmc::bytes32>();
@@ -206,21 +210,21 @@ Task<void> EthereumRpcApi::handle_eth_get_block_by_hash(const nlohmann::json& re
         const auto block_with_hash = co_await core::read_block_by_hash(*block_cache_, *chain_storage, block_hash);
         if (block_with_hash) {
             BlockNum block_number = block_with_hash->block.header.number;
-            const auto total_difficulty{co_await chain_storage->read_total_difficulty(block_with_hash->hash, block_number)};
+            const auto total_difficulty{co_await core::read_total_difficulty(*block_cache_, *chain_storage, block_with_hash->hash, block_number)};
             ensure_post_condition(total_difficulty.has_value(), "no difficulty for block number=" + std::to_string(block_number));
             const Block extended_block{*block_with_hash, *total_difficulty, full_tx};
-            reply = make_json_content(request["id"], extended_block);
+            make_buffer_json_content(reply, request["id"], extended_block);
         } else {
-            reply = make_json_content(request["id"], {});
+            make_buffer_json_content(reply, request["id"]);
         }
     } catch (const std::invalid_argument& iv) {
-        reply = make_json_content(request["id"], {});
+        make_buffer_json_content(reply, request["id"]);
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, e.what());
+        make_glaze_json_error(reply, request["id"], 100, e.what());
     } catch (...) {
         SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, "unexpected exception");
+        make_glaze_json_error(reply, request["id"], 100, "unexpected exception");
     }
 
     co_await tx->close();  // RAII not (yet) available with coroutines
@@ -228,12 +232,12 @@ Task<void> EthereumRpcApi::handle_eth_get_block_by_hash(const nlohmann::json& re
 }
 
 // https://eth.wiki/json-rpc/API#eth_getblockbynumber
-Task<void> EthereumRpcApi::handle_eth_get_block_by_number(const nlohmann::json& request, nlohmann::json& reply) {
+Task<void> EthereumRpcApi::handle_eth_get_block_by_number(const nlohmann::json& request, std::string& reply) {
     const auto& params = request["params"];
     if (params.size() != 2) {
         auto error_msg = "invalid eth_getBlockByNumber params: " + params.dump();
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], 100, error_msg);
+        make_glaze_json_error(reply, request["id"], 100, error_msg);
         co_return;
     }
     const auto block_id = params[0].get<std::string>();
@@ -248,22 +252,22 @@ Task<void> EthereumRpcApi::handle_eth_get_block_by_number(const nlohmann::json&
         const auto chain_storage = tx->create_storage(tx_database, backend_);
         const auto block_with_hash = co_await core::read_block_by_number(*block_cache_, *chain_storage, block_number);
         if (block_with_hash) {
-            const auto total_difficulty{co_await chain_storage->read_total_difficulty(block_with_hash->hash, block_number)};
+            const auto total_difficulty{co_await core::read_total_difficulty(*block_cache_, *chain_storage, block_with_hash->hash, block_number)};
             ensure_post_condition(total_difficulty.has_value(), "no difficulty for block number=" + std::to_string(block_number));
             const Block extended_block{*block_with_hash, *total_difficulty, full_tx};
 
-            reply = make_json_content(request["id"], extended_block);
+            make_buffer_json_content(reply, request["id"], extended_block);
         } else {
-            reply = make_json_content(request["id"], {});
+            make_buffer_json_content(reply, request["id"]);
         }
     } catch (const std::invalid_argument& iv) {
-        reply = make_json_content(request["id"], {});
+        make_buffer_json_content(reply, request["id"]);
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, e.what());
+        make_glaze_json_error(reply, request["id"], 100, e.what());
     } catch (...) {
         SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, "unexpected exception");
+        make_glaze_json_error(reply, request["id"], 100, "unexpected exception");
     }
 
     co_await tx->close();  // RAII not (yet) available with coroutines
@@ -377,7 +381,7 @@ Task<void> EthereumRpcApi::handle_eth_get_uncle_by_block_hash_and_index(const nl
                 reply = make_json_content(request["id"], nullptr);
             } else {
                 const auto block_number = block_with_hash->block.header.number;
-                const auto total_difficulty = co_await chain_storage->read_total_difficulty(block_hash, block_number);
+                const auto total_difficulty = co_await core::read_total_difficulty(*block_cache_, *chain_storage, block_hash, block_number);
                 const auto& uncle = ommers[idx];
 
                 silkworm::BlockWithHash uncle_block_with_hash{{{}, uncle}, uncle.hash()};
@@ -431,7 +435,7 @@ Task<void> EthereumRpcApi::handle_eth_get_uncle_by_block_number_and_index(const
                 SILK_WARN << "invalid_argument: index not found processing request: " << request.dump();
                 reply = make_json_content(request["id"], nullptr);
             } else {
-                const auto total_difficulty = co_await chain_storage->read_total_difficulty(block_with_hash->hash, block_number);
+                const auto total_difficulty = co_await core::read_total_difficulty(*block_cache_, *chain_storage, block_with_hash->hash, block_number);
                 const auto& uncle = ommers[idx];
 
                 silkworm::BlockWithHash uncle_block_with_hash{{{}, uncle}, uncle.hash()};
@@ -862,7 +866,7 @@ Task<void> EthereumRpcApi::handle_eth_get_transaction_receipt(const nlohmann::js
             co_await tx->close();  // RAII not (yet) available with coroutines
             co_return;
         }
-        auto receipts = co_await core::get_receipts(tx_database, *block_with_hash);
+        auto receipts = co_await core::get_receipts(*tx, tx_database, *chain_storage, workers_, *block_cache_, *block_with_hash);
         const auto& transactions = block_with_hash->block.transactions;
         if (receipts.size() != transactions.size()) {
             throw std::invalid_argument{"Unexpected size for receipts in handle_eth_get_transaction_receipt"};
@@ -1278,7 +1282,7 @@ Task<void> EthereumRpcApi::handle_eth_max_priority_fee_per_gas(const nlohmann::j
             return core::read_block_by_number(*block_cache_, *chain_storage, block_number);
         };
 
-        GasPriceOracle gas_price_oracle{block_provider};
+        GasPriceOracle gas_price_oracle{block_provider, fee_summary_cache_};
         auto gas_price = co_await gas_price_oracle.suggested_price(latest_block_number);
 
         reply = make_json_content(request["id"], to_quantity(gas_price));
@@ -1527,10 +1531,12 @@ Task<void> EthereumRpcApi::handle_eth_new_filter(const nlohmann::json& request,
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        LogsWalker logs_walker(backend_, *block_cache_, tx_database);
+        LogsWalker logs_walker(backend_, *block_cache_, tx_database, database_, &workers_);
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
         filter.start = start;
         filter.end = end;
+        // Filters following the chain head get the logs of new blocks pushed, the others are polled from the database
+        filter.follows_head = !filter.block_hash && (!filter.to_block || filter.to_block.value() == core::kLatestBlockId);
 
         const auto filter_id = filter_storage_->add_filter(filter);
         SILK_TRACE << "Added a new filter, storage size: " << filter_storage_->size();
@@ -1620,7 +1626,7 @@ Task<void> EthereumRpcApi::handle_eth_get_filter_logs(const nlohmann::json& requ
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        LogsWalker logs_walker(backend_, *block_cache_, tx_database);
+        LogsWalker logs_walker(backend_, *block_cache_, tx_database, database_, &workers_);
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
 
         if (filter.start != start && filter.end != end) {
@@ -1668,25 +1674,39 @@ Task<void> EthereumRpcApi::handle_eth_get_filter_changes(const nlohmann::json& r
     }
 
     auto& filter = filter_opt.value().get();
+
+    // Logs pushed on new blocks since the last poll are just drained, unless too many have been accumulated
+    auto pending_logs = filter_storage_->take_pending_logs(filter_id);
+    if (pending_logs && !pending_logs->lost_range) {
+        reply = make_json_content(request["id"], pending_logs->logs);
+        co_return;
+    }
+
     auto tx = co_await database_->begin();
 
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        LogsWalker logs_walker(backend_, *block_cache_, tx_database);
-        const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
+        LogsWalker logs_walker(backend_, *block_cache_, tx_database, database_, &workers_);
 
         std::vector<Log> logs;
-        if (filter.start == start && filter.end != end) {
-            co_await logs_walker.get_logs(start, end, filter.addresses, filter.topics, logs);
-            filter.logs.insert(filter.logs.end(), logs.begin(), logs.end());
-        } else if (filter.start != start && filter.end != end) {
-            co_await logs_walker.get_logs(start, end, filter.addresses, filter.topics, logs);
-            filter.logs.clear();
-            filter.logs.insert(filter.logs.end(), logs.begin(), logs.end());
+        if (pending_logs) {
+            const auto [first_block, last_block] = *pending_logs->lost_range;
+            co_await logs_walker.get_logs(first_block, last_block, filter.addresses, filter.topics, logs);
+        } else {
+            const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
+
+            if (filter.start == start && filter.end != end) {
+                co_await logs_walker.get_logs(start, end, filter.addresses, filter.topics, logs);
+                filter.logs.insert(filter.logs.end(), logs.begin(), logs.end());
+            } else if (filter.start != start && filter.end != end) {
+                co_await logs_walker.get_logs(start, end, filter.addresses, filter.topics, logs);
+                filter.logs.clear();
+                filter.logs.insert(filter.logs.end(), logs.begin(), logs.end());
+            }
+            filter.start = start;
+            filter.end = end;
         }
-        filter.start = start;
-        filter.end = end;
 
         reply = make_json_content(request["id"], logs);
     } catch (const std::exception& e) {
@@ -1746,7 +1766,7 @@ Task<void> EthereumRpcApi::handle_eth_get_logs(const nlohmann::json& request, st
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        LogsWalker logs_walker(backend_, *block_cache_, tx_database);
+        LogsWalker logs_walker(backend_, *block_cache_, tx_database, database_, &workers_);
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
         if (start == end && start == std::numeric_limits<std::uint64_t>::max()) {
             auto error_msg = "invalid eth_getLogs filter block_hash: " + filter.block_hash.value();
@@ -1889,14 +1909,72 @@ Task<void> EthereumRpcApi::handle_eth_sign_transaction(const nlohmann::json& req
     co_return;
 }
 
-// https://eth.wiki/json-rpc/API#eth_getproof
+// https://eips.ethereum.org/EIPS/eip-1186
 Task<void> EthereumRpcApi::handle_eth_get_proof(const nlohmann::json& request, nlohmann::json& reply) {
+    auto params = request["params"];
+    if (params.size() != 3) {
+        auto error_msg = "invalid eth_getProof params: " + params.dump();
+        SILK_ERROR << error_msg;
+        reply = make_json_error(request["id"], 100, error_msg);
+        co_return;
+    }
+    const auto address = params[0].get<evmc::address>();
+    const auto storage_keys = params[1].get<std::vector<evmc::bytes32>>();
+    const auto block_id = params[2].get<std::string>();
+    SILK_DEBUG << "address: " << address << " #storage_keys: " << storage_keys.size() << " block_id: " << block_id;
+
     auto tx = co_await database_->begin();
 
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        reply = make_json_content(request["id"], to_quantity(0));
+        // Proofs are built from the intermediate hashes in the local database, hence only for the state they refer to
+        auto local_txn = tx->local_txn();
+        if (!local_txn) {
+            reply = make_json_error(request["id"], -32000, "eth_getProof requires a local database");
+            co_await tx->close();  // RAII not (yet) available with coroutines
+            co_return;
+        }
+
+        const auto [block_number, is_latest_block] = co_await core::get_block_number(BlockNumberOrHash{block_id}, tx_database);
+        const auto state_block_number = db::stages::read_stage_progress(*local_txn, db::stages::kIntermediateHashesKey);
+        if (block_number != state_block_number) {
+            const auto error_msg = "eth_getProof supported only at block " + std::to_string(state_block_number);
+            reply = make_json_error(request["id"], -32000, error_msg);
+            co_await tx->close();  // RAII not (yet) available with coroutines
+            co_return;
+        }
+
+        trie::ProofLoader proof_loader{*local_txn};
+        const auto account_proof = proof_loader.calculate_proof(address, storage_keys);
+
+        const auto header = db::read_canonical_header(*local_txn, block_number);
+        ensure(header && header->state_root == account_proof.state_root, "state root mismatch at block " + std::to_string(block_number));
+
+        nlohmann::json result;
+        result["address"] = address;
+        result["accountProof"] = nlohmann::json::array();
+        for (const auto& node : account_proof.proof) {
+            result["accountProof"].push_back("0x" + silkworm::to_hex(node));
+        }
+        const auto& account = account_proof.account ? *account_proof.account : silkworm::Account{};
+        result["balance"] = to_quantity(account.balance);
+        result["codeHash"] = account.code_hash;
+        result["nonce"] = to_quantity(account.nonce);
+        result["storageHash"] = account_proof.storage_root;
+        result["storageProof"] = nlohmann::json::array();
+        for (const auto& storage_proof : account_proof.storage_proofs) {
+            nlohmann::json storage_proof_json;
+            storage_proof_json["key"] = storage_proof.location;
+            storage_proof_json["value"] = to_quantity(silkworm::ByteView{storage_proof.value.bytes});
+            storage_proof_json["proof"] = nlohmann::json::array();
+            for (const auto& node : storage_proof.proof) {
+                storage_proof_json["proof"].push_back("0x" + silkworm::to_hex(node));
+            }
+            result["storageProof"].push_back(std::move(storage_proof_json));
+        }
+
+        reply = make_json_content(request["id"], result);
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
         reply = make_json_error(request["id"], 100, e.what());
@@ -2057,41 +2135,15 @@ Task<void> EthereumRpcApi::handle_eth_submit_work(const nlohmann::json& request,
 
 // https://eth.wiki/json-rpc/API#eth_subscribe
 Task<void> EthereumRpcApi::handle_eth_subscribe(const nlohmann::json& request, nlohmann::json& reply) {
-    auto tx = co_await database_->begin();
-
-    try {
-        ethdb::TransactionDatabase tx_database{*tx};
-
-        reply = make_json_content(request["id"], to_quantity(0));
-    } catch (const std::exception& e) {
-        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, e.what());
-    } catch (...) {
-        SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, "unexpected exception");
-    }
-
-    co_await tx->close();  // RAII not (yet) available with coroutines
+    // Subscriptions need push notifications, so they are served only on WebSocket connections (see ws::Connection)
+    reply = make_json_error(request["id"], -32601, "notifications not supported");
     co_return;
 }
 
 // https://eth.wiki/json-rpc/API#eth_unsubscribe
 Task<void> EthereumRpcApi::handle_eth_unsubscribe(const nlohmann::json& request, nlohmann::json& reply) {
-    auto tx = co_await database_->begin();
-
-    try {
-        ethdb::TransactionDatabase tx_database{*tx};
-
-        reply = make_json_content(request["id"], to_quantity(0));
-    } catch (const std::exception& e) {
-        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, e.what());
-    } catch (...) {
-        SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, "unexpected exception");
-    }
-
-    co_await tx->close();  // RAII not (yet) available with coroutines
+    // Subscriptions need push notifications, so they are served only on WebSocket connections (see ws::Connection)
+    reply = make_json_error(request["id"], -32601, "notifications not supported");
     co_return;
 }
 
@@ -2128,14 +2180,14 @@ Task<void> EthereumRpcApi::handle_fee_history(const nlohmann::json& request, nlo
         rpc::fee_history::BlockProvider block_provider = [this, &chain_storage](BlockNum block_number) {
             return core::read_block_by_number(*(this->block_cache_), *chain_storage, block_number);
         };
-        rpc::fee_history::ReceiptsProvider receipts_provider = [&tx_database](const BlockWithHash& block_with_hash) {
-            return core::get_receipts(tx_database, block_with_hash);
+        rpc::fee_history::ReceiptsProvider receipts_provider = [this, &tx, &tx_database, &chain_storage](const BlockWithHash& block_with_hash) {
+            return core::get_receipts(*tx, tx_database, *chain_storage, workers_, *block_cache_, block_with_hash);
         };
 
         auto chain_config = co_await chain_storage->read_chain_config();
         ensure(chain_config.has_value(), "cannot read chain config");
 
-        rpc::fee_history::FeeHistoryOracle oracle{*chain_config, block_provider, receipts_provider};
+        rpc::fee_history::FeeHistoryOracle oracle{*chain_config, block_provider, receipts_provider, fee_summary_cache_};
 
         const auto block_number = co_await core::get_block_number(newest_block, tx_database);
         auto fee_history = co_await oracle.fee_history(block_number, block_count, reward_percentile);
@@ -23,10 +23,11 @@
 #include <evmc/evmc.hpp>
 #include <nlohmann/json.hpp>
 
-#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 #include <silkworm/core/types/receipt.hpp>
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
+#include <silkworm/silkrpc/core/fee_summary_cache.hpp>
 #include <silkworm/silkrpc/core/filter_storage.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 #include <silkworm/silkrpc/ethbackend/backend.hpp>
@@ -58,6 +59,7 @@ class EthereumRpcApi {
           miner_{must_use_private_service<txpool::Miner>(io_context_)},
           tx_pool_{must_use_private_service<txpool::TransactionPool>(io_context_)},
           filter_storage_{must_use_shared_service<FilterStorage>(io_context_)},
+          fee_summary_cache_{must_use_shared_service<FeeSummaryCache>(io_context_)},
           workers_{workers} {}
 
     virtual ~EthereumRpcApi() = default;
@@ -71,8 +73,8 @@ class EthereumRpcApi {
     Task<void> handle_eth_protocol_version(const nlohmann::json& request, nlohmann::json& reply);
     Task<void> handle_eth_syncing(const nlohmann::json& request, nlohmann::json& reply);
     Task<void> handle_eth_gas_price(const nlohmann::json& request, nlohmann::json& reply);
-    Task<void> handle_eth_get_block_by_hash(const nlohmann::json& request, nlohmann::json& reply);
-    Task<void> handle_eth_get_block_by_number(const nlohmann::json& request, nlohmann::json& reply);
+    Task<void> handle_eth_get_block_by_hash(const nlohmann::json& request, std::string& reply);
+    Task<void> handle_eth_get_block_by_number(const nlohmann::json& request, std::string& reply);
     Task<void> handle_eth_get_block_transaction_count_by_hash(const nlohmann::json& request, nlohmann::json& reply);
     Task<void> handle_eth_get_block_transaction_count_by_number(const nlohmann::json& request, nlohmann::json& reply);
     Task<void> handle_eth_get_uncle_by_block_hash_and_index(const nlohmann::json& request, nlohmann::json& reply);
@@ -127,6 +129,7 @@ class EthereumRpcApi {
     txpool::Miner* miner_;
     txpool::TransactionPool* tx_pool_;
     FilterStorage* filter_storage_;
+    FeeSummaryCache* fee_summary_cache_;
     boost::asio::thread_pool& workers_;
 
     friend class silkworm::http::RequestHandler;
@@ -22,7 +22,7 @@
 #include <nlohmann/json.hpp>
 
 #include <silkworm/core/common/base.hpp>
-#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 #include <silkworm/core/common/bytes.hpp>
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
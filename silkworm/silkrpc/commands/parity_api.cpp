@@ -30,17 +30,18 @@
 #include <silkworm/silkrpc/core/receipts.hpp>
 #include <silkworm/silkrpc/core/state_reader.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
+#include <silkworm/silkrpc/json/buffer_writer.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
 
 namespace silkworm::rpc::commands {
 
 // https://eth.wiki/json-rpc/API#parity_getblockreceipts
-Task<void> ParityRpcApi::handle_parity_get_block_receipts(const nlohmann::json& request, nlohmann::json& reply) {
+Task<void> ParityRpcApi::handle_parity_get_block_receipts(const nlohmann::json& request, std::string& reply) {
     auto params = request["params"];
     if (params.size() != 1) {
         auto error_msg = "invalid parity_getBlockReceipts params: " + params.dump();
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], 100, error_msg);
+        make_glaze_json_error(reply, request["id"], 100, error_msg);
         co_return;
     }
     const auto block_id = params[0].get<std::string>();
@@ -55,26 +56,26 @@ Task<void> ParityRpcApi::handle_parity_get_block_receipts(const nlohmann::json&
         const auto block_number = co_await core::get_block_number(block_id, tx_database);
         const auto block_with_hash = co_await core::read_block_by_number(*block_cache_, *chain_storage, block_number);
         if (block_with_hash) {
-            auto receipts{co_await core::get_receipts(tx_database, *block_with_hash)};
+            auto receipts{co_await core::get_receipts(*tx, tx_database, *chain_storage, workers_, *block_cache_, *block_with_hash)};
             SILK_TRACE << "#receipts: " << receipts.size();
 
             const auto block{block_with_hash->block};
             for (size_t i{0}; i < block.transactions.size(); i++) {
                 receipts[i].effective_gas_price = block.transactions[i].effective_gas_price(block.header.base_fee_per_gas.value_or(0));
             }
-            reply = make_json_content(request["id"], receipts);
+            make_buffer_json_content(reply, request["id"], receipts);
         } else {
-            reply = make_json_content(request["id"], {});
+            make_buffer_json_content(reply, request["id"]);
         }
     } catch (const std::invalid_argument& iv) {
         SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.dump();
-        reply = make_json_content(request["id"], {});
+        make_buffer_json_content(reply, request["id"]);
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, e.what());
+        make_glaze_json_error(reply, request["id"], 100, e.what());
     } catch (...) {
         SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, "unexpected exception");
+        make_glaze_json_error(reply, request["id"], 100, "unexpected exception");
     }
 
     co_await tx->close();  // RAII not (yet) available with coroutines
@@ -19,9 +19,10 @@
 #include <silkworm/infra/concurrency/task.hpp>
 
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <nlohmann/json.hpp>
 
-#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
@@ -36,8 +37,9 @@ namespace silkworm::rpc::commands {
 
 class ParityRpcApi {
   public:
-    explicit ParityRpcApi(boost::asio::io_context& io_context)
-        : block_cache_{must_use_shared_service<BlockCache>(io_context)},
+    ParityRpcApi(boost::asio::io_context& io_context, boost::asio::thread_pool& workers)
+        : workers_{workers},
+          block_cache_{must_use_shared_service<BlockCache>(io_context)},
           database_{must_use_private_service<ethdb::Database>(io_context)},
           backend_{must_use_private_service<ethbackend::BackEnd>(io_context)} {}
     virtual ~ParityRpcApi() = default;
@@ -46,10 +48,11 @@ class ParityRpcApi {
     ParityRpcApi& operator=(const ParityRpcApi&) = delete;
 
   protected:
-    Task<void> handle_parity_get_block_receipts(const nlohmann::json& request, nlohmann::json& reply);
+    Task<void> handle_parity_get_block_receipts(const nlohmann::json& request, std::string& reply);
     Task<void> handle_parity_list_storage_keys(const nlohmann::json& request, nlohmann::json& reply);
 
   private:
+    boost::asio::thread_pool& workers_;
     BlockCache* block_cache_;
     ethdb::Database* database_;
     ethbackend::BackEnd* backend_;
@@ -32,6 +32,8 @@
 #include <silkworm/silkrpc/commands/trace_api.hpp>
 #include <silkworm/silkrpc/commands/txpool_api.hpp>
 #include <silkworm/silkrpc/commands/web3_api.hpp>
+#include <silkworm/silkrpc/common/constants.hpp>
+#include <silkworm/silkrpc/common/execution_lanes.hpp>
 
 namespace silkworm::http {
 class RequestHandler;
@@ -53,26 +55,38 @@ class RpcApi : protected EthereumRpcApi,
                TxPoolRpcApi,
                OtsRpcApi {
   public:
-    explicit RpcApi(boost::asio::io_context& io_context, boost::asio::thread_pool& workers)
-        : EthereumRpcApi{io_context, workers},
+    //! Each API namespace having a dedicated execution lane runs its long-running tasks on the lane workers
+    explicit RpcApi(boost::asio::io_context& io_context, boost::asio::thread_pool& workers, const ExecutionLanes& execution_lanes)
+        : EthereumRpcApi{io_context, execution_lanes.workers(kEthApiNamespace, workers)},
           NetRpcApi{io_context},
           AdminRpcApi{io_context},
           Web3RpcApi{io_context},
-          DebugRpcApi{io_context, workers},
-          ParityRpcApi{io_context},
-          ErigonRpcApi{io_context},
-          TraceRpcApi{io_context, workers},
+          DebugRpcApi{io_context, execution_lanes.workers(kDebugApiNamespace, workers)},
+          ParityRpcApi{io_context, execution_lanes.workers(kParityApiNamespace, workers)},
+          ErigonRpcApi{io_context, execution_lanes.workers(kErigonApiNamespace, workers)},
+          TraceRpcApi{io_context, execution_lanes.workers(kTraceApiNamespace, workers)},
           EngineRpcApi(io_context),
           TxPoolRpcApi(io_context),
-          OtsRpcApi{io_context, workers} {}
+          OtsRpcApi{io_context, execution_lanes.workers(kOtterscanApiNamespace, workers)},
+          default_workers_{workers},
+          execution_lanes_{execution_lanes} {}
 
     ~RpcApi() override = default;
 
     RpcApi(const RpcApi&) = delete;
     RpcApi& operator=(const RpcApi&) = delete;
 
+    //! The workers for the long-running tasks not belonging to any API namespace (e.g. reply compression)
+    [[nodiscard]] boost::asio::thread_pool& default_workers() const { return default_workers_; }
+
+    [[nodiscard]] const ExecutionLanes& execution_lanes() const { return execution_lanes_; }
+
     friend class RpcApiTable;
     friend class silkworm::http::RequestHandler;
+
+  private:
+    boost::asio::thread_pool& default_workers_;
+    const ExecutionLanes& execution_lanes_;
 };
 
 }  // namespace silkworm::rpc::commands
@@ -26,6 +26,7 @@ namespace silkworm::rpc::commands {
 
 RpcApiTable::RpcApiTable(const std::string& api_spec) {
     build_handlers(api_spec);
+    register_latency_histograms();
 }
 
 std::optional<RpcApiTable::HandleMethod> RpcApiTable::find_json_handler(const std::string& method) const {
@@ -52,6 +53,34 @@ std::optional<RpcApiTable::HandleStream> RpcApiTable::find_stream_handler(const
     return handle_method_pair->second;
 }
 
+metrics::Histogram* RpcApiTable::find_latency_histogram(const std::string& method) const {
+    const auto histogram_pair = latency_histograms_.find(method);
+    if (histogram_pair == latency_histograms_.end()) {
+        return nullptr;
+    }
+    return histogram_pair->second;
+}
+
+std::string_view RpcApiTable::find_api_namespace(const std::string& method) const {
+    const auto api_namespace_pair = api_namespaces_.find(method);
+    if (api_namespace_pair == api_namespaces_.end()) {
+        return {};
+    }
+    return api_namespace_pair->second;
+}
+
+void RpcApiTable::register_latency_histograms() {
+    // Register all histograms upfront so that request dispatch never touches the metrics registry
+    auto& registry = metrics::Registry::instance();
+    auto register_method = [&](const std::string& method) {
+        latency_histograms_[method] = &registry.histogram(
+            "silkworm_rpc_request_duration_seconds", "Duration of JSON-RPC request handling", {{"method", method}}, 1e-9);
+    };
+    for (const auto& [method, _] : method_handlers_) register_method(method);
+    for (const auto& [method, _] : method_handlers_glaze_) register_method(method);
+    for (const auto& [method, _] : stream_handlers_) register_method(method);
+}
+
 void RpcApiTable::build_handlers(const std::string& api_spec) {
     size_t start = 0;
     size_t end = api_spec.find(kApiSpecSeparator);
@@ -88,7 +117,18 @@ void RpcApiTable::add_handlers(const std::string& api_namespace) {
         add_ots_handlers();
     } else {
         SILK_WARN << "Server::add_handlers invalid namespace [" << api_namespace << "] ignored";
+        return;
     }
+
+    // The methods just added are served by this API namespace, unless their handler belongs to another one
+    const auto add_api_namespace = [&](const auto& handlers) {
+        for (const auto& [method, _] : handlers) {
+            api_namespaces_.try_emplace(method, api_namespace);
+        }
+    };
+    add_api_namespace(method_handlers_);
+    add_api_namespace(method_handlers_glaze_);
+    add_api_namespace(stream_handlers_);
 }
 
 void RpcApiTable::add_admin_handlers() {
@@ -120,8 +160,6 @@ void RpcApiTable::add_eth_handlers() {
     method_handlers_[http::method::k_eth_protocolVersion] = &commands::RpcApi::handle_eth_protocol_version;
     method_handlers_[http::method::k_eth_syncing] = &commands::RpcApi::handle_eth_syncing;
     method_handlers_[http::method::k_eth_gasPrice] = &commands::RpcApi::handle_eth_gas_price;
-    method_handlers_[http::method::k_eth_getBlockByHash] = &commands::RpcApi::handle_eth_get_block_by_hash;
-    method_handlers_[http::method::k_eth_getBlockByNumber] = &commands::RpcApi::handle_eth_get_block_by_number;
     method_handlers_[http::method::k_eth_getBlockTransactionCountByHash] = &commands::RpcApi::handle_eth_get_block_transaction_count_by_hash;
     method_handlers_[http::method::k_eth_getBlockTransactionCountByNumber] = &commands::RpcApi::handle_eth_get_block_transaction_count_by_number;
     method_handlers_[http::method::k_eth_getUncleByBlockHashAndIndex] = &commands::RpcApi::handle_eth_get_uncle_by_block_hash_and_index;
@@ -160,8 +198,6 @@ void RpcApiTable::add_eth_handlers() {
     method_handlers_[http::method::k_eth_submitWork] = &commands::RpcApi::handle_eth_submit_work;
     method_handlers_[http::method::k_eth_subscribe] = &commands::RpcApi::handle_eth_subscribe;
     method_handlers_[http::method::k_eth_unsubscribe] = &commands::RpcApi::handle_eth_unsubscribe;
-    method_handlers_[http::method::k_eth_getBlockReceipts] = &commands::RpcApi::handle_parity_get_block_receipts;
-    method_handlers_[http::method::k_eth_getTransactionReceiptsByBlock] = &commands::RpcApi::handle_parity_get_block_receipts;
     method_handlers_[http::method::k_eth_maxPriorityFeePerGas] = &commands::RpcApi::handle_eth_max_priority_fee_per_gas;
     method_handlers_[http::method::k_eth_feeHistory] = &commands::RpcApi::handle_fee_history;
     method_handlers_[http::method::k_eth_callMany] = &commands::RpcApi::handle_eth_call_many;
@@ -169,6 +205,14 @@ void RpcApiTable::add_eth_handlers() {
     // GLAZE methods
     method_handlers_glaze_[http::method::k_eth_getLogs] = &commands::RpcApi::handle_eth_get_logs;
     method_handlers_glaze_[http::method::k_eth_call] = &commands::RpcApi::handle_eth_call;
+
+    // Direct-to-buffer JSON methods
+    method_handlers_glaze_[http::method::k_eth_getBlockByHash] = &commands::RpcApi::handle_eth_get_block_by_hash;
+    method_handlers_glaze_[http::method::k_eth_getBlockByNumber] = &commands::RpcApi::handle_eth_get_block_by_number;
+    method_handlers_glaze_[http::method::k_eth_getBlockReceipts] = &commands::RpcApi::handle_parity_get_block_receipts;
+    method_handlers_glaze_[http::method::k_eth_getTransactionReceiptsByBlock] = &commands::RpcApi::handle_parity_get_block_receipts;
+    api_namespaces_[http::method::k_eth_getBlockReceipts] = kParityApiNamespace;
+    api_namespaces_[http::method::k_eth_getTransactionReceiptsByBlock] = kParityApiNamespace;
 }
 
 void RpcApiTable::add_net_handlers() {
@@ -178,7 +222,7 @@ void RpcApiTable::add_net_handlers() {
 }
 
 void RpcApiTable::add_parity_handlers() {
-    method_handlers_[http::method::k_parity_getBlockReceipts] = &commands::RpcApi::handle_parity_get_block_receipts;
+    method_handlers_glaze_[http::method::k_parity_getBlockReceipts] = &commands::RpcApi::handle_parity_get_block_receipts;
     method_handlers_[http::method::k_parity_listStorageKeys] = &commands::RpcApi::handle_parity_list_storage_keys;
 }
 
@@ -204,7 +248,7 @@ void RpcApiTable::add_trace_handlers() {
     method_handlers_[http::method::k_trace_rawTransaction] = &commands::RpcApi::handle_trace_raw_transaction;
     method_handlers_[http::method::k_trace_replayBlockTransactions] = &commands::RpcApi::handle_trace_replay_block_transactions;
     method_handlers_[http::method::k_trace_replayTransaction] = &commands::RpcApi::handle_trace_replay_transaction;
-    method_handlers_[http::method::k_trace_block] = &commands::RpcApi::handle_trace_block;
+    method_handlers_glaze_[http::method::k_trace_block] = &commands::RpcApi::handle_trace_block;
     method_handlers_[http::method::k_trace_get] = &commands::RpcApi::handle_trace_get;
     method_handlers_[http::method::k_trace_transaction] = &commands::RpcApi::handle_trace_transaction;
 
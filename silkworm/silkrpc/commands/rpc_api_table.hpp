@@ -19,11 +19,13 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include <silkworm/infra/concurrency/task.hpp>
 
 #include <nlohmann/json.hpp>
 
+#include <silkworm/infra/metrics/metrics.hpp>
 #include <silkworm/silkrpc/commands/rpc_api.hpp>
 #include <silkworm/silkrpc/json/stream.hpp>
 
@@ -44,8 +46,15 @@ class RpcApiTable {
     [[nodiscard]] std::optional<HandleMethodGlaze> find_json_glaze_handler(const std::string& method) const;
     [[nodiscard]] std::optional<HandleStream> find_stream_handler(const std::string& method) const;
 
+    //! Histogram of the handling latency for the specified method or \code nullptr if method is not supported
+    [[nodiscard]] metrics::Histogram* find_latency_histogram(const std::string& method) const;
+
+    //! API namespace whose handler serves the specified method (i.e. whose workers run it) or empty if not supported
+    [[nodiscard]] std::string_view find_api_namespace(const std::string& method) const;
+
   private:
     void build_handlers(const std::string& api_spec);
+    void register_latency_histograms();
     void add_handlers(const std::string& api_namespace);
     void add_admin_handlers();
     void add_debug_handlers();
@@ -62,6 +71,8 @@ class RpcApiTable {
     std::map<std::string, HandleMethod> method_handlers_;
     std::map<std::string, HandleMethodGlaze> method_handlers_glaze_;
     std::map<std::string, HandleStream> stream_handlers_;
+    std::map<std::string, metrics::Histogram*> latency_histograms_;
+    std::map<std::string, std::string> api_namespaces_;
 };
 
 }  // namespace silkworm::rpc::commands
@@ -0,0 +1,52 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "rpc_api_table.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/silkrpc/common/constants.hpp>
+#include <silkworm/silkrpc/common/execution_lanes.hpp>
+
+namespace silkworm::rpc::commands {
+
+TEST_CASE("RpcApiTable::find_api_namespace", "[silkrpc][commands][rpc_api_table]") {
+    const RpcApiTable rpc_api_table{kDefaultEth1ApiSpec};
+
+    SECTION("method served by its own namespace") {
+        CHECK(rpc_api_table.find_api_namespace("eth_blockNumber") == kEthApiNamespace);
+        CHECK(rpc_api_table.find_api_namespace("debug_traceTransaction") == kDebugApiNamespace);
+        CHECK(rpc_api_table.find_api_namespace("parity_getBlockReceipts") == kParityApiNamespace);
+    }
+
+    SECTION("method served by the handler of another namespace") {
+        CHECK(rpc_api_table.find_api_namespace("eth_getBlockReceipts") == kParityApiNamespace);
+        CHECK(rpc_api_table.find_api_namespace("eth_getTransactionReceiptsByBlock") == kParityApiNamespace);
+    }
+
+    SECTION("method not supported") {
+        CHECK(rpc_api_table.find_api_namespace("eth_unknownMethod").empty());
+        CHECK(rpc_api_table.find_api_namespace("").empty());
+    }
+
+    SECTION("lane looked up by handler namespace") {
+        const ExecutionLanes execution_lanes{{{.api_namespace = "parity", .max_concurrency = 1}}};
+        CHECK(execution_lanes.find(rpc_api_table.find_api_namespace("eth_getBlockReceipts")) != nullptr);
+        CHECK(execution_lanes.find(rpc_api_table.find_api_namespace("eth_blockNumber")) == nullptr);
+    }
+}
+
+}  // namespace silkworm::rpc::commands
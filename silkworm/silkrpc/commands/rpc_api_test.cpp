@@ -39,6 +39,7 @@
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/node/db/buffer.hpp>
 #include <silkworm/silkrpc/common/constants.hpp>
+#include <silkworm/silkrpc/common/execution_lanes.hpp>
 #include <silkworm/silkrpc/ethdb/file/local_database.hpp>
 #include <silkworm/silkrpc/http/request_handler.hpp>
 #include <silkworm/silkrpc/test/context_test_base.hpp>
@@ -266,7 +267,7 @@ class LocalContextTestBase : public silkworm::rpc::test::ContextTestBase {
 template <typename TestRequestHandler>
 class RpcApiTestBase : public LocalContextTestBase {
   public:
-    explicit RpcApiTestBase(const std::shared_ptr<mdbx::env_managed>& chaindata_env) : LocalContextTestBase(chaindata_env), workers_{1}, socket{io_context_}, rpc_api{io_context_, workers_}, rpc_api_table{kDefaultEth1ApiSpec} {
+    explicit RpcApiTestBase(const std::shared_ptr<mdbx::env_managed>& chaindata_env) : LocalContextTestBase(chaindata_env), workers_{1}, socket{io_context_}, rpc_api{io_context_, workers_, execution_lanes_}, rpc_api_table{kDefaultEth1ApiSpec} {
     }
 
     template <auto method, typename... Args>
@@ -276,6 +277,7 @@ class RpcApiTestBase : public LocalContextTestBase {
     }
 
     boost::asio::thread_pool workers_;
+    ExecutionLanes execution_lanes_;
     boost::asio::ip::tcp::socket socket;
     commands::RpcApi rpc_api;
     commands::RpcApiTable rpc_api_table;
@@ -386,6 +388,57 @@ TEST_CASE("rpc_api io (all files)", "[silkrpc][rpc_api]") {
     }
 }
 
+TEST_CASE("rpc_api regenerated receipts", "[silkrpc][rpc_api]") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    const auto tests_dir = get_tests_dir();
+    const auto db_dir = TemporaryDirectory::get_unique_temporary_path();
+    auto db = open_db(db_dir);
+    db::RWTxnManaged txn{*db};
+    db::table::check_or_create_chaindata_tables(txn);
+    auto state_buffer = populate_genesis(txn, tests_dir);
+    populate_blocks(txn, tests_dir, state_buffer);
+    txn.commit_and_stop();
+
+    const auto get_block_receipts = [](RpcApiTestBase<RequestHandler_ForTest>& test_base, BlockNum block_number) {
+        const nlohmann::json request{{"jsonrpc", "2.0"}, {"id", 1}, {"method", "eth_getBlockReceipts"}, {"params", {to_quantity(block_number)}}};
+        http::Reply reply;
+        test_base.run<&RequestHandler_ForTest::request_and_create_reply>(request, reply);
+        return nlohmann::json::parse(reply.content);
+    };
+
+    // Stored receipts of all blocks up to the head, i.e. until no block is found
+    std::vector<nlohmann::json> stored_receipts;
+    {
+        RpcApiTestBase<RequestHandler_ForTest> test_base{db};
+        for (BlockNum block_number{1};; ++block_number) {
+            auto reply = get_block_receipts(test_base, block_number);
+            REQUIRE(!reply.contains("error"));
+            if (reply["result"].is_null()) break;
+            stored_receipts.push_back(std::move(reply));
+        }
+    }
+    REQUIRE(!stored_receipts.empty());
+
+    // Prune all receipts and logs, so that they are regenerated by re-executing the blocks
+    db::RWTxnManaged prune_txn{*db};
+    prune_txn->clear_map(db::table::kBlockReceipts.name);
+    prune_txn->clear_map(db::table::kLogs.name);
+    prune_txn.commit_and_stop();
+
+    // A new test base has its own block cache, hence receipts are not served by the cache
+    RpcApiTestBase<RequestHandler_ForTest> test_base{db};
+    for (size_t i{0}; i < stored_receipts.size(); ++i) {
+        const auto regenerated_receipts = get_block_receipts(test_base, i + 1);
+        INFO("Block number:         " << i + 1)
+        INFO("Stored receipts:      " << stored_receipts[i].dump())
+        INFO("Regenerated receipts: " << regenerated_receipts.dump())
+        CHECK(regenerated_receipts == stored_receipts[i]);
+    }
+
+    db->close();
+    std::filesystem::remove_all(db_dir);
+}
+
 TEST_CASE("rpc_api io (individual)", "[silkrpc][rpc_api][ignore]") {
     test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
     const auto tests_dir = get_tests_dir();
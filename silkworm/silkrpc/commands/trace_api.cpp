@@ -29,6 +29,7 @@
 #include <silkworm/silkrpc/core/evm_trace.hpp>
 #include <silkworm/silkrpc/ethdb/kv/cached_database.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
+#include <silkworm/silkrpc/json/buffer_writer.hpp>
 #include <silkworm/silkrpc/json/call.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
 #include <silkworm/silkrpc/types/call.hpp>
@@ -313,12 +314,12 @@ Task<void> TraceRpcApi::handle_trace_replay_transaction(const nlohmann::json& re
 }
 
 // https://eth.wiki/json-rpc/API#trace_block
-Task<void> TraceRpcApi::handle_trace_block(const nlohmann::json& request, nlohmann::json& reply) {
+Task<void> TraceRpcApi::handle_trace_block(const nlohmann::json& request, std::string& reply) {
     const auto& params = request["params"];
     if (params.empty()) {
         auto error_msg = "invalid trace_block params: " + params.dump();
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], 100, error_msg);
+        make_glaze_json_error(reply, request["id"], 100, error_msg);
         co_return;
     }
     const auto block_number_or_hash = params[0].get<BlockNumberOrHash>();
@@ -332,7 +333,7 @@ Task<void> TraceRpcApi::handle_trace_block(const nlohmann::json& request, nlohma
         const auto chain_storage = tx->create_storage(tx_database, backend_);
         const auto block_with_hash = co_await core::read_block_by_number_or_hash(*block_cache_, *chain_storage, tx_database, block_number_or_hash);
         if (!block_with_hash) {
-            reply = make_json_error(request["id"], 100, "block not found");
+            make_glaze_json_error(reply, request["id"], 100, "block not found");
             co_await tx->close();  // RAII not (yet) available with coroutines
             co_return;
         }
@@ -340,13 +341,13 @@ Task<void> TraceRpcApi::handle_trace_block(const nlohmann::json& request, nlohma
         trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
         trace::Filter filter;
         const auto result = co_await executor.trace_block(*block_with_hash, filter);
-        reply = make_json_content(request["id"], result);
+        make_buffer_json_content(reply, request["id"], result);
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, e.what());
+        make_glaze_json_error(reply, request["id"], 100, e.what());
     } catch (...) {
         SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, "unexpected exception");
+        make_glaze_json_error(reply, request["id"], 100, "unexpected exception");
     }
 
     co_await tx->close();  // RAII not (yet) available with coroutines
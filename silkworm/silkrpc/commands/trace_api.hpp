@@ -22,7 +22,7 @@
 #include <boost/asio/thread_pool.hpp>
 #include <nlohmann/json.hpp>
 
-#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
@@ -59,7 +59,7 @@ class TraceRpcApi {
     Task<void> handle_trace_raw_transaction(const nlohmann::json& request, nlohmann::json& reply);
     Task<void> handle_trace_replay_block_transactions(const nlohmann::json& request, nlohmann::json& reply);
     Task<void> handle_trace_replay_transaction(const nlohmann::json& request, nlohmann::json& reply);
-    Task<void> handle_trace_block(const nlohmann::json& request, nlohmann::json& reply);
+    Task<void> handle_trace_block(const nlohmann::json& request, std::string& reply);
     Task<void> handle_trace_get(const nlohmann::json& request, nlohmann::json& reply);
     Task<void> handle_trace_transaction(const nlohmann::json& request, nlohmann::json& reply);
 
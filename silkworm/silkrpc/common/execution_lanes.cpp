@@ -0,0 +1,158 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "execution_lanes.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include <absl/strings/numbers.h>
+#include <absl/strings/str_split.h>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::rpc {
+
+std::optional<ExecutionLaneSettings> parse_execution_lane(std::string_view lane_spec) {
+    const std::vector<std::string_view> fields = absl::StrSplit(lane_spec, ':');
+    if (fields.size() != 5 || fields[0].empty()) {
+        return std::nullopt;
+    }
+    ExecutionLaneSettings settings{.api_namespace = std::string{fields[0]}};
+    uint32_t max_queue_time_ms{0};
+    if (!absl::SimpleAtoi(fields[1], &settings.num_workers) || !absl::SimpleAtoi(fields[2], &settings.max_concurrency) ||
+        !absl::SimpleAtoi(fields[3], &settings.max_queue_depth) || !absl::SimpleAtoi(fields[4], &max_queue_time_ms)) {
+        return std::nullopt;
+    }
+    settings.max_queue_time = std::chrono::milliseconds{max_queue_time_ms};
+    return settings;
+}
+
+ExecutionLane::ExecutionLane(ExecutionLaneSettings settings)
+    : settings_{std::move(settings)},
+      shed_requests_{metrics::Registry::instance().counter(
+          "silkworm_rpc_requests_shed_total", "Number of JSON-RPC requests shed by admission control",
+          {{"namespace", settings_.api_namespace}})} {
+    if (settings_.num_workers > 0) {
+        workers_ = std::make_unique<boost::asio::thread_pool>(settings_.num_workers);
+    }
+}
+
+Task<bool> ExecutionLane::acquire() {
+    auto executor = co_await boost::asio::this_coro::executor;
+
+    std::unique_lock lock{mutex_};
+    if (settings_.max_concurrency == 0 || num_admitted_ < settings_.max_concurrency) {
+        ++num_admitted_;
+        co_return true;
+    }
+    if (waiters_.size() >= settings_.max_queue_depth) {
+        lock.unlock();
+        shed_requests_.increment();
+        SILK_DEBUG << "ExecutionLane::acquire request shed on " << settings_.api_namespace << " lane: queue full";
+        co_return false;
+    }
+    concurrency::AwaitablePromise<bool> admission{executor};
+    auto admission_future = admission.get_future();
+    const uint64_t waiter_id{next_waiter_id_++};
+    waiters_.push_back({waiter_id, std::chrono::steady_clock::now(), std::move(admission)});
+    lock.unlock();
+
+    // Waiting longer than allowed means the client has probably given up already, so shed the request on deadline
+    // even if no admission is released in the meantime
+    boost::asio::steady_timer deadline{executor};
+    if (settings_.max_queue_time.count() > 0) {
+        deadline.expires_after(settings_.max_queue_time);
+        deadline.async_wait([this, waiter_id](const boost::system::error_code& ec) {
+            if (!ec) expire(waiter_id);
+        });
+    }
+    const bool admitted = co_await admission_future.get_async();
+    deadline.cancel();
+    if (!admitted) {
+        SILK_DEBUG << "ExecutionLane::acquire request shed on " << settings_.api_namespace << " lane: deadline expired";
+    }
+    co_return admitted;
+}
+
+void ExecutionLane::release() {
+    const auto now{std::chrono::steady_clock::now()};
+
+    std::scoped_lock lock{mutex_};
+    while (!waiters_.empty()) {
+        auto waiter{std::move(waiters_.front())};
+        waiters_.pop_front();
+        // The deadline may have expired before its timer has fired, so shed the request anyway
+        if (settings_.max_queue_time.count() > 0 && now - waiter.enqueue_time > settings_.max_queue_time) {
+            shed_requests_.increment();
+            waiter.admission.set_value(false);
+            continue;
+        }
+        // The admission is handed over to the first waiter, hence the number of admitted requests does not change
+        waiter.admission.set_value(true);
+        return;
+    }
+    --num_admitted_;
+}
+
+void ExecutionLane::expire(uint64_t waiter_id) {
+    std::scoped_lock lock{mutex_};
+    const auto it = std::find_if(waiters_.begin(), waiters_.end(), [&](const auto& waiter) { return waiter.id == waiter_id; });
+    if (it == waiters_.end()) {
+        return;  // already admitted or shed by release
+    }
+    shed_requests_.increment();
+    it->admission.set_value(false);
+    waiters_.erase(it);
+}
+
+uint32_t ExecutionLane::num_admitted() const {
+    std::scoped_lock lock{mutex_};
+    return num_admitted_;
+}
+
+std::size_t ExecutionLane::num_waiting() const {
+    std::scoped_lock lock{mutex_};
+    return waiters_.size();
+}
+
+ExecutionLanes::ExecutionLanes(const std::vector<ExecutionLaneSettings>& settings) {
+    for (const auto& lane_settings : settings) {
+        lanes_.insert_or_assign(lane_settings.api_namespace, std::make_unique<ExecutionLane>(lane_settings));
+    }
+}
+
+ExecutionLane* ExecutionLanes::find(std::string_view method) const {
+    if (lanes_.empty()) {
+        return nullptr;
+    }
+    const auto api_namespace{method.substr(0, method.find('_'))};
+    const auto it{lanes_.find(api_namespace)};
+    return it != lanes_.end() ? it->second.get() : nullptr;
+}
+
+boost::asio::thread_pool& ExecutionLanes::workers(std::string_view api_namespace, boost::asio::thread_pool& default_workers) const {
+    const auto it{lanes_.find(api_namespace)};
+    if (it == lanes_.end() || it->second->workers() == nullptr) {
+        return default_workers;
+    }
+    return *it->second->workers();
+}
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,131 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <silkworm/infra/concurrency/awaitable_future.hpp>
+#include <silkworm/infra/metrics/metrics.hpp>
+
+namespace silkworm::rpc {
+
+//! The resources isolated for the methods of one JSON RPC API namespace
+struct ExecutionLaneSettings {
+    //! The API namespace served by the lane (e.g. debug, trace)
+    std::string api_namespace;
+
+    //! The number of worker threads dedicated to long-running tasks, 0 means sharing the default workers
+    uint32_t num_workers{0};
+
+    //! The max number of requests handled concurrently, 0 means unlimited
+    uint32_t max_concurrency{0};
+
+    //! The max number of requests waiting for admission when max concurrency is reached, beyond that they are shed
+    uint32_t max_queue_depth{0};
+
+    //! The max time a request can wait for admission before being shed, 0 means no deadline
+    std::chrono::milliseconds max_queue_time{0};
+};
+
+//! Parse the lane specification as <namespace>:<num_workers>:<max_concurrency>:<max_queue_depth>:<max_queue_time_ms>
+//! \return the lane settings or std::nullopt if the specification is invalid
+std::optional<ExecutionLaneSettings> parse_execution_lane(std::string_view lane_spec);
+
+//! ExecutionLane applies admission control to the requests of one API namespace and optionally provides the
+//! dedicated workers for its long-running tasks, so that expensive methods cannot starve the other ones
+class ExecutionLane {
+  public:
+    explicit ExecutionLane(ExecutionLaneSettings settings);
+
+    ExecutionLane(const ExecutionLane&) = delete;
+    ExecutionLane& operator=(const ExecutionLane&) = delete;
+
+    [[nodiscard]] const ExecutionLaneSettings& settings() const { return settings_; }
+
+    //! The dedicated workers or \code nullptr if sharing the default ones
+    [[nodiscard]] boost::asio::thread_pool* workers() const { return workers_.get(); }
+
+    //! Wait for admission of one request in FIFO order
+    //! \return true if admitted, false if shed because the queue is full or the deadline has expired while waiting
+    //! \remarks every admitted request must call release when done
+    Task<bool> acquire();
+
+    //! Release the admission of one request, handing it over to the next waiting request
+    void release();
+
+    //! The number of requests currently admitted
+    [[nodiscard]] uint32_t num_admitted() const;
+
+    //! The number of requests currently waiting for admission
+    [[nodiscard]] std::size_t num_waiting() const;
+
+  private:
+    struct Waiter {
+        uint64_t id{0};
+        std::chrono::steady_clock::time_point enqueue_time;
+        concurrency::AwaitablePromise<bool> admission;
+    };
+
+    //! Shed the specified request if still waiting for admission
+    void expire(uint64_t waiter_id);
+
+    const ExecutionLaneSettings settings_;
+    std::unique_ptr<boost::asio::thread_pool> workers_;
+
+    mutable std::mutex mutex_;
+    uint32_t num_admitted_{0};
+    std::deque<Waiter> waiters_;
+    uint64_t next_waiter_id_{0};
+
+    //! The number of requests shed by this lane
+    metrics::Counter& shed_requests_;
+};
+
+//! ExecutionLanes is the collection of the configured lanes, looked up by API namespace
+class ExecutionLanes {
+  public:
+    ExecutionLanes() = default;
+    explicit ExecutionLanes(const std::vector<ExecutionLaneSettings>& settings);
+
+    ExecutionLanes(const ExecutionLanes&) = delete;
+    ExecutionLanes& operator=(const ExecutionLanes&) = delete;
+
+    //! The lane serving the given API namespace or method (i.e. its namespace prefix) or \code nullptr if none
+    [[nodiscard]] ExecutionLane* find(std::string_view method) const;
+
+    //! The workers for the long-running tasks of the given API namespace, i.e. the dedicated ones if any or the default
+    [[nodiscard]] boost::asio::thread_pool& workers(std::string_view api_namespace, boost::asio::thread_pool& default_workers) const;
+
+  private:
+    std::map<std::string, std::unique_ptr<ExecutionLane>, std::less<>> lanes_;
+};
+
+}  // namespace silkworm::rpc
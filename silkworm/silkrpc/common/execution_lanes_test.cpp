@@ -0,0 +1,163 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "execution_lanes.hpp"
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/infra/test_util/task_runner.hpp>
+
+namespace silkworm::rpc {
+
+using namespace std::chrono_literals;
+
+//! Poll the io_context until the spawned futures cannot make further progress
+static void poll_all(test_util::TaskRunner& runner) {
+    runner.context().restart();
+    while (runner.context().poll_one() > 0) {
+    }
+}
+
+TEST_CASE("parse_execution_lane", "[silkrpc][common][execution_lanes]") {
+    SECTION("valid") {
+        const auto settings{parse_execution_lane("debug:4:8:64:2000")};
+        REQUIRE(settings);
+        CHECK(settings->api_namespace == "debug");
+        CHECK(settings->num_workers == 4);
+        CHECK(settings->max_concurrency == 8);
+        CHECK(settings->max_queue_depth == 64);
+        CHECK(settings->max_queue_time == 2000ms);
+    }
+
+    SECTION("invalid") {
+        CHECK(!parse_execution_lane(""));
+        CHECK(!parse_execution_lane("debug"));
+        CHECK(!parse_execution_lane("debug:4:8:64"));
+        CHECK(!parse_execution_lane(":4:8:64:2000"));
+        CHECK(!parse_execution_lane("debug:4:8:64:2000:1"));
+        CHECK(!parse_execution_lane("debug:-1:8:64:2000"));
+        CHECK(!parse_execution_lane("debug:four:8:64:2000"));
+    }
+}
+
+TEST_CASE("ExecutionLane", "[silkrpc][common][execution_lanes]") {
+    test_util::TaskRunner runner;
+
+    SECTION("unlimited concurrency") {
+        ExecutionLane lane{{.api_namespace = "eth"}};
+        CHECK(lane.workers() == nullptr);
+        for (int i{0}; i < 100; ++i) {
+            CHECK(runner.run(lane.acquire()));
+        }
+        CHECK(lane.num_admitted() == 100);
+    }
+
+    SECTION("dedicated workers") {
+        ExecutionLane lane{{.api_namespace = "debug", .num_workers = 2}};
+        CHECK(lane.workers() != nullptr);
+    }
+
+    SECTION("shed when queue is full") {
+        ExecutionLane lane{{.api_namespace = "trace", .max_concurrency = 1, .max_queue_depth = 1}};
+        CHECK(runner.run(lane.acquire()));
+        auto waiting = runner.spawn_future(lane.acquire());
+        poll_all(runner);
+        CHECK(lane.num_waiting() == 1);
+        CHECK(!runner.run(lane.acquire()));
+
+        lane.release();
+        runner.poll_context_until_future_is_ready(waiting);
+        CHECK(waiting.get());
+        CHECK(lane.num_admitted() == 1);
+        CHECK(lane.num_waiting() == 0);
+
+        lane.release();
+        CHECK(lane.num_admitted() == 0);
+    }
+
+    SECTION("admission in FIFO order") {
+        ExecutionLane lane{{.api_namespace = "trace", .max_concurrency = 1, .max_queue_depth = 2}};
+        CHECK(runner.run(lane.acquire()));
+        auto first = runner.spawn_future(lane.acquire());
+        poll_all(runner);
+        auto second = runner.spawn_future(lane.acquire());
+        poll_all(runner);
+        CHECK(lane.num_waiting() == 2);
+
+        lane.release();
+        runner.poll_context_until_future_is_ready(first);
+        CHECK(first.get());
+        CHECK(second.wait_for(0s) == std::future_status::timeout);
+
+        lane.release();
+        runner.poll_context_until_future_is_ready(second);
+        CHECK(second.get());
+    }
+
+    SECTION("shed when deadline expired") {
+        ExecutionLane lane{{.api_namespace = "trace", .max_concurrency = 1, .max_queue_depth = 2, .max_queue_time = 1ms}};
+        CHECK(runner.run(lane.acquire()));
+        auto expired = runner.spawn_future(lane.acquire());
+        poll_all(runner);
+        std::this_thread::sleep_for(5ms);
+
+        lane.release();
+        runner.poll_context_until_future_is_ready(expired);
+        CHECK(!expired.get());
+        CHECK(lane.num_admitted() == 0);
+    }
+
+    SECTION("shed when deadline expired without release") {
+        ExecutionLane lane{{.api_namespace = "trace", .max_concurrency = 1, .max_queue_depth = 2, .max_queue_time = 1ms}};
+        CHECK(runner.run(lane.acquire()));
+        auto expired = runner.spawn_future(lane.acquire());
+        poll_all(runner);
+        CHECK(lane.num_waiting() == 1);
+
+        runner.poll_context_until_future_is_ready(expired);
+        CHECK(!expired.get());
+        CHECK(lane.num_waiting() == 0);
+        CHECK(lane.num_admitted() == 1);
+
+        lane.release();
+        CHECK(lane.num_admitted() == 0);
+    }
+}
+
+TEST_CASE("ExecutionLanes", "[silkrpc][common][execution_lanes]") {
+    boost::asio::thread_pool default_workers{1};
+    ExecutionLanes lanes{{{.api_namespace = "debug", .num_workers = 1}, {.api_namespace = "trace", .max_concurrency = 4}}};
+
+    CHECK(lanes.find("debug_traceTransaction") != nullptr);
+    CHECK(lanes.find("trace_filter") != nullptr);
+    CHECK(lanes.find("eth_blockNumber") == nullptr);
+    CHECK(lanes.find("debug") != nullptr);
+    CHECK(lanes.find("") == nullptr);
+
+    CHECK(&lanes.workers("debug", default_workers) != &default_workers);
+    CHECK(&lanes.workers("trace", default_workers) == &default_workers);
+    CHECK(&lanes.workers("eth", default_workers) == &default_workers);
+
+    ExecutionLanes no_lanes;
+    CHECK(no_lanes.find("debug_traceTransaction") == nullptr);
+    CHECK(&no_lanes.workers("debug", default_workers) == &default_workers);
+}
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,110 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_cache.hpp"
+
+#include <algorithm>
+
+#include <silkworm/infra/grpc/common/conversion.hpp>
+
+namespace silkworm::rpc {
+
+size_t BlockWeigher::operator()(const std::shared_ptr<BlockWithHash>& block_with_hash) const noexcept {
+    const silkworm::Block& block{block_with_hash->block};
+    size_t weight{sizeof(BlockWithHash) + block.header.extra_data.size()};
+    for (const auto& transaction : block.transactions) {
+        weight += sizeof(silkworm::Transaction) + transaction.data.size();
+        weight += transaction.blob_versioned_hashes.size() * sizeof(evmc::bytes32);
+        for (const auto& entry : transaction.access_list) {
+            weight += sizeof(AccessListEntry) + entry.storage_keys.size() * sizeof(evmc::bytes32);
+        }
+    }
+    weight += block.ommers.size() * sizeof(BlockHeader);
+    if (block.withdrawals) {
+        weight += block.withdrawals->size() * sizeof(Withdrawal);
+    }
+    return weight;
+}
+
+size_t ReceiptsWeigher::operator()(const std::shared_ptr<Receipts>& receipts) const noexcept {
+    size_t weight{sizeof(Receipts)};
+    for (const auto& receipt : *receipts) {
+        weight += sizeof(Receipt);
+        for (const auto& log : receipt.logs) {
+            weight += sizeof(Log) + log.topics.size() * sizeof(evmc::bytes32) + log.data.size();
+        }
+    }
+    return weight;
+}
+
+// Blocks and receipts take almost all the budget, total difficulties being tiny
+static size_t blocks_budget(size_t max_bytes) { return max_bytes / 2; }
+static size_t total_difficulties_budget(size_t max_bytes) { return max_bytes / 64; }
+static size_t receipts_budget(size_t max_bytes) {
+    return max_bytes - blocks_budget(max_bytes) - total_difficulties_budget(max_bytes);
+}
+
+BlockCache::BlockCache(size_t max_bytes, bool shared_cache, size_t canonical_window)
+    : blocks_{blocks_budget(max_bytes), shared_cache ? decltype(blocks_)::kDefaultNumShards : 1},
+      receipts_{receipts_budget(max_bytes), shared_cache ? decltype(receipts_)::kDefaultNumShards : 1},
+      total_difficulties_{total_difficulties_budget(max_bytes), shared_cache ? decltype(total_difficulties_)::kDefaultNumShards : 1},
+      canonical_ring_(std::max<size_t>(canonical_window, 1)) {}
+
+std::optional<evmc::bytes32> BlockCache::get_canonical_hash(BlockNum block_number) const {
+    std::scoped_lock lock{canonical_mutex_};
+    const auto& slot{canonical_ring_[block_number % canonical_ring_.size()]};
+    if (slot.block_number != block_number) {
+        return std::nullopt;
+    }
+    return slot.block_hash;
+}
+
+void BlockCache::on_new_block(const remote::StateChangeBatch& state_changes) {
+    std::vector<evmc::bytes32> unwound_hashes;
+    {
+        std::scoped_lock lock{canonical_mutex_};
+        for (const auto& state_change : state_changes.change_batch()) {
+            const BlockNum block_number{state_change.block_height()};
+            std::optional<evmc::bytes32> block_hash;
+            if (state_change.direction() == remote::Direction::FORWARD) {
+                block_hash = bytes32_from_H256(state_change.block_hash());
+            }
+            // Any block above the notified one is no more canonical, whatever the direction
+            for (auto& slot : canonical_ring_) {
+                if (!slot.block_hash || slot.block_number < block_number) {
+                    continue;
+                }
+                if (slot.block_number > block_number || slot.block_hash != block_hash) {
+                    unwound_hashes.push_back(*slot.block_hash);
+                    slot = CanonicalSlot{};
+                }
+            }
+            if (block_hash) {
+                canonical_ring_[block_number % canonical_ring_.size()] = {block_number, block_hash};
+            }
+        }
+    }
+    // Receipts of unwound blocks may have been read by number after the reorg, so they cannot be trusted anymore
+    for (const auto& block_hash : unwound_hashes) {
+        receipts_.remove(block_hash);
+    }
+}
+
+size_t BlockCache::weight() const {
+    return blocks_.weight() + receipts_.weight() + total_difficulties_.weight();
+}
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,128 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <evmc/evmc.hpp>
+#include <intx/intx.hpp>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/concurrent_cache.hpp>
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/interfaces/remote/kv.pb.h>
+#include <silkworm/silkrpc/types/receipt.hpp>
+
+namespace silkworm::rpc {
+
+//! Default max approximate size in bytes of the chain data kept in BlockCache
+inline constexpr size_t kDefaultBlockCacheSize{256 * 1024 * 1024};
+
+//! Default number of most recent canonical blocks whose hash is tracked by BlockCache
+inline constexpr size_t kDefaultCanonicalHashWindow{128};
+
+//! Weigher approximating the memory footprint of a block, transactions included
+struct BlockWeigher {
+    size_t operator()(const std::shared_ptr<BlockWithHash>& block_with_hash) const noexcept;
+};
+
+//! Weigher approximating the memory footprint of a receipt list, logs included
+struct ReceiptsWeigher {
+    size_t operator()(const std::shared_ptr<Receipts>& receipts) const noexcept;
+};
+
+//! Weigher approximating the memory footprint of a total difficulty entry
+struct TotalDifficultyWeigher {
+    size_t operator()(const intx::uint256&) const noexcept { return sizeof(evmc::bytes32) + sizeof(intx::uint256); }
+};
+
+//! \brief BlockCache keeps the decoded chain data shared among all RPC requests: blocks (senders included), receipts
+//! (derived fields included) and total difficulties keyed by block hash, plus the canonical hashes of the most recent
+//! blocks keyed by block number.
+//! \details The data keyed by block hash is immutable and evicted using the byte budget only, except the receipts of
+//! unwound blocks. The canonical hashes are fed just by the state changes stream, so that requests targeting the
+//! chain head can be served without touching the database and can never see stale data after a reorg.
+class BlockCache {
+  public:
+    //! \param max_bytes: max approximate size in bytes of the cached data, split among blocks, receipts and difficulties
+    //! \param shared_cache: whether the cache is shared among threads (i.e. sharded to reduce contention) or not
+    //! \param canonical_window: number of most recent canonical blocks whose hash is tracked
+    explicit BlockCache(size_t max_bytes = kDefaultBlockCacheSize,
+                        bool shared_cache = true,
+                        size_t canonical_window = kDefaultCanonicalHashWindow);
+
+    BlockCache(const BlockCache&) = delete;
+    BlockCache& operator=(const BlockCache&) = delete;
+
+    std::optional<std::shared_ptr<BlockWithHash>> get(const evmc::bytes32& block_hash) {
+        return blocks_.get_as_copy(block_hash);
+    }
+
+    void insert(const evmc::bytes32& block_hash, const std::shared_ptr<BlockWithHash>& block) {
+        blocks_.put(block_hash, block);
+    }
+
+    std::optional<std::shared_ptr<Receipts>> get_receipts(const evmc::bytes32& block_hash) {
+        return receipts_.get_as_copy(block_hash);
+    }
+
+    void insert_receipts(const evmc::bytes32& block_hash, std::shared_ptr<Receipts> receipts) {
+        receipts_.put(block_hash, std::move(receipts));
+    }
+
+    std::optional<intx::uint256> get_total_difficulty(const evmc::bytes32& block_hash) {
+        return total_difficulties_.get_as_copy(block_hash);
+    }
+
+    void insert_total_difficulty(const evmc::bytes32& block_hash, const intx::uint256& total_difficulty) {
+        total_difficulties_.put(block_hash, total_difficulty);
+    }
+
+    //! Get the hash of the specified canonical block, if it is among the most recent ones
+    [[nodiscard]] std::optional<evmc::bytes32> get_canonical_hash(BlockNum block_number) const;
+
+    //! Record the new canonical heads and forget the unwound blocks along with their receipts
+    void on_new_block(const remote::StateChangeBatch& state_changes);
+
+    //! Statistics about the block lookups
+    [[nodiscard]] ConcurrentCacheStats stats() const { return blocks_.stats(); }
+
+    [[nodiscard]] ConcurrentCacheStats receipts_stats() const { return receipts_.stats(); }
+
+    //! Approximate size in bytes of the cached data
+    [[nodiscard]] size_t weight() const;
+
+  private:
+    struct CanonicalSlot {
+        BlockNum block_number{0};
+        std::optional<evmc::bytes32> block_hash;
+    };
+
+    ConcurrentCache<evmc::bytes32, std::shared_ptr<BlockWithHash>, BlockWeigher> blocks_;
+    ConcurrentCache<evmc::bytes32, std::shared_ptr<Receipts>, ReceiptsWeigher> receipts_;
+    ConcurrentCache<evmc::bytes32, intx::uint256, TotalDifficultyWeigher> total_difficulties_;
+
+    mutable std::mutex canonical_mutex_;
+    std::vector<CanonicalSlot> canonical_ring_;
+};
+
+}  // namespace silkworm::rpc
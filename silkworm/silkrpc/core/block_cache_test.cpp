@@ -0,0 +1,186 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_cache.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/infra/grpc/common/conversion.hpp>
+
+namespace silkworm::rpc {
+
+using Catch::Matchers::Message;
+using evmc::literals::operator""_address, evmc::literals::operator""_bytes32;
+
+static void add_change(remote::StateChangeBatch& batch, BlockNum block_number, const evmc::bytes32& block_hash,
+                       remote::Direction direction = remote::Direction::FORWARD) {
+    auto* state_change = batch.add_change_batch();
+    state_change->set_direction(direction);
+    state_change->set_block_height(block_number);
+    state_change->set_allocated_block_hash(H256_from_bytes32(block_hash).release());
+}
+
+static evmc::bytes32 make_hash(uint8_t n) {
+    evmc::bytes32 hash;
+    hash.bytes[0] = n;
+    return hash;
+}
+
+TEST_CASE("check get cache key not present(lock)", "[silkrpc][commands][block_cache]") {
+    BlockCache block_cache(1024, true);
+    evmc::bytes32 bh1{0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32};
+
+    auto b = block_cache.get(bh1);
+    CHECK(!b);
+}
+
+TEST_CASE("check get cache key not present(no-lock)", "[silkrpc][commands][block_cache]") {
+    BlockCache block_cache(1024, false);
+    evmc::bytes32 bh1{0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32};
+
+    auto b = block_cache.get(bh1);
+    CHECK(!b);
+}
+
+TEST_CASE("insert entry in cache(lock)", "[silkrpc][commands][block_cache]") {
+    evmc::bytes32 bh1{0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32};
+    BlockCache block_cache(16 * 1024, true);
+    auto ret_block_option = block_cache.get(bh1);
+    CHECK(!ret_block_option);
+
+    auto block1 = std::make_shared<silkworm::BlockWithHash>();
+    block_cache.insert(bh1, block1);
+
+    ret_block_option = block_cache.get(bh1);
+    CHECK((*ret_block_option)->hash == block1->hash);
+}
+
+TEST_CASE("insert entry in cache(no-lock)", "[silkrpc][commands][block_cache]") {
+    evmc::bytes32 bh1{0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32};
+    BlockCache block_cache(16 * 1024, false);
+    auto ret_block_option = block_cache.get(bh1);
+    CHECK(!ret_block_option);
+
+    auto block1 = std::make_shared<silkworm::BlockWithHash>();
+    block_cache.insert(bh1, block1);
+
+    ret_block_option = block_cache.get(bh1);
+    CHECK((*ret_block_option)->hash == block1->hash);
+}
+
+TEST_CASE("BlockWeigher", "[silkrpc][commands][block_cache]") {
+    BlockWeigher weigher;
+    auto block_with_hash{std::make_shared<BlockWithHash>()};
+    const size_t empty_weight{weigher(block_with_hash)};
+    CHECK(empty_weight >= sizeof(BlockWithHash));
+
+    silkworm::Transaction transaction;
+    transaction.data.resize(100);
+    block_with_hash->block.transactions.push_back(transaction);
+    CHECK(weigher(block_with_hash) == empty_weight + sizeof(silkworm::Transaction) + 100);
+}
+
+TEST_CASE("ReceiptsWeigher", "[silkrpc][commands][block_cache]") {
+    ReceiptsWeigher weigher;
+    auto receipts{std::make_shared<Receipts>(1)};
+    const size_t empty_weight{weigher(receipts)};
+    CHECK(empty_weight >= sizeof(Receipt));
+
+    Log log;
+    log.topics.resize(2);
+    log.data.resize(100);
+    (*receipts)[0].logs.push_back(log);
+    CHECK(weigher(receipts) == empty_weight + sizeof(Log) + 2 * sizeof(evmc::bytes32) + 100);
+}
+
+TEST_CASE("evict blocks by byte budget", "[silkrpc][commands][block_cache]") {
+    // Single shard with room for a few blocks having 1KB of calldata each
+    BlockCache block_cache(2 * 4 * 1024, false);
+    for (uint8_t n{0}; n < 16; ++n) {
+        auto block_with_hash{std::make_shared<BlockWithHash>()};
+        block_with_hash->hash = make_hash(n);
+        block_with_hash->block.transactions.resize(1);
+        block_with_hash->block.transactions[0].data.resize(1024);
+        block_cache.insert(block_with_hash->hash, block_with_hash);
+    }
+    CHECK(block_cache.weight() <= 4 * 1024);
+    CHECK(block_cache.get(make_hash(15)));
+    CHECK(!block_cache.get(make_hash(0)));
+}
+
+TEST_CASE("cache receipts and total difficulty", "[silkrpc][commands][block_cache]") {
+    BlockCache block_cache(1024 * 1024, true);
+    const auto block_hash{make_hash(1)};
+    CHECK(!block_cache.get_receipts(block_hash));
+    CHECK(!block_cache.get_total_difficulty(block_hash));
+
+    block_cache.insert_receipts(block_hash, std::make_shared<Receipts>(2));
+    block_cache.insert_total_difficulty(block_hash, 1'000);
+
+    const auto receipts{block_cache.get_receipts(block_hash)};
+    REQUIRE(receipts);
+    CHECK((*receipts)->size() == 2);
+    CHECK(block_cache.get_total_difficulty(block_hash) == intx::uint256{1'000});
+    CHECK(block_cache.receipts_stats().hits == 1);
+}
+
+TEST_CASE("canonical hashes follow state changes", "[silkrpc][commands][block_cache]") {
+    BlockCache block_cache(1024 * 1024, true, 4);
+    CHECK(!block_cache.get_canonical_hash(0));
+    CHECK(!block_cache.get_canonical_hash(100));
+
+    remote::StateChangeBatch batch;
+    for (uint8_t n{100}; n < 106; ++n) {
+        add_change(batch, n, make_hash(n));
+    }
+    block_cache.on_new_block(batch);
+
+    SECTION("only the most recent blocks are tracked") {
+        CHECK(!block_cache.get_canonical_hash(101));
+        CHECK(block_cache.get_canonical_hash(102) == make_hash(102));
+        CHECK(block_cache.get_canonical_hash(105) == make_hash(105));
+        CHECK(!block_cache.get_canonical_hash(106));
+    }
+
+    SECTION("unwind drops canonical hashes and receipts") {
+        block_cache.insert_receipts(make_hash(104), std::make_shared<Receipts>(1));
+        block_cache.insert_receipts(make_hash(103), std::make_shared<Receipts>(1));
+
+        remote::StateChangeBatch unwind_batch;
+        add_change(unwind_batch, 104, make_hash(104), remote::Direction::UNWIND);
+        add_change(unwind_batch, 104, make_hash(204));
+        block_cache.on_new_block(unwind_batch);
+
+        CHECK(block_cache.get_canonical_hash(103) == make_hash(103));
+        CHECK(block_cache.get_canonical_hash(104) == make_hash(204));
+        CHECK(!block_cache.get_canonical_hash(105));
+        CHECK(block_cache.get_receipts(make_hash(103)));
+        CHECK(!block_cache.get_receipts(make_hash(104)));
+    }
+
+    SECTION("forward replacing a different hash drops it") {
+        block_cache.insert_receipts(make_hash(105), std::make_shared<Receipts>(1));
+
+        remote::StateChangeBatch reorg_batch;
+        add_change(reorg_batch, 105, make_hash(205));
+        block_cache.on_new_block(reorg_batch);
+
+        CHECK(block_cache.get_canonical_hash(105) == make_hash(205));
+        CHECK(!block_cache.get_receipts(make_hash(105)));
+    }
+}
+
+}  // namespace silkworm::rpc
@@ -25,7 +25,7 @@
 #include <boost/asio/this_coro.hpp>
 #include <evmc/evmc.hpp>
 
-#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/types/account.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
@@ -21,8 +21,18 @@
 
 namespace silkworm::rpc::core {
 
+//! Insert the block into the cache, recovering the senders not read from storage (i.e. pruned ones) just once
+static void insert_into_cache(BlockCache& cache, const std::shared_ptr<BlockWithHash>& block_with_hash) {
+    block_with_hash->block.recover_senders();
+    cache.insert(block_with_hash->hash, block_with_hash);
+}
+
 Task<std::shared_ptr<BlockWithHash>> read_block_by_number(BlockCache& cache, const ChainStorage& storage, BlockNum block_number) {
-    const auto block_hash = co_await storage.read_canonical_hash(block_number);
+    // The most recent canonical hashes are kept up-to-date by the state changes stream
+    auto block_hash = cache.get_canonical_hash(block_number);
+    if (!block_hash) {
+        block_hash = co_await storage.read_canonical_hash(block_number);
+    }
     if (!block_hash) {
         co_return nullptr;
     }
@@ -39,7 +49,7 @@ Task<std::shared_ptr<BlockWithHash>> read_block_by_number(BlockCache& cache, con
     if (!block_with_hash->block.transactions.empty()) {
         // don't save empty (without txs) blocks to cache, if block become non-canonical (not in main chain), we remove it's transactions,
         // but block can in the future become canonical(inserted in main chain) with its transactions
-        cache.insert(std::move(*block_hash), block_with_hash);
+        insert_into_cache(cache, block_with_hash);
     }
     co_return block_with_hash;
 }
@@ -62,11 +72,22 @@ Task<std::shared_ptr<BlockWithHash>> read_block_by_hash(BlockCache& cache, const
     if (!block_with_hash->block.transactions.empty()) {
         // don't save empty (without txs) blocks to cache, if block become non-canonical (not in main chain), we remove it's transactions,
         // but block can in the future become canonical(inserted in main chain) with its transactions
-        cache.insert(std::move(block_hash), block_with_hash);
+        insert_into_cache(cache, block_with_hash);
     }
     co_return block_with_hash;
 }
 
+Task<std::optional<intx::uint256>> read_total_difficulty(BlockCache& cache, const ChainStorage& storage, const evmc::bytes32& block_hash, BlockNum block_number) {
+    if (const auto cached_total_difficulty = cache.get_total_difficulty(block_hash)) {
+        co_return cached_total_difficulty;
+    }
+    const auto total_difficulty = co_await storage.read_total_difficulty(block_hash, block_number);
+    if (total_difficulty) {
+        cache.insert_total_difficulty(block_hash, *total_difficulty);
+    }
+    co_return total_difficulty;
+}
+
 Task<std::shared_ptr<BlockWithHash>> read_block_by_number_or_hash(BlockCache& cache, const ChainStorage& storage, const rawdb::DatabaseReader& reader, const BlockNumberOrHash& bnoh) {
     if (bnoh.is_number()) {  // NOLINT(bugprone-branch-clone)
         co_return co_await read_block_by_number(cache, storage, bnoh.number());
@@ -19,8 +19,9 @@
 #include <silkworm/infra/concurrency/task.hpp>
 
 #include <evmc/evmc.hpp>
+#include <intx/intx.hpp>
 
-#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 #include <silkworm/silkrpc/storage/chain_storage.hpp>
 #include <silkworm/silkrpc/types/block.hpp>
@@ -30,6 +31,7 @@ namespace silkworm::rpc::core {
 
 Task<std::shared_ptr<BlockWithHash>> read_block_by_number(BlockCache& cache, const ChainStorage& storage, BlockNum block_number);
 Task<std::shared_ptr<BlockWithHash>> read_block_by_hash(BlockCache& cache, const ChainStorage& storage, const evmc::bytes32& block_hash);
+Task<std::optional<intx::uint256>> read_total_difficulty(BlockCache& cache, const ChainStorage& storage, const evmc::bytes32& block_hash, BlockNum block_number);
 Task<std::shared_ptr<BlockWithHash>> read_block_by_number_or_hash(BlockCache& cache, const ChainStorage& storage, const rawdb::DatabaseReader& reader, const BlockNumberOrHash& bnoh);
 Task<std::shared_ptr<BlockWithHash>> read_block_by_transaction_hash(BlockCache& cache, const ChainStorage& storage, const evmc::bytes32& transaction_hash);
 Task<std::optional<TransactionWithBlock>> read_transaction_by_hash(BlockCache& cache, const ChainStorage& storage, const evmc::bytes32& transaction_hash);
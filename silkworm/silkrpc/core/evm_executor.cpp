@@ -184,6 +184,18 @@ void EVMExecutor::reset() {
     ibs_state_.clear_journal_and_substate();
 }
 
+void EVMExecutor::initialize_block(const silkworm::Block& block) {
+    auto& svc = use_service<AnalysisCacheService>(workers_);
+    EVM evm{block, ibs_state_, config_};
+    evm.analysis_cache = svc.get_analysis_cache();
+    evm.state_pool = svc.get_object_pool();
+    evm.beneficiary = rule_set_->get_beneficiary(block.header);
+
+    rule_set_->initialize(evm);
+    ibs_state_.finalize_transaction(evm.revision());
+    ibs_state_.clear_journal_and_substate();
+}
+
 std::optional<std::string> EVMExecutor::pre_check(const EVM& evm, const silkworm::Transaction& txn, const intx::uint256& base_fee_per_gas, const intx::uint128& g0) {
     const evmc_revision rev{evm.revision()};
 
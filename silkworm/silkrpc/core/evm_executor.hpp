@@ -36,6 +36,7 @@
 #include <silkworm/core/state/state.hpp>
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/core/types/transaction.hpp>
+#include <silkworm/node/common/shared_analysis_cache.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 #include <silkworm/silkrpc/core/state_reader.hpp>
 #include <silkworm/silkrpc/storage/chain_storage.hpp>
@@ -55,8 +56,6 @@ struct ExecutionResult {
     std::string error_message(bool full_error = true) const;
 };
 
-constexpr int kCacheSize = 32000;
-
 template <typename T>
 using ServiceBase = boost::asio::detail::execution_context_service_base<T>;
 
@@ -67,11 +66,10 @@ class AnalysisCacheService : public ServiceBase<AnalysisCacheService> {
 
     void shutdown() override {}
     ObjectPool<evmone::ExecutionState>* get_object_pool() { return &state_pool_; }
-    AnalysisCache* get_analysis_cache() { return &analysis_cache_; }
+    AnalysisCache* get_analysis_cache() { return &shared_analysis_cache(); }
 
   private:
     ObjectPool<evmone::ExecutionState> state_pool_{true};
-    AnalysisCache analysis_cache_{kCacheSize, true};
 };
 
 using Tracers = std::vector<std::shared_ptr<EvmTracer>>;
@@ -110,6 +108,9 @@ class EVMExecutor {
     ExecutionResult call(const silkworm::Block& block, const silkworm::Transaction& txn, Tracers tracers = {}, bool refund = true, bool gas_bailout = false);
     void reset();
 
+    //! Apply the pre-block system calls and irregular state changes (e.g. EIP-4788, DAO fork) as block execution does
+    void initialize_block(const silkworm::Block& block);
+
     const IntraBlockState& get_ibs_state() { return ibs_state_; }
 
   private:
@@ -33,7 +33,7 @@
 #include <gsl/narrow>
 #include <nlohmann/json.hpp>
 
-#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wattributes"
 #include <silkworm/core/execution/evm.hpp>
@@ -484,7 +484,7 @@ struct Filter {
 
 class TraceCallExecutor {
   public:
-    explicit TraceCallExecutor(silkworm::BlockCache& block_cache,
+    explicit TraceCallExecutor(BlockCache& block_cache,
                                const core::rawdb::DatabaseReader& database_reader,
                                const ChainStorage& chain_storage,
                                boost::asio::thread_pool& workers,
@@ -518,7 +518,7 @@ class TraceCallExecutor {
         std::int32_t index,
         const TraceConfig& config);
 
-    silkworm::BlockCache& block_cache_;
+    BlockCache& block_cache_;
     const core::rawdb::DatabaseReader& database_reader_;
     const ChainStorage& chain_storage_;
     boost::asio::thread_pool& workers_;
@@ -28,6 +28,7 @@
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/core/types/transaction.hpp>
 #include <silkworm/silkrpc/core/blocks.hpp>
+#include <silkworm/silkrpc/core/fee_summary_cache.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 
 namespace silkworm::rpc::fee_history {
@@ -47,27 +48,12 @@ struct FeeHistory {
 
 void to_json(nlohmann::json& json, const FeeHistory& fh);
 
-struct BlockRange {
-    uint64_t num_blocks;
-    BlockNum last_block;
-    BlockWithHash block;
-    rpc::Receipts receipts;
-};
-
-struct BlockFees {
-    BlockNum block_number;
-    BlockWithHash block;
-    rpc::Receipts receipts;
-    Rewards rewards;
-    intx::uint256 base_fee;
-    intx::uint256 next_base_fee;
-    double gas_used_ratio;
-};
-
 class FeeHistoryOracle {
   public:
-    explicit FeeHistoryOracle(const silkworm::ChainConfig& config, const BlockProvider& block_provider, ReceiptsProvider& receipts_provider)
-        : config_{config}, block_provider_(block_provider), receipts_provider_(receipts_provider) {}
+    //! \param fee_summary_cache the cache of block fee summaries used to avoid reading blocks and receipts, if any
+    explicit FeeHistoryOracle(const silkworm::ChainConfig& config, const BlockProvider& block_provider, ReceiptsProvider& receipts_provider,
+                              FeeSummaryCache* fee_summary_cache = nullptr)
+        : config_{config}, block_provider_(block_provider), receipts_provider_(receipts_provider), fee_summary_cache_(fee_summary_cache) {}
     virtual ~FeeHistoryOracle() {}
 
     FeeHistoryOracle(const FeeHistoryOracle&) = delete;
@@ -80,12 +66,13 @@ class FeeHistoryOracle {
     static inline const std::uint32_t kDefaultMaxHeaderHistory = 300;
     static inline const std::uint32_t kDefaultMaxBlockHistory = 5;
 
-    Task<BlockRange> resolve_block_range(BlockNum newest_block, uint64_t block_count, uint64_t max_history);
-    Task<void> process_block(BlockFees& block_fees, const std::vector<std::int8_t>& reward_percentile);
+    //! Get the fee summary of the specified block from cache or build it, nullptr if block is not found
+    Task<std::shared_ptr<const BlockFeeSummary>> get_fee_summary(BlockNum block_number, bool with_tips);
 
     const silkworm::ChainConfig& config_;
     const BlockProvider& block_provider_;
     const ReceiptsProvider& receipts_provider_;
+    FeeSummaryCache* fee_summary_cache_;
 };
 
 }  // namespace silkworm::rpc::fee_history
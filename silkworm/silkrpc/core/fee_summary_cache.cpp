@@ -0,0 +1,169 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "fee_summary_cache.hpp"
+
+#include <algorithm>
+#include <exception>
+
+#include <silkworm/core/protocol/validation.hpp>
+#include <silkworm/infra/common/ensure.hpp>
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/grpc/common/conversion.hpp>
+#include <silkworm/silkrpc/core/cached_chain.hpp>
+#include <silkworm/silkrpc/core/gas_price_oracle.hpp>
+#include <silkworm/silkrpc/core/rawdb/chain.hpp>
+#include <silkworm/silkrpc/ethdb/transaction_database.hpp>
+
+namespace silkworm::rpc {
+
+std::vector<intx::uint256> BlockFeeSummary::rewards(const std::vector<std::int8_t>& reward_percentile) const {
+    std::vector<intx::uint256> rewards(reward_percentile.size(), 0);
+    if (sorted_tips.empty()) {
+        return rewards;
+    }
+
+    size_t tx_index{0};
+    uint64_t sum_gas_used{sorted_tips[0].gas_used};
+    for (size_t i{0}; i < reward_percentile.size(); ++i) {
+        const uint64_t threshold_gas_used{gas_used * static_cast<uint64_t>(reward_percentile[i]) / 100};
+        while (sum_gas_used < threshold_gas_used && tx_index < sorted_tips.size() - 1) {
+            ++tx_index;
+            sum_gas_used += sorted_tips[tx_index].gas_used;
+        }
+        rewards[i] = sorted_tips[tx_index].tip;
+    }
+    return rewards;
+}
+
+BlockFeeSummary make_block_fee_summary(const ChainConfig& config, const BlockWithHash& block_with_hash, const Receipts& receipts) {
+    const auto& header = block_with_hash.block.header;
+    const auto& transactions = block_with_hash.block.transactions;
+
+    BlockFeeSummary summary;
+    summary.block_number = header.number;
+    summary.block_hash = block_with_hash.hash;
+    summary.base_fee = header.base_fee_per_gas.value_or(0);
+    summary.gas_used = header.gas_used;
+    summary.gas_used_ratio = header.gas_limit > 0 ? static_cast<double>(header.gas_used) / static_cast<double>(header.gas_limit) : 0;
+    if (config.revision(header.number + 1, header.timestamp) >= EVMC_LONDON) {
+        summary.next_base_fee = protocol::expected_base_fee_per_gas(header);
+    }
+
+    // Effective tips weighted by gas used can be computed only if receipts are available
+    if (receipts.size() == transactions.size()) {
+        summary.has_tips = true;
+        summary.sorted_tips.reserve(transactions.size());
+        uint64_t previous_cumulative_gas_used{0};
+        for (size_t i{0}; i < transactions.size(); ++i) {
+            const uint64_t gas_used{receipts[i].cumulative_gas_used - previous_cumulative_gas_used};
+            previous_cumulative_gas_used = receipts[i].cumulative_gas_used;
+            summary.sorted_tips.push_back({transactions[i].priority_fee_per_gas(summary.base_fee), gas_used});
+        }
+        std::sort(summary.sorted_tips.begin(), summary.sorted_tips.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.tip < rhs.tip;
+        });
+    }
+
+    // Same sampling criteria as GasPriceOracle: skip too cheap transactions and the ones sent by the fee recipient
+    std::vector<intx::uint256> block_prices;
+    block_prices.reserve(transactions.size());
+    for (const auto& transaction : transactions) {
+        const auto priority_fee_per_gas = transaction.priority_fee_per_gas(summary.base_fee);
+        if (priority_fee_per_gas < kDefaultMinPrice || transaction.from == header.beneficiary) {
+            continue;
+        }
+        block_prices.push_back(priority_fee_per_gas);
+    }
+    const auto num_samples{std::min(block_prices.size(), size_t{kSamples})};
+    std::partial_sort(block_prices.begin(), block_prices.begin() + static_cast<std::ptrdiff_t>(num_samples), block_prices.end());
+    summary.gas_price_samples.assign(block_prices.begin(), block_prices.begin() + static_cast<std::ptrdiff_t>(num_samples));
+
+    return summary;
+}
+
+FeeSummaryCache::FeeSummaryCache(size_t capacity) : ring_(std::max(capacity, size_t{1})) {}
+
+std::shared_ptr<const BlockFeeSummary> FeeSummaryCache::get(BlockNum block_number) const {
+    std::scoped_lock lock{mutex_};
+    const auto& slot = ring_[block_number % ring_.size()];
+    if (slot.block_number != block_number) {
+        return nullptr;
+    }
+    return slot.summary;
+}
+
+void FeeSummaryCache::insert(std::shared_ptr<const BlockFeeSummary> summary) {
+    std::scoped_lock lock{mutex_};
+    auto& slot = ring_[summary->block_number % ring_.size()];
+    if (slot.block_number != summary->block_number || slot.block_hash != summary->block_hash) {
+        return;
+    }
+    slot.summary = std::move(summary);
+}
+
+void FeeSummaryCache::on_new_block(const remote::StateChangeBatch& state_changes) {
+    std::scoped_lock lock{mutex_};
+    for (const auto& state_change : state_changes.change_batch()) {
+        const BlockNum block_number{state_change.block_height()};
+        if (state_change.direction() == remote::Direction::UNWIND) {
+            for (auto& slot : ring_) {
+                if (slot.block_number >= block_number) {
+                    slot = Slot{};
+                }
+            }
+            std::erase_if(pending_blocks_, [&](const auto& pending) { return pending.first >= block_number; });
+            continue;
+        }
+        const auto block_hash{bytes32_from_H256(state_change.block_hash())};
+        ring_[block_number % ring_.size()] = Slot{block_number, block_hash, nullptr};
+        pending_blocks_.emplace_back(block_number, block_hash);
+    }
+}
+
+Task<void> FeeSummaryCache::update(ethdb::Database& database, ethbackend::BackEnd* backend, BlockCache& block_cache) {
+    std::vector<std::pair<BlockNum, evmc::bytes32>> pending_blocks;
+    {
+        std::scoped_lock lock{mutex_};
+        pending_blocks.swap(pending_blocks_);
+    }
+    if (pending_blocks.empty()) {
+        co_return;
+    }
+
+    auto tx = co_await database.begin();
+    try {
+        ethdb::TransactionDatabase tx_database{*tx};
+        const auto chain_storage{tx->create_storage(tx_database, backend)};
+        const auto chain_config = co_await chain_storage->read_chain_config();
+        ensure(chain_config.has_value(), "cannot read chain config");
+
+        for (const auto& [block_number, block_hash] : pending_blocks) {
+            const auto block_with_hash = co_await core::read_block_by_hash(block_cache, *chain_storage, block_hash);
+            if (!block_with_hash) {
+                SILK_DEBUG << "FeeSummaryCache::update block not found: " << block_number;
+                continue;
+            }
+            const auto receipts = co_await core::rawdb::read_raw_receipts(tx_database, block_number);
+            insert(std::make_shared<BlockFeeSummary>(make_block_fee_summary(*chain_config, *block_with_hash, receipts)));
+        }
+    } catch (const std::exception& e) {
+        SILK_WARN << "FeeSummaryCache::update exception: " << e.what();
+    }
+    co_await tx->close();  // RAII not (yet) available with coroutines
+}
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,111 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <evmc/evmc.hpp>
+#include <intx/intx.hpp>
+
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/interfaces/remote/kv.pb.h>
+#include <silkworm/silkrpc/ethbackend/backend.hpp>
+#include <silkworm/silkrpc/ethdb/database.hpp>
+#include <silkworm/silkrpc/types/receipt.hpp>
+
+namespace silkworm::rpc {
+
+//! Default max number of block fee summaries kept in memory
+inline constexpr size_t kDefaultFeeSummaryCacheSize{1024};
+
+//! Effective tip paid by one transaction along with its gas used
+struct TransactionTip {
+    intx::uint256 tip;
+    uint64_t gas_used{0};
+};
+
+//! The fee statistics of one block needed by fee history and gas price oracles
+struct BlockFeeSummary {
+    BlockNum block_number{0};
+    evmc::bytes32 block_hash;
+    intx::uint256 base_fee;
+    intx::uint256 next_base_fee;
+    uint64_t gas_used{0};
+    double gas_used_ratio{0};
+
+    //! Whether transaction tips are available, i.e. receipts were available when building the summary
+    bool has_tips{false};
+
+    //! Transaction effective tips sorted in ascending order
+    std::vector<TransactionTip> sorted_tips;
+
+    //! Lowest priority fees per gas eligible as gas price samples, sorted in ascending order
+    std::vector<intx::uint256> gas_price_samples;
+
+    //! Compute the rewards (i.e. effective tips) at the given percentiles of gas used, as in Erigon/Geth fee history
+    [[nodiscard]] std::vector<intx::uint256> rewards(const std::vector<std::int8_t>& reward_percentile) const;
+};
+
+//! \brief Build the fee summary of the specified block
+//! \param receipts the block receipts (raw or full) or empty if unavailable, in which case no tips are computed
+BlockFeeSummary make_block_fee_summary(const ChainConfig& config, const BlockWithHash& block_with_hash, const Receipts& receipts);
+
+//! \brief FeeSummaryCache keeps the fee summaries of the most recent canonical blocks in a ring buffer
+//! \details Summaries are computed just once when new heads are notified by the state changes stream and then served
+//! from memory to eth_feeHistory, eth_gasPrice and eth_maxPriorityFeePerGas. Unwound blocks are dropped.
+class FeeSummaryCache {
+  public:
+    explicit FeeSummaryCache(size_t capacity = kDefaultFeeSummaryCacheSize);
+
+    FeeSummaryCache(const FeeSummaryCache&) = delete;
+    FeeSummaryCache& operator=(const FeeSummaryCache&) = delete;
+
+    //! Get the fee summary of the specified canonical block, if any
+    [[nodiscard]] std::shared_ptr<const BlockFeeSummary> get(BlockNum block_number) const;
+
+    //! Store the fee summary of a block notified as new head, ignored if such block is no more expected
+    void insert(std::shared_ptr<const BlockFeeSummary> summary);
+
+    //! Record the new heads as pending and drop the unwound blocks
+    void on_new_block(const remote::StateChangeBatch& state_changes);
+
+    //! Compute and store the fee summaries of the pending new heads
+    Task<void> update(ethdb::Database& database, ethbackend::BackEnd* backend, BlockCache& block_cache);
+
+    [[nodiscard]] size_t capacity() const { return ring_.size(); }
+
+  private:
+    struct Slot {
+        BlockNum block_number{0};
+        evmc::bytes32 block_hash;
+        std::shared_ptr<const BlockFeeSummary> summary;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<Slot> ring_;
+    std::vector<std::pair<BlockNum, evmc::bytes32>> pending_blocks_;
+};
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,146 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "fee_summary_cache.hpp"
+
+#include <catch2/catch.hpp>
+#include <evmc/evmc.hpp>
+
+#include <silkworm/infra/grpc/common/conversion.hpp>
+#include <silkworm/silkrpc/core/gas_price_oracle.hpp>
+
+namespace silkworm::rpc {
+
+using evmc::literals::operator""_address;
+using evmc::literals::operator""_bytes32;
+
+static silkworm::Transaction make_transaction(const intx::uint256& max_priority_fee, const intx::uint256& max_fee) {
+    silkworm::Transaction txn;
+    txn.type = TransactionType::kDynamicFee;
+    txn.max_priority_fee_per_gas = max_priority_fee;
+    txn.max_fee_per_gas = max_fee;
+    txn.from = 0xe5ef458d37212a06e3f59d40c454e76150ae7c32_address;
+    return txn;
+}
+
+static void add_change(remote::StateChangeBatch& batch, BlockNum block_number, const evmc::bytes32& block_hash,
+                       remote::Direction direction = remote::Direction::FORWARD) {
+    auto* state_change = batch.add_change_batch();
+    state_change->set_direction(direction);
+    state_change->set_block_height(block_number);
+    state_change->set_allocated_block_hash(H256_from_bytes32(block_hash).release());
+}
+
+static std::shared_ptr<BlockFeeSummary> make_summary(BlockNum block_number, const evmc::bytes32& block_hash) {
+    auto summary = std::make_shared<BlockFeeSummary>();
+    summary->block_number = block_number;
+    summary->block_hash = block_hash;
+    return summary;
+}
+
+TEST_CASE("make_block_fee_summary", "[silkrpc][core][fee_summary_cache]") {
+    BlockWithHash block_with_hash;
+    auto& header = block_with_hash.block.header;
+    header.number = 17'000'000;
+    header.gas_limit = 30'000'000;
+    header.gas_used = 15'000'000;
+    header.base_fee_per_gas = 10 * kGWei;
+    auto& transactions = block_with_hash.block.transactions;
+    transactions.push_back(make_transaction(3 * kGWei, 100 * kGWei));
+    transactions.push_back(make_transaction(1 * kGWei, 100 * kGWei));
+    transactions.push_back(make_transaction(5 * kGWei, 12 * kGWei));  // tip capped by max fee
+
+    SECTION("with receipts") {
+        Receipts receipts(3);
+        receipts[0].cumulative_gas_used = 5'000'000;
+        receipts[1].cumulative_gas_used = 10'000'000;
+        receipts[2].cumulative_gas_used = 15'000'000;
+        const auto summary = make_block_fee_summary(kMainnetConfig, block_with_hash, receipts);
+        CHECK(summary.block_number == 17'000'000);
+        CHECK(summary.base_fee == 10 * kGWei);
+        CHECK(summary.next_base_fee == 10 * kGWei);  // gas used exactly at target
+        CHECK(summary.gas_used_ratio == 0.5);
+        CHECK(summary.has_tips);
+        REQUIRE(summary.sorted_tips.size() == 3);
+        CHECK(summary.sorted_tips[0].tip == 1 * kGWei);
+        CHECK(summary.sorted_tips[1].tip == 2 * kGWei);
+        CHECK(summary.sorted_tips[2].tip == 3 * kGWei);
+        CHECK(summary.gas_price_samples == std::vector<intx::uint256>{1 * kGWei, 2 * kGWei, 3 * kGWei});
+
+        CHECK(summary.rewards({0, 10, 34, 50, 100}) == std::vector<intx::uint256>{1 * kGWei, 1 * kGWei, 2 * kGWei, 2 * kGWei, 3 * kGWei});
+    }
+
+    SECTION("without receipts") {
+        const auto summary = make_block_fee_summary(kMainnetConfig, block_with_hash, {});
+        CHECK_FALSE(summary.has_tips);
+        CHECK(summary.sorted_tips.empty());
+        CHECK(summary.gas_price_samples.size() == kSamples);
+        CHECK(summary.rewards({50}) == std::vector<intx::uint256>{0});
+    }
+}
+
+TEST_CASE("FeeSummaryCache", "[silkrpc][core][fee_summary_cache]") {
+    FeeSummaryCache cache{4};
+    CHECK(cache.capacity() == 4);
+    CHECK(cache.get(1) == nullptr);
+
+    const auto hash1{0x1111111111111111111111111111111111111111111111111111111111111111_bytes32};
+    const auto hash2{0x2222222222222222222222222222222222222222222222222222222222222222_bytes32};
+
+    SECTION("insert only blocks notified as new heads") {
+        cache.insert(make_summary(1, hash1));
+        CHECK(cache.get(1) == nullptr);
+
+        remote::StateChangeBatch batch;
+        add_change(batch, 1, hash1);
+        cache.on_new_block(batch);
+        CHECK(cache.get(1) == nullptr);
+
+        cache.insert(make_summary(1, hash2));
+        CHECK(cache.get(1) == nullptr);
+        cache.insert(make_summary(1, hash1));
+        REQUIRE(cache.get(1) != nullptr);
+        CHECK(cache.get(1)->block_hash == hash1);
+    }
+
+    SECTION("unwind drops blocks") {
+        remote::StateChangeBatch batch;
+        add_change(batch, 1, hash1);
+        add_change(batch, 2, hash2);
+        cache.on_new_block(batch);
+        cache.insert(make_summary(1, hash1));
+        cache.insert(make_summary(2, hash2));
+
+        remote::StateChangeBatch unwind_batch;
+        add_change(unwind_batch, 2, hash2, remote::Direction::UNWIND);
+        cache.on_new_block(unwind_batch);
+        CHECK(cache.get(1) != nullptr);
+        CHECK(cache.get(2) == nullptr);
+    }
+
+    SECTION("ring buffer overwrites oldest blocks") {
+        remote::StateChangeBatch batch;
+        add_change(batch, 1, hash1);
+        add_change(batch, 5, hash2);
+        cache.on_new_block(batch);
+        cache.insert(make_summary(1, hash1));
+        cache.insert(make_summary(5, hash2));
+        CHECK(cache.get(1) == nullptr);
+        CHECK(cache.get(5) != nullptr);
+    }
+}
+
+}  // namespace silkworm::rpc
@@ -16,7 +16,15 @@
 
 #include "filter_storage.hpp"
 
+#include <algorithm>
+#include <exception>
+
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/grpc/common/conversion.hpp>
+#include <silkworm/silkrpc/core/cached_chain.hpp>
+#include <silkworm/silkrpc/core/rawdb/chain.hpp>
+#include <silkworm/silkrpc/core/subscription_manager.hpp>
+#include <silkworm/silkrpc/ethdb/transaction_database.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
 
 namespace silkworm::rpc {
@@ -25,9 +33,11 @@ std::mt19937_64 random_engine{std::random_device{}()};
 
 Generator default_generator = []() { return random_engine(); };
 
-FilterStorage::FilterStorage(std::size_t max_size, double max_filter_age) : generator_{default_generator}, max_size_{max_size}, max_filter_age_{max_filter_age} {}
+FilterStorage::FilterStorage(std::size_t max_size, double max_filter_age, std::size_t max_pending_logs)
+    : generator_{default_generator}, max_size_{max_size}, max_filter_age_{max_filter_age}, max_pending_logs_{max_pending_logs} {}
 
-FilterStorage::FilterStorage(Generator& generator, std::size_t max_size, double max_filter_age) : generator_{generator}, max_size_{max_size}, max_filter_age_{max_filter_age} {}
+FilterStorage::FilterStorage(Generator& generator, std::size_t max_size, double max_filter_age, std::size_t max_pending_logs)
+    : generator_{generator}, max_size_{max_size}, max_filter_age_{max_filter_age}, max_pending_logs_{max_pending_logs} {}
 
 std::optional<std::string> FilterStorage::add_filter(const StoredFilter& filter) {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -57,7 +67,9 @@ std::optional<std::string> FilterStorage::add_filter(const StoredFilter& filter)
         return std::nullopt;
     }
 
-    storage_.emplace(filter_id, entry);
+    entry.filter.last_drained_block = std::max(entry.filter.end, last_block_number_);
+    index(filter_id, entry.filter);
+    storage_.emplace(filter_id, std::move(entry));
     return filter_id;
 }
 
@@ -68,7 +80,7 @@ bool FilterStorage::remove_filter(const std::string& filter_id) {
     if (itr == storage_.end()) {
         return false;
     }
-    storage_.erase(itr);
+    erase(itr);
 
     return true;
 }
@@ -86,7 +98,7 @@ std::optional<std::reference_wrapper<StoredFilter>> FilterStorage::get_filter(co
     auto age = itr->second.age();
     if (age > max_filter_age_) {
         SILK_TRACE << "Filter  " << filter_id << " exhausted: removed";
-        storage_.erase(itr);
+        erase(itr);
         return std::nullopt;
     }
 
@@ -100,10 +112,218 @@ void FilterStorage::clean_up() {
         auto age = itr->second.age();
         if (age > max_filter_age_) {
             SILK_TRACE << "Filter  " << itr->first << " exhausted: removed";
-            itr = storage_.erase(itr);
+            itr = erase(itr);
         } else {
             ++itr;
         }
     }
 }
+
+std::optional<PendingLogs> FilterStorage::take_pending_logs(const std::string& filter_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto itr = storage_.find(filter_id);
+    if (itr == storage_.end() || !itr->second.filter.follows_head) {
+        return std::nullopt;
+    }
+    itr->second.renew();
+
+    auto& filter = itr->second.filter;
+    PendingLogs pending_logs;
+    if (filter.pending_logs_lost) {
+        if (last_block_number_ > filter.last_drained_block) {
+            pending_logs.lost_range = std::make_pair(filter.last_drained_block + 1, last_block_number_);
+        }
+        filter.pending_logs_lost = false;
+    } else {
+        pending_logs.logs.swap(filter.pending_logs);
+    }
+    filter.last_drained_block = std::max(filter.last_drained_block, last_block_number_);
+    return pending_logs;
+}
+
+void FilterStorage::on_new_block(const remote::StateChangeBatch& state_changes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const bool any_log_filter = !filters_by_address_.empty() || !filters_by_topic_.empty() || !unindexed_filters_.empty();
+    for (const auto& state_change : state_changes.change_batch()) {
+        const BlockNum block_number{state_change.block_height()};
+        if (state_change.direction() == remote::Direction::UNWIND) {
+            // Logs of unwound blocks must not be returned anymore, the ones of the new blocks will be pushed again
+            const BlockNum last_valid_block{block_number > 0 ? block_number - 1 : 0};
+            for (auto& [_, entry] : storage_) {
+                std::erase_if(entry.filter.pending_logs, [&](const Log& log) { return log.block_number >= block_number; });
+                entry.filter.last_drained_block = std::min(entry.filter.last_drained_block, last_valid_block);
+            }
+            std::erase_if(pending_blocks_, [&](const auto& pending) { return pending.first >= block_number; });
+            lowest_unwound_block_ = std::min(lowest_unwound_block_, block_number);
+            last_block_number_ = std::min(last_block_number_, last_valid_block);
+            continue;
+        }
+        if (any_log_filter) {
+            pending_blocks_.emplace_back(block_number, bytes32_from_H256(state_change.block_hash()));
+        } else {
+            last_block_number_ = block_number;
+        }
+    }
+}
+
+Task<void> FilterStorage::update(ethdb::Database& database, ethbackend::BackEnd* backend, BlockCache& block_cache) {
+    co_await update([&](const PendingBlocks& pending_blocks) -> Task<BlocksLogs> {
+        // Open one transaction per batch, otherwise the new heads committed in the meantime would not be visible
+        BlocksLogs blocks_logs;
+        auto tx = co_await database.begin();
+        try {
+            ethdb::TransactionDatabase tx_database{*tx};
+            const auto chain_storage{tx->create_storage(tx_database, backend)};
+
+            for (const auto& [block_number, block_hash] : pending_blocks) {
+                const auto block_with_hash = co_await core::read_block_by_hash(block_cache, *chain_storage, block_hash);
+                if (!block_with_hash) {
+                    SILK_DEBUG << "FilterStorage::update block not found: " << block_number;
+                    continue;
+                }
+                const auto receipts = co_await core::rawdb::read_receipts(tx_database, *block_with_hash);
+                auto& [_, logs] = blocks_logs.emplace_back(block_number, std::vector<Log>{});
+                for (const auto& receipt : receipts) {
+                    logs.insert(logs.end(), receipt.logs.cbegin(), receipt.logs.cend());
+                }
+            }
+        } catch (const std::exception& e) {
+            SILK_WARN << "FilterStorage::update exception: " << e.what();
+        }
+        co_await tx->close();  // RAII not (yet) available with coroutines
+        co_return blocks_logs;
+    });
+}
+
+Task<void> FilterStorage::update(const LogsReader& read_logs) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (updating_) {
+            co_return;
+        }
+        updating_ = true;
+    }
+
+    // Single consumer of the pending new heads: logs are matched in block order and never for a skipped block
+    while (true) {
+        PendingBlocks pending_blocks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pending_blocks_.empty()) {
+                updating_ = false;
+                co_return;
+            }
+            pending_blocks.swap(pending_blocks_);
+            lowest_unwound_block_ = std::numeric_limits<BlockNum>::max();
+        }
+
+        BlocksLogs blocks_logs;
+        try {
+            blocks_logs = co_await read_logs(pending_blocks);
+        } catch (const std::exception& e) {
+            SILK_WARN << "FilterStorage::update exception: " << e.what();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& [block_number, logs] : blocks_logs) {
+            // Logs of the blocks unwound while reading are stale, the ones of the new blocks are pending again
+            if (block_number >= lowest_unwound_block_) {
+                SILK_DEBUG << "FilterStorage::update block unwound: " << block_number;
+                continue;
+            }
+            match_logs(block_number, logs);
+        }
+    }
+}
+
+void FilterStorage::on_new_logs(BlockNum block_number, const std::vector<Log>& logs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    match_logs(block_number, logs);
+}
+
+void FilterStorage::match_logs(BlockNum block_number, const std::vector<Log>& logs) {
+    last_block_number_ = std::max(last_block_number_, block_number);
+
+    // Each log is checked only against the filters sharing its address or first topic, plus the unindexed ones
+    std::vector<const std::string*> candidates;
+    for (const auto& log : logs) {
+        candidates.clear();
+        if (const auto it = filters_by_address_.find(log.address); it != filters_by_address_.end()) {
+            for (const auto& filter_id : it->second) candidates.push_back(&filter_id);
+        }
+        if (!log.topics.empty()) {
+            if (const auto it = filters_by_topic_.find(log.topics[0]); it != filters_by_topic_.end()) {
+                for (const auto& filter_id : it->second) candidates.push_back(&filter_id);
+            }
+        }
+        for (const auto& filter_id : unindexed_filters_) candidates.push_back(&filter_id);
+        std::sort(candidates.begin(), candidates.end(), [](const auto* lhs, const auto* rhs) { return *lhs < *rhs; });
+        candidates.erase(std::unique(candidates.begin(), candidates.end(), [](const auto* lhs, const auto* rhs) { return *lhs == *rhs; }),
+                         candidates.end());
+
+        for (const auto* filter_id : candidates) {
+            const auto itr = storage_.find(*filter_id);
+            if (itr == storage_.end()) continue;
+            auto& filter = itr->second.filter;
+            if (filter.pending_logs_lost || block_number < filter.start || block_number <= filter.last_drained_block) continue;
+            if (!log_matches(log, filter.addresses, filter.topics)) continue;
+            if (filter.pending_logs.size() == max_pending_logs_) {
+                SILK_DEBUG << "Filter " << *filter_id << " not polled, pending logs discarded";
+                filter.pending_logs.clear();
+                filter.pending_logs.shrink_to_fit();
+                filter.pending_logs_lost = true;
+                continue;
+            }
+            filter.pending_logs.push_back(log);
+        }
+    }
+}
+
+std::map<std::string, FilterEntry>::iterator FilterStorage::erase(std::map<std::string, FilterEntry>::iterator itr) {
+    unindex(itr->first, itr->second.filter);
+    return storage_.erase(itr);
+}
+
+void FilterStorage::index(const std::string& filter_id, const StoredFilter& filter) {
+    if (!filter.follows_head) {
+        return;
+    }
+    if (!filter.addresses.empty()) {
+        for (const auto& address : filter.addresses) {
+            filters_by_address_[address].push_back(filter_id);
+        }
+    } else if (!filter.topics.empty() && !filter.topics[0].empty()) {
+        for (const auto& topic : filter.topics[0]) {
+            filters_by_topic_[topic].push_back(filter_id);
+        }
+    } else {
+        unindexed_filters_.push_back(filter_id);
+    }
+}
+
+void FilterStorage::unindex(const std::string& filter_id, const StoredFilter& filter) {
+    if (!filter.follows_head) {
+        return;
+    }
+    const auto unindex_from = [&](auto& index, const auto& key) {
+        const auto it = index.find(key);
+        if (it == index.end()) return;
+        std::erase(it->second, filter_id);
+        if (it->second.empty()) index.erase(it);
+    };
+    if (!filter.addresses.empty()) {
+        for (const auto& address : filter.addresses) {
+            unindex_from(filters_by_address_, address);
+        }
+    } else if (!filter.topics.empty() && !filter.topics[0].empty()) {
+        for (const auto& topic : filter.topics[0]) {
+            unindex_from(filters_by_topic_, topic);
+        }
+    } else {
+        std::erase(unindexed_filters_, filter_id);
+    }
+}
+
 }  // namespace silkworm::rpc
@@ -21,10 +21,22 @@
 #include <limits>
 #include <map>
 #include <mutex>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <absl/container/flat_hash_map.h>
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
+#include <silkworm/interfaces/remote/kv.pb.h>
+#include <silkworm/silkrpc/ethbackend/backend.hpp>
+#include <silkworm/silkrpc/ethdb/database.hpp>
 #include <silkworm/silkrpc/types/filter.hpp>
 #include <silkworm/silkrpc/types/log.hpp>
 
@@ -32,6 +44,7 @@ namespace silkworm::rpc {
 
 static const std::size_t kDefaultFilterStorageSize = 1024;  // default filter storage size, ie max num for filters in storage
 static const std::size_t kDefaultMaxFilterAge = 900;        // lasting time for unused filters in seconds (15 min)
+static const std::size_t kDefaultMaxPendingLogs = 10'000;   // max num of logs accumulated per filter between two polls
 
 enum FilterType {
     logs,
@@ -43,6 +56,19 @@ struct StoredFilter : public Filter {
     uint64_t start = std::numeric_limits<std::uint64_t>::max();
     uint64_t end = std::numeric_limits<std::uint64_t>::max();
     std::vector<Log> logs;
+
+    /* push-accumulated logs (only for log filters following the chain head) */
+    bool follows_head{false};
+    std::vector<Log> pending_logs;   // logs matched on new blocks since the last poll
+    bool pending_logs_lost{false};   // true if pending logs exceeded the max size and have been discarded
+    uint64_t last_drained_block{0};  // highest block whose logs have been returned by the last poll
+};
+
+//! The logs of a filter following the chain head accumulated since the last poll
+struct PendingLogs {
+    std::vector<Log> logs;
+    //! The block range [first, last] to scan instead, if the accumulated logs have been discarded
+    std::optional<std::pair<uint64_t, uint64_t>> lost_range;
 };
 
 struct FilterEntry {
@@ -57,8 +83,16 @@ typedef std::function<std::uint64_t()> Generator;
 
 class FilterStorage {
   public:
-    explicit FilterStorage(std::size_t max_size, double max_filter_age = kDefaultMaxFilterAge);
-    explicit FilterStorage(Generator& generator, std::size_t max_size, double max_filter_age = kDefaultMaxFilterAge);
+    using PendingBlocks = std::vector<std::pair<BlockNum, evmc::bytes32>>;
+    using BlocksLogs = std::vector<std::pair<BlockNum, std::vector<Log>>>;
+
+    //! Read the logs of each of the given blocks, skipping the blocks not found
+    using LogsReader = std::function<Task<BlocksLogs>(const PendingBlocks&)>;
+
+    explicit FilterStorage(std::size_t max_size, double max_filter_age = kDefaultMaxFilterAge,
+                           std::size_t max_pending_logs = kDefaultMaxPendingLogs);
+    explicit FilterStorage(Generator& generator, std::size_t max_size, double max_filter_age = kDefaultMaxFilterAge,
+                           std::size_t max_pending_logs = kDefaultMaxPendingLogs);
 
     FilterStorage(const FilterStorage&) = delete;
     FilterStorage& operator=(const FilterStorage&) = delete;
@@ -67,6 +101,23 @@ class FilterStorage {
     bool remove_filter(const std::string& filter_id);
     std::optional<std::reference_wrapper<StoredFilter>> get_filter(const std::string& filter_id);
 
+    //! Take the logs accumulated by the specified filter since the last call, nullopt if the filter does not
+    //! follow the chain head (or is not found) and logs must be polled from the database
+    std::optional<PendingLogs> take_pending_logs(const std::string& filter_id);
+
+    //! Record the new heads whose logs must be matched by the next update, if any filter follows the chain head
+    void on_new_block(const remote::StateChangeBatch& state_changes);
+
+    //! Read the logs of the pending new heads and match them against the installed filters
+    Task<void> update(ethdb::Database& database, ethbackend::BackEnd* backend, BlockCache& block_cache);
+
+    //! Same as above, reading the logs by means of the given reader. Concurrent updates are serialized: if another
+    //! update is in progress, it will match the pending new heads after its own ones, so this returns immediately
+    Task<void> update(const LogsReader& read_logs);
+
+    //! Match the logs of one new block against all the filters following the chain head, just once
+    void on_new_logs(BlockNum block_number, const std::vector<Log>& logs);
+
     [[nodiscard]] auto size() const {
         return storage_.size();
     }
@@ -74,11 +125,39 @@ class FilterStorage {
   private:
     void clean_up();
 
+    //! Match the logs of one new block against all the filters following the chain head, lock held
+    void match_logs(BlockNum block_number, const std::vector<Log>& logs);
+
+    //! Erase the entry pointed by the iterator, keeping the log index consistent
+    std::map<std::string, FilterEntry>::iterator erase(std::map<std::string, FilterEntry>::iterator itr);
+
+    void index(const std::string& filter_id, const StoredFilter& filter);
+    void unindex(const std::string& filter_id, const StoredFilter& filter);
+
     Generator& generator_;
     std::size_t max_size_;
     std::chrono::duration<double> max_filter_age_;
+    std::size_t max_pending_logs_;
     std::mutex mutex_;
     std::map<std::string, FilterEntry> storage_;
+
+    //! Index of the filters following the chain head: by address, by first topic if no address is specified or
+    //! unindexed if neither is specified (i.e. matching any log)
+    absl::flat_hash_map<evmc::address, std::vector<std::string>> filters_by_address_;
+    absl::flat_hash_map<evmc::bytes32, std::vector<std::string>> filters_by_topic_;
+    std::vector<std::string> unindexed_filters_;
+
+    //! The new heads whose logs have not been read yet
+    PendingBlocks pending_blocks_;
+
+    //! Flag indicating if an update is in progress, i.e. reading the logs of the new heads taken from pending ones
+    bool updating_{false};
+
+    //! The lowest block unwound while the update in progress was reading logs: logs from there on are stale
+    BlockNum lowest_unwound_block_{std::numeric_limits<BlockNum>::max()};
+
+    //! The highest block whose logs have been matched
+    BlockNum last_block_number_{0};
 };
 
 }  // namespace silkworm::rpc
@@ -16,17 +16,26 @@
 
 #include "filter_storage.hpp"
 
+#include <chrono>
+#include <future>
 #include <thread>
 
+#include <boost/asio/as_tuple.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <catch2/catch.hpp>
 #include <nlohmann/json.hpp>
 
+#include <silkworm/infra/grpc/common/conversion.hpp>
 #include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/infra/test_util/task_runner.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
 
 namespace silkworm::rpc {
 
 using Catch::Matchers::Message;
+using evmc::literals::operator""_address;
+using evmc::literals::operator""_bytes32;
 
 TEST_CASE("FilterStorage base") {
     test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
@@ -140,4 +149,251 @@ TEST_CASE("FilterStorage enhanced") {
     }
 }
 
+TEST_CASE("FilterStorage pushed logs") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+
+    const auto address1{0x00000000000000000000000000000000000000aa_address};
+    const auto address2{0x00000000000000000000000000000000000000bb_address};
+    const auto topic1{0x000000000000000000000000000000000000000000000000000000000000000a_bytes32};
+    const auto topic2{0x000000000000000000000000000000000000000000000000000000000000000b_bytes32};
+    const Log log1{.address = address1, .topics = {topic1}, .block_number = 101};
+    const Log log2{.address = address2, .topics = {topic2}, .block_number = 101};
+
+    FilterStorage filter_storage{10, kDefaultMaxFilterAge, /*max_pending_logs=*/2};
+    StoredFilter filter;
+    filter.start = 100;
+    filter.end = 100;
+    filter.follows_head = true;
+
+    SECTION("logs matched by address and topic") {
+        StoredFilter by_address{filter};
+        by_address.addresses = {address1};
+        StoredFilter by_topic{filter};
+        by_topic.topics = {{topic2}};
+        const auto id_by_address = filter_storage.add_filter(by_address);
+        const auto id_by_topic = filter_storage.add_filter(by_topic);
+        const auto id_any = filter_storage.add_filter(filter);
+
+        filter_storage.on_new_logs(101, {log1, log2});
+
+        const auto logs_by_address = filter_storage.take_pending_logs(*id_by_address);
+        REQUIRE(logs_by_address);
+        CHECK(!logs_by_address->lost_range);
+        REQUIRE(logs_by_address->logs.size() == 1);
+        CHECK(logs_by_address->logs[0].address == address1);
+        const auto logs_by_topic = filter_storage.take_pending_logs(*id_by_topic);
+        REQUIRE(logs_by_topic);
+        REQUIRE(logs_by_topic->logs.size() == 1);
+        CHECK(logs_by_topic->logs[0].address == address2);
+        const auto logs_any = filter_storage.take_pending_logs(*id_any);
+        REQUIRE(logs_any);
+        CHECK(logs_any->logs.size() == 2);
+
+        // Logs are drained by polling
+        CHECK(filter_storage.take_pending_logs(*id_any)->logs.empty());
+    }
+
+    SECTION("filters not following head are polled") {
+        filter.follows_head = false;
+        const auto filter_id = filter_storage.add_filter(filter);
+        filter_storage.on_new_logs(101, {log1});
+        CHECK(!filter_storage.take_pending_logs(*filter_id));
+    }
+
+    SECTION("removed filters not matched") {
+        const auto filter_id = filter_storage.add_filter(filter);
+        CHECK(filter_storage.remove_filter(*filter_id));
+        filter_storage.on_new_logs(101, {log1});
+        CHECK(!filter_storage.take_pending_logs(*filter_id));
+    }
+
+    SECTION("too many logs fall back to scan") {
+        const auto filter_id = filter_storage.add_filter(filter);
+        filter_storage.on_new_logs(101, {log1, log2});
+        filter_storage.on_new_logs(102, {log1});
+        filter_storage.on_new_logs(103, {log1});
+
+        const auto pending_logs = filter_storage.take_pending_logs(*filter_id);
+        REQUIRE(pending_logs);
+        CHECK(pending_logs->logs.empty());
+        REQUIRE(pending_logs->lost_range);
+        CHECK(pending_logs->lost_range->first == 101);
+        CHECK(pending_logs->lost_range->second == 103);
+
+        filter_storage.on_new_logs(104, {log1});
+        CHECK(filter_storage.take_pending_logs(*filter_id)->logs.size() == 1);
+    }
+}
+
+static void add_change(remote::StateChangeBatch& batch, BlockNum block_number, const evmc::bytes32& block_hash,
+                       remote::Direction direction = remote::Direction::FORWARD) {
+    auto* state_change = batch.add_change_batch();
+    state_change->set_direction(direction);
+    state_change->set_block_height(block_number);
+    state_change->set_allocated_block_hash(H256_from_bytes32(block_hash).release());
+}
+
+//! Poll the io_context until the spawned tasks cannot make further progress
+static void poll_all(test_util::TaskRunner& runner) {
+    runner.context().restart();
+    while (runner.context().poll_one() > 0) {
+    }
+}
+
+TEST_CASE("FilterStorage update", "[silkrpc][core][filter_storage]") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    test_util::TaskRunner runner;
+
+    const auto address{0x00000000000000000000000000000000000000aa_address};
+    const auto hash101{0x0101010101010101010101010101010101010101010101010101010101010101_bytes32};
+    const auto hash102{0x0202020202020202020202020202020202020202020202020202020202020202_bytes32};
+    const auto hash102_reorg{0x2020202020202020202020202020202020202020202020202020202020202020_bytes32};
+    const auto hash103{0x0303030303030303030303030303030303030303030303030303030303030303_bytes32};
+
+    // Each block has one log, logs of forks are told apart by block hash
+    std::vector<FilterStorage::PendingBlocks> reads;
+    bool reader_blocked{false};
+    boost::asio::steady_timer gate{runner.context(), std::chrono::steady_clock::time_point::max()};
+    const FilterStorage::LogsReader read_logs = [&](const FilterStorage::PendingBlocks& pending_blocks) -> Task<FilterStorage::BlocksLogs> {
+        reads.push_back(pending_blocks);
+        if (reader_blocked) {
+            reader_blocked = false;
+            co_await gate.async_wait(boost::asio::as_tuple(boost::asio::use_awaitable));
+        }
+        FilterStorage::BlocksLogs blocks_logs;
+        for (const auto& [block_number, block_hash] : pending_blocks) {
+            const Log log{.address = address, .block_number = block_number, .block_hash = block_hash};
+            blocks_logs.emplace_back(block_number, std::vector<Log>{log});
+        }
+        co_return blocks_logs;
+    };
+    const auto log_hashes = [](const PendingLogs& pending_logs) {
+        std::vector<evmc::bytes32> hashes;
+        for (const auto& log : pending_logs.logs) {
+            hashes.push_back(log.block_hash);
+        }
+        return hashes;
+    };
+
+    FilterStorage filter_storage{10};
+    StoredFilter filter;
+    filter.start = 100;
+    filter.end = 100;
+    filter.follows_head = true;
+
+    SECTION("no new heads recorded without log filters") {
+        remote::StateChangeBatch batch;
+        add_change(batch, 101, hash101);
+        filter_storage.on_new_block(batch);
+        runner.run(filter_storage.update(read_logs));
+        CHECK(reads.empty());
+
+        // Only the logs of blocks after the last new head can be pushed to filters installed afterwards
+        const auto filter_id = filter_storage.add_filter(filter);
+        filter_storage.on_new_logs(101, {Log{.address = address, .block_number = 101}});
+        CHECK(filter_storage.take_pending_logs(*filter_id)->logs.empty());
+    }
+
+    SECTION("new heads matched on update") {
+        const auto filter_id = filter_storage.add_filter(filter);
+        remote::StateChangeBatch batch;
+        add_change(batch, 101, hash101);
+        add_change(batch, 102, hash102);
+        filter_storage.on_new_block(batch);
+        CHECK(filter_storage.take_pending_logs(*filter_id)->logs.empty());
+
+        runner.run(filter_storage.update(read_logs));
+        REQUIRE(reads.size() == 1);
+        CHECK(reads[0] == FilterStorage::PendingBlocks{{101, hash101}, {102, hash102}});
+        CHECK(log_hashes(*filter_storage.take_pending_logs(*filter_id)) == std::vector{hash101, hash102});
+
+        // Nothing left to read
+        runner.run(filter_storage.update(read_logs));
+        CHECK(reads.size() == 1);
+    }
+
+    SECTION("concurrent updates are serialized in block order") {
+        const auto filter_id = filter_storage.add_filter(filter);
+        remote::StateChangeBatch batch101;
+        add_change(batch101, 101, hash101);
+        filter_storage.on_new_block(batch101);
+        reader_blocked = true;
+        auto first_update = runner.spawn_future(filter_storage.update(read_logs));
+        poll_all(runner);
+        REQUIRE(reads.size() == 1);
+
+        // The update of the next block returns immediately, its block is left to the update in progress
+        remote::StateChangeBatch batch102;
+        add_change(batch102, 102, hash102);
+        filter_storage.on_new_block(batch102);
+        runner.run(filter_storage.update(read_logs));
+        CHECK(reads.size() == 1);
+        CHECK(first_update.wait_for(std::chrono::seconds{0}) == std::future_status::timeout);
+
+        // A poll in the middle must not make the logs of the block being read skipped
+        CHECK(filter_storage.take_pending_logs(*filter_id)->logs.empty());
+
+        gate.cancel();
+        runner.poll_context_until_future_is_ready(first_update);
+        REQUIRE(reads.size() == 2);
+        CHECK(reads[1] == FilterStorage::PendingBlocks{{102, hash102}});
+        CHECK(log_hashes(*filter_storage.take_pending_logs(*filter_id)) == std::vector{hash101, hash102});
+    }
+
+    SECTION("logs of blocks unwound while reading are dropped") {
+        const auto filter_id = filter_storage.add_filter(filter);
+        remote::StateChangeBatch batch;
+        add_change(batch, 101, hash101);
+        add_change(batch, 102, hash102);
+        filter_storage.on_new_block(batch);
+        reader_blocked = true;
+        auto update = runner.spawn_future(filter_storage.update(read_logs));
+        poll_all(runner);
+        REQUIRE(reads.size() == 1);
+
+        remote::StateChangeBatch reorg_batch;
+        add_change(reorg_batch, 102, hash102, remote::Direction::UNWIND);
+        add_change(reorg_batch, 102, hash102_reorg);
+        add_change(reorg_batch, 103, hash103);
+        filter_storage.on_new_block(reorg_batch);
+
+        gate.cancel();
+        runner.poll_context_until_future_is_ready(update);
+        REQUIRE(reads.size() == 2);
+        CHECK(reads[1] == FilterStorage::PendingBlocks{{102, hash102_reorg}, {103, hash103}});
+        CHECK(log_hashes(*filter_storage.take_pending_logs(*filter_id)) == std::vector{hash101, hash102_reorg, hash103});
+    }
+
+    SECTION("logs of unwound blocks are dropped") {
+        const auto filter_id = filter_storage.add_filter(filter);
+        remote::StateChangeBatch batch;
+        add_change(batch, 101, hash101);
+        add_change(batch, 102, hash102);
+        filter_storage.on_new_block(batch);
+        runner.run(filter_storage.update(read_logs));
+
+        remote::StateChangeBatch unwind_batch;
+        add_change(unwind_batch, 102, hash102, remote::Direction::UNWIND);
+        filter_storage.on_new_block(unwind_batch);
+        CHECK(log_hashes(*filter_storage.take_pending_logs(*filter_id)) == std::vector{hash101});
+    }
+
+    SECTION("logs of blocks unwound after poll are pushed again") {
+        const auto filter_id = filter_storage.add_filter(filter);
+        remote::StateChangeBatch batch;
+        add_change(batch, 101, hash101);
+        add_change(batch, 102, hash102);
+        filter_storage.on_new_block(batch);
+        runner.run(filter_storage.update(read_logs));
+        CHECK(log_hashes(*filter_storage.take_pending_logs(*filter_id)) == std::vector{hash101, hash102});
+
+        remote::StateChangeBatch reorg_batch;
+        add_change(reorg_batch, 102, hash102, remote::Direction::UNWIND);
+        add_change(reorg_batch, 102, hash102_reorg);
+        filter_storage.on_new_block(reorg_batch);
+        runner.run(filter_storage.update(read_logs));
+        CHECK(log_hashes(*filter_storage.take_pending_logs(*filter_id)) == std::vector{hash102_reorg});
+    }
+}
+
 }  // namespace silkworm::rpc
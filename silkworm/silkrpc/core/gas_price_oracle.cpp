@@ -24,6 +24,7 @@
 #include <silkworm/core/execution/address.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/silkrpc/core/blocks.hpp>
+#include <silkworm/silkrpc/core/fee_summary_cache.hpp>
 
 namespace silkworm {
 
@@ -68,6 +69,14 @@ Task<intx::uint256> GasPriceOracle::suggested_price(BlockNum block_number) {
 Task<void> GasPriceOracle::load_block_prices(BlockNum block_number, uint64_t limit, std::vector<intx::uint256>& tx_prices) {
     SILK_TRACE << "GasPriceOracle::load_block_prices processing block: " << block_number;
 
+    if (fee_summary_cache_) {
+        if (const auto summary = fee_summary_cache_->get(block_number)) {
+            const auto num_samples = std::min(summary->gas_price_samples.size(), limit);
+            tx_prices.insert(tx_prices.end(), summary->gas_price_samples.begin(), summary->gas_price_samples.begin() + static_cast<std::ptrdiff_t>(num_samples));
+            co_return;
+        }
+    }
+
     const auto block_with_hash = co_await block_provider_(block_number);
     const auto& base_fee = block_with_hash->block.header.base_fee_per_gas.value_or(0);
     const auto& coinbase = block_with_hash->block.header.beneficiary;
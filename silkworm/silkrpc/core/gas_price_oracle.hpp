@@ -29,6 +29,10 @@
 #include <silkworm/silkrpc/core/blocks.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 
+namespace silkworm::rpc {
+class FeeSummaryCache;
+}
+
 namespace silkworm {
 
 const intx::uint256 kWei = 1;
@@ -47,7 +51,9 @@ typedef std::function<Task<std::shared_ptr<silkworm::BlockWithHash>>(BlockNum)>
 
 class GasPriceOracle {
   public:
-    explicit GasPriceOracle(const BlockProvider& block_provider) : block_provider_(block_provider) {}
+    //! \param fee_summary_cache the cache of block fee summaries used to avoid reading blocks, if any
+    explicit GasPriceOracle(const BlockProvider& block_provider, rpc::FeeSummaryCache* fee_summary_cache = nullptr)
+        : block_provider_(block_provider), fee_summary_cache_(fee_summary_cache) {}
     virtual ~GasPriceOracle() {}
 
     GasPriceOracle(const GasPriceOracle&) = delete;
@@ -59,6 +65,7 @@ class GasPriceOracle {
     Task<void> load_block_prices(BlockNum block_number, uint64_t limit, std::vector<intx::uint256>& tx_prices);
 
     const BlockProvider& block_provider_;
+    rpc::FeeSummaryCache* fee_summary_cache_;
 };
 
 }  // namespace silkworm
@@ -16,6 +16,9 @@
 
 #include "logs_walker.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <iterator>
 #include <string>
 
 #include <boost/endian/conversion.hpp>
@@ -23,10 +26,13 @@
 #include <silkworm/core/execution/address.hpp>
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
 #include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
 #include <silkworm/silkrpc/core/blocks.hpp>
 #include <silkworm/silkrpc/core/cached_chain.hpp>
 #include <silkworm/silkrpc/core/rawdb/chain.hpp>
+#include <silkworm/silkrpc/core/receipts.hpp>
 #include <silkworm/silkrpc/ethdb/bitmap.hpp>
 #include <silkworm/silkrpc/ethdb/cbor.hpp>
 
@@ -68,10 +74,20 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
     SILK_DEBUG << "start block: " << start << " end block: " << end;
 
     const auto chain_storage{tx_database_.get_tx().create_storage(tx_database_, backend_)};
+
+    // Blocks in [start, pruned_end) have neither receipts nor logs (hence no log indices): their logs get regenerated
+    BlockNum pruned_end{start};
+    if (database_ && workers_) {
+        pruned_end = co_await first_block_with_receipts(start, end);
+    }
+    SILK_DEBUG << "pruned_end: " << pruned_end;
+
     roaring::Roaring block_numbers;
-    block_numbers.addRange(start, end + 1);  // [min, max)
+    if (pruned_end <= end) {
+        block_numbers.addRange(pruned_end, end + 1);  // [min, max)
+    }
 
-    if (!topics.empty()) {
+    if (!topics.empty() && !block_numbers.isEmpty()) {
         auto topics_bitmap = co_await ethdb::bitmap::from_topics(tx_database_, db::table::kLogTopicIndexName, topics, start, end);
         SILK_TRACE << "topics_bitmap: " << topics_bitmap.toString();
         if (topics_bitmap.isEmpty()) {
@@ -81,7 +97,7 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
         }
     }
 
-    if (!addresses.empty()) {
+    if (!addresses.empty() && !block_numbers.isEmpty()) {
         auto addresses_bitmap = co_await ethdb::bitmap::from_addresses(tx_database_, db::table::kLogAddressIndexName, addresses, start, end);
         if (addresses_bitmap.isEmpty()) {
             block_numbers = addresses_bitmap;
@@ -92,12 +108,15 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
     SILK_DEBUG << "block_numbers.cardinality(): " << block_numbers.cardinality();
     SILK_TRACE << "block_numbers: " << block_numbers.toString();
 
-    if (block_numbers.cardinality() == 0) {
+    if (block_numbers.cardinality() == 0 && pruned_end == start) {
         co_return;
     }
 
     std::vector<BlockNum> matching_block_numbers;
-    matching_block_numbers.reserve(block_numbers.cardinality());
+    matching_block_numbers.reserve((pruned_end - start) + block_numbers.cardinality());
+    for (BlockNum block_to_match{start}; block_to_match < pruned_end; ++block_to_match) {
+        matching_block_numbers.push_back(block_to_match);
+    }
     for (const auto& block_to_match : block_numbers) {
         matching_block_numbers.push_back(block_to_match);
     }
@@ -115,38 +134,74 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
     filtered_chunk_logs.reserve(64);
     filtered_block_logs.reserve(256);
 
-    for (const auto& block_to_match : matching_block_numbers) {
+    // Logs regenerated for the window of pruned blocks starting at regenerated_position in matching_block_numbers
+    std::vector<Logs> regenerated_logs;
+    size_t regenerated_position{0};
+
+    for (size_t position{0}; position < matching_block_numbers.size(); ++position) {
+        const auto block_to_match = matching_block_numbers[position];
         uint32_t log_index{0};
 
         filtered_block_logs.clear();
-        const auto block_key = silkworm::db::block_key(block_to_match);
-        SILK_DEBUG << "block_to_match: " << block_to_match << " block_key: " << silkworm::to_hex(block_key);
-        co_await tx_database_.for_prefix(db::table::kLogsName, block_key, [&](const silkworm::Bytes& k, const silkworm::Bytes& v) {
-            chunk_logs.clear();
-            const bool decoding_ok{cbor_decode(v, chunk_logs)};
-            if (!decoding_ok) {
-                return false;
-            }
-            for (auto& log : chunk_logs) {
-                log.index = log_index++;
+        if (block_to_match < pruned_end) {
+            if (position >= regenerated_position + regenerated_logs.size()) {
+                std::vector<BlockNum> window;
+                for (size_t i{position}; i < matching_block_numbers.size() && window.size() < kLogsRegenerationWindow; ++i) {
+                    if (matching_block_numbers[i] >= pruned_end) {
+                        break;
+                    }
+                    window.push_back(matching_block_numbers[i]);
+                }
+                regenerated_logs = co_await regenerate_logs(window);
+                regenerated_position = position;
             }
-            SILK_DEBUG << "chunk_logs.size(): " << chunk_logs.size();
-
-            filtered_chunk_logs.clear();
-            filter_logs(std::move(chunk_logs), addresses, topics, filtered_chunk_logs);
+            // Regenerated logs are already in block order, filter them transaction by transaction as the stored ones
+            auto& block_logs = regenerated_logs[position - regenerated_position];
+            for (auto it = block_logs.begin(); it != block_logs.end();) {
+                const auto tx_index = it->tx_index;
+                const auto tx_end = std::find_if(it, block_logs.end(), [&](const Log& log) { return log.tx_index != tx_index; });
+                chunk_logs.assign(std::make_move_iterator(it), std::make_move_iterator(tx_end));
+                it = tx_end;
 
-            if (!filtered_chunk_logs.empty()) {
-                const auto tx_index = boost::endian::load_big_u32(&k[sizeof(uint64_t)]);
-                SILK_TRACE << "Transaction index: " << tx_index;
-                for (auto& log : filtered_chunk_logs) {
-                    log.tx_index = tx_index;
-                }
+                filtered_chunk_logs.clear();
+                filter_logs(std::move(chunk_logs), addresses, topics, filtered_chunk_logs);
                 logCount += filtered_chunk_logs.size();
-                SILK_TRACE << "logCount: " << logCount;
                 filtered_block_logs.insert(filtered_block_logs.end(), filtered_chunk_logs.rbegin(), filtered_chunk_logs.rend());
+                if (options.log_count != 0 && options.log_count <= logCount) {
+                    break;
+                }
             }
-            return options.log_count == 0 || options.log_count > logCount;
-        });
+            block_logs.clear();
+        } else {
+            const auto block_key = silkworm::db::block_key(block_to_match);
+            SILK_DEBUG << "block_to_match: " << block_to_match << " block_key: " << silkworm::to_hex(block_key);
+            co_await tx_database_.for_prefix(db::table::kLogsName, block_key, [&](const silkworm::Bytes& k, const silkworm::Bytes& v) {
+                chunk_logs.clear();
+                const bool decoding_ok{cbor_decode(v, chunk_logs)};
+                if (!decoding_ok) {
+                    return false;
+                }
+                for (auto& log : chunk_logs) {
+                    log.index = log_index++;
+                }
+                SILK_DEBUG << "chunk_logs.size(): " << chunk_logs.size();
+
+                filtered_chunk_logs.clear();
+                filter_logs(std::move(chunk_logs), addresses, topics, filtered_chunk_logs);
+
+                if (!filtered_chunk_logs.empty()) {
+                    const auto tx_index = boost::endian::load_big_u32(&k[sizeof(uint64_t)]);
+                    SILK_TRACE << "Transaction index: " << tx_index;
+                    for (auto& log : filtered_chunk_logs) {
+                        log.tx_index = tx_index;
+                    }
+                    logCount += filtered_chunk_logs.size();
+                    SILK_TRACE << "logCount: " << logCount;
+                    filtered_block_logs.insert(filtered_block_logs.end(), filtered_chunk_logs.rbegin(), filtered_chunk_logs.rend());
+                }
+                return options.log_count == 0 || options.log_count > logCount;
+            });
+        }
         SILK_DEBUG << "filtered_block_logs.size(): " << filtered_block_logs.size();
 
         if (!filtered_block_logs.empty()) {
@@ -179,6 +234,46 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
     co_return;
 }
 
+Task<BlockNum> LogsWalker::first_block_with_receipts(BlockNum start, BlockNum end) {
+    const auto kv = co_await tx_database_.get(db::table::kBlockReceiptsName, silkworm::db::block_key(start));
+    if (kv.key.size() < sizeof(BlockNum)) {
+        co_return end + 1;
+    }
+    co_return std::min(BlockNum{boost::endian::load_big_u64(kv.key.data())}, end + 1);
+}
+
+Task<std::vector<Logs>> LogsWalker::regenerate_logs(const std::vector<BlockNum>& block_numbers) {
+    SILK_DEBUG << "regenerate_logs: #blocks: " << block_numbers.size();
+
+    std::vector<Logs> block_logs(block_numbers.size());
+    co_await concurrency::generate_parallel_group_task(block_numbers.size(), [&](size_t index) -> Task<void> {
+        // Each block gets its own transaction because the same transaction cannot be used concurrently
+        auto tx = co_await database_->begin();
+        std::exception_ptr eptr;
+        try {
+            ethdb::TransactionDatabase tx_database{*tx};
+            const auto chain_storage{tx->create_storage(tx_database, backend_)};
+            const auto block_number = block_numbers[index];
+            const auto block_with_hash = co_await core::read_block_by_number(block_cache_, *chain_storage, block_number);
+            if (!block_with_hash) {
+                throw std::invalid_argument("read_block_by_number: block not found " + std::to_string(block_number));
+            }
+            const auto receipts = co_await core::get_receipts(*tx, tx_database, *chain_storage, *workers_, block_cache_, *block_with_hash);
+            for (const auto& receipt : receipts) {
+                block_logs[index].insert(block_logs[index].end(), receipt.logs.begin(), receipt.logs.end());
+            }
+        } catch (...) {
+            eptr = std::current_exception();
+        }
+        co_await tx->close();  // RAII not (yet) available with coroutines
+        if (eptr) {
+            std::rethrow_exception(eptr);
+        }
+    });
+
+    co_return block_logs;
+}
+
 void LogsWalker::filter_logs(const std::vector<Log>&& logs, const FilterAddresses& addresses, const FilterTopics& topics, std::vector<Log>& filtered_logs) {
     SILK_DEBUG << "filter_logs: addresses: " << addresses << ", topics: " << topics;
     for (auto& log : logs) {
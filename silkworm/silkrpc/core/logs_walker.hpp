@@ -19,9 +19,11 @@
 #include <vector>
 
 #include <boost/asio/awaitable.hpp>
+#include <boost/asio/thread_pool.hpp>
 
-#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 #include <silkworm/silkrpc/ethbackend/backend.hpp>
+#include <silkworm/silkrpc/ethdb/database.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
 #include <silkworm/silkrpc/types/filter.hpp>
 #include <silkworm/silkrpc/types/log.hpp>
@@ -30,10 +32,17 @@ namespace silkworm::rpc {
 
 using boost::asio::awaitable;
 
+//! Max number of blocks whose pruned receipts are regenerated concurrently while walking logs
+inline constexpr size_t kLogsRegenerationWindow{16};
+
 class LogsWalker {
   public:
-    explicit LogsWalker(ethbackend::BackEnd* backend, BlockCache& block_cache, ethdb::TransactionDatabase& tx_database)
-        : backend_(backend), block_cache_(block_cache), tx_database_(tx_database) {}
+    //! \param database: the database used to open one transaction per concurrent block re-execution (optional)
+    //! \param workers: the workers used to re-execute the blocks whose receipts have been pruned (optional)
+    //! \remarks Logs for blocks whose receipts have been pruned are skipped unless both database and workers are given
+    explicit LogsWalker(ethbackend::BackEnd* backend, BlockCache& block_cache, ethdb::TransactionDatabase& tx_database,
+                        ethdb::Database* database = nullptr, boost::asio::thread_pool* workers = nullptr)
+        : backend_(backend), block_cache_(block_cache), tx_database_(tx_database), database_(database), workers_(workers) {}
 
     LogsWalker(const LogsWalker&) = delete;
     LogsWalker& operator=(const LogsWalker&) = delete;
@@ -50,11 +59,19 @@ class LogsWalker {
                         std::vector<Log>& logs);
 
   private:
+    //! Find the first block in [start, end] having stored receipts, end + 1 if none
+    Task<BlockNum> first_block_with_receipts(BlockNum start, BlockNum end);
+
+    //! Regenerate in parallel the logs of the specified blocks whose receipts have been pruned, one entry per block
+    Task<std::vector<Logs>> regenerate_logs(const std::vector<BlockNum>& block_numbers);
+
     void filter_logs(const std::vector<Log>&& logs, const FilterAddresses& addresses, const FilterTopics& topics, std::vector<Log>& filtered_logs);
 
     ethbackend::BackEnd* backend_;
     BlockCache& block_cache_;
     ethdb::TransactionDatabase& tx_database_;
+    ethdb::Database* database_;
+    boost::asio::thread_pool* workers_;
 };
 
 }  // namespace silkworm::rpc
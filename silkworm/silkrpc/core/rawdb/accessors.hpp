@@ -25,6 +25,10 @@
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
 
+namespace silkworm::db {
+class ROTxn;
+}
+
 namespace silkworm::rpc::core::rawdb {
 
 using Walker = std::function<bool(silkworm::Bytes&, silkworm::Bytes&)>;
@@ -42,6 +46,9 @@ class DatabaseReader {
     [[nodiscard]] virtual Task<void> walk(const std::string& table, silkworm::ByteView start_key, uint32_t fixed_bits, Walker w) const = 0;
 
     [[nodiscard]] virtual Task<void> for_prefix(const std::string& table, silkworm::ByteView prefix, Walker w) const = 0;
+
+    //! The local read-only transaction for zero-copy inline reads, or nullptr if database is not local
+    [[nodiscard]] virtual db::ROTxn* local_txn() const { return nullptr; }
 };
 
 }  // namespace silkworm::rpc::core::rawdb
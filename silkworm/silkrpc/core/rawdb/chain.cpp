@@ -205,16 +205,21 @@ Task<Receipts> read_raw_receipts(const DatabaseReader& reader, BlockNum block_nu
 }
 
 Task<Receipts> read_receipts(const DatabaseReader& reader, const silkworm::BlockWithHash& block_with_hash) {
-    const evmc::bytes32 block_hash = block_with_hash.hash;
-    uint64_t block_number = block_with_hash.block.header.number;
-    auto receipts = co_await read_raw_receipts(reader, block_number);
+    auto receipts = co_await read_raw_receipts(reader, block_with_hash.block.header.number);
 
-    // Add derived fields to the receipts
-    auto transactions = block_with_hash.block.transactions;
     SILK_DEBUG << "#transactions=" << block_with_hash.block.transactions.size() << " #receipts=" << receipts.size();
-    if (transactions.size() != receipts.size()) {
+    if (block_with_hash.block.transactions.size() != receipts.size()) {
         throw std::runtime_error{"#transactions and #receipts do not match in read_receipts"};
     }
+    add_receipts_derived_fields(block_with_hash, receipts);
+
+    co_return receipts;
+}
+
+void add_receipts_derived_fields(const silkworm::BlockWithHash& block_with_hash, Receipts& receipts) {
+    const evmc::bytes32 block_hash = block_with_hash.hash;
+    uint64_t block_number = block_with_hash.block.header.number;
+    auto transactions = block_with_hash.block.transactions;
     uint32_t log_index{0};
     for (size_t i{0}; i < receipts.size(); i++) {
         // The tx hash can be calculated by the tx content itself
@@ -225,6 +230,11 @@ Task<Receipts> read_receipts(const DatabaseReader& reader, const silkworm::Block
         receipts[i].block_hash = block_hash;
         receipts[i].block_number = block_number;
 
+        // The tx sender may be missing when senders have been pruned
+        if (!transactions[i].from) {
+            transactions[i].recover_sender();
+        }
+
         // When tx receiver is not set, create a contract with address depending on tx sender and its nonce
         if (!transactions[i].to.has_value()) {
             receipts[i].contract_address = silkworm::create_address(*transactions[i].from, transactions[i].nonce);
@@ -251,8 +261,6 @@ Task<Receipts> read_receipts(const DatabaseReader& reader, const silkworm::Block
             receipts[i].logs[j].removed = false;
         }
     }
-
-    co_return receipts;
 }
 
 Task<intx::uint256> read_total_issued(const core::rawdb::DatabaseReader& reader, BlockNum block_number) {
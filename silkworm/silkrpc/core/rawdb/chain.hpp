@@ -56,6 +56,9 @@ Task<Receipts> read_raw_receipts(const DatabaseReader& reader, BlockNum block_nu
 
 Task<Receipts> read_receipts(const DatabaseReader& reader, const silkworm::BlockWithHash& block_with_hash);
 
+//! Fill the receipt and log fields derived from block and transactions into the raw receipts (one per transaction)
+void add_receipts_derived_fields(const silkworm::BlockWithHash& block_with_hash, Receipts& receipts);
+
 Task<intx::uint256> read_total_issued(const core::rawdb::DatabaseReader& reader, BlockNum block_number);
 
 Task<intx::uint256> read_total_burnt(const core::rawdb::DatabaseReader& reader, BlockNum block_number);
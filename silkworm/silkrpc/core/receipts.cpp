@@ -16,22 +16,121 @@
 
 #include "receipts.hpp"
 
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <boost/asio/compose.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+
+#include <silkworm/infra/common/ensure.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/silkrpc/core/evm_executor.hpp>
 #include <silkworm/silkrpc/core/rawdb/chain.hpp>
 
 namespace silkworm::rpc::core {
 
-Task<Receipts> get_receipts(const core::rawdb::DatabaseReader& db_reader, const silkworm::BlockWithHash& block_with_hash) {
-    const auto cached_receipts = co_await core::rawdb::read_receipts(db_reader, block_with_hash);
-    if (!cached_receipts.empty()) {
-        co_return cached_receipts;
+Task<Receipts> get_receipts(ethdb::Transaction& tx,
+                            const core::rawdb::DatabaseReader& db_reader,
+                            const ChainStorage& chain_storage,
+                            boost::asio::thread_pool& workers,
+                            BlockCache& block_cache,
+                            const silkworm::BlockWithHash& block_with_hash) {
+    if (const auto cached_receipts{block_cache.get_receipts(block_with_hash.hash)}) {
+        co_return **cached_receipts;
+    }
+
+    const auto& transactions = block_with_hash.block.transactions;
+    auto receipts = co_await core::rawdb::read_raw_receipts(db_reader, block_with_hash.block.header.number);
+    if (receipts.empty() && !transactions.empty()) {
+        // Receipts have been pruned: retrieve them by executing transactions
+        receipts = co_await execute_block_receipts(tx, db_reader, chain_storage, workers, block_with_hash.block);
+    }
+
+    SILK_DEBUG << "#transactions=" << transactions.size() << " #receipts=" << receipts.size();
+    if (transactions.size() != receipts.size()) {
+        throw std::runtime_error{"#transactions and #receipts do not match in get_receipts"};
+    }
+    core::rawdb::add_receipts_derived_fields(block_with_hash, receipts);
+
+    // Receipts are stored by block number, so they belong to the requested block only if it is the canonical one.
+    // The most recent canonical hashes are kept up-to-date by the state changes stream, so hot blocks skip the db
+    const auto block_number = block_with_hash.block.header.number;
+    auto canonical_hash = block_cache.get_canonical_hash(block_number);
+    if (!canonical_hash) {
+        canonical_hash = co_await chain_storage.read_canonical_hash(block_number);
+    }
+    if (canonical_hash && *canonical_hash == block_with_hash.hash) {
+        block_cache.insert_receipts(block_with_hash.hash, std::make_shared<Receipts>(receipts));
     }
+    co_return receipts;
+}
+
+Task<Receipts> execute_block_receipts(ethdb::Transaction& tx,
+                                      const core::rawdb::DatabaseReader& db_reader,
+                                      const ChainStorage& chain_storage,
+                                      boost::asio::thread_pool& workers,
+                                      const silkworm::Block& block) {
+    const auto block_number = block.header.number;
+    SILK_DEBUG << "execute_block_receipts: block_number: " << block_number << " #txns: " << block.transactions.size();
+
+    const auto chain_config_ptr = co_await chain_storage.read_chain_config();
+    ensure(chain_config_ptr.has_value(), "cannot read chain config");
+
+    auto current_executor = co_await boost::asio::this_coro::executor;
+
+    const auto receipts = co_await boost::asio::async_compose<decltype(boost::asio::use_awaitable), void(std::exception_ptr, Receipts)>(
+        [&](auto&& self) {
+            boost::asio::post(workers, [&, self = std::move(self)]() mutable {
+                std::exception_ptr eptr;
+                Receipts receipts;
+                try {
+                    auto state = tx.create_state(current_executor, db_reader, chain_storage, block_number - 1);
+                    EVMExecutor executor{*chain_config_ptr, workers, state};
+                    executor.initialize_block(block);
+
+                    receipts.reserve(block.transactions.size());
+                    uint64_t cumulative_gas_used{0};
+                    for (const auto& block_transaction : block.transactions) {
+                        silkworm::Transaction transaction{block_transaction};
+                        if (!transaction.from) {
+                            transaction.recover_sender();
+                        }
+
+                        const auto execution_result = executor.call(block, transaction, /*tracers=*/{}, /*refund=*/true, /*gas_bailout=*/false);
+                        if (execution_result.pre_check_error) {
+                            throw std::runtime_error{"cannot regenerate receipts in block " + std::to_string(block_number) +
+                                                     ": " + *execution_result.pre_check_error};
+                        }
+                        cumulative_gas_used += transaction.gas_limit - execution_result.gas_left;
+
+                        Receipt& receipt = receipts.emplace_back();
+                        receipt.success = execution_result.success();
+                        receipt.cumulative_gas_used = cumulative_gas_used;
+                        for (const auto& ibs_log : executor.get_ibs_state().logs()) {
+                            Log& log = receipt.logs.emplace_back();
+                            log.address = ibs_log.address;
+                            log.topics = ibs_log.topics;
+                            log.data = ibs_log.data;
+                        }
+                        receipt.bloom = bloom_from_logs(receipt.logs);
+
+                        executor.reset();
+                    }
+                } catch (...) {
+                    eptr = std::current_exception();
+                }
+                boost::asio::post(current_executor, [eptr, receipts = std::move(receipts), self = std::move(self)]() mutable {
+                    self.complete(eptr, std::move(receipts));
+                });
+            });
+        },
+        boost::asio::use_awaitable);
 
-    // If not already present, retrieve receipts by executing transactions
-    // auto block = co_await core::rawdb::read_block(db_reader, hash, number);
-    // TODO(canepat): implement
-    SILK_WARN << "retrieve receipts by executing transactions NOT YET IMPLEMENTED";
-    co_return Receipts{};
+    co_return receipts;
 }
 
 }  // namespace silkworm::rpc::core
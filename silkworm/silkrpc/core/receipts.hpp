@@ -16,16 +16,40 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
+
 #include <silkworm/infra/concurrency/task.hpp>
 
+#include <boost/asio/thread_pool.hpp>
 #include <evmc/evmc.hpp>
 
 #include <silkworm/core/types/block.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
+#include <silkworm/silkrpc/ethdb/transaction.hpp>
+#include <silkworm/silkrpc/storage/chain_storage.hpp>
 #include <silkworm/silkrpc/types/receipt.hpp>
 
 namespace silkworm::rpc::core {
 
-Task<Receipts> get_receipts(const rawdb::DatabaseReader& db_reader, const silkworm::BlockWithHash& block_with_hash);
+//! \brief Get the receipts of the specified block, including the derived fields
+//! \details Receipts are looked up in the block cache first and stored there once read. When the receipts of a
+//! non-empty block have been pruned (i.e. PruneMode 'r'), they are regenerated by re-executing the block transactions
+//! on top of the historical state at the parent block using the workers. This requires the state history of the block
+//! to be still available (i.e. not pruned by PruneMode 'h').
+Task<Receipts> get_receipts(ethdb::Transaction& tx,
+                            const rawdb::DatabaseReader& db_reader,
+                            const ChainStorage& chain_storage,
+                            boost::asio::thread_pool& workers,
+                            BlockCache& block_cache,
+                            const silkworm::BlockWithHash& block_with_hash);
+
+//! Regenerate the raw receipts (i.e. without the derived fields) of the specified block by re-executing its transactions
+Task<Receipts> execute_block_receipts(ethdb::Transaction& tx,
+                                      const rawdb::DatabaseReader& db_reader,
+                                      const ChainStorage& chain_storage,
+                                      boost::asio::thread_pool& workers,
+                                      const silkworm::Block& block);
 
 }  // namespace silkworm::rpc::core
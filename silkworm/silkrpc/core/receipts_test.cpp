@@ -16,10 +16,107 @@
 
 #include "receipts.hpp"
 
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/use_future.hpp>
 #include <catch2/catch.hpp>
+#include <gmock/gmock.h>
 
-namespace silkworm {
+#include <silkworm/infra/grpc/common/conversion.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/silkrpc/test/mock_chain_storage.hpp>
+#include <silkworm/silkrpc/test/mock_database_reader.hpp>
+#include <silkworm/silkrpc/test/mock_transaction.hpp>
 
-using Catch::Matchers::Message;
+namespace silkworm::rpc::core {
 
-}  // namespace silkworm
+using testing::_;
+using testing::InvokeWithoutArgs;
+using evmc::literals::operator""_bytes32;
+
+TEST_CASE("get_receipts", "[silkrpc][core][receipts]") {
+    silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    boost::asio::thread_pool pool{1};
+    boost::asio::thread_pool workers{1};
+    test::MockTransaction tx;
+    test::MockDatabaseReader db_reader;
+    test::MockChainStorage chain_storage;
+
+    silkworm::BlockWithHash block_with_hash;
+    block_with_hash.block.header.number = 4'000'000;
+    block_with_hash.hash = 0x0b6f2ba6d2cb46bf5a1a1bf1e0dd6a5d1a0d6e4a26d1c6a2f0f0c3d1f1f3a5b7_bytes32;
+
+    BlockCache block_cache;
+
+    SECTION("no transactions, no receipts") {
+        EXPECT_CALL(db_reader, get_one(db::table::kBlockReceiptsName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<silkworm::Bytes> {
+            co_return silkworm::Bytes{};
+        }));
+        EXPECT_CALL(tx, create_state(_, _, _, _)).Times(0);
+        EXPECT_CALL(chain_storage, read_canonical_hash(block_with_hash.block.header.number)).WillOnce(InvokeWithoutArgs([&]() -> Task<std::optional<Hash>> {
+            co_return Hash{block_with_hash.hash};
+        }));
+        auto result = boost::asio::co_spawn(pool, get_receipts(tx, db_reader, chain_storage, workers, block_cache, block_with_hash), boost::asio::use_future);
+        CHECK(result.get().empty());
+
+        // Receipts are served by block cache afterwards
+        auto cached_result = boost::asio::co_spawn(pool, get_receipts(tx, db_reader, chain_storage, workers, block_cache, block_with_hash), boost::asio::use_future);
+        CHECK(cached_result.get().empty());
+        CHECK(block_cache.receipts_stats().hits == 1);
+    }
+
+    SECTION("receipts of non-canonical block not cached") {
+        EXPECT_CALL(db_reader, get_one(db::table::kBlockReceiptsName, _)).Times(2).WillRepeatedly(InvokeWithoutArgs([]() -> Task<silkworm::Bytes> {
+            co_return silkworm::Bytes{};
+        }));
+        EXPECT_CALL(chain_storage, read_canonical_hash(block_with_hash.block.header.number)).Times(2).WillRepeatedly(InvokeWithoutArgs([]() -> Task<std::optional<Hash>> {
+            co_return Hash{0x8e3387a9c6c6b3a1a6a4b7dd4d6f7cde9a6bb3b3e7a1fb9a5b0d8f8f76ab7c6a_bytes32};
+        }));
+        auto result = boost::asio::co_spawn(pool, get_receipts(tx, db_reader, chain_storage, workers, block_cache, block_with_hash), boost::asio::use_future);
+        CHECK(result.get().empty());
+        CHECK(!block_cache.get_receipts(block_with_hash.hash));
+
+        // Receipts are read again afterwards
+        auto uncached_result = boost::asio::co_spawn(pool, get_receipts(tx, db_reader, chain_storage, workers, block_cache, block_with_hash), boost::asio::use_future);
+        CHECK(uncached_result.get().empty());
+    }
+
+    SECTION("canonical hash of hot block served by block cache") {
+        remote::StateChangeBatch state_changes;
+        auto* state_change = state_changes.add_change_batch();
+        state_change->set_direction(remote::Direction::FORWARD);
+        state_change->set_block_height(block_with_hash.block.header.number);
+        state_change->set_allocated_block_hash(rpc::H256_from_bytes32(block_with_hash.hash).release());
+        block_cache.on_new_block(state_changes);
+
+        EXPECT_CALL(db_reader, get_one(db::table::kBlockReceiptsName, _)).WillOnce(InvokeWithoutArgs([]() -> Task<silkworm::Bytes> {
+            co_return silkworm::Bytes{};
+        }));
+        EXPECT_CALL(chain_storage, read_canonical_hash(_)).Times(0);
+        auto result = boost::asio::co_spawn(pool, get_receipts(tx, db_reader, chain_storage, workers, block_cache, block_with_hash), boost::asio::use_future);
+        CHECK(result.get().empty());
+        CHECK(block_cache.get_receipts(block_with_hash.hash));
+    }
+
+    SECTION("pruned receipts served by block cache") {
+        block_with_hash.block.transactions.resize(1);
+        Receipt receipt;
+        receipt.success = true;
+        receipt.cumulative_gas_used = 21'000;
+        receipt.gas_used = 21'000;
+        receipt.block_hash = block_with_hash.hash;
+        block_cache.insert_receipts(block_with_hash.hash, std::make_shared<Receipts>(Receipts{receipt}));
+
+        EXPECT_CALL(db_reader, get_one(db::table::kBlockReceiptsName, _)).Times(0);
+        EXPECT_CALL(tx, create_state(_, _, _, _)).Times(0);
+        auto result = boost::asio::co_spawn(pool, get_receipts(tx, db_reader, chain_storage, workers, block_cache, block_with_hash), boost::asio::use_future);
+        const auto receipts{result.get()};
+        REQUIRE(receipts.size() == 1);
+        CHECK(receipts[0].success);
+        CHECK(receipts[0].cumulative_gas_used == 21'000);
+        CHECK(receipts[0].block_hash == block_with_hash.hash);
+    }
+}
+
+}  // namespace silkworm::rpc::core
@@ -20,6 +20,7 @@
 #include <silkworm/core/types/account.hpp>
 #include <silkworm/infra/common/decoding_exception.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/node/db/bitmap.hpp>
 #include <silkworm/node/db/tables.hpp>
 #include <silkworm/node/db/util.hpp>
@@ -29,6 +30,11 @@
 namespace silkworm::rpc {
 
 Task<std::optional<silkworm::Account>> StateReader::read_account(const evmc::address& address, BlockNum block_number) const {
+    if (auto local_txn{db_reader_.local_txn()}) {
+        // Zero-copy local mode: read inline from db pages, no cursor tasks nor intermediate copies
+        co_return db::read_account(*local_txn, address, block_number);
+    }
+
     std::optional<silkworm::Bytes> encoded{co_await read_historical_account(address, block_number)};
     if (!encoded) {
         encoded = co_await db_reader_.get_one(db::table::kPlainStateName, full_view(address));
@@ -58,6 +64,11 @@ Task<evmc::bytes32> StateReader::read_storage(
     uint64_t incarnation,
     const evmc::bytes32& location_hash,
     BlockNum block_number) const {
+    if (auto local_txn{db_reader_.local_txn()}) {
+        // Zero-copy local mode: read inline from db pages, no cursor tasks nor intermediate copies
+        co_return db::read_storage(*local_txn, address, incarnation, location_hash, block_number);
+    }
+
     std::optional<silkworm::Bytes> value{co_await read_historical_storage(address, incarnation, location_hash, block_number)};
     if (!value) {
         auto composite_key{silkworm::composite_storage_key_without_hash_lookup(address, incarnation)};
@@ -78,6 +89,11 @@ Task<std::optional<silkworm::Bytes>> StateReader::read_code(const evmc::bytes32&
     if (code_hash == silkworm::kEmptyHash) {
         co_return std::nullopt;
     }
+    if (auto local_txn{db_reader_.local_txn()}) {
+        // Zero-copy local mode: just one copy out of db pages
+        const auto code{db::read_code(*local_txn, code_hash)};
+        co_return code ? std::make_optional<silkworm::Bytes>(*code) : std::nullopt;
+    }
     co_return co_await db_reader_.get_one(db::table::kCodeName, full_view(code_hash));
 }
 
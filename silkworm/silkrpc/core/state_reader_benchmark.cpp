@@ -0,0 +1,123 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_future.hpp>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/types/account.hpp>
+#include <silkworm/infra/common/directories.hpp>
+#include <silkworm/node/db/mdbx.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/silkrpc/core/state_reader.hpp>
+#include <silkworm/silkrpc/ethdb/file/local_transaction.hpp>
+#include <silkworm/silkrpc/ethdb/transaction_database.hpp>
+
+namespace {
+
+using namespace silkworm;
+using namespace silkworm::rpc;
+
+constexpr size_t kNumAccounts{100'000};
+
+//! DatabaseReader forwarding any call to the wrapped one but hiding its local txn, i.e. the cursor-based local path
+class CursorDatabaseReader : public core::rawdb::DatabaseReader {
+  public:
+    explicit CursorDatabaseReader(const core::rawdb::DatabaseReader& reader) : reader_{reader} {}
+
+    [[nodiscard]] Task<KeyValue> get(const std::string& table, ByteView key) const override {
+        return reader_.get(table, key);
+    }
+    [[nodiscard]] Task<Bytes> get_one(const std::string& table, ByteView key) const override {
+        return reader_.get_one(table, key);
+    }
+    [[nodiscard]] Task<std::optional<Bytes>> get_both_range(const std::string& table, ByteView key, ByteView subkey) const override {
+        return reader_.get_both_range(table, key, subkey);
+    }
+    [[nodiscard]] Task<void> walk(const std::string& table, ByteView start_key, uint32_t fixed_bits, core::rawdb::Walker w) const override {
+        return reader_.walk(table, start_key, fixed_bits, std::move(w));
+    }
+    [[nodiscard]] Task<void> for_prefix(const std::string& table, ByteView prefix, core::rawdb::Walker w) const override {
+        return reader_.for_prefix(table, prefix, std::move(w));
+    }
+
+  private:
+    const core::rawdb::DatabaseReader& reader_;
+};
+
+evmc::address account_address(size_t i) {
+    evmc::address address;
+    endian::store_big_u64(address.bytes + kAddressLength - sizeof(uint64_t), i);
+    return address;
+}
+
+//! Local chaindata populated with kNumAccounts accounts in current state, as seen by eth_getBalance at latest block
+std::shared_ptr<mdbx::env_managed> make_chaindata(const TemporaryDirectory& tmp_dir) {
+    auto chaindata_env{std::make_shared<mdbx::env_managed>(
+        db::open_env(db::EnvConfig{.path = tmp_dir.path().string(), .create = true, .in_memory = true}))};
+    db::RWTxnManaged txn{*chaindata_env};
+    db::table::check_or_create_chaindata_tables(txn);
+    auto plain_state{txn.rw_cursor_dup_sort(db::table::kPlainState)};
+    for (size_t i{0}; i < kNumAccounts; ++i) {
+        Account account;
+        account.nonce = i;
+        account.balance = i * 1'000;
+        plain_state->upsert(db::to_slice(account_address(i)), db::to_slice(account.encode_for_storage()));
+    }
+    txn.commit_and_stop();
+    return chaindata_env;
+}
+
+void read_account(benchmark::State& state, bool zero_copy) {
+    TemporaryDirectory tmp_dir;
+    const auto chaindata_env{make_chaindata(tmp_dir)};
+    ethdb::file::LocalTransaction transaction{chaindata_env};
+    ethdb::TransactionDatabase tx_database{transaction};
+    CursorDatabaseReader cursor_database{tx_database};
+    StateReader state_reader{zero_copy ? static_cast<core::rawdb::DatabaseReader&>(tx_database) : cursor_database};
+
+    boost::asio::io_context io_context;
+    size_t i{0};
+    for ([[maybe_unused]] auto _ : state) {
+        auto result{boost::asio::co_spawn(io_context, state_reader.read_account(account_address(i++ % kNumAccounts), 1),
+                                          boost::asio::use_future)};
+        io_context.run();
+        io_context.restart();
+        benchmark::DoNotOptimize(result.get());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+}  // namespace
+
+static void state_reader_read_account_cursors(benchmark::State& state) {
+    read_account(state, /*zero_copy=*/false);
+}
+
+BENCHMARK(state_reader_read_account_cursors);
+
+static void state_reader_read_account_zero_copy(benchmark::State& state) {
+    read_account(state, /*zero_copy=*/true);
+}
+
+BENCHMARK(state_reader_read_account_zero_copy);
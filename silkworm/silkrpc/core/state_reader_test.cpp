@@ -21,14 +21,19 @@
 #include <catch2/catch.hpp>
 #include <evmc/evmc.hpp>
 
+#include <silkworm/infra/common/directories.hpp>
+#include <silkworm/node/db/mdbx.hpp>
 #include <silkworm/node/db/tables.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
 #include <silkworm/silkrpc/core/blocks.hpp>
+#include <silkworm/silkrpc/ethdb/file/local_transaction.hpp>
+#include <silkworm/silkrpc/ethdb/transaction_database.hpp>
 #include <silkworm/silkrpc/test/context_test_base.hpp>
 #include <silkworm/silkrpc/test/mock_database_reader.hpp>
 
 namespace silkworm::rpc {
 
+using evmc::literals::operator""_address;
 using evmc::literals::operator""_bytes32;
 using testing::_;
 using testing::InvokeWithoutArgs;
@@ -217,6 +222,59 @@ TEST_CASE_METHOD(StateReaderTest, "StateReader::read_code") {
         }
     }
 }
+
+struct LocalStateReaderTest : public test::ContextTestBase {
+    LocalStateReaderTest() {
+        chaindata_env_ = std::make_shared<mdbx::env_managed>(
+            db::open_env(db::EnvConfig{.path = tmp_dir_.path().string(), .create = true, .in_memory = true}));
+        db::RWTxnManaged txn{*chaindata_env_};
+        db::table::check_or_create_chaindata_tables(txn);
+        silkworm::Account account;
+        account.balance = 1'000;
+        account.code_hash = kCodeHash;
+        txn.rw_cursor_dup_sort(db::table::kPlainState)->upsert(db::to_slice(kZeroAddress), db::to_slice(account.encode_for_storage()));
+        txn.rw_cursor(db::table::kCode)->upsert(db::to_slice(kCodeHash), db::to_slice(kBinaryCode));
+        txn.commit_and_stop();
+    }
+
+    TemporaryDirectory tmp_dir_;
+    std::shared_ptr<mdbx::env_managed> chaindata_env_;
+};
+
+TEST_CASE_METHOD(LocalStateReaderTest, "StateReader in zero-copy local mode") {
+    ethdb::file::LocalTransaction transaction{chaindata_env_};
+    ethdb::TransactionDatabase tx_database{transaction};
+    REQUIRE(tx_database.local_txn() != nullptr);
+    StateReader state_reader{tx_database};
+
+    SECTION("account found in current state") {
+        std::optional<silkworm::Account> account;
+        CHECK_NOTHROW(account = spawn_and_wait(state_reader.read_account(kZeroAddress, core::kEarliestBlockNumber)));
+        REQUIRE(account);
+        CHECK(account->balance == 1'000);
+        CHECK(account->code_hash == kCodeHash);
+    }
+
+    SECTION("no account for unknown address") {
+        std::optional<silkworm::Account> account;
+        CHECK_NOTHROW(account = spawn_and_wait(state_reader.read_account(0x0000000000000000000000000000000000000001_address,
+                                                                         core::kEarliestBlockNumber)));
+        CHECK(!account);
+    }
+
+    SECTION("empty storage value") {
+        evmc::bytes32 value;
+        CHECK_NOTHROW(value = spawn_and_wait(state_reader.read_storage(kZeroAddress, 0, kLocationHash, core::kEarliestBlockNumber)));
+        CHECK(value == evmc::bytes32{});
+    }
+
+    SECTION("non-empty code found for code hash") {
+        std::optional<silkworm::Bytes> code;
+        CHECK_NOTHROW(code = spawn_and_wait(state_reader.read_code(kCodeHash)));
+        REQUIRE(code);
+        CHECK(silkworm::to_hex(*code) == silkworm::to_hex(kBinaryCode));
+    }
+}
 #endif  // SILKWORM_SANITIZE
 
 }  // namespace silkworm::rpc
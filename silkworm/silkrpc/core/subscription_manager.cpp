@@ -0,0 +1,230 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "subscription_manager.hpp"
+
+#include <algorithm>
+#include <exception>
+
+#include <nlohmann/json.hpp>
+
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/grpc/common/conversion.hpp>
+#include <silkworm/silkrpc/core/cached_chain.hpp>
+#include <silkworm/silkrpc/core/rawdb/chain.hpp>
+#include <silkworm/silkrpc/ethdb/transaction_database.hpp>
+#include <silkworm/silkrpc/json/log.hpp>
+#include <silkworm/silkrpc/json/types.hpp>
+
+namespace silkworm::rpc {
+
+std::optional<SubscriptionKind> parse_subscription_kind(std::string_view name) {
+    if (name == "newHeads") {
+        return SubscriptionKind::kNewHeads;
+    }
+    if (name == "logs") {
+        return SubscriptionKind::kLogs;
+    }
+    if (name == "newPendingTransactions") {
+        return SubscriptionKind::kNewPendingTransactions;
+    }
+    return std::nullopt;
+}
+
+bool log_matches(const Log& log, const FilterAddresses& addresses, const FilterTopics& topics) {
+    if (!addresses.empty() && std::find(addresses.cbegin(), addresses.cend(), log.address) == addresses.cend()) {
+        return false;
+    }
+    if (topics.size() > log.topics.size()) {
+        return false;
+    }
+    for (size_t i{0}; i < topics.size(); ++i) {
+        const auto& subtopics{topics[i]};
+        // Empty subtopics act as wildcard
+        if (!subtopics.empty() && std::find(subtopics.cbegin(), subtopics.cend(), log.topics[i]) == subtopics.cend()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+SubscriptionId SubscriptionManager::subscribe(const std::shared_ptr<Subscriber>& subscriber, SubscriptionKind kind, Filter filter) {
+    std::scoped_lock lock{mutex_};
+    SubscriptionId subscription_id;
+    do {
+        subscription_id = to_quantity(random_engine_());
+    } while (subscriptions_.contains(subscription_id));
+    subscriptions_.emplace(subscription_id, Subscription{kind, subscriber, subscriber.get(), std::move(filter)});
+    SILK_DEBUG << "SubscriptionManager::subscribe id=" << subscription_id << " #subscriptions=" << subscriptions_.size();
+    return subscription_id;
+}
+
+bool SubscriptionManager::unsubscribe(const SubscriptionId& subscription_id) {
+    std::scoped_lock lock{mutex_};
+    return subscriptions_.erase(subscription_id) > 0;
+}
+
+void SubscriptionManager::unsubscribe_all(const Subscriber* subscriber) {
+    std::scoped_lock lock{mutex_};
+    std::erase_if(subscriptions_, [&](const auto& entry) {
+        return entry.second.owner == subscriber || entry.second.subscriber.expired();
+    });
+}
+
+bool SubscriptionManager::has_subscriptions(SubscriptionKind kind) const {
+    std::scoped_lock lock{mutex_};
+    return std::any_of(subscriptions_.cbegin(), subscriptions_.cend(), [&](const auto& entry) {
+        return entry.second.kind == kind;
+    });
+}
+
+size_t SubscriptionManager::size() const {
+    std::scoped_lock lock{mutex_};
+    return subscriptions_.size();
+}
+
+void SubscriptionManager::on_new_block(const remote::StateChangeBatch& state_changes) {
+    std::scoped_lock lock{mutex_};
+    const bool any_block_subscription{std::any_of(subscriptions_.cbegin(), subscriptions_.cend(), [](const auto& entry) {
+        return entry.second.kind == SubscriptionKind::kNewHeads || entry.second.kind == SubscriptionKind::kLogs;
+    })};
+    if (!any_block_subscription) {
+        return;
+    }
+    for (const auto& state_change : state_changes.change_batch()) {
+        if (state_change.direction() == remote::Direction::FORWARD) {
+            pending_blocks_.push_back(bytes32_from_H256(state_change.block_hash()));
+        }
+    }
+}
+
+Task<void> SubscriptionManager::update(ethdb::Database& database, ethbackend::BackEnd* backend, BlockCache& block_cache) {
+    {
+        std::scoped_lock lock{mutex_};
+        if (updating_) {
+            co_return;
+        }
+        updating_ = true;
+    }
+
+    // Single consumer of the pending new heads: notifications are sent in block order even if updates overlap
+    while (true) {
+        std::vector<evmc::bytes32> pending_blocks;
+        {
+            std::scoped_lock lock{mutex_};
+            if (pending_blocks_.empty()) {
+                updating_ = false;
+                co_return;
+            }
+            pending_blocks.swap(pending_blocks_);
+        }
+
+        auto tx = co_await database.begin();
+        try {
+            ethdb::TransactionDatabase tx_database{*tx};
+            const auto chain_storage{tx->create_storage(tx_database, backend)};
+
+            for (const auto& block_hash : pending_blocks) {
+                const auto block_with_hash = co_await core::read_block_by_hash(block_cache, *chain_storage, block_hash);
+                if (!block_with_hash) {
+                    SILK_DEBUG << "SubscriptionManager::update block not found: " << to_hex(block_hash);
+                    continue;
+                }
+                notify_new_head(block_with_hash->block.header);
+
+                if (has_subscriptions(SubscriptionKind::kLogs)) {
+                    const auto receipts = co_await core::rawdb::read_receipts(tx_database, *block_with_hash);
+                    Logs logs;
+                    for (const auto& receipt : receipts) {
+                        logs.insert(logs.end(), receipt.logs.cbegin(), receipt.logs.cend());
+                    }
+                    notify_logs(logs);
+                }
+            }
+        } catch (const std::exception& e) {
+            SILK_WARN << "SubscriptionManager::update exception: " << e.what();
+        }
+        co_await tx->close();  // RAII not (yet) available with coroutines
+    }
+}
+
+void SubscriptionManager::on_new_transactions(const std::vector<evmc::bytes32>& transaction_hashes) {
+    const auto targets{targets_of(SubscriptionKind::kNewPendingTransactions)};
+    if (targets.empty()) {
+        return;
+    }
+    for (const auto& transaction_hash : transaction_hashes) {
+        notify(targets, std::make_shared<const std::string>(nlohmann::json(transaction_hash).dump()));
+    }
+}
+
+void SubscriptionManager::notify_new_head(const BlockHeader& header) {
+    const auto targets{targets_of(SubscriptionKind::kNewHeads)};
+    if (targets.empty()) {
+        return;
+    }
+    notify(targets, std::make_shared<const std::string>(nlohmann::json(header).dump()));
+}
+
+void SubscriptionManager::notify_logs(const Logs& logs) {
+    // Match each log against the subscription filters, then serialize just once the logs matched by anyone
+    std::vector<std::vector<std::pair<SubscriptionId, std::weak_ptr<Subscriber>>>> targets_by_log(logs.size());
+    {
+        std::scoped_lock lock{mutex_};
+        for (const auto& [subscription_id, subscription] : subscriptions_) {
+            if (subscription.kind != SubscriptionKind::kLogs) continue;
+            for (size_t i{0}; i < logs.size(); ++i) {
+                if (log_matches(logs[i], subscription.filter.addresses, subscription.filter.topics)) {
+                    targets_by_log[i].emplace_back(subscription_id, subscription.subscriber);
+                }
+            }
+        }
+    }
+    for (size_t i{0}; i < logs.size(); ++i) {
+        if (!targets_by_log[i].empty()) {
+            notify(targets_by_log[i], std::make_shared<const std::string>(nlohmann::json(logs[i]).dump()));
+        }
+    }
+}
+
+std::vector<std::pair<SubscriptionId, std::weak_ptr<Subscriber>>> SubscriptionManager::targets_of(SubscriptionKind kind) const {
+    std::vector<std::pair<SubscriptionId, std::weak_ptr<Subscriber>>> targets;
+    std::scoped_lock lock{mutex_};
+    for (const auto& [subscription_id, subscription] : subscriptions_) {
+        if (subscription.kind == kind) {
+            targets.emplace_back(subscription_id, subscription.subscriber);
+        }
+    }
+    return targets;
+}
+
+void SubscriptionManager::notify(const std::vector<std::pair<SubscriptionId, std::weak_ptr<Subscriber>>>& targets,
+                                 const NotificationPayload& payload) {
+    // Subscribers are notified outside the lock, so that they can subscribe/unsubscribe meanwhile
+    for (const auto& [subscription_id, weak_subscriber] : targets) {
+        const auto subscriber{weak_subscriber.lock()};
+        if (!subscriber) {
+            unsubscribe(subscription_id);
+            continue;
+        }
+        if (!subscriber->notify(subscription_id, payload)) {
+            SILK_WARN << "SubscriptionManager: subscriber too slow, dropping its subscriptions";
+            unsubscribe_all(subscriber.get());
+        }
+    }
+}
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,132 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <evmc/evmc.hpp>
+
+#include <silkworm/silkrpc/core/block_cache.hpp>
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/interfaces/remote/kv.pb.h>
+#include <silkworm/silkrpc/ethbackend/backend.hpp>
+#include <silkworm/silkrpc/ethdb/database.hpp>
+#include <silkworm/silkrpc/types/filter.hpp>
+#include <silkworm/silkrpc/types/log.hpp>
+
+namespace silkworm::rpc {
+
+//! The kinds of subscription supported by eth_subscribe
+enum class SubscriptionKind {
+    kNewHeads,
+    kLogs,
+    kNewPendingTransactions,
+};
+
+//! Parse the eth_subscribe subscription name (e.g. "newHeads"), if supported
+std::optional<SubscriptionKind> parse_subscription_kind(std::string_view name);
+
+using SubscriptionId = std::string;
+
+//! The JSON result of one notification, serialized once and shared among all the subscribers of the same event
+using NotificationPayload = std::shared_ptr<const std::string>;
+
+//! The receiver of subscription notifications, e.g. one WebSocket connection
+class Subscriber {
+  public:
+    virtual ~Subscriber() = default;
+
+    //! \brief Enqueue the notification for the given subscription without blocking
+    //! \return false if the subscriber cannot keep up with the notifications, in which case it will be unsubscribed
+    virtual bool notify(const SubscriptionId& subscription_id, NotificationPayload payload) = 0;
+};
+
+//! Check if the log matches the given addresses and topics (empty means any) according to eth_getLogs semantics
+bool log_matches(const Log& log, const FilterAddresses& addresses, const FilterTopics& topics);
+
+//! \brief SubscriptionManager keeps the active eth_subscribe subscriptions and fans out the notifications
+//! \details New heads and logs are read once per new block notified by the state changes stream, new pending
+//! transactions come from the txpool stream. Each event is serialized once and the same payload is pushed to all the
+//! matching subscribers, which are dropped when they cannot keep up.
+class SubscriptionManager {
+  public:
+    SubscriptionManager() = default;
+
+    SubscriptionManager(const SubscriptionManager&) = delete;
+    SubscriptionManager& operator=(const SubscriptionManager&) = delete;
+
+    //! Add a new subscription of the given kind for the subscriber, the filter being meaningful only for logs
+    SubscriptionId subscribe(const std::shared_ptr<Subscriber>& subscriber, SubscriptionKind kind, Filter filter = {});
+
+    //! Remove the specified subscription, return false if not found
+    bool unsubscribe(const SubscriptionId& subscription_id);
+
+    //! Remove all the subscriptions of the specified subscriber
+    void unsubscribe_all(const Subscriber* subscriber);
+
+    [[nodiscard]] bool has_subscriptions(SubscriptionKind kind) const;
+    [[nodiscard]] size_t size() const;
+
+    //! Record the new heads to be notified by the next update, if anyone subscribed to new heads or logs
+    void on_new_block(const remote::StateChangeBatch& state_changes);
+
+    //! Read and notify the pending new heads and their logs
+    //! \details Only one update at a time consumes the pending new heads, any overlapping call returns immediately
+    Task<void> update(ethdb::Database& database, ethbackend::BackEnd* backend, BlockCache& block_cache);
+
+    //! Notify the hashes of the transactions added to the txpool
+    void on_new_transactions(const std::vector<evmc::bytes32>& transaction_hashes);
+
+    //! Notify the new head to the newHeads subscribers
+    void notify_new_head(const BlockHeader& header);
+
+    //! Notify the logs of one new block to the matching logs subscribers
+    void notify_logs(const Logs& logs);
+
+  private:
+    struct Subscription {
+        SubscriptionKind kind;
+        std::weak_ptr<Subscriber> subscriber;
+        const Subscriber* owner;  // identity of the subscriber, valid only while subscriber is not expired
+        Filter filter;
+    };
+
+    //! Push the payload to each given subscription, dropping the subscribers which cannot keep up
+    void notify(const std::vector<std::pair<SubscriptionId, std::weak_ptr<Subscriber>>>& targets,
+                const NotificationPayload& payload);
+
+    //! Collect the subscriptions of the given kind
+    std::vector<std::pair<SubscriptionId, std::weak_ptr<Subscriber>>> targets_of(SubscriptionKind kind) const;
+
+    mutable std::mutex mutex_;
+    std::map<SubscriptionId, Subscription> subscriptions_;
+    std::vector<evmc::bytes32> pending_blocks_;
+    bool updating_{false};  // an update is in progress, i.e. reading and notifying the new heads taken from pending ones
+    std::mt19937_64 random_engine_{std::random_device{}()};
+};
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,147 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "subscription_manager.hpp"
+
+#include <catch2/catch.hpp>
+#include <evmc/evmc.hpp>
+
+namespace silkworm::rpc {
+
+using evmc::literals::operator""_address;
+using evmc::literals::operator""_bytes32;
+
+//! Subscriber recording the notifications received, accepting at most max_pending of them
+struct FakeSubscriber : public Subscriber {
+    explicit FakeSubscriber(size_t max_pending = 100) : max_pending{max_pending} {}
+
+    bool notify(const SubscriptionId& subscription_id, NotificationPayload payload) override {
+        if (notifications.size() == max_pending) {
+            return false;
+        }
+        notifications.emplace_back(subscription_id, std::move(payload));
+        return true;
+    }
+
+    size_t max_pending;
+    std::vector<std::pair<SubscriptionId, NotificationPayload>> notifications;
+};
+
+static const auto kAddress1{0x00000000000000000000000000000000000000aa_address};
+static const auto kAddress2{0x00000000000000000000000000000000000000bb_address};
+static const auto kTopic1{0x000000000000000000000000000000000000000000000000000000000000000a_bytes32};
+static const auto kTopic2{0x000000000000000000000000000000000000000000000000000000000000000b_bytes32};
+
+TEST_CASE("parse_subscription_kind", "[silkrpc][core][subscription_manager]") {
+    CHECK(parse_subscription_kind("newHeads") == SubscriptionKind::kNewHeads);
+    CHECK(parse_subscription_kind("logs") == SubscriptionKind::kLogs);
+    CHECK(parse_subscription_kind("newPendingTransactions") == SubscriptionKind::kNewPendingTransactions);
+    CHECK(!parse_subscription_kind("syncing"));
+}
+
+TEST_CASE("log_matches", "[silkrpc][core][subscription_manager]") {
+    Log log{.address = kAddress1, .topics = {kTopic1, kTopic2}};
+
+    CHECK(log_matches(log, {}, {}));
+    CHECK(log_matches(log, {kAddress1}, {}));
+    CHECK(!log_matches(log, {kAddress2}, {}));
+    CHECK(log_matches(log, {kAddress2, kAddress1}, {{kTopic1}}));
+    CHECK(log_matches(log, {}, {{}, {kTopic2}}));
+    CHECK(!log_matches(log, {}, {{kTopic2}}));
+    CHECK(!log_matches(log, {}, {{}, {}, {kTopic1}}));
+}
+
+TEST_CASE("SubscriptionManager", "[silkrpc][core][subscription_manager]") {
+    SubscriptionManager manager;
+
+    SECTION("subscribe and unsubscribe") {
+        auto subscriber = std::make_shared<FakeSubscriber>();
+        const auto id1 = manager.subscribe(subscriber, SubscriptionKind::kNewHeads);
+        const auto id2 = manager.subscribe(subscriber, SubscriptionKind::kNewPendingTransactions);
+        CHECK(id1 != id2);
+        CHECK(manager.size() == 2);
+        CHECK(manager.has_subscriptions(SubscriptionKind::kNewHeads));
+        CHECK(!manager.has_subscriptions(SubscriptionKind::kLogs));
+        CHECK(manager.unsubscribe(id1));
+        CHECK(!manager.unsubscribe(id1));
+        CHECK(!manager.has_subscriptions(SubscriptionKind::kNewHeads));
+        manager.unsubscribe_all(subscriber.get());
+        CHECK(manager.size() == 0);
+    }
+
+    SECTION("same payload shared among subscribers") {
+        auto subscriber1 = std::make_shared<FakeSubscriber>();
+        auto subscriber2 = std::make_shared<FakeSubscriber>();
+        manager.subscribe(subscriber1, SubscriptionKind::kNewHeads);
+        manager.subscribe(subscriber2, SubscriptionKind::kNewHeads);
+        manager.subscribe(subscriber2, SubscriptionKind::kNewPendingTransactions);
+
+        BlockHeader header;
+        header.number = 17'000'000;
+        manager.notify_new_head(header);
+        REQUIRE(subscriber1->notifications.size() == 1);
+        REQUIRE(subscriber2->notifications.size() == 1);
+        CHECK(subscriber1->notifications[0].second == subscriber2->notifications[0].second);
+        CHECK(subscriber1->notifications[0].second->find(R"("number":"0x1036640")") != std::string::npos);
+    }
+
+    SECTION("logs notified by filter") {
+        auto subscriber1 = std::make_shared<FakeSubscriber>();
+        auto subscriber2 = std::make_shared<FakeSubscriber>();
+        const auto id1 = manager.subscribe(subscriber1, SubscriptionKind::kLogs, Filter{.addresses = {kAddress1}});
+        manager.subscribe(subscriber2, SubscriptionKind::kLogs, Filter{.topics = {{kTopic2}}});
+
+        const Logs logs{
+            Log{.address = kAddress1, .topics = {kTopic1}},
+            Log{.address = kAddress2, .topics = {kTopic2}},
+        };
+        manager.notify_logs(logs);
+        REQUIRE(subscriber1->notifications.size() == 1);
+        CHECK(subscriber1->notifications[0].first == id1);
+        REQUIRE(subscriber2->notifications.size() == 1);
+        CHECK(subscriber1->notifications[0].second != subscriber2->notifications[0].second);
+    }
+
+    SECTION("pending transactions") {
+        auto subscriber = std::make_shared<FakeSubscriber>();
+        manager.subscribe(subscriber, SubscriptionKind::kNewPendingTransactions);
+        manager.on_new_transactions({kTopic1, kTopic2});
+        REQUIRE(subscriber->notifications.size() == 2);
+        CHECK(*subscriber->notifications[0].second == R"("0x000000000000000000000000000000000000000000000000000000000000000a")");
+    }
+
+    SECTION("slow subscriber dropped") {
+        auto slow_subscriber = std::make_shared<FakeSubscriber>(/*max_pending=*/1);
+        auto fast_subscriber = std::make_shared<FakeSubscriber>();
+        manager.subscribe(slow_subscriber, SubscriptionKind::kNewPendingTransactions);
+        manager.subscribe(slow_subscriber, SubscriptionKind::kNewHeads);
+        manager.subscribe(fast_subscriber, SubscriptionKind::kNewPendingTransactions);
+        manager.on_new_transactions({kTopic1, kTopic2});
+        CHECK(slow_subscriber->notifications.size() == 1);
+        CHECK(fast_subscriber->notifications.size() == 2);
+        CHECK(manager.size() == 1);
+    }
+
+    SECTION("expired subscriber removed") {
+        auto subscriber = std::make_shared<FakeSubscriber>();
+        manager.subscribe(subscriber, SubscriptionKind::kNewPendingTransactions);
+        subscriber.reset();
+        manager.on_new_transactions({kTopic1});
+        CHECK(manager.size() == 0);
+    }
+}
+
+}  // namespace silkworm::rpc
@@ -33,6 +33,8 @@
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/silkrpc/common/compatibility.hpp>
+#include <silkworm/silkrpc/core/fee_summary_cache.hpp>
+#include <silkworm/silkrpc/core/subscription_manager.hpp>
 #include <silkworm/silkrpc/ethbackend/remote_backend.hpp>
 #include <silkworm/silkrpc/ethdb/file/local_database.hpp>
 #include <silkworm/silkrpc/ethdb/kv/remote_database.hpp>
@@ -179,6 +181,7 @@ Daemon::Daemon(DaemonSettings settings,
       create_channel_{make_channel_factory(settings_)},
       context_pool_{settings_.context_pool_settings.num_contexts},
       worker_pool_{settings_.num_workers},
+      execution_lanes_{settings_.execution_lanes},
       kv_stub_{::remote::KV::NewStub(create_channel_())} {
     // Check pre-conditions
     ensure(!settings_.datadir || !chaindata_env, "Daemon::Daemon datadir and chaindata_env are alternative");
@@ -233,6 +236,12 @@ Daemon::Daemon(DaemonSettings settings,
     auto& context = context_pool_.next_context();
     state_changes_stream_ = std::make_unique<ethdb::kv::StateChangesStream>(context, kv_stub_.get());
 
+    // Create the unique txpool stream feeding the pending transaction subscriptions (if required)
+    if (settings_.ws_enabled) {
+        auto& txpool_context = context_pool_.next_context();
+        transactions_stream_ = std::make_unique<txpool::TransactionsStream>(txpool_context, create_channel_());
+    }
+
     // Set compatibility with Erigon RpcDaemon at JSON RPC level
     compatibility::set_erigon_json_api_compatibility_required(settings_.erigon_json_rpc_compatibility);
 }
@@ -265,11 +274,15 @@ void Daemon::add_private_services() {
 
 void Daemon::add_shared_services() {
     // Create the unique block cache to be shared among the execution contexts
-    auto block_cache = std::make_shared<BlockCache>();
+    auto block_cache = std::make_shared<BlockCache>(settings_.block_cache_size);
     // Create the unique state cache to be shared among the execution contexts
     auto state_cache = std::make_shared<ethdb::kv::CoherentStateCache>();
     // Create the unique filter storage to be shared among the execution contexts
     auto filter_storage = std::make_shared<FilterStorage>(context_pool_.num_contexts() * kDefaultFilterStorageSize);
+    // Create the unique block fee summary cache to be shared among the execution contexts
+    auto fee_summary_cache = std::make_shared<FeeSummaryCache>();
+    // Create the unique eth_subscribe subscription manager to be shared among the execution contexts
+    auto subscription_manager = std::make_shared<SubscriptionManager>();
 
     // Add the shared state to the execution contexts
     for (std::size_t i{0}; i < settings_.context_pool_settings.num_contexts; ++i) {
@@ -278,6 +291,8 @@ void Daemon::add_shared_services() {
         add_shared_service(io_context, block_cache);
         add_shared_service<ethdb::kv::StateCache>(io_context, state_cache);
         add_shared_service(io_context, filter_storage);
+        add_shared_service(io_context, fee_summary_cache);
+        add_shared_service(io_context, subscription_manager);
     }
 }
 
@@ -310,12 +325,13 @@ void Daemon::start() {
         if (not settings_.eth_end_point.empty()) {
             rpc_services_.emplace_back(
                 std::make_unique<http::Server>(
-                    settings_.eth_end_point, settings_.eth_api_spec, ioc, worker_pool_, settings_.cors_domain, /*jwt_secret=*/std::nullopt));
+                    settings_.eth_end_point, settings_.eth_api_spec, ioc, worker_pool_, execution_lanes_, settings_.cors_domain, /*jwt_secret=*/std::nullopt,
+                    settings_.ws_enabled));
         }
         if (not settings_.engine_end_point.empty()) {
             rpc_services_.emplace_back(
                 std::make_unique<http::Server>(
-                    settings_.engine_end_point, kDefaultEth2ApiSpec, ioc, worker_pool_, settings_.cors_domain, jwt_secret_));
+                    settings_.engine_end_point, kDefaultEth2ApiSpec, ioc, worker_pool_, execution_lanes_, settings_.cors_domain, jwt_secret_));
         }
     }
 
@@ -323,21 +339,37 @@ void Daemon::start() {
         service->start();
     }
 
+    if (not settings_.metrics_end_point.empty()) {
+        metrics_exporter_ = std::make_unique<metrics::Exporter>(settings_.metrics_end_point, context_pool_.next_io_context());
+        metrics_exporter_->start();
+    }
+
     // Open the KV state-changes stream feeding the state cache
     state_changes_stream_->open();
 
+    // Open the txpool stream feeding the pending transaction subscriptions
+    if (transactions_stream_) {
+        transactions_stream_->open();
+    }
+
     context_pool_.start();
 }
 
 void Daemon::stop() {
     // Cancel registration for incoming KV state changes
     state_changes_stream_->close();
+    if (transactions_stream_) {
+        transactions_stream_->close();
+    }
 
     context_pool_.stop();
 
     for (auto& service : rpc_services_) {
         service->stop();
     }
+    if (metrics_exporter_) {
+        metrics_exporter_->stop();
+    }
 }
 
 void Daemon::join() {
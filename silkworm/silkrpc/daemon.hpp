@@ -25,11 +25,14 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/grpc/client/client_context_pool.hpp>
 #include <silkworm/infra/grpc/common/version.hpp>
+#include <silkworm/infra/metrics/exporter.hpp>
 #include <silkworm/node/db/mdbx.hpp>
 #include <silkworm/node/snapshot/repository.hpp>
 #include <silkworm/silkrpc/common/constants.hpp>
+#include <silkworm/silkrpc/common/execution_lanes.hpp>
 #include <silkworm/silkrpc/ethdb/kv/state_changes_stream.hpp>
 #include <silkworm/silkrpc/http/server.hpp>
+#include <silkworm/silkrpc/txpool/transactions_stream.hpp>
 
 #include "settings.hpp"
 
@@ -87,6 +90,9 @@ class Daemon {
     //! The pool of workers for long-running tasks.
     boost::asio::thread_pool worker_pool_;
 
+    //! The execution lanes isolating the configured API namespaces, each one with its own workers and admission control.
+    ExecutionLanes execution_lanes_;
+
     //! The chaindata MDBX environment or \code nullptr if working remotely
     std::shared_ptr<mdbx::env_managed> chaindata_env_;
 
@@ -96,12 +102,18 @@ class Daemon {
     //! The JSON RPC API services.
     std::vector<std::unique_ptr<http::Server>> rpc_services_;
 
+    //! The Prometheus metrics endpoint or \code nullptr if disabled
+    std::unique_ptr<metrics::Exporter> metrics_exporter_;
+
     //! The gRPC KV interface client stub.
     std::unique_ptr<::remote::KV::StubInterface> kv_stub_;
 
     //! The stream handling StateChanges server-streaming RPC.
     std::unique_ptr<ethdb::kv::StateChangesStream> state_changes_stream_;
 
+    //! The stream handling txpool OnAdd server-streaming RPC or \code nullptr if WebSocket is disabled.
+    std::unique_ptr<txpool::TransactionsStream> transactions_stream_;
+
     //! The secret key for communication from CL & EL
     std::optional<std::string> jwt_secret_;
 };
@@ -17,6 +17,7 @@
 #include "local_cursor.hpp"
 
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/node/db/util.hpp>
 #include <silkworm/silkrpc/common/clock_time.hpp>
 
 namespace silkworm::rpc::ethdb::file {
@@ -43,7 +44,7 @@ Task<KeyValue> LocalCursor::seek(ByteView key) {
 
     if (result) {
         SILK_DEBUG << "LocalCursor::seek found: key: " << key << " value: " << byte_view_of_string(result.value.as_string());
-        co_return KeyValue{bytes_of_string(result.key.as_string()), bytes_of_string(result.value.as_string())};
+        co_return KeyValue{Bytes{db::from_slice(result.key)}, Bytes{db::from_slice(result.value)}};
     } else {
         SILK_DEBUG << "LocalCursor::seek not found key: " << key;
         co_return KeyValue{};
@@ -60,7 +61,7 @@ Task<KeyValue> LocalCursor::seek_exact(ByteView key) {
         if (result) {
             SILK_DEBUG << "LocalCursor::seek_exact found: "
                        << " key: " << key << " value: " << byte_view_of_string(result.value.as_string());
-            co_return KeyValue{bytes_of_string(result.key.as_string()), bytes_of_string(result.value.as_string())};
+            co_return KeyValue{Bytes{db::from_slice(result.key)}, Bytes{db::from_slice(result.value)}};
         }
         SILK_ERROR << "LocalCursor::seek_exact !result key: " << key;
     }
@@ -76,7 +77,7 @@ Task<KeyValue> LocalCursor::next() {
     if (result) {
         SILK_DEBUG << "LocalCursor::next: "
                    << " key: " << byte_view_of_string(result.key.as_string()) << " value: " << byte_view_of_string(result.value.as_string());
-        co_return KeyValue{bytes_of_string(result.key.as_string()), bytes_of_string(result.value.as_string())};
+        co_return KeyValue{Bytes{db::from_slice(result.key)}, Bytes{db::from_slice(result.value)}};
     } else {
         SILK_ERROR << "LocalCursor::next !result";
     }
@@ -92,7 +93,7 @@ Task<KeyValue> LocalCursor::previous() {
     if (result) {
         SILK_DEBUG << "LocalCursor::previous: "
                    << " key: " << byte_view_of_string(result.key.as_string()) << " value: " << byte_view_of_string(result.value.as_string());
-        co_return KeyValue{bytes_of_string(result.key.as_string()), bytes_of_string(result.value.as_string())};
+        co_return KeyValue{Bytes{db::from_slice(result.key)}, Bytes{db::from_slice(result.value)}};
     } else {
         SILK_ERROR << "LocalCursor::previous !result";
     }
@@ -108,7 +109,7 @@ Task<KeyValue> LocalCursor::next_dup() {
     if (result) {
         SILK_DEBUG << "LocalCursor::next_dup: "
                    << " key: " << byte_view_of_string(result.key.as_string()) << " value: " << byte_view_of_string(result.value.as_string());
-        co_return KeyValue{bytes_of_string(result.key.as_string()), bytes_of_string(result.value.as_string())};
+        co_return KeyValue{Bytes{db::from_slice(result.key)}, Bytes{db::from_slice(result.value)}};
     } else {
         SILK_ERROR << "LocalCursor::next_dup !result";
     }
@@ -123,7 +124,7 @@ Task<Bytes> LocalCursor::seek_both(silkworm::ByteView key, silkworm::ByteView va
 
     if (result) {
         SILK_DEBUG << "LocalCursor::seek_both key: " << byte_view_of_string(result.key.as_string()) << " value: " << byte_view_of_string(result.value.as_string());
-        co_return bytes_of_string(result.value.as_string());
+        co_return Bytes{db::from_slice(result.value)};
     }
     co_return bytes_of_string("");
 }
@@ -137,7 +138,7 @@ Task<KeyValue> LocalCursor::seek_both_exact(silkworm::ByteView key, silkworm::By
     if (result) {
         SILK_DEBUG << "LocalCursor::seek_both_exact: "
                    << " key: " << byte_view_of_string(result.key.as_string()) << " value: " << byte_view_of_string(result.value.as_string());
-        co_return KeyValue{bytes_of_string(result.key.as_string()), bytes_of_string(result.value.as_string())};
+        co_return KeyValue{Bytes{db::from_slice(result.key)}, Bytes{db::from_slice(result.value)}};
     } else {
         SILK_ERROR << "LocalCursor::seek_both_exact !found key: " << key << " subkey:" << value;
     }
@@ -51,6 +51,8 @@ class LocalTransaction : public Transaction {
 
     std::shared_ptr<ChainStorage> create_storage(const DatabaseReader& db_reader, ethbackend::BackEnd* backend) override;
 
+    db::ROTxn* local_txn() override { return &txn_; }
+
     Task<void> close() override;
 
   private:
@@ -55,6 +55,9 @@ class CachedDatabase : public core::rawdb::DatabaseReader {
         silkworm::ByteView prefix,
         core::rawdb::Walker w) const override;
 
+    //! Local db pages are read inline as fast as cache entries, so any local txn is exposed to bypass the cache
+    [[nodiscard]] db::ROTxn* local_txn() const override { return txn_.local_txn(); }
+
   private:
     BlockNumberOrHash block_id_;
     Transaction& txn_;
@@ -42,7 +42,23 @@ Task<std::optional<silkworm::Bytes>> CoherentStateView::get_code(const silkworm:
     co_return co_await cache_->get_code(key, txn_);
 }
 
-CoherentStateCache::CoherentStateCache(CoherentCacheConfig config) : config_(config) {
+CoherentStateCache::Metrics CoherentStateCache::make_metrics() {
+    auto& registry = metrics::Registry::instance();
+    const metrics::Labels state_labels{{"cache", "state"}};
+    const metrics::Labels code_labels{{"cache", "code"}};
+    return {
+        .state_hits = registry.counter("silkworm_rpc_state_cache_hits_total", "Number of state cache hits", state_labels),
+        .state_misses = registry.counter("silkworm_rpc_state_cache_misses_total", "Number of state cache misses", state_labels),
+        .state_evictions = registry.counter("silkworm_rpc_state_cache_evictions_total", "Number of state cache evictions", state_labels),
+        .state_keys = registry.gauge("silkworm_rpc_state_cache_keys", "Number of keys in latest state cache view", state_labels),
+        .code_hits = registry.counter("silkworm_rpc_state_cache_hits_total", "Number of state cache hits", code_labels),
+        .code_misses = registry.counter("silkworm_rpc_state_cache_misses_total", "Number of state cache misses", code_labels),
+        .code_evictions = registry.counter("silkworm_rpc_state_cache_evictions_total", "Number of state cache evictions", code_labels),
+        .code_keys = registry.gauge("silkworm_rpc_state_cache_keys", "Number of keys in latest state cache view", code_labels),
+    };
+}
+
+CoherentStateCache::CoherentStateCache(CoherentCacheConfig config) : config_(config), metrics_(make_metrics()) {
     if (config.max_views == 0) {
         throw std::invalid_argument{"unexpected zero max_views"};
     }
@@ -116,6 +132,8 @@ void CoherentStateCache::on_new_block(const remote::StateChangeBatch& state_chan
 
     state_key_count_ = static_cast<std::size_t>(latest_state_view_->cache.size());
     code_key_count_ = static_cast<std::size_t>(latest_state_view_->code_cache.size());
+    metrics_.state_keys.set(static_cast<int64_t>(state_key_count_));
+    metrics_.code_keys.set(static_cast<int64_t>(code_key_count_));
 
     root->ready = true;
 }
@@ -182,6 +200,7 @@ bool CoherentStateCache::add(KeyValue kv, CoherentStateRoot* root, StateViewId v
         const auto oldest = state_evictions_.back();
         SILK_DEBUG << "Data cache resize oldest.key=" << silkworm::to_hex(oldest.key);
         state_evictions_.pop_back();
+        metrics_.state_evictions.increment();
         const auto num_erased = root->cache.erase(oldest);
         SILKWORM_ASSERT(num_erased == 1);
     }
@@ -212,6 +231,7 @@ bool CoherentStateCache::add_code(KeyValue kv, CoherentStateRoot* root, StateVie
         const auto oldest = code_evictions_.back();
         SILK_DEBUG << "Code cache resize oldest.key=" << silkworm::to_hex(oldest.key);
         code_evictions_.pop_back();
+        metrics_.code_evictions.increment();
         const auto num_erased = root->code_cache.erase(oldest);
         SILKWORM_ASSERT(num_erased == 1);
     }
@@ -232,6 +252,7 @@ Task<std::optional<silkworm::Bytes>> CoherentStateCache::get(const silkworm::Byt
     const auto kv_it = cache.find(kv);
     if (kv_it != cache.end()) {
         ++state_hit_count_;
+        metrics_.state_hits.increment();
 
         SILK_DEBUG << "Hit in state cache key=" << key << " value=" << kv_it->value;
 
@@ -244,6 +265,7 @@ Task<std::optional<silkworm::Bytes>> CoherentStateCache::get(const silkworm::Byt
     }
 
     ++state_miss_count_;
+    metrics_.state_misses.increment();
 
     TransactionDatabase tx_database{txn};
     const auto value = co_await tx_database.get_one(db::table::kPlainStateName, key);
@@ -274,6 +296,7 @@ Task<std::optional<silkworm::Bytes>> CoherentStateCache::get_code(const silkworm
     const auto kv_it = code_cache.find(kv);
     if (kv_it != code_cache.end()) {
         ++code_hit_count_;
+        metrics_.code_hits.increment();
 
         SILK_DEBUG << "Hit in code cache key=" << key << " value=" << kv_it->value;
 
@@ -286,6 +309,7 @@ Task<std::optional<silkworm::Bytes>> CoherentStateCache::get_code(const silkworm
     }
 
     ++code_miss_count_;
+    metrics_.code_misses.increment();
 
     TransactionDatabase tx_database{txn};
     const auto value = co_await tx_database.get_one(db::table::kCodeName, key);
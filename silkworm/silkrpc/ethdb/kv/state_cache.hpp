@@ -29,6 +29,7 @@
 
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
+#include <silkworm/infra/metrics/metrics.hpp>
 #include <silkworm/interfaces/remote/kv.pb.h>
 #include <silkworm/silkrpc/common/util.hpp>
 #include <silkworm/silkrpc/ethdb/transaction.hpp>
@@ -158,6 +159,21 @@ class CoherentStateCache : public StateCache {
     uint64_t code_miss_count_{0};
     uint64_t code_key_count_{0};
     uint64_t code_eviction_count_{0};
+
+    //! Process-wide metrics, shared by all cache instances
+    struct Metrics {
+        metrics::Counter& state_hits;
+        metrics::Counter& state_misses;
+        metrics::Counter& state_evictions;
+        metrics::Gauge& state_keys;
+        metrics::Counter& code_hits;
+        metrics::Counter& code_misses;
+        metrics::Counter& code_evictions;
+        metrics::Gauge& code_keys;
+    };
+    static Metrics make_metrics();
+
+    Metrics metrics_;
 };
 
 }  // namespace silkworm::rpc::ethdb::kv
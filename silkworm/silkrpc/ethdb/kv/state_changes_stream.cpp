@@ -18,12 +18,15 @@
 
 #include <ostream>
 
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
 #include <boost/asio/experimental/as_tuple.hpp>
 #include <boost/asio/use_future.hpp>
 #include <boost/system/error_code.hpp>
 
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/concurrency/co_spawn_sw.hpp>
+#include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/silkrpc/grpc/util.hpp>
 
@@ -43,6 +46,12 @@ StateChangesStream::StateChangesStream(ClientContext& context, remote::KV::StubI
       grpc_context_(*context.grpc_context()),
       stub_(stub),
       cache_(must_use_shared_service<ethdb::kv::StateCache>(scheduler_)),
+      fee_summary_cache_(use_shared_service<FeeSummaryCache>(scheduler_)),
+      database_(use_private_service<Database>(scheduler_)),
+      backend_(use_private_service<ethbackend::BackEnd>(scheduler_)),
+      block_cache_(use_shared_service<BlockCache>(scheduler_)),
+      subscription_manager_(use_shared_service<SubscriptionManager>(scheduler_)),
+      filter_storage_(use_shared_service<FilterStorage>(scheduler_)),
       retry_timer_{scheduler_} {}
 
 std::future<void> StateChangesStream::open() {
@@ -102,6 +111,21 @@ Task<void> StateChangesStream::run() {
             if (!read_ec) {
                 SILK_TRACE << "State changes batch received: " << reply << "";
                 cache_->on_new_block(reply);
+                if (block_cache_) {
+                    block_cache_->on_new_block(reply);
+                }
+                if (fee_summary_cache_ && database_ && block_cache_) {
+                    fee_summary_cache_->on_new_block(reply);
+                    boost::asio::co_spawn(scheduler_, fee_summary_cache_->update(*database_, backend_, *block_cache_), boost::asio::detached);
+                }
+                if (subscription_manager_ && database_ && block_cache_) {
+                    subscription_manager_->on_new_block(reply);
+                    boost::asio::co_spawn(scheduler_, subscription_manager_->update(*database_, backend_, *block_cache_), boost::asio::detached);
+                }
+                if (filter_storage_ && database_ && block_cache_) {
+                    filter_storage_->on_new_block(reply);
+                    boost::asio::co_spawn(scheduler_, filter_storage_->update(*database_, backend_, *block_cache_), boost::asio::detached);
+                }
             } else {
                 if (read_ec.value() == grpc::StatusCode::CANCELLED) {
                     cancelled = true;
@@ -32,6 +32,10 @@
 
 #include <silkworm/infra/grpc/client/client_context_pool.hpp>
 #include <silkworm/interfaces/remote/kv.grpc.pb.h>
+#include <silkworm/silkrpc/core/block_cache.hpp>
+#include <silkworm/silkrpc/core/fee_summary_cache.hpp>
+#include <silkworm/silkrpc/core/filter_storage.hpp>
+#include <silkworm/silkrpc/core/subscription_manager.hpp>
 #include <silkworm/silkrpc/ethdb/kv/rpc.hpp>
 #include <silkworm/silkrpc/ethdb/kv/state_cache.hpp>
 
@@ -87,6 +91,18 @@ class StateChangesStream {
     //! The local state cache where the received state changes will be applied
     StateCache* cache_;
 
+    //! The block fee summary cache updated on new heads (optional, with the services needed to read blocks)
+    FeeSummaryCache* fee_summary_cache_;
+    Database* database_;
+    ethbackend::BackEnd* backend_;
+    BlockCache* block_cache_;
+
+    //! The eth_subscribe subscriptions notified on new heads (optional)
+    SubscriptionManager* subscription_manager_;
+
+    //! The installed log filters accumulating the logs of new heads (optional)
+    FilterStorage* filter_storage_;
+
     //! The signal used to cancel the register-and-receive stream loop
     boost::asio::cancellation_signal cancellation_signal_;
 
@@ -54,6 +54,9 @@ class Transaction {
 
     virtual std::shared_ptr<ChainStorage> create_storage(const DatabaseReader& db_reader, ethbackend::BackEnd* backend) = 0;
 
+    //! The local read-only transaction, if any: data views obtained from it are valid until this transaction is closed
+    virtual db::ROTxn* local_txn() { return nullptr; }
+
     virtual Task<void> close() = 0;
 };
 
@@ -44,6 +44,8 @@ class TransactionDatabase : public core::rawdb::DatabaseReader {
 
     [[nodiscard]] Task<void> for_prefix(const std::string& table, ByteView prefix, core::rawdb::Walker w) const override;
 
+    [[nodiscard]] db::ROTxn* local_txn() const override { return tx_.local_txn(); }
+
     Transaction& get_tx() { return tx_; }
 
   private:
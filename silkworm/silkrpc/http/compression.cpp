@@ -0,0 +1,117 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "compression.hpp"
+
+#include <limits>
+#include <stdexcept>
+
+#include <absl/strings/ascii.h>
+#include <absl/strings/match.h>
+#include <absl/strings/numbers.h>
+#include <absl/strings/str_split.h>
+#include <zlib.h>
+
+#include <silkworm/core/common/assert.hpp>
+
+namespace silkworm::rpc::http {
+
+//! Favour latency over ratio: JSON replies are highly redundant and compress well even at the fastest level
+constexpr int kCompressionLevel{Z_BEST_SPEED};
+
+//! The zlib window bits: adding 16 selects the gzip wrapper, otherwise the zlib wrapper of HTTP deflate coding
+constexpr int kDeflateWindowBits{15};
+constexpr int kGzipWindowBits{kDeflateWindowBits + 16};
+
+//! The zlib memory level, i.e. the default one
+constexpr int kMemoryLevel{8};
+
+std::string_view to_string(ContentEncoding encoding) {
+    switch (encoding) {
+        case ContentEncoding::gzip:
+            return "gzip";
+        case ContentEncoding::deflate:
+            return "deflate";
+        default:
+            return "identity";
+    }
+}
+
+ContentEncoding negotiate_content_encoding(std::string_view accept_encoding) {
+    ContentEncoding best_encoding{ContentEncoding::identity};
+    double best_quality{0.0};
+    for (std::string_view coding : absl::StrSplit(accept_encoding, ',', absl::SkipWhitespace())) {
+        std::string_view name{coding};
+        double quality{1.0};
+        if (const auto separator{coding.find(';')}; separator != std::string_view::npos) {
+            name = coding.substr(0, separator);
+            const auto parameter{absl::StripAsciiWhitespace(coding.substr(separator + 1))};
+            if (absl::StartsWithIgnoreCase(parameter, "q=") && !absl::SimpleAtod(parameter.substr(2), &quality)) {
+                continue;
+            }
+        }
+        name = absl::StripAsciiWhitespace(name);
+
+        ContentEncoding encoding;
+        if (absl::EqualsIgnoreCase(name, "gzip") || name == "*") {
+            encoding = ContentEncoding::gzip;
+        } else if (absl::EqualsIgnoreCase(name, "deflate")) {
+            encoding = ContentEncoding::deflate;
+        } else {
+            continue;
+        }
+        if (quality <= 0.0) {
+            continue;
+        }
+        if (quality > best_quality || (quality == best_quality && encoding == ContentEncoding::gzip)) {
+            best_encoding = encoding;
+            best_quality = quality;
+        }
+    }
+    return best_encoding;
+}
+
+std::string compress(std::string_view content, ContentEncoding encoding) {
+    if (encoding == ContentEncoding::identity) {
+        return std::string{content};
+    }
+    SILKWORM_ASSERT(content.size() <= std::numeric_limits<uInt>::max());
+
+    z_stream stream{};
+    const int window_bits{encoding == ContentEncoding::gzip ? kGzipWindowBits : kDeflateWindowBits};
+    if (deflateInit2(&stream, kCompressionLevel, Z_DEFLATED, window_bits, kMemoryLevel, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw std::runtime_error{"compress: cannot initialize zlib stream"};
+    }
+
+    // Compress in one shot into a buffer large enough for the worst case
+    std::string compressed;
+    compressed.resize(deflateBound(&stream, static_cast<uLong>(content.size())));
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(content.data()));
+    stream.avail_in = static_cast<uInt>(content.size());
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    const int result{deflate(&stream, Z_FINISH)};
+    const auto compressed_size{stream.total_out};
+    deflateEnd(&stream);
+    if (result != Z_STREAM_END) {
+        throw std::runtime_error{"compress: zlib deflate failed with code " + std::to_string(result)};
+    }
+
+    compressed.resize(compressed_size);
+    return compressed;
+}
+
+}  // namespace silkworm::rpc::http
@@ -0,0 +1,45 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace silkworm::rpc::http {
+
+//! The content codings supported for replies
+enum class ContentEncoding {
+    identity,
+    gzip,
+    deflate
+};
+
+//! The min size of reply content worth compressing, smaller replies are sent as they are
+constexpr std::size_t kMinCompressedContentSize{1024};
+
+//! Get the token identifying the content coding in Content-Encoding header
+std::string_view to_string(ContentEncoding encoding);
+
+//! Choose the content coding for the reply given the Accept-Encoding header value, preferring gzip over deflate
+//! on equal quality values. Codings having zero quality value (i.e. "q=0") are not acceptable.
+ContentEncoding negotiate_content_encoding(std::string_view accept_encoding);
+
+//! Compress the content using the given content coding
+std::string compress(std::string_view content, ContentEncoding encoding);
+
+}  // namespace silkworm::rpc::http
@@ -0,0 +1,91 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "compression.hpp"
+
+#include <string>
+
+#include <catch2/catch.hpp>
+#include <zlib.h>
+
+namespace silkworm::rpc::http {
+
+//! Decompress gzip or zlib wrapped content, detecting the wrapper automatically
+static std::string decompress(const std::string& compressed, std::size_t content_size) {
+    std::string content(content_size, '\0');
+    z_stream stream{};
+    REQUIRE(inflateInit2(&stream, 15 + 32) == Z_OK);
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+    stream.avail_in = static_cast<uInt>(compressed.size());
+    stream.next_out = reinterpret_cast<Bytef*>(content.data());
+    stream.avail_out = static_cast<uInt>(content.size());
+    const int result{inflate(&stream, Z_FINISH)};
+    inflateEnd(&stream);
+    REQUIRE(result == Z_STREAM_END);
+    content.resize(stream.total_out);
+    return content;
+}
+
+TEST_CASE("negotiate_content_encoding", "[silkrpc][http][compression]") {
+    CHECK(negotiate_content_encoding("") == ContentEncoding::identity);
+    CHECK(negotiate_content_encoding("identity") == ContentEncoding::identity);
+    CHECK(negotiate_content_encoding("br") == ContentEncoding::identity);
+    CHECK(negotiate_content_encoding("gzip") == ContentEncoding::gzip);
+    CHECK(negotiate_content_encoding("GZIP") == ContentEncoding::gzip);
+    CHECK(negotiate_content_encoding("deflate") == ContentEncoding::deflate);
+    CHECK(negotiate_content_encoding("*") == ContentEncoding::gzip);
+    CHECK(negotiate_content_encoding("deflate, gzip") == ContentEncoding::gzip);
+    CHECK(negotiate_content_encoding("gzip, deflate, br") == ContentEncoding::gzip);
+    CHECK(negotiate_content_encoding("gzip;q=0.5, deflate") == ContentEncoding::deflate);
+    CHECK(negotiate_content_encoding("gzip; q=0.8, deflate;q=0.2") == ContentEncoding::gzip);
+    CHECK(negotiate_content_encoding("gzip;q=0") == ContentEncoding::identity);
+    CHECK(negotiate_content_encoding("gzip;q=0, deflate;q=0") == ContentEncoding::identity);
+    CHECK(negotiate_content_encoding("gzip;q=abc, deflate") == ContentEncoding::deflate);
+}
+
+TEST_CASE("compress", "[silkrpc][http][compression]") {
+    std::string content;
+    for (int i{0}; i < 1000; ++i) {
+        content += R"({"jsonrpc":"2.0","id":)" + std::to_string(i) + R"(,"result":"0x0000000000000000"})";
+    }
+
+    SECTION("identity") {
+        CHECK(compress(content, ContentEncoding::identity) == content);
+    }
+
+    SECTION("gzip") {
+        const auto compressed{compress(content, ContentEncoding::gzip)};
+        REQUIRE(compressed.size() > 2);
+        CHECK(static_cast<uint8_t>(compressed[0]) == 0x1f);  // gzip magic number
+        CHECK(static_cast<uint8_t>(compressed[1]) == 0x8b);
+        CHECK(compressed.size() < content.size() / 4);
+        CHECK(decompress(compressed, content.size()) == content);
+    }
+
+    SECTION("deflate") {
+        const auto compressed{compress(content, ContentEncoding::deflate)};
+        REQUIRE(!compressed.empty());
+        CHECK((static_cast<uint8_t>(compressed[0]) & 0x0f) == Z_DEFLATED);  // zlib header
+        CHECK(compressed.size() < content.size() / 4);
+        CHECK(decompress(compressed, content.size()) == content);
+    }
+
+    SECTION("empty content") {
+        CHECK(decompress(compress("", ContentEncoding::gzip), 16).empty());
+    }
+}
+
+}  // namespace silkworm::rpc::http
@@ -26,23 +26,39 @@
 #include <fstream>
 #include <string_view>
 
+#include <absl/strings/match.h>
+#include <boost/asio/co_spawn.hpp>
 #include <boost/asio/use_awaitable.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/system/error_code.hpp>
 
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
+#include <silkworm/silkrpc/ws/connection.hpp>
 
 namespace silkworm::rpc::http {
 
+static bool is_websocket_upgrade(const Request& request) {
+    for (const auto& header : request.headers) {
+        if (absl::EqualsIgnoreCase(header.name, "Upgrade") && absl::EqualsIgnoreCase(header.value, "websocket")) {
+            return true;
+        }
+    }
+    return false;
+}
+
 Connection::Connection(boost::asio::io_context& io_context,
                        commands::RpcApi& api,
                        commands::RpcApiTable& handler_table,
                        const std::vector<std::string>& allowed_origins,
-                       std::optional<std::string> jwt_secret)
+                       std::optional<std::string> jwt_secret,
+                       SubscriptionManager* subscription_manager)
     : socket_{io_context},
-      request_handler_{socket_, api, handler_table, allowed_origins, std::move(jwt_secret)},
-      buffer_{} {
+      api_{api},
+      handler_table_{handler_table},
+      allowed_origins_{allowed_origins},
+      subscription_manager_{subscription_manager},
+      request_handler_{socket_, api, handler_table, allowed_origins, std::move(jwt_secret)} {
     request_.content.reserve(kRequestContentInitialCapacity);
     request_.headers.reserve(kRequestHeadersInitialCapacity);
     request_.method.reserve(kRequestMethodInitialCapacity);
@@ -57,8 +73,8 @@ Connection::~Connection() {
 
 Task<void> Connection::read_loop() {
     try {
-        // Read next request or next chunk (result == RequestParser::indeterminate) until closed or error
-        while (true) {
+        // Read next request or next chunk (result == RequestParser::indeterminate) until closed, upgraded or error
+        while (!upgraded_) {
             co_await do_read();
         }
     } catch (const boost::system::system_error& se) {
@@ -78,23 +94,67 @@ Task<void> Connection::read_loop() {
 
 Task<void> Connection::do_read() {
     SILK_DEBUG << "Connection::do_read going to read...";
-    std::size_t bytes_read = co_await socket_.async_read_some(boost::asio::buffer(buffer_), boost::asio::use_awaitable);
+    const auto buffer = request_parser_.prepare(kHttpIncomingBufferSize);
+    std::size_t bytes_read = co_await socket_.async_read_some(buffer, boost::asio::use_awaitable);
     SILK_DEBUG << "Connection::do_read bytes_read: " << bytes_read;
-    SILK_TRACE << "Connection::do_read buffer: " << std::string_view{static_cast<const char*>(buffer_.data()), bytes_read};
-
-    RequestParser::ResultType result = request_parser_.parse(request_, buffer_.data(), buffer_.data() + bytes_read);
-
-    if (result == RequestParser::ResultType::good) {
-        co_await request_handler_.handle(request_);
-        clean();
-    } else if (result == RequestParser::ResultType::bad) {
-        reply_ = Reply::stock_reply(StatusType::bad_request);
-        co_await do_write();
-        clean();
-    } else if (result == RequestParser::ResultType::processing_continue) {
-        reply_ = Reply::stock_reply(StatusType::processing_continue);
-        co_await do_write();
-        reply_.reset();
+    SILK_TRACE << "Connection::do_read buffer: " << std::string_view{static_cast<const char*>(buffer.data()), bytes_read};
+    request_parser_.commit(bytes_read);
+
+    // Handle all the requests received so far: the pipelined ones run concurrently, each one writing its reply in turn
+    auto result = request_parser_.parse(request_);
+    for (; result != RequestParser::ResultType::indeterminate; result = request_parser_.parse(request_)) {
+        if (result == RequestParser::ResultType::good) {
+            if (subscription_manager_ && is_websocket_upgrade(request_)) {
+                co_await wait_for_pending_replies(0);
+                co_await do_upgrade();
+                co_return;
+            }
+            co_await wait_for_pending_replies(kMaxPipelinedRequests - 1);
+            boost::asio::co_spawn(socket_.get_executor(), handle_pipelined(std::move(request_), next_request_number_++),
+                                  [self = shared_from_this()](const std::exception_ptr&) {});
+            request_.reset();
+        } else if (result == RequestParser::ResultType::bad) {
+            co_await wait_for_pending_replies(0);
+            reply_ = Reply::stock_reply(StatusType::bad_request);
+            co_await do_write();
+            clean();
+            co_return;
+        } else if (result == RequestParser::ResultType::processing_continue) {
+            // Interim reply cannot precede the replies to previous requests
+            co_await wait_for_pending_replies(0);
+            reply_ = Reply::stock_reply(StatusType::processing_continue);
+            co_await do_write();
+            reply_.reset();
+        }
+    }
+}
+
+Task<void> Connection::handle_pipelined(Request request, uint64_t sequence_number) {
+    try {
+        co_await request_handler_.handle(request, [this, sequence_number]() { return wait_for_write_turn(sequence_number); });
+    } catch (const std::exception& e) {
+        SILK_ERROR << "Connection::handle_pipelined exception: " << e.what();
+        // Reply is missing, so the following ones would be mismatched: close the connection
+        boost::system::error_code ec;
+        socket_.close(ec);
+    }
+    ++next_reply_number_;
+    reply_written_.notify_all();
+}
+
+Task<void> Connection::wait_for_write_turn(uint64_t sequence_number) {
+    while (true) {
+        auto waiter = reply_written_.waiter();
+        if (next_reply_number_ == sequence_number) break;
+        co_await waiter();
+    }
+}
+
+Task<void> Connection::wait_for_pending_replies(std::size_t max_pending_replies) {
+    while (true) {
+        auto waiter = reply_written_.waiter();
+        if (next_request_number_ - next_reply_number_ <= max_pending_replies) break;
+        co_await waiter();
     }
 }
 
@@ -104,6 +164,15 @@ Task<void> Connection::do_write() {
     SILK_TRACE << "Connection::do_write bytes_transferred: " << bytes_transferred;
 }
 
+Task<void> Connection::do_upgrade() {
+    SILK_DEBUG << "Connection::do_upgrade socket " << &socket_ << " upgrading to WebSocket";
+    upgraded_ = true;
+    auto ws_connection = std::make_shared<ws::Connection>(std::move(socket_), api_, handler_table_, allowed_origins_, *subscription_manager_);
+    const Request upgrade_request{std::move(request_)};
+    clean();
+    co_await ws_connection->run(upgrade_request);
+}
+
 void Connection::clean() {
     request_.reset();
     request_parser_.reset();
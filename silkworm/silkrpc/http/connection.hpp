@@ -22,7 +22,8 @@
 
 #pragma once
 
-#include <array>
+#include <cstdint>
+#include <memory>
 #include <string>
 
 #include <silkworm/infra/concurrency/task.hpp>
@@ -31,8 +32,10 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/thread_pool.hpp>
 
+#include <silkworm/infra/concurrency/awaitable_condition_variable.hpp>
 #include <silkworm/silkrpc/commands/rpc_api_table.hpp>
 #include <silkworm/silkrpc/common/constants.hpp>
+#include <silkworm/silkrpc/core/subscription_manager.hpp>
 #include <silkworm/silkrpc/http/reply.hpp>
 #include <silkworm/silkrpc/http/request.hpp>
 #include <silkworm/silkrpc/http/request_handler.hpp>
@@ -40,18 +43,24 @@
 
 namespace silkworm::rpc::http {
 
+//! The max number of pipelined requests handled concurrently per connection before reading more
+constexpr std::size_t kMaxPipelinedRequests{16};
+
 //! Represents a single connection from a client.
-class Connection {
+//! Pipelined requests are handled concurrently while their replies are written in request order.
+class Connection : public std::enable_shared_from_this<Connection> {
   public:
     Connection(const Connection&) = delete;
     Connection& operator=(const Connection&) = delete;
 
     //! Construct a connection running within the given execution context.
+    //! WebSocket upgrade requests are accepted only if a subscription manager is given.
     Connection(boost::asio::io_context& io_context,
                commands::RpcApi& api,
                commands::RpcApiTable& handler_table,
                const std::vector<std::string>& allowed_origins,
-               std::optional<std::string> jwt_secret);
+               std::optional<std::string> jwt_secret,
+               SubscriptionManager* subscription_manager = nullptr);
 
     ~Connection();
 
@@ -64,27 +73,57 @@ class Connection {
     //! Reset connection data
     void clean();
 
-    //! Perform an asynchronous read operation.
+    //! Perform an asynchronous read operation and handle all the requests received.
     Task<void> do_read();
 
+    //! Handle the pipelined request having the given sequence number, writing its reply in turn.
+    Task<void> handle_pipelined(Request request, uint64_t sequence_number);
+
+    //! Wait until the replies to all previous requests have been written.
+    Task<void> wait_for_write_turn(uint64_t sequence_number);
+
+    //! Wait until the number of requests not yet replied drops to the given limit.
+    Task<void> wait_for_pending_replies(std::size_t max_pending_replies);
+
     //! Perform an asynchronous write operation.
     Task<void> do_write();
 
+    //! Hand over the socket to a WebSocket connection and serve it until closed.
+    Task<void> do_upgrade();
+
     //! Socket for the connection.
     boost::asio::ip::tcp::socket socket_;
 
+    commands::RpcApi& api_;
+
+    commands::RpcApiTable& handler_table_;
+
+    const std::vector<std::string>& allowed_origins_;
+
+    //! The subscription manager for WebSocket connections or \code nullptr if WebSocket is disabled
+    SubscriptionManager* subscription_manager_;
+
+    //! Flag indicating if the socket has been handed over to a WebSocket connection.
+    bool upgraded_{false};
+
     //! The handler used to process the incoming request.
     RequestHandler request_handler_;
 
-    //! Buffer for incoming data.
-    std::array<char, kHttpIncomingBufferSize> buffer_;
-
     //! The incoming request.
     Request request_;
 
-    //! The parser for the incoming request.
+    //! The parser for the incoming requests, owning the growable buffer for incoming data.
     RequestParser request_parser_;
 
+    //! The sequence number of the next incoming request.
+    uint64_t next_request_number_{0};
+
+    //! The sequence number of the request whose reply is the next to be written.
+    uint64_t next_reply_number_{0};
+
+    //! Notified whenever a reply has been written.
+    concurrency::AwaitableConditionVariable reply_written_;
+
     //! The reply to be sent back to the client.
     Reply reply_;
 };
@@ -16,17 +16,114 @@
 
 #include "connection.hpp"
 
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/thread_pool.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/http/read.hpp>
+#include <boost/beast/http/string_body.hpp>
+#include <boost/beast/http/write.hpp>
 #include <catch2/catch.hpp>
+#include <nlohmann/json.hpp>
 
 #include <silkworm/infra/grpc/client/client_context_pool.hpp>
 #include <silkworm/infra/test_util/log.hpp>
 #include <silkworm/silkrpc/commands/rpc_api_table.hpp>
+#include <silkworm/silkrpc/common/execution_lanes.hpp>
+#include <silkworm/silkrpc/http/compression.hpp>
+#include <silkworm/silkrpc/test/context_test_base.hpp>
 
 namespace silkworm::rpc::http {
 
+namespace beast_http = boost::beast::http;
+using boost::asio::ip::tcp;
 using Catch::Matchers::Message;
 
+//! Server accepting HTTP connections on a local ephemeral port, whose web3 requests are admitted one at a time
+class ConnectionTestBase : public test::ContextTestBase {
+  public:
+    ConnectionTestBase()
+        : workers_{1},
+          execution_lanes_{{{.api_namespace = kWeb3ApiNamespace, .max_concurrency = 1, .max_queue_depth = 64}}},
+          rpc_api_{io_context_, workers_, execution_lanes_},
+          rpc_api_table_{kDefaultEth1ApiSpec},
+          acceptor_{io_context_, tcp::endpoint{boost::asio::ip::make_address("127.0.0.1"), 0}} {
+        boost::asio::co_spawn(io_context_, accept_loop(), boost::asio::detached);
+    }
+
+    ~ConnectionTestBase() {
+        // Stop serving before the API is gone
+        context_.stop();
+        context_thread_.join();
+    }
+
+    //! The lane of web3 requests, whose only admission can be held by the test to keep them waiting
+    ExecutionLane& web3_lane() { return *execution_lanes_.find(kWeb3ApiNamespace); }
+
+    void connect(tcp::socket& client) { client.connect(acceptor_.local_endpoint()); }
+
+    boost::asio::io_context client_context;
+
+  private:
+    Task<void> accept_loop() {
+        while (true) {
+            auto connection = std::make_shared<Connection>(io_context_, rpc_api_, rpc_api_table_, allowed_origins_,
+                                                           /*jwt_secret=*/std::nullopt);
+            co_await acceptor_.async_accept(connection->socket(), boost::asio::use_awaitable);
+            boost::asio::co_spawn(io_context_, serve(connection), boost::asio::detached);
+        }
+    }
+
+    static Task<void> serve(std::shared_ptr<Connection> connection) {
+        co_await connection->read_loop();
+    }
+
+    boost::asio::thread_pool workers_;
+    ExecutionLanes execution_lanes_;
+    commands::RpcApi rpc_api_;
+    commands::RpcApiTable rpc_api_table_;
+    std::vector<std::string> allowed_origins_;
+    tcp::acceptor acceptor_;
+};
+
+static void write_request(tcp::socket& client, const std::string& method, int id, const std::string& accept_encoding = {}) {
+    beast_http::request<beast_http::string_body> request{beast_http::verb::post, "/", 11};
+    request.set(beast_http::field::host, "localhost");
+    request.set(beast_http::field::content_type, "application/json");
+    if (!accept_encoding.empty()) {
+        request.set(beast_http::field::accept_encoding, accept_encoding);
+    }
+    const nlohmann::json params = method == "web3_sha3" ? nlohmann::json::array({"0x68656c6c6f"}) : nlohmann::json::array();
+    request.body() = nlohmann::json{{"jsonrpc", "2.0"}, {"id", id}, {"method", method}, {"params", params}}.dump();
+    request.prepare_payload();
+    beast_http::write(client, request);
+}
+
+static beast_http::response<beast_http::string_body> read_reply(tcp::socket& client, boost::beast::flat_buffer& buffer) {
+    beast_http::response<beast_http::string_body> reply;
+    beast_http::read(client, buffer, reply);
+    return reply;
+}
+
+//! Wait until the given number of requests is waiting for admission on the lane
+static void wait_for_waiting(const ExecutionLane& lane, std::size_t num_waiting) {
+    using namespace std::chrono_literals;
+    for (int i{0}; i < 500 && lane.num_waiting() < num_waiting; ++i) {
+        std::this_thread::sleep_for(10ms);
+    }
+    // Give the connection the chance to handle more requests than expected, if any
+    std::this_thread::sleep_for(50ms);
+}
+
 // Exclude gRPC tests from sanitizer builds due to data race warnings inside gRPC library
 // SUMMARY: ThreadSanitizer: data race /usr/include/c++/11/bits/stl_algobase.h:431
 // - write of size 1 thread T8 'grpc_global_tim' created by main thread
@@ -49,6 +146,68 @@ TEST_CASE("connection creation", "[silkrpc][http][connection]") {
         context_pool.join();
     }
 }
+
+TEST_CASE("Connection pipelined requests", "[silkrpc][http][connection]") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+
+    ConnectionTestBase server;
+    tcp::socket client{server.client_context};
+    server.connect(client);
+    boost::beast::flat_buffer buffer;
+
+    // Hold the only web3 admission, so that web3 requests cannot complete until released
+    REQUIRE(server.spawn_and_wait(server.web3_lane().acquire()));
+
+    SECTION("replies in request order") {
+        // The first request completes last, the following ones (not having any lane) immediately
+        write_request(client, "web3_sha3", 0);
+        write_request(client, "eth_unknownMethod", 1);
+        write_request(client, "eth_unknownMethod", 2);
+        wait_for_waiting(server.web3_lane(), 1);
+        CHECK(server.web3_lane().num_waiting() == 1);
+        CHECK(client.available() == 0);
+
+        server.web3_lane().release();
+        for (int id{0}; id < 3; ++id) {
+            const auto reply{read_reply(client, buffer)};
+            const auto reply_json = nlohmann::json::parse(reply.body());
+            CHECK(reply_json["id"] == id);
+            CHECK(reply_json.contains(id == 0 ? "result" : "error"));
+        }
+    }
+
+    SECTION("back-pressure on too many pipelined requests") {
+        constexpr int kNumRequests{kMaxPipelinedRequests + 4};
+        for (int id{0}; id < kNumRequests; ++id) {
+            write_request(client, "web3_sha3", id);
+        }
+        wait_for_waiting(server.web3_lane(), kMaxPipelinedRequests);
+        CHECK(server.web3_lane().num_waiting() == kMaxPipelinedRequests);
+
+        server.web3_lane().release();
+        for (int id{0}; id < kNumRequests; ++id) {
+            const auto reply{read_reply(client, buffer)};
+            CHECK(nlohmann::json::parse(reply.body())["id"] == id);
+        }
+    }
+
+    SECTION("compressed reply") {
+        server.web3_lane().release();
+
+        // The error reply echoes the method name, hence it is large enough to be compressed
+        const std::string method{"eth_" + std::string(kMinCompressedContentSize, 'x')};
+        write_request(client, method, 0, "gzip");
+        const auto reply{read_reply(client, buffer)};
+        CHECK(reply[beast_http::field::content_encoding] == "gzip");
+        CHECK(reply[beast_http::field::vary] == "Accept-Encoding");
+        CHECK(reply.body().size() < kMinCompressedContentSize);
+
+        write_request(client, method, 1);
+        const auto identity_reply{read_reply(client, buffer)};
+        CHECK(identity_reply[beast_http::field::content_encoding].empty());
+        CHECK(nlohmann::json::parse(identity_reply.body())["id"] == 1);
+    }
+}
 #endif  // SILKWORM_SANITIZE
 
 }  // namespace silkworm::rpc::http
@@ -22,11 +22,18 @@
 
 #include "request_handler.hpp"
 
+#include <exception>
 #include <iostream>
 #include <vector>
 
+#include <absl/strings/match.h>
 #include <absl/strings/str_join.h>
+#include <boost/asio/compose.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <boost/asio/write.hpp>
+#include <gsl/util>
 #include <jwt-cpp/jwt.h>
 #include <jwt-cpp/traits/nlohmann-json/defaults.h>
 #include <nlohmann/json.hpp>
@@ -39,7 +46,17 @@
 
 namespace silkworm::rpc::http {
 
-Task<void> RequestHandler::handle(const http::Request& request) {
+//! Choose the content coding of the reply out of the ones accepted by the client
+static ContentEncoding accepted_content_encoding(const http::Request& request) {
+    for (const auto& header : request.headers) {
+        if (absl::EqualsIgnoreCase(header.name, "Accept-Encoding")) {
+            return negotiate_content_encoding(header.value);
+        }
+    }
+    return ContentEncoding::identity;
+}
+
+Task<void> RequestHandler::handle(const http::Request& request, WriteTurn write_turn) {
     auto start = clock_time::now();
 
     http::Reply reply;
@@ -62,7 +79,7 @@ Task<void> RequestHandler::handle(const http::Request& request) {
                     reply.content = make_json_error(request_id, 403, auth_result.error()).dump() + "\n";
                     reply.status = http::StatusType::unauthorized;
                 } else {
-                    co_await handle_request_and_create_reply(request_json, reply);
+                    co_await handle_request_and_create_reply(request_json, reply, write_turn);
                     reply.content += "\n";
                 }
             }
@@ -86,7 +103,7 @@ Task<void> RequestHandler::handle(const http::Request& request) {
                         } else {
                             batch_reply_content += ",";
                         }
-                        co_await handle_request_and_create_reply(item_json, reply);
+                        co_await handle_request_and_create_reply(item_json, reply, write_turn);
                         batch_reply_content += reply.content;
                     }
                 }
@@ -96,12 +113,15 @@ Task<void> RequestHandler::handle(const http::Request& request) {
         }
     }
 
-    co_await do_write(reply);
+    if (write_turn) {
+        co_await write_turn();
+    }
+    co_await do_write(reply, accepted_content_encoding(request));
 
     SILK_TRACE << "handle HTTP request t=" << clock_time::since(start) << "ns";
 }
 
-Task<void> RequestHandler::handle_request_and_create_reply(const nlohmann::json& request_json, http::Reply& reply) {
+Task<void> RequestHandler::handle_request_and_create_reply(const nlohmann::json& request_json, http::Reply& reply, WriteTurn write_turn) {
     const auto request_id = request_json["id"].get<uint32_t>();
     if (!request_json.contains("method")) {
         reply.content = make_json_error(request_id, -32600, "invalid request").dump();
@@ -116,6 +136,19 @@ Task<void> RequestHandler::handle_request_and_create_reply(const nlohmann::json&
         co_return;
     }
 
+    metrics::ScopedTimer latency_timer{rpc_api_table_.find_latency_histogram(method)};
+
+    // Admit the request on the execution lane (if any) of its handler API, shedding it when the lane is overloaded
+    ExecutionLane* execution_lane = rpc_api_.execution_lanes().find(rpc_api_table_.find_api_namespace(method));
+    if (execution_lane && !co_await execution_lane->acquire()) {
+        reply.content = make_json_error(request_id, -32005, "server busy: request shed on " + execution_lane->settings().api_namespace + " lane").dump();
+        reply.status = http::StatusType::service_unavailable;
+        co_return;
+    }
+    [[maybe_unused]] auto _ = gsl::finally([execution_lane]() {
+        if (execution_lane) execution_lane->release();
+    });
+
     // Dispatch JSON handlers in this order: 1) glaze JSON 2) nlohmann JSON 3) JSON streaming
     const auto json_glaze_handler = rpc_api_table_.find_json_glaze_handler(method);
     if (json_glaze_handler) {
@@ -134,7 +167,7 @@ Task<void> RequestHandler::handle_request_and_create_reply(const nlohmann::json&
     const auto stream_handler = rpc_api_table_.find_stream_handler(method);
     if (stream_handler) {
         SILK_TRACE << "--> handle RPC stream request: " << method;
-        co_await handle_request(*stream_handler, request_json);
+        co_await handle_request(*stream_handler, request_json, write_turn);
         SILK_TRACE << "<-- handle RPC stream request: " << method;
         co_return;
     }
@@ -186,12 +219,16 @@ Task<void> RequestHandler::handle_request(uint32_t request_id, commands::RpcApiT
     co_return;
 }
 
-Task<void> RequestHandler::handle_request(commands::RpcApiTable::HandleStream handler, const nlohmann::json& request_json) {
+Task<void> RequestHandler::handle_request(commands::RpcApiTable::HandleStream handler, const nlohmann::json& request_json, const WriteTurn& write_turn) {
     try {
         SocketWriter socket_writer(socket_);
         ChunksWriter chunks_writer(socket_writer);
         json::Stream stream(chunks_writer);
 
+        // Streamed replies are written while being built, hence not before the previous replies
+        if (write_turn) {
+            co_await write_turn();
+        }
         co_await write_headers();
         co_await (rpc_api_.*handler)(request_json, stream);
 
@@ -252,13 +289,23 @@ RequestHandler::AuthorizationResult RequestHandler::is_request_authorized(const
 //! The number of HTTP headers added when Cross-Origin Resource Sharing (CORS) is enabled.
 static constexpr size_t kCorsNumHeaders{4};
 
-Task<void> RequestHandler::do_write(Reply& reply) {
+Task<void> RequestHandler::do_write(Reply& reply, ContentEncoding encoding) {
     try {
         SILK_DEBUG << "RequestHandler::do_write reply: " << reply.content;
 
-        reply.headers.reserve(allowed_origins_.empty() ? 2 : 2 + kCorsNumHeaders);
+        const bool compressed{encoding != ContentEncoding::identity && reply.content.size() >= kMinCompressedContentSize};
+        if (compressed) {
+            reply.content = co_await compress_async(reply.content, encoding);
+        }
+
+        reply.headers.reserve(allowed_origins_.empty() ? 4 : 4 + kCorsNumHeaders);
         reply.headers.emplace_back(http::Header{"Content-Length", std::to_string(reply.content.size())});
         reply.headers.emplace_back(http::Header{"Content-Type", "application/json"});
+        if (compressed) {
+            reply.headers.emplace_back(http::Header{"Content-Encoding", std::string{to_string(encoding)}});
+            // The content depends on the request Accept-Encoding, so caches must not serve it to other clients
+            reply.headers.emplace_back(http::Header{"Vary", "Accept-Encoding"});
+        }
 
         set_cors(reply.headers);
 
@@ -271,6 +318,28 @@ Task<void> RequestHandler::do_write(Reply& reply) {
     }
 }
 
+Task<std::string> RequestHandler::compress_async(const std::string& content, ContentEncoding encoding) {
+    auto current_executor = co_await boost::asio::this_coro::executor;
+
+    // Compression of large replies is CPU-bound, so it must not block the I/O thread
+    co_return co_await boost::asio::async_compose<decltype(boost::asio::use_awaitable), void(std::exception_ptr, std::string)>(
+        [&](auto&& self) {
+            boost::asio::post(rpc_api_.default_workers(), [&, self = std::move(self)]() mutable {
+                std::exception_ptr eptr;
+                std::string compressed_content;
+                try {
+                    compressed_content = compress(content, encoding);
+                } catch (...) {
+                    eptr = std::current_exception();
+                }
+                boost::asio::post(current_executor, [eptr, compressed_content = std::move(compressed_content), self = std::move(self)]() mutable {
+                    self.complete(eptr, std::move(compressed_content));
+                });
+            });
+        },
+        boost::asio::use_awaitable);
+}
+
 Task<void> RequestHandler::write_headers() {
     try {
         std::vector<http::Header> headers;
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -30,6 +31,7 @@
 
 #include <silkworm/silkrpc/commands/rpc_api.hpp>
 #include <silkworm/silkrpc/commands/rpc_api_table.hpp>
+#include <silkworm/silkrpc/http/compression.hpp>
 #include <silkworm/silkrpc/http/reply.hpp>
 #include <silkworm/silkrpc/http/request.hpp>
 
@@ -37,6 +39,9 @@ namespace silkworm::rpc::http {
 
 class RequestHandler {
   public:
+    //! Awaited right before writing anything to the socket, so that replies to pipelined requests are written in order
+    using WriteTurn = std::function<Task<void>()>;
+
     RequestHandler(boost::asio::ip::tcp::socket& socket,
                    commands::RpcApi& rpc_api,
                    const commands::RpcApiTable& rpc_api_table,
@@ -51,10 +56,9 @@ class RequestHandler {
     RequestHandler(const RequestHandler&) = delete;
     RequestHandler& operator=(const RequestHandler&) = delete;
 
-    Task<void> handle(const http::Request& request);
+    Task<void> handle(const http::Request& request, WriteTurn write_turn = {});
 
-  protected:
-    Task<void> handle_request_and_create_reply(const nlohmann::json& request_json, http::Reply& reply);
+    Task<void> handle_request_and_create_reply(const nlohmann::json& request_json, http::Reply& reply, WriteTurn write_turn = {});
 
   private:
     using AuthorizationError = std::string;
@@ -73,8 +77,10 @@ class RequestHandler {
         commands::RpcApiTable::HandleMethodGlaze handler,
         const nlohmann::json& request_json,
         http::Reply& reply);
-    Task<void> handle_request(commands::RpcApiTable::HandleStream handler, const nlohmann::json& request_json);
-    Task<void> do_write(http::Reply& reply);
+    Task<void> handle_request(commands::RpcApiTable::HandleStream handler, const nlohmann::json& request_json, const WriteTurn& write_turn);
+    Task<void> do_write(http::Reply& reply, ContentEncoding encoding);
+    //! Compress the content on the worker threads
+    Task<std::string> compress_async(const std::string& content, ContentEncoding encoding);
     Task<void> write_headers();
 
     commands::RpcApi& rpc_api_;
@@ -24,104 +24,159 @@
 
 #include <picohttpparser.h>
 
-#include <cstdlib>
+#include <algorithm>
+#include <charconv>
 #include <cstring>
+#include <string_view>
+
+#include <absl/strings/match.h>
+
+#include <silkworm/core/common/assert.hpp>
 
 namespace silkworm::rpc::http {
 
 //! The default size of HTTP character buffer used by the parser
 constexpr std::size_t kDefaultHttpBufferSize{65536};
 
+//! The max size of buffer allocated in advance for the content of one request, larger content grows it geometrically
+constexpr std::size_t kMaxPreallocatedContentSize{16 * 1024 * 1024};
+
 //! The maximum number of HTTP headers supported by the parser
 constexpr std::size_t kMaxHttpHeaders{100};
 
+//! Check if the header is needed to validate and perform the WebSocket opening handshake (names are case-insensitive)
+static bool is_websocket_handshake_header(std::string_view name) {
+    return absl::EqualsIgnoreCase(name, "Upgrade") || absl::EqualsIgnoreCase(name, "Connection") ||
+           absl::EqualsIgnoreCase(name, "Origin") || absl::StartsWithIgnoreCase(name, "Sec-WebSocket-");
+}
+
+//! Check if the header must be kept in the request for later processing
+static bool is_retained_header(std::string_view name) {
+    return absl::EqualsIgnoreCase(name, "Authorization") || absl::EqualsIgnoreCase(name, "Accept-Encoding") ||
+           is_websocket_handshake_header(name);
+}
+
 void RequestParser::reset() {
+    begin_ = 0;
+    end_ = 0;
     prev_len_ = 0;
-    buffer_.clear();
+    head_len_ = 0;
+    content_length_ = 0;
 }
 
 RequestParser::RequestParser() {
     buffer_.resize(kDefaultHttpBufferSize);
 }
 
-RequestParser::ResultType RequestParser::parse(Request& req, const char* begin, const char* end) {
-    auto current_len = static_cast<size_t>(end - begin);
-
-    if (req.content_length != 0 && req.content.length() < req.content_length) {
-        for (size_t i{0}; i < current_len; i++) {
-            req.content.push_back(begin[i]);
+boost::asio::mutable_buffer RequestParser::prepare(std::size_t min_size) {
+    const std::size_t received_size{end_ - begin_};
+    if (head_len_ > 0 && head_len_ + content_length_ > received_size) {
+        // Make room for the whole missing content at once (up to a limit), avoiding many reads and reallocations
+        min_size = std::max(min_size, std::min(head_len_ + content_length_ - received_size, kMaxPreallocatedContentSize));
+    }
+    if (buffer_.size() - end_ < min_size) {
+        // Move the data received to the front, dropping the requests already parsed
+        if (begin_ > 0) {
+            std::memmove(buffer_.data(), buffer_.data() + begin_, received_size);
+            begin_ = 0;
+            end_ = received_size;
+        }
+        if (buffer_.size() - end_ < min_size) {
+            buffer_.resize(std::max(buffer_.size() * 2, end_ + min_size));
         }
-        if (req.content.length() < req.content_length)
-            return ResultType::indeterminate;
-        else
-            return ResultType::good;
     }
+    return boost::asio::buffer(buffer_.data() + end_, buffer_.size() - end_);
+}
 
-    if (prev_len_) {
-        for (size_t i = 0; i < current_len; i++) {
-            buffer_.push_back(*begin++);
-        }
-        begin = buffer_.data();
-        current_len = buffer_.size();
+void RequestParser::commit(std::size_t size) {
+    SILKWORM_ASSERT(end_ + size <= buffer_.size());
+    end_ += size;
+}
+
+void RequestParser::consume(std::size_t size) {
+    begin_ += size;
+    if (begin_ == end_) {
+        begin_ = 0;
+        end_ = 0;
+    }
+    prev_len_ = 0;
+    head_len_ = 0;
+    content_length_ = 0;
+}
+
+RequestParser::ResultType RequestParser::parse(Request& req, const char* begin, const char* end) {
+    const auto size = static_cast<std::size_t>(end - begin);
+    if (size > 0) {
+        std::memcpy(prepare(size).data(), begin, size);
+        commit(size);
     }
+    return parse(req);
+}
 
-    const char* method_name;  // uninitialised here because phr_parse_request initialises it
-    size_t method_len;        // uninitialised here because phr_parse_request initialises it
-    const char* path;         // uninitialised here because phr_parse_request initialises it
-    size_t path_len;          // uninitialised here because phr_parse_request initialises it
-    int minor_version;        // uninitialised here because phr_parse_request initialises it
-    struct phr_header headers[kMaxHttpHeaders];
-    size_t num_headers = sizeof(headers) / sizeof(headers[0]);
-
-    const auto res = phr_parse_request(begin, current_len, &method_name, &method_len, &path, &path_len, &minor_version, headers, &num_headers, prev_len_);
-    if (res == -1) {
-        return ResultType::bad;
-    } else if (res == -2) {
-        buffer_.clear();
-        for (size_t i = 0; i < current_len; i++) {
-            buffer_.push_back(*begin++);
+RequestParser::ResultType RequestParser::parse(Request& req) {
+    const char* data = buffer_.data() + begin_;
+    const std::size_t received_size{end_ - begin_};
+
+    if (head_len_ == 0) {
+        if (received_size == 0) {
+            return ResultType::indeterminate;
         }
-        prev_len_ = buffer_.size();
-        return ResultType::indeterminate;
-    }
 
-    req.http_version_minor = minor_version;
-
-    bool expect_request{false};
-    bool content_length_present{false};
-    for (size_t i{0}; i < num_headers; ++i) {
-        const auto& header{headers[i]};
-        if (header.name_len == 0) continue;
-        if (std::memcmp(header.name, "Content-Length", std::min(header.name_len, sizeof("Content-Length"))) == 0) {
-            req.content_length = static_cast<uint32_t>(atoi(header.value));
-            content_length_present = true;
-        } else if (std::memcmp(header.name, "Expect", std::min(header.name_len, sizeof("Expect"))) == 0) {
-            expect_request = true;
-        } else if (std::memcmp(header.name, "Authorization", std::min(header.name_len, sizeof("Authorization"))) == 0) {
-            req.headers.emplace_back();
-            for (size_t index = 0; index < static_cast<size_t>(header.name_len); index++) {
-                req.headers.back().name.push_back(header.name[index]);
-            }
-            for (size_t index = 0; index < static_cast<size_t>(header.value_len); index++) {
-                req.headers.back().value.push_back(header.value[index]);
+        const char* method_name;  // uninitialised here because phr_parse_request initialises it
+        size_t method_len;        // uninitialised here because phr_parse_request initialises it
+        const char* path;         // uninitialised here because phr_parse_request initialises it
+        size_t path_len;          // uninitialised here because phr_parse_request initialises it
+        int minor_version;        // uninitialised here because phr_parse_request initialises it
+        struct phr_header headers[kMaxHttpHeaders];
+        size_t num_headers = sizeof(headers) / sizeof(headers[0]);
+
+        const auto res = phr_parse_request(data, received_size, &method_name, &method_len, &path, &path_len, &minor_version, headers, &num_headers, prev_len_);
+        if (res == -1) {
+            return ResultType::bad;
+        } else if (res == -2) {
+            prev_len_ = received_size;
+            return ResultType::indeterminate;
+        }
+
+        req.method.assign(method_name, method_len);
+        req.uri.assign(path, path_len);
+        req.http_version_minor = minor_version;
+
+        bool expect_request{false};
+        for (size_t i{0}; i < num_headers; ++i) {
+            const auto& header{headers[i]};
+            if (header.name_len == 0) continue;
+            const std::string_view name{header.name, header.name_len};
+            if (absl::EqualsIgnoreCase(name, "Content-Length")) {
+                uint32_t content_length{0};
+                const auto [_, ec] = std::from_chars(header.value, header.value + header.value_len, content_length);
+                if (ec != std::errc{}) {
+                    return ResultType::bad;
+                }
+                req.content_length = content_length;
+            } else if (absl::EqualsIgnoreCase(name, "Expect")) {
+                expect_request = true;
+            } else if (is_retained_header(name)) {
+                req.headers.emplace_back();
+                req.headers.back().name.assign(header.name, header.name_len);
+                req.headers.back().value.assign(header.value, header.value_len);
             }
         }
-    }
+        head_len_ = static_cast<std::size_t>(res);
+        content_length_ = req.content_length;
 
-    if (!content_length_present || req.content_length == 0) {
-        return ResultType::good;
+        if (expect_request && content_length_ > 0) {
+            return ResultType::processing_continue;
+        }
     }
 
-    req.content.resize(current_len - static_cast<size_t>(res));
-    std::memcpy(req.content.data(), begin + res, current_len - static_cast<size_t>(res));
-
-    if (expect_request) {
-        return ResultType::processing_continue;
-    } else if (req.content.length() < req.content_length) {
+    if (received_size < head_len_ + content_length_) {
         return ResultType::indeterminate;
-    } else {
-        return ResultType::good;
     }
+
+    req.content.assign(data + head_len_, content_length_);
+    consume(head_len_ + content_length_);
+    return ResultType::good;
 }
 
 }  // namespace silkworm::rpc::http
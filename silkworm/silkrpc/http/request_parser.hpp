@@ -16,6 +16,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
+#include <boost/asio/buffer.hpp>
+
 #include "request.hpp"
 
 namespace silkworm::rpc::http {
@@ -33,18 +38,46 @@ class RequestParser {
     };
 
     /**
-     * Parse some data. The enum return value is good when a complete request has
-     * been parsed, bad if the data is invalid, indeterminate when more data is
-     * required. The InputIterator return value indicates how much of the input
-     * has been consumed.
+     * Append some data to the received one and parse the next request. The enum
+     * return value is good when a complete request has been parsed, bad if the
+     * data is invalid, indeterminate when more data is required. Any data following
+     * a complete request is kept for the next pipelined request(s).
      */
     ResultType parse(Request& req, const char* begin, const char* end);
 
+    //! Parse the next request out of the data received so far.
+    ResultType parse(Request& req);
+
+    /**
+     * Get a buffer of at least min_size bytes to read data into, placed after the
+     * data received so far. The buffer grows as needed, up to the whole content
+     * of the current request if its length is known.
+     */
+    boost::asio::mutable_buffer prepare(std::size_t min_size);
+
+    //! Mark as received the given number of bytes read into the buffer got from prepare.
+    void commit(std::size_t size);
+
+    //! Discard both the current request and any data received.
     void reset();
 
   private:
-    uint64_t prev_len_{0};
+    //! Drop the current request from the data received
+    void consume(std::size_t size);
+
+    //! The data received and not yet parsed is in [begin_, end_)
     std::vector<char> buffer_;
+    std::size_t begin_{0};
+    std::size_t end_{0};
+
+    //! The request head size already checked by previous incomplete parsing
+    std::size_t prev_len_{0};
+
+    //! The request head size once completely parsed, zero otherwise
+    std::size_t head_len_{0};
+
+    //! The request content length once the request head has been parsed
+    std::size_t content_length_{0};
 };
 
 }  // namespace silkworm::rpc::http
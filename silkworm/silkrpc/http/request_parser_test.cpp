@@ -16,7 +16,9 @@
 
 #include "request_parser.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -159,6 +161,26 @@ TEST_CASE("parse", "[silkrpc][http][request_parser]") {
         }
     }
 
+    SECTION("websocket upgrade request") {
+        std::string s{
+            "GET / HTTP/1.1\r\nHost: localhost:8545\r\nupgrade: websocket\r\nConnection: Upgrade\r\n"
+            "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\nOrigin: http://localhost\r\n\r\n"};
+        RequestParser parser;
+        Request req;
+        const auto result{parser.parse(req, s.data(), s.data() + s.size())};
+        CHECK(result == RequestParser::ResultType::good);
+        CHECK(req.method == "GET");
+        CHECK(req.uri == "/");
+        REQUIRE(req.headers.size() == 5);
+        CHECK(req.headers[0].name == "upgrade");
+        CHECK(req.headers[0].value == "websocket");
+        CHECK(req.headers[1].name == "Connection");
+        CHECK(req.headers[2].name == "Sec-WebSocket-Key");
+        CHECK(req.headers[3].value == "13");
+        CHECK(req.headers[4].name == "Origin");
+        CHECK(req.headers[4].value == "http://localhost");
+    }
+
     SECTION("segemented http request 2 segs") {
         std::string seg1{"POST / HTTP/1.9\r\nHost: localhost:8545\r\n User-Agent: curl/7.68.0\r\n Accept: */*\r\n"};
         std::string seg2{"Content-Type: application/json\r\nContent-Length: 0\r\n\r\n}"};
@@ -217,6 +239,72 @@ TEST_CASE("parse", "[silkrpc][http][request_parser]") {
     }
 }
 
+TEST_CASE("parse pipelined requests", "[silkrpc][http][request_parser]") {
+    const std::string req1{"POST / HTTP/1.1\r\nContent-Length: 15\r\n\r\n{\"json\": \"2.0\"}"};
+    const std::string req2{"POST / HTTP/1.1\r\nAccept-Encoding: gzip\r\nContent-Length: 2\r\n\r\n{}"};
+    const std::string req3{"POST / HTTP/1.1\r\nContent-Length: 0\r\n\r\n"};
+    RequestParser parser;
+
+    SECTION("received at once") {
+        const std::string data{req1 + req2 + req3};
+        Request req;
+        CHECK(parser.parse(req, data.data(), data.data() + data.size()) == RequestParser::ResultType::good);
+        CHECK(req.content == "{\"json\": \"2.0\"}");
+        req.reset();
+        CHECK(parser.parse(req) == RequestParser::ResultType::good);
+        CHECK(req.content == "{}");
+        REQUIRE(req.headers.size() == 1);
+        CHECK(req.headers[0] == Header{"Accept-Encoding", "gzip"});
+        req.reset();
+        CHECK(parser.parse(req) == RequestParser::ResultType::good);
+        CHECK(req.content.empty());
+        req.reset();
+        CHECK(parser.parse(req) == RequestParser::ResultType::indeterminate);
+    }
+
+    SECTION("split across requests") {
+        const std::string data{req1 + req2};
+        const std::size_t split_position{req1.size() + 10};
+        Request req;
+        CHECK(parser.parse(req, data.data(), data.data() + split_position) == RequestParser::ResultType::good);
+        req.reset();
+        CHECK(parser.parse(req) == RequestParser::ResultType::indeterminate);
+        CHECK(parser.parse(req, data.data() + split_position, data.data() + data.size()) == RequestParser::ResultType::good);
+        CHECK(req.content == "{}");
+    }
+
+    SECTION("reset discards pipelined requests") {
+        const std::string data{req1 + req2};
+        Request req;
+        CHECK(parser.parse(req, data.data(), data.data() + data.size()) == RequestParser::ResultType::good);
+        parser.reset();
+        req.reset();
+        CHECK(parser.parse(req) == RequestParser::ResultType::indeterminate);
+    }
+}
+
+TEST_CASE("parse into prepared buffer", "[silkrpc][http][request_parser]") {
+    const std::string content(1'000'000, 'x');
+    const std::string data{"POST / HTTP/1.1\r\nContent-Length: " + std::to_string(content.size()) + "\r\n\r\n" + content};
+    RequestParser parser;
+    Request req;
+
+    std::size_t offset{0};
+    RequestParser::ResultType result{RequestParser::ResultType::indeterminate};
+    while (result == RequestParser::ResultType::indeterminate && offset < data.size()) {
+        const auto buffer{parser.prepare(8192)};
+        REQUIRE(buffer.size() >= 8192);
+        const auto size{std::min(buffer.size(), data.size() - offset)};
+        std::memcpy(buffer.data(), data.data() + offset, size);
+        parser.commit(size);
+        offset += size;
+        result = parser.parse(req);
+    }
+    CHECK(result == RequestParser::ResultType::good);
+    CHECK(req.content_length == content.size());
+    CHECK(req.content == content);
+}
+
 TEST_CASE("reset", "[silkrpc][http][request_parser]") {
     RequestParser parser;
 
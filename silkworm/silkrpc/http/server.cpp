@@ -31,6 +31,7 @@
 #include <boost/asio/use_awaitable.hpp>
 
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/silkrpc/common/constants.hpp>
 #include <silkworm/silkrpc/http/connection.hpp>
 
@@ -51,14 +52,20 @@ Server::Server(const std::string& end_point,
                const std::string& api_spec,
                boost::asio::io_context& io_context,
                boost::asio::thread_pool& workers,
+               const ExecutionLanes& execution_lanes,
                std::vector<std::string> allowed_origins,
-               std::optional<std::string> jwt_secret)
-    : rpc_api_{io_context, workers},
+               std::optional<std::string> jwt_secret,
+               bool ws_enabled)
+    : rpc_api_{io_context, workers, execution_lanes},
       handler_table_{api_spec},
       io_context_(io_context),
       acceptor_{io_context},
       allowed_origins_{allowed_origins},
       jwt_secret_(std::move(jwt_secret)) {
+    if (ws_enabled) {
+        subscription_manager_ = must_use_shared_service<SubscriptionManager>(io_context_);
+    }
+
     const auto [host, port] = parse_endpoint(end_point);
 
     // Open the acceptor with the option to reuse the address (i.e. SO_REUSEADDR).
@@ -83,7 +90,7 @@ Task<void> Server::run() {
         while (acceptor_.is_open()) {
             SILK_DEBUG << "Server::run accepting using io_context " << &io_context_ << "...";
 
-            auto new_connection = std::make_shared<Connection>(io_context_, rpc_api_, handler_table_, allowed_origins_, jwt_secret_);
+            auto new_connection = std::make_shared<Connection>(io_context_, rpc_api_, handler_table_, allowed_origins_, jwt_secret_, subscription_manager_);
             co_await acceptor_.async_accept(new_connection->socket(), boost::asio::use_awaitable);
             if (!acceptor_.is_open()) {
                 SILK_TRACE << "Server::run returning...";
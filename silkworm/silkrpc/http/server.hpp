@@ -34,6 +34,8 @@
 
 #include <silkworm/infra/grpc/client/client_context_pool.hpp>
 #include <silkworm/silkrpc/commands/rpc_api_table.hpp>
+#include <silkworm/silkrpc/common/execution_lanes.hpp>
+#include <silkworm/silkrpc/core/subscription_manager.hpp>
 #include <silkworm/silkrpc/http/request_handler.hpp>
 
 namespace silkworm::rpc::http {
@@ -44,13 +46,15 @@ class Server {
     Server(const Server&) = delete;
     Server& operator=(const Server&) = delete;
 
-    // Construct the server to listen on the specified local TCP end-point
+    // Construct the server to listen on the specified local TCP end-point, optionally accepting WebSocket upgrades
     explicit Server(const std::string& end_point,
                     const std::string& api_spec,
                     boost::asio::io_context& io_context,
                     boost::asio::thread_pool& workers,
+                    const ExecutionLanes& execution_lanes,
                     std::vector<std::string> allowed_origins,
-                    std::optional<std::string> jwt_secret);
+                    std::optional<std::string> jwt_secret,
+                    bool ws_enabled = false);
 
     void start();
 
@@ -78,6 +82,9 @@ class Server {
 
     //! The JSON Web Token (JWT) secret for secure channel communication
     std::optional<std::string> jwt_secret_;
+
+    //! The manager of eth_subscribe subscriptions or \code nullptr if WebSocket is disabled
+    SubscriptionManager* subscription_manager_{nullptr};
 };
 
 }  // namespace silkworm::rpc::http
@@ -0,0 +1,585 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "buffer_writer.hpp"
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <variant>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/silkrpc/common/compatibility.hpp>
+#include <silkworm/silkrpc/common/util.hpp>
+
+namespace silkworm::rpc {
+
+static constexpr std::string_view kHexDigits{"0123456789abcdef"};
+
+//! Lookup table giving the two lowercase hex digits of each byte value
+static constexpr auto kHexByteTable = []() {
+    std::array<char, 512> table{};
+    for (std::size_t b{0}; b < 256; ++b) {
+        table[2 * b] = kHexDigits[b >> 4];
+        table[2 * b + 1] = kHexDigits[b & 0x0f];
+    }
+    return table;
+}();
+
+void JsonBufferWriter::separate() {
+    if (need_comma_) {
+        buffer_.push_back(',');
+    }
+    need_comma_ = true;
+}
+
+void JsonBufferWriter::begin_object() {
+    separate();
+    buffer_.push_back('{');
+    need_comma_ = false;
+}
+
+void JsonBufferWriter::end_object() {
+    buffer_.push_back('}');
+    need_comma_ = true;
+}
+
+void JsonBufferWriter::begin_array() {
+    separate();
+    buffer_.push_back('[');
+    need_comma_ = false;
+}
+
+void JsonBufferWriter::end_array() {
+    buffer_.push_back(']');
+    need_comma_ = true;
+}
+
+void JsonBufferWriter::key(std::string_view name) {
+    separate();
+    buffer_.push_back('"');
+    buffer_.append(name);
+    buffer_.append("\":");
+    need_comma_ = false;
+}
+
+void JsonBufferWriter::value_null() {
+    separate();
+    buffer_.append("null");
+}
+
+void JsonBufferWriter::value_bool(bool value) {
+    separate();
+    buffer_.append(value ? "true" : "false");
+}
+
+void JsonBufferWriter::value_number(int64_t value) {
+    separate();
+    std::array<char, 24> digits{};
+    const auto result{std::to_chars(digits.data(), digits.data() + digits.size(), value)};
+    buffer_.append(digits.data(), result.ptr);
+}
+
+void JsonBufferWriter::value_number(uint64_t value) {
+    separate();
+    std::array<char, 24> digits{};
+    const auto result{std::to_chars(digits.data(), digits.data() + digits.size(), value)};
+    buffer_.append(digits.data(), result.ptr);
+}
+
+void JsonBufferWriter::value_string(std::string_view value) {
+    separate();
+    buffer_.push_back('"');
+    for (const char c : value) {
+        switch (c) {
+            case '"':
+                buffer_.append("\\\"");
+                break;
+            case '\\':
+                buffer_.append("\\\\");
+                break;
+            case '\b':
+                buffer_.append("\\b");
+                break;
+            case '\f':
+                buffer_.append("\\f");
+                break;
+            case '\n':
+                buffer_.append("\\n");
+                break;
+            case '\r':
+                buffer_.append("\\r");
+                break;
+            case '\t':
+                buffer_.append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    buffer_.append("\\u00");
+                    buffer_.push_back(kHexDigits[static_cast<unsigned char>(c) >> 4]);
+                    buffer_.push_back(kHexDigits[static_cast<unsigned char>(c) & 0x0f]);
+                } else {
+                    buffer_.push_back(c);
+                }
+        }
+    }
+    buffer_.push_back('"');
+}
+
+void JsonBufferWriter::value_hex(ByteView bytes) {
+    separate();
+    const auto offset{buffer_.size()};
+    buffer_.resize(offset + 2 * bytes.size() + 4);
+    char* dest{buffer_.data() + offset};
+    *dest++ = '"';
+    *dest++ = '0';
+    *dest++ = 'x';
+    for (const auto b : bytes) {
+        *dest++ = kHexByteTable[2 * b];
+        *dest++ = kHexByteTable[2 * b + 1];
+    }
+    *dest = '"';
+}
+
+void JsonBufferWriter::value_quantity(uint64_t value) {
+    separate();
+    buffer_.append("\"0x");
+    if (value == 0) {
+        buffer_.append("0\"");
+        return;
+    }
+    const auto num_digits{16 - std::countl_zero(value) / 4};
+    const auto offset{buffer_.size()};
+    buffer_.resize(offset + static_cast<std::size_t>(num_digits) + 1);
+    char* dest{buffer_.data() + offset};
+    for (int i{num_digits - 1}; i >= 0; --i) {
+        *dest++ = kHexDigits[(value >> (4 * i)) & 0x0f];
+    }
+    *dest = '"';
+}
+
+void JsonBufferWriter::value_quantity(const intx::uint256& value) {
+    separate();
+    buffer_.append("\"0x");
+    if (value == 0) {
+        buffer_.append("0\"");
+        return;
+    }
+    // Words are stored least significant first: the most significant non-zero one has no leading zeros
+    std::size_t top_word{intx::uint256::num_words - 1};
+    while (value[top_word] == 0) {
+        --top_word;
+    }
+    const auto top_digits{16 - std::countl_zero(value[top_word]) / 4};
+    const auto offset{buffer_.size()};
+    buffer_.resize(offset + static_cast<std::size_t>(top_digits) + 16 * top_word + 1);
+    char* dest{buffer_.data() + offset};
+    for (int i{top_digits - 1}; i >= 0; --i) {
+        *dest++ = kHexDigits[(value[top_word] >> (4 * i)) & 0x0f];
+    }
+    for (std::size_t w{top_word}; w > 0; --w) {
+        const uint64_t word{value[w - 1]};
+        for (int i{15}; i >= 0; --i) {
+            *dest++ = kHexDigits[(word >> (4 * i)) & 0x0f];
+        }
+    }
+    *dest = '"';
+}
+
+void write_json(JsonBufferWriter& writer, const Log& log) {
+    writer.begin_object();
+    writer.key("address");
+    writer.value_hex(log.address);
+    writer.key("blockHash");
+    writer.value_hex(log.block_hash);
+    writer.key("blockNumber");
+    writer.value_quantity(log.block_number);
+    writer.key("data");
+    writer.value_hex(log.data);
+    writer.key("logIndex");
+    writer.value_quantity(log.index);
+    writer.key("removed");
+    writer.value_bool(log.removed);
+    if (log.timestamp) {
+        writer.key("timestamp");
+        writer.value_quantity(*log.timestamp);
+    }
+    writer.key("topics");
+    writer.begin_array();
+    for (const auto& topic : log.topics) {
+        writer.value_hex(topic);
+    }
+    writer.end_array();
+    writer.key("transactionHash");
+    writer.value_hex(log.tx_hash);
+    writer.key("transactionIndex");
+    writer.value_quantity(log.tx_index);
+    writer.end_object();
+}
+
+void write_json(JsonBufferWriter& writer, const Receipt& receipt) {
+    writer.begin_object();
+    writer.key("blockHash");
+    writer.value_hex(receipt.block_hash);
+    writer.key("blockNumber");
+    writer.value_quantity(receipt.block_number);
+    writer.key("contractAddress");
+    if (receipt.contract_address) {
+        writer.value_hex(receipt.contract_address);
+    } else {
+        writer.value_null();
+    }
+    writer.key("cumulativeGasUsed");
+    writer.value_quantity(receipt.cumulative_gas_used);
+    writer.key("effectiveGasPrice");
+    writer.value_quantity(receipt.effective_gas_price);
+    writer.key("from");
+    writer.value_hex(receipt.from.value_or(evmc::address{}));
+    writer.key("gasUsed");
+    writer.value_quantity(receipt.gas_used);
+    writer.key("logs");
+    write_json(writer, receipt.logs);
+    writer.key("logsBloom");
+    writer.value_hex(full_view(receipt.bloom));
+    writer.key("status");
+    writer.value_quantity(uint64_t{receipt.success ? 1u : 0u});
+    writer.key("to");
+    if (receipt.to) {
+        writer.value_hex(*receipt.to);
+    } else {
+        writer.value_null();
+    }
+    writer.key("transactionHash");
+    writer.value_hex(receipt.tx_hash);
+    writer.key("transactionIndex");
+    writer.value_quantity(uint64_t{receipt.tx_index});
+    writer.key("type");
+    writer.value_quantity(uint64_t{receipt.type.value_or(0)});
+    writer.end_object();
+}
+
+//! Location of the transaction in its block, missing for transactions still in the pool
+struct TransactionLocation {
+    const evmc::bytes32& block_hash;
+    BlockNum block_number;
+    uint64_t transaction_index;
+};
+
+static void write_transaction(JsonBufferWriter& writer, const silkworm::Transaction& transaction, const intx::uint256& gas_price,
+                              const std::optional<TransactionLocation>& location) {
+    if (!transaction.from) {
+        (const_cast<silkworm::Transaction&>(transaction)).recover_sender();
+    }
+    const bool is_legacy{transaction.type == silkworm::TransactionType::kLegacy};
+
+    writer.begin_object();
+    if (!is_legacy) {
+        writer.key("accessList");
+        writer.begin_array();
+        for (const auto& entry : transaction.access_list) {
+            writer.begin_object();
+            writer.key("address");
+            writer.value_hex(entry.account);
+            writer.key("storageKeys");
+            writer.begin_array();
+            for (const auto& storage_key : entry.storage_keys) {
+                writer.value_hex(storage_key);
+            }
+            writer.end_array();
+            writer.end_object();
+        }
+        writer.end_array();
+    }
+    writer.key("blockHash");
+    if (location) {
+        writer.value_hex(location->block_hash);
+    } else {
+        writer.value_null();
+    }
+    writer.key("blockNumber");
+    if (location) {
+        writer.value_quantity(location->block_number);
+    } else {
+        writer.value_null();
+    }
+    if (!is_legacy) {
+        writer.key("chainId");
+        writer.value_quantity(*transaction.chain_id);
+    } else if (transaction.chain_id) {
+        writer.key("chainId");
+        writer.value_quantity(*transaction.chain_id);
+    }
+    if (transaction.from) {
+        writer.key("from");
+        writer.value_hex(*transaction.from);
+    }
+    writer.key("gas");
+    writer.value_quantity(transaction.gas_limit);
+    writer.key("gasPrice");
+    writer.value_quantity(gas_price);
+    writer.key("hash");
+    const auto ethash_hash{hash_of_transaction(transaction)};
+    writer.value_hex(full_view(ethash_hash));
+    writer.key("input");
+    writer.value_hex(transaction.data);
+    if (transaction.type == silkworm::TransactionType::kDynamicFee) {
+        writer.key("maxFeePerGas");
+        writer.value_quantity(transaction.max_fee_per_gas);
+        writer.key("maxPriorityFeePerGas");
+        writer.value_quantity(transaction.max_priority_fee_per_gas);
+    }
+    writer.key("nonce");
+    writer.value_quantity(transaction.nonce);
+    writer.key("r");
+    writer.value_quantity(transaction.r);
+    writer.key("s");
+    writer.value_quantity(transaction.s);
+    writer.key("to");
+    if (transaction.to) {
+        writer.value_hex(*transaction.to);
+    } else {
+        writer.value_null();
+    }
+    writer.key("transactionIndex");
+    if (location) {
+        writer.value_quantity(location->transaction_index);
+    } else {
+        writer.value_null();
+    }
+    writer.key("type");
+    writer.value_quantity(static_cast<uint64_t>(transaction.type));
+    writer.key("v");
+    if (!is_legacy) {
+        writer.value_quantity(uint64_t{transaction.odd_y_parity});
+    } else {
+        writer.value_quantity(transaction.v());
+    }
+    writer.key("value");
+    writer.value_quantity(transaction.value);
+    // Erigon currently at 2.48.1 does not yet support yParity field
+    if (!is_legacy && !compatibility::is_erigon_json_api_compatibility_required()) {
+        writer.key("yParity");
+        writer.value_quantity(uint64_t{transaction.odd_y_parity});
+    }
+    writer.end_object();
+}
+
+void write_json(JsonBufferWriter& writer, const Transaction& transaction) {
+    std::optional<TransactionLocation> location;
+    if (!transaction.queued_in_pool) {
+        location.emplace(TransactionLocation{transaction.block_hash, transaction.block_number, transaction.transaction_index});
+    }
+    write_transaction(writer, transaction, transaction.effective_gas_price(), location);
+}
+
+void write_json(JsonBufferWriter& writer, const Block& b) {
+    const auto& header{b.block.header};
+
+    writer.begin_object();
+    if (header.base_fee_per_gas) {
+        writer.key("baseFeePerGas");
+        writer.value_quantity(*header.base_fee_per_gas);
+    }
+    writer.key("difficulty");
+    writer.value_quantity(header.difficulty);
+    writer.key("extraData");
+    writer.value_hex(header.extra_data);
+    writer.key("gasLimit");
+    writer.value_quantity(header.gas_limit);
+    writer.key("gasUsed");
+    writer.value_quantity(header.gas_used);
+    writer.key("hash");
+    writer.value_hex(b.hash);
+    writer.key("logsBloom");
+    writer.value_hex(full_view(header.logs_bloom));
+    writer.key("miner");
+    writer.value_hex(header.beneficiary);
+    writer.key("mixHash");
+    writer.value_hex(header.prev_randao);
+    writer.key("nonce");
+    writer.value_hex(ByteView{header.nonce.data(), header.nonce.size()});
+    writer.key("number");
+    writer.value_quantity(header.number);
+    writer.key("parentHash");
+    writer.value_hex(header.parent_hash);
+    writer.key("receiptsRoot");
+    writer.value_hex(header.receipts_root);
+    writer.key("sha3Uncles");
+    writer.value_hex(header.ommers_hash);
+    writer.key("size");
+    writer.value_quantity(b.get_block_size());
+    writer.key("stateRoot");
+    writer.value_hex(header.state_root);
+    writer.key("timestamp");
+    writer.value_quantity(header.timestamp);
+    writer.key("totalDifficulty");
+    writer.value_quantity(b.total_difficulty);
+    writer.key("transactions");
+    writer.begin_array();
+    const auto base_fee_per_gas{header.base_fee_per_gas.value_or(0)};
+    for (std::size_t i{0}; i < b.block.transactions.size(); ++i) {
+        const auto& transaction{b.block.transactions[i]};
+        if (b.full_tx) {
+            write_transaction(writer, transaction, transaction.effective_gas_price(base_fee_per_gas),
+                              TransactionLocation{b.hash, header.number, i});
+        } else {
+            const auto ethash_hash{hash_of_transaction(transaction)};
+            writer.value_hex(full_view(ethash_hash));
+        }
+    }
+    writer.end_array();
+    writer.key("transactionsRoot");
+    writer.value_hex(header.transactions_root);
+    writer.key("uncles");
+    writer.begin_array();
+    for (const auto& ommer : b.block.ommers) {
+        writer.value_hex(ommer.hash());
+    }
+    writer.end_array();
+    if (b.block.withdrawals) {
+        writer.key("withdrawals");
+        writer.begin_array();
+        for (const auto& withdrawal : *b.block.withdrawals) {
+            writer.begin_object();
+            writer.key("address");
+            writer.value_hex(withdrawal.address);
+            writer.key("amount");
+            writer.value_quantity(withdrawal.amount);
+            writer.key("index");
+            writer.value_quantity(withdrawal.index);
+            writer.key("validatorIndex");
+            writer.value_quantity(withdrawal.validator_index);
+            writer.end_object();
+        }
+        writer.end_array();
+    }
+    if (header.withdrawals_root) {
+        writer.key("withdrawalsRoot");
+        writer.value_hex(*header.withdrawals_root);
+    }
+    writer.end_object();
+}
+
+static void write_action(JsonBufferWriter& writer, const trace::TraceAction& action) {
+    writer.begin_object();
+    if (action.call_type) {
+        writer.key("callType");
+        writer.value_string(*action.call_type);
+    }
+    writer.key("from");
+    writer.value_hex(action.from);
+    writer.key("gas");
+    writer.value_quantity(static_cast<uint64_t>(action.gas));
+    if (action.init) {
+        writer.key("init");
+        writer.value_hex(*action.init);
+    }
+    if (action.input) {
+        writer.key("input");
+        writer.value_hex(*action.input);
+    }
+    if (action.to) {
+        writer.key("to");
+        writer.value_hex(*action.to);
+    }
+    writer.key("value");
+    writer.value_quantity(action.value);
+    writer.end_object();
+}
+
+static void write_action(JsonBufferWriter& writer, const trace::RewardAction& action) {
+    writer.begin_object();
+    writer.key("author");
+    writer.value_hex(action.author);
+    writer.key("rewardType");
+    writer.value_string(action.reward_type);
+    writer.key("value");
+    writer.value_quantity(action.value);
+    writer.end_object();
+}
+
+void write_json(JsonBufferWriter& writer, const trace::Trace& trace) {
+    writer.begin_object();
+    writer.key("action");
+    std::visit([&](const auto& action) { write_action(writer, action); }, trace.action);
+    if (trace.block_hash) {
+        writer.key("blockHash");
+        writer.value_hex(*trace.block_hash);
+    }
+    if (trace.block_number) {
+        writer.key("blockNumber");
+        writer.value_number(uint64_t{*trace.block_number});
+    }
+    if (trace.error) {
+        writer.key("error");
+        writer.value_string(*trace.error);
+    }
+    writer.key("result");
+    if (trace.trace_result) {
+        const auto& result{*trace.trace_result};
+        writer.begin_object();
+        if (result.address) {
+            writer.key("address");
+            writer.value_hex(*result.address);
+        }
+        if (result.code) {
+            writer.key("code");
+            writer.value_hex(*result.code);
+        }
+        writer.key("gasUsed");
+        writer.value_quantity(static_cast<uint64_t>(result.gas_used));
+        if (result.output) {
+            writer.key("output");
+            writer.value_hex(*result.output);
+        }
+        writer.end_object();
+    } else {
+        writer.value_null();
+    }
+    writer.key("subtraces");
+    writer.value_number(int64_t{trace.sub_traces});
+    writer.key("traceAddress");
+    writer.begin_array();
+    for (const auto index : trace.trace_address) {
+        writer.value_number(int64_t{index});
+    }
+    writer.end_array();
+    if (trace.transaction_hash) {
+        writer.key("transactionHash");
+        writer.value_hex(*trace.transaction_hash);
+    }
+    if (trace.transaction_position) {
+        writer.key("transactionPosition");
+        writer.value_number(uint64_t{*trace.transaction_position});
+    }
+    writer.key("type");
+    writer.value_string(trace.type);
+    writer.end_object();
+}
+
+void make_buffer_json_content(std::string& reply, uint32_t id) {
+    JsonBufferWriter writer{reply};
+    writer.begin_object();
+    writer.key("id");
+    writer.value_number(uint64_t{id});
+    writer.key("jsonrpc");
+    writer.value_string("2.0");
+    writer.key("result");
+    writer.value_null();
+    writer.end_object();
+}
+
+}  // namespace silkworm::rpc
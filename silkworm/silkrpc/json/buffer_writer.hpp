@@ -0,0 +1,111 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <evmc/evmc.hpp>
+#include <intx/intx.hpp>
+
+#include <silkworm/core/common/bytes.hpp>
+#include <silkworm/silkrpc/core/evm_trace.hpp>
+#include <silkworm/silkrpc/types/block.hpp>
+#include <silkworm/silkrpc/types/log.hpp>
+#include <silkworm/silkrpc/types/receipt.hpp>
+#include <silkworm/silkrpc/types/transaction.hpp>
+
+namespace silkworm::rpc {
+
+//! JsonBufferWriter appends compact JSON text straight into the output buffer, without building any DOM.
+//! Separators are handled automatically, so the caller just has to emit keys and values in the right order.
+class JsonBufferWriter {
+  public:
+    explicit JsonBufferWriter(std::string& buffer) : buffer_{buffer} {}
+
+    JsonBufferWriter(const JsonBufferWriter&) = delete;
+    JsonBufferWriter& operator=(const JsonBufferWriter&) = delete;
+
+    void begin_object();
+    void end_object();
+    void begin_array();
+    void end_array();
+
+    //! Write the object key, which must be a plain string not requiring any escape
+    void key(std::string_view name);
+
+    void value_null();
+    void value_bool(bool value);
+    void value_number(int64_t value);
+    void value_number(uint64_t value);
+
+    //! Write the string value escaped as per JSON specification
+    void value_string(std::string_view value);
+
+    //! Write the bytes as 0x-prefixed hex string (e.g. data, hash, address)
+    void value_hex(ByteView bytes);
+    void value_hex(const evmc::address& address) { value_hex(ByteView{address.bytes}); }
+    void value_hex(const evmc::bytes32& hash) { value_hex(ByteView{hash.bytes}); }
+
+    //! Write the number as 0x-prefixed hex quantity without leading zeros (e.g. 0x0, 0x1a)
+    void value_quantity(uint64_t value);
+    void value_quantity(const intx::uint256& value);
+
+  private:
+    void separate();
+
+    std::string& buffer_;
+    bool need_comma_{false};
+};
+
+//! Direct-to-buffer serialization of the hot RPC response types, producing exactly the same JSON text as nlohmann
+//! (i.e. the same keys in the same alphabetical order) but much faster
+void write_json(JsonBufferWriter& writer, const Log& log);
+void write_json(JsonBufferWriter& writer, const Receipt& receipt);
+void write_json(JsonBufferWriter& writer, const Transaction& transaction);
+void write_json(JsonBufferWriter& writer, const Block& block);
+void write_json(JsonBufferWriter& writer, const trace::Trace& trace);
+
+template <typename T>
+void write_json(JsonBufferWriter& writer, const std::vector<T>& items) {
+    writer.begin_array();
+    for (const auto& item : items) {
+        write_json(writer, item);
+    }
+    writer.end_array();
+}
+
+//! Write the JSON RPC reply having null result
+void make_buffer_json_content(std::string& reply, uint32_t id);
+
+//! Write the JSON RPC reply having the given result
+template <typename T>
+void make_buffer_json_content(std::string& reply, uint32_t id, const T& result) {
+    JsonBufferWriter writer{reply};
+    writer.begin_object();
+    writer.key("id");
+    writer.value_number(uint64_t{id});
+    writer.key("jsonrpc");
+    writer.value_string("2.0");
+    writer.key("result");
+    write_json(writer, result);
+    writer.end_object();
+}
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,212 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <evmc/evmc.hpp>
+#include <nlohmann/json.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/silkrpc/json/block.hpp>
+#include <silkworm/silkrpc/json/buffer_writer.hpp>
+#include <silkworm/silkrpc/json/log.hpp>
+#include <silkworm/silkrpc/json/receipt.hpp>
+#include <silkworm/silkrpc/json/transaction.hpp>
+
+namespace silkworm::rpc {
+
+namespace {
+
+using evmc::literals::operator""_address, evmc::literals::operator""_bytes32;
+
+constexpr size_t kNumBlockTransactions{150};
+
+Log sample_log() {
+    return Log{
+        .address = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address,
+        .topics = {0xddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef_bytes32,
+                   0x000000000000000000000000e0a2bd4258d2768837baa26a28fe71dc079f84c7_bytes32,
+                   0x0000000000000000000000000715a7794a1dc8e42615f059dd6e406a6594651a_bytes32},
+        .data = Bytes(32, 0xff),
+        .block_number = 17'000'000,
+        .tx_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126e_bytes32,
+        .tx_index = 12,
+        .block_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32,
+        .index = 3,
+    };
+}
+
+Receipt sample_receipt() {
+    Receipt receipt{
+        .success = true,
+        .cumulative_gas_used = 12'345'678,
+        .logs = {sample_log(), sample_log()},
+        .tx_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126e_bytes32,
+        .gas_used = 51'234,
+        .block_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32,
+        .block_number = 17'000'000,
+        .tx_index = 12,
+        .from = 0xe0a2bd4258d2768837baa26a28fe71dc079f84c7_address,
+        .to = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address,
+        .type = 2,
+        .effective_gas_price = 30 * kGiga,
+    };
+    receipt.bloom = bloom_from_logs(receipt.logs);
+    return receipt;
+}
+
+silkworm::Transaction sample_transaction() {
+    silkworm::Transaction txn{};
+    txn.type = TransactionType::kDynamicFee;
+    txn.nonce = 172'339;
+    txn.max_priority_fee_per_gas = 2 * kGiga;
+    txn.max_fee_per_gas = 50 * kGiga;
+    txn.gas_limit = 90'000;
+    txn.to = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address;
+    txn.value = 1'027'501'080 * kGiga;
+    txn.data = *from_hex("a9059cbb000000000000000000000000e0a2bd4258d2768837baa26a28fe71dc079f84c7"
+                         "00000000000000000000000000000000000000000000000000000000000f4240");
+    [[maybe_unused]] const bool valid_v{txn.set_v(37)};
+    txn.r = intx::from_string<intx::uint256>("0x48b55bfa915ac795c431978d8a6a992b628d557da5ff759b307d495a36649353");
+    txn.s = intx::from_string<intx::uint256>("0x1fffd310ac743f371de3b9f7f9cb56c0b28ad43601b4ab949f53faa07bd2c804");
+    txn.from = 0xe0a2bd4258d2768837baa26a28fe71dc079f84c7_address;
+    return txn;
+}
+
+rpc::Transaction sample_rpc_transaction() {
+    rpc::Transaction txn{sample_transaction()};
+    txn.block_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32;
+    txn.block_number = 17'000'000;
+    txn.block_base_fee_per_gas = 15 * kGiga;
+    txn.transaction_index = 12;
+    return txn;
+}
+
+Block sample_block() {
+    Block block;
+    block.hash = 0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32;
+    block.total_difficulty = intx::from_string<intx::uint256>("0xc70d815d562d3cfa955");
+    block.full_tx = true;
+    auto& header{block.block.header};
+    header.parent_hash = 0x474f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126d_bytes32;
+    header.beneficiary = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address;
+    header.number = 17'000'000;
+    header.gas_limit = 30'000'000;
+    header.gas_used = 15'000'000;
+    header.timestamp = 1'681'338'455;
+    header.extra_data = *from_hex("6265617665726275696c642e6f7267");
+    header.base_fee_per_gas = 15 * kGiga;
+    block.block.transactions.resize(kNumBlockTransactions, sample_transaction());
+    return block;
+}
+
+trace::Trace sample_trace() {
+    trace::Trace trace;
+    trace.action = trace::TraceAction{
+        .call_type = "call",
+        .from = 0xe0a2bd4258d2768837baa26a28fe71dc079f84c7_address,
+        .to = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address,
+        .gas = 81'234,
+        .input = sample_transaction().data,
+        .value = 0,
+    };
+    trace.trace_result = trace::TraceResult{.output = Bytes(32, 0x01), .gas_used = 51'234};
+    trace.trace_address = {0, 1};
+    trace.type = "call";
+    trace.block_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32;
+    trace.block_number = 17'000'000;
+    trace.transaction_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126e_bytes32;
+    trace.transaction_position = 12;
+    return trace;
+}
+
+//! Current path: build the nlohmann DOM and dump it
+template <typename T>
+void serialize_nlohmann(benchmark::State& state, const T& object) {
+    for ([[maybe_unused]] auto _ : state) {
+        const nlohmann::json json = object;
+        benchmark::DoNotOptimize(json.dump());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+//! Direct path: write into the reusable output buffer
+template <typename T>
+void serialize_buffer_writer(benchmark::State& state, const T& object) {
+    std::string buffer;
+    for ([[maybe_unused]] auto _ : state) {
+        buffer.clear();
+        JsonBufferWriter writer{buffer};
+        write_json(writer, object);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+}  // namespace
+
+static void json_log_nlohmann(benchmark::State& state) {
+    serialize_nlohmann(state, sample_log());
+}
+BENCHMARK(json_log_nlohmann);
+
+static void json_log_buffer_writer(benchmark::State& state) {
+    serialize_buffer_writer(state, sample_log());
+}
+BENCHMARK(json_log_buffer_writer);
+
+static void json_receipt_nlohmann(benchmark::State& state) {
+    serialize_nlohmann(state, sample_receipt());
+}
+BENCHMARK(json_receipt_nlohmann);
+
+static void json_receipt_buffer_writer(benchmark::State& state) {
+    serialize_buffer_writer(state, sample_receipt());
+}
+BENCHMARK(json_receipt_buffer_writer);
+
+static void json_transaction_nlohmann(benchmark::State& state) {
+    serialize_nlohmann(state, sample_rpc_transaction());
+}
+BENCHMARK(json_transaction_nlohmann);
+
+static void json_transaction_buffer_writer(benchmark::State& state) {
+    serialize_buffer_writer(state, sample_rpc_transaction());
+}
+BENCHMARK(json_transaction_buffer_writer);
+
+static void json_block_full_tx_nlohmann(benchmark::State& state) {
+    serialize_nlohmann(state, sample_block());
+}
+BENCHMARK(json_block_full_tx_nlohmann);
+
+static void json_block_full_tx_buffer_writer(benchmark::State& state) {
+    serialize_buffer_writer(state, sample_block());
+}
+BENCHMARK(json_block_full_tx_buffer_writer);
+
+static void json_trace_nlohmann(benchmark::State& state) {
+    serialize_nlohmann(state, sample_trace());
+}
+BENCHMARK(json_trace_nlohmann);
+
+static void json_trace_buffer_writer(benchmark::State& state) {
+    serialize_buffer_writer(state, sample_trace());
+}
+BENCHMARK(json_trace_buffer_writer);
+
+}  // namespace silkworm::rpc
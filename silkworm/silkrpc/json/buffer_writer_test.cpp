@@ -0,0 +1,307 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "buffer_writer.hpp"
+
+#include <catch2/catch.hpp>
+#include <evmc/evmc.hpp>
+#include <nlohmann/json.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/silkrpc/json/block.hpp>
+#include <silkworm/silkrpc/json/log.hpp>
+#include <silkworm/silkrpc/json/receipt.hpp>
+#include <silkworm/silkrpc/json/transaction.hpp>
+#include <silkworm/silkrpc/json/types.hpp>
+
+namespace silkworm::rpc {
+
+using evmc::literals::operator""_address, evmc::literals::operator""_bytes32;
+
+template <typename T>
+static std::string write_buffer_json(const T& value) {
+    std::string buffer;
+    JsonBufferWriter writer{buffer};
+    write_json(writer, value);
+    return buffer;
+}
+
+static Log sample_log() {
+    return Log{
+        .address = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address,
+        .topics = {0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32,
+                   0x0000000000000000000000000000000000000000000000000000000000000001_bytes32},
+        .data = *silkworm::from_hex("0x00010203ff"),
+        .block_number = 5'405'021,
+        .tx_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126e_bytes32,
+        .tx_index = 12,
+        .block_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32,
+        .index = 3,
+        .removed = false,
+    };
+}
+
+static silkworm::Transaction sample_transaction(TransactionType type) {
+    silkworm::Transaction txn{};
+    txn.type = type;
+    txn.nonce = 172'339;
+    txn.max_priority_fee_per_gas = 5 * kGiga;
+    txn.max_fee_per_gas = 50 * kGiga;
+    txn.gas_limit = 90'000;
+    txn.to = 0xe5ef458d37212a06e3f59d40c454e76150ae7c32_address;
+    txn.value = 1'027'501'080 * kGiga;
+    txn.data = *silkworm::from_hex("602a6000556101c960015560068060166000396000f3600035600055");
+    if (type != TransactionType::kLegacy) {
+        txn.access_list = {{0xde0b295669a9fd93d5f28d9ec85e40f4cb697bae_address,
+                            {0x0000000000000000000000000000000000000000000000000000000000000003_bytes32}}};
+    }
+    REQUIRE(txn.set_v(37));
+    txn.r = intx::from_string<intx::uint256>("0x48b55bfa915ac795c431978d8a6a992b628d557da5ff759b307d495a36649353");
+    txn.s = intx::from_string<intx::uint256>("0x1fffd310ac743f371de3b9f7f9cb56c0b28ad43601b4ab949f53faa07bd2c804");
+    txn.from = 0x007fb8417eb9ad4d958b050fc3720d5b46a2c053_address;
+    return txn;
+}
+
+TEST_CASE("JsonBufferWriter", "[silkrpc][json][buffer_writer]") {
+    std::string buffer;
+    JsonBufferWriter writer{buffer};
+
+    SECTION("separators") {
+        writer.begin_object();
+        writer.key("a");
+        writer.begin_array();
+        writer.value_number(int64_t{-1});
+        writer.value_null();
+        writer.begin_object();
+        writer.end_object();
+        writer.value_bool(true);
+        writer.end_array();
+        writer.key("b");
+        writer.value_number(uint64_t{18'446'744'073'709'551'615u});
+        writer.end_object();
+        CHECK(buffer == R"({"a":[-1,null,{},true],"b":18446744073709551615})");
+    }
+
+    SECTION("string escape") {
+        writer.value_string("a\"b\\c\n\t\x01\x1f d");
+        CHECK(buffer == nlohmann::json("a\"b\\c\n\t\x01\x1f d").dump());
+    }
+
+    SECTION("hex") {
+        writer.begin_array();
+        writer.value_hex(ByteView{});
+        writer.value_hex(*silkworm::from_hex("0x00ff7f80"));
+        writer.value_hex(0x0715a7794a1dc8e42615f059dd6e406a6594651a_address);
+        writer.end_array();
+        CHECK(buffer == R"(["0x","0x00ff7f80","0x0715a7794a1dc8e42615f059dd6e406a6594651a"])");
+    }
+
+    SECTION("quantity") {
+        for (const uint64_t n : {uint64_t{0}, uint64_t{1}, uint64_t{0x10}, uint64_t{0xdeadbeef}, ~uint64_t{0}}) {
+            buffer.clear();
+            writer.value_quantity(n);
+            CHECK(buffer == "\"" + to_quantity(n) + "\"");
+        }
+        const std::vector<intx::uint256> numbers{
+            0,
+            1,
+            intx::uint256{1} << 64,
+            intx::uint256{0xabc} << 130,
+            intx::from_string<intx::uint256>("0x48b55bfa915ac795c431978d8a6a992b628d557da5ff759b307d495a36649353"),
+            ~intx::uint256{0},
+        };
+        for (const auto& n : numbers) {
+            buffer.clear();
+            writer.value_quantity(n);
+            CHECK(buffer == "\"" + to_quantity(n) + "\"");
+        }
+    }
+}
+
+TEST_CASE("write_json Log", "[silkrpc][json][buffer_writer]") {
+    auto log{sample_log()};
+    CHECK(write_buffer_json(log) == nlohmann::json(log).dump());
+
+    log.removed = true;
+    log.timestamp = 1'690'000'000;
+    log.topics.clear();
+    log.data.clear();
+    CHECK(write_buffer_json(log) == nlohmann::json(log).dump());
+}
+
+TEST_CASE("write_json Receipt", "[silkrpc][json][buffer_writer]") {
+    Receipt receipt{
+        .success = true,
+        .cumulative_gas_used = 0x1234567,
+        .logs = {sample_log(), sample_log()},
+        .tx_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126e_bytes32,
+        .gas_used = 21'000,
+        .block_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32,
+        .block_number = 5'405'021,
+        .tx_index = 12,
+        .from = 0x007fb8417eb9ad4d958b050fc3720d5b46a2c053_address,
+        .effective_gas_price = 30 * kGiga,
+    };
+    receipt.bloom = bloom_from_logs(receipt.logs);
+
+    SECTION("call") {
+        receipt.to = 0xe5ef458d37212a06e3f59d40c454e76150ae7c32_address;
+        receipt.type = 2;
+        CHECK(write_buffer_json(receipt) == nlohmann::json(receipt).dump());
+    }
+
+    SECTION("contract creation") {
+        receipt.success = false;
+        receipt.contract_address = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address;
+        CHECK(write_buffer_json(receipt) == nlohmann::json(receipt).dump());
+    }
+}
+
+TEST_CASE("write_json Transaction", "[silkrpc][json][buffer_writer]") {
+    for (const auto type : {TransactionType::kLegacy, TransactionType::kAccessList, TransactionType::kDynamicFee}) {
+        Transaction txn{sample_transaction(type)};
+        txn.block_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32;
+        txn.block_number = 5'405'021;
+        txn.block_base_fee_per_gas = 7;
+        txn.transaction_index = 3;
+        CHECK(write_buffer_json(txn) == nlohmann::json(txn).dump());
+
+        txn.queued_in_pool = true;
+        txn.to = std::nullopt;
+        CHECK(write_buffer_json(txn) == nlohmann::json(txn).dump());
+    }
+
+    SECTION("legacy without chain id") {
+        Transaction txn{sample_transaction(TransactionType::kLegacy)};
+        REQUIRE(txn.set_v(27));
+        CHECK(write_buffer_json(txn) == nlohmann::json(txn).dump());
+    }
+}
+
+TEST_CASE("write_json Block", "[silkrpc][json][buffer_writer]") {
+    Block block;
+    block.hash = 0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32;
+    block.total_difficulty = intx::from_string<intx::uint256>("0x2d5e3e1f5fcd7c52b30a");
+    auto& header{block.block.header};
+    header.parent_hash = 0x474f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126d_bytes32;
+    header.beneficiary = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address;
+    header.difficulty = 0x0b5c7e1f5fcd;
+    header.number = 5'405'021;
+    header.gas_limit = 30'000'000;
+    header.gas_used = 1'000'000;
+    header.timestamp = 1'690'000'000;
+    header.extra_data = *silkworm::from_hex("0001FF0100");
+    header.nonce = {0, 0, 0, 0, 0, 0, 0, 255};
+    header.base_fee_per_gas = 7;
+    block.block.transactions = {sample_transaction(TransactionType::kLegacy),
+                                sample_transaction(TransactionType::kDynamicFee)};
+    block.block.ommers.resize(1);
+
+    SECTION("transaction hashes") {
+        CHECK(write_buffer_json(block) == nlohmann::json(block).dump());
+    }
+
+    SECTION("full transactions") {
+        block.full_tx = true;
+        CHECK(write_buffer_json(block) == nlohmann::json(block).dump());
+    }
+
+    SECTION("withdrawals") {
+        header.withdrawals_root = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32;
+        block.block.withdrawals = std::vector<Withdrawal>{
+            {.index = 1, .validator_index = 2, .address = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address, .amount = 3}};
+        CHECK(write_buffer_json(block) == nlohmann::json(block).dump());
+    }
+
+    SECTION("empty pre-London block") {
+        header.base_fee_per_gas = std::nullopt;
+        block.block.transactions.clear();
+        block.block.ommers.clear();
+        CHECK(write_buffer_json(block) == nlohmann::json(block).dump());
+    }
+}
+
+TEST_CASE("write_json Trace", "[silkrpc][json][buffer_writer]") {
+    trace::TraceAction trace_action;
+    trace_action.call_type = "call";
+    trace_action.from = 0xe0a2bd4258d2768837baa26a28fe71dc079f84c7_address;
+    trace_action.to = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address;
+    trace_action.gas = 1000;
+    trace_action.input = *silkworm::from_hex("0x1234");
+    trace_action.value = intx::uint256{0xdeadbeaf};
+
+    trace::Trace trace;
+    trace.action = trace_action;
+    trace.type = "call";
+    trace.trace_address = {0, 2};
+    trace.sub_traces = 1;
+
+    SECTION("with trace action") {
+        trace.block_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32;
+        trace.block_number = 5'405'021;
+        trace.transaction_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126e_bytes32;
+        trace.transaction_position = 3;
+        trace.trace_result = trace::TraceResult{.output = *silkworm::from_hex("0x00"), .gas_used = 500};
+        CHECK(write_buffer_json(trace) == nlohmann::json(trace).dump());
+    }
+
+    SECTION("with contract creation") {
+        trace_action.call_type = std::nullopt;
+        trace_action.to = std::nullopt;
+        trace_action.input = std::nullopt;
+        trace_action.init = *silkworm::from_hex("0x6080");
+        trace.action = trace_action;
+        trace.type = "create";
+        trace.trace_result = trace::TraceResult{
+            .address = 0xe0a2bd4258d2768837baa26a28fe71dc079f84c8_address,
+            .code = *silkworm::from_hex("0x6080"),
+            .gas_used = 21'000,
+        };
+        CHECK(write_buffer_json(trace) == nlohmann::json(trace).dump());
+    }
+
+    SECTION("with error") {
+        trace.error = "Reverted";
+        CHECK(write_buffer_json(trace) == nlohmann::json(trace).dump());
+    }
+
+    SECTION("with reward action") {
+        trace.action = trace::RewardAction{
+            .author = 0xe0a2bd4258d2768837baa26a28fe71dc079f84d8_address,
+            .reward_type = "block",
+            .value = intx::uint256{2} * kEther,
+        };
+        trace.type = "reward";
+        CHECK(write_buffer_json(trace) == nlohmann::json(trace).dump());
+    }
+}
+
+TEST_CASE("make_buffer_json_content", "[silkrpc][json][buffer_writer]") {
+    std::string reply;
+
+    SECTION("null result") {
+        make_buffer_json_content(reply, 1);
+        CHECK(reply == make_json_content(1).dump());
+    }
+
+    SECTION("logs result") {
+        const Logs logs{sample_log(), sample_log()};
+        make_buffer_json_content(reply, 42, logs);
+        CHECK(reply == make_json_content(42, logs).dump());
+    }
+}
+
+}  // namespace silkworm::rpc
@@ -23,6 +23,8 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/concurrency/context_pool_settings.hpp>
 #include <silkworm/silkrpc/common/constants.hpp>
+#include <silkworm/silkrpc/common/execution_lanes.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 
 namespace silkworm::rpc {
 
@@ -35,10 +37,14 @@ struct DaemonSettings {
     std::string eth_api_spec{kDefaultEth1ApiSpec};
     std::string private_api_addr{kDefaultPrivateApiAddr};
     uint32_t num_workers{std::thread::hardware_concurrency() / 2};
+    std::vector<ExecutionLaneSettings> execution_lanes;
+    size_t block_cache_size{kDefaultBlockCacheSize};
     std::vector<std::string> cors_domain;
     std::optional<std::string> jwt_secret_file;
     bool skip_protocol_check{false};
     bool erigon_json_rpc_compatibility{false};
+    bool ws_enabled{false};
+    std::string metrics_end_point;  // empty means metrics are not exported
 };
 
 }  // namespace silkworm::rpc
@@ -24,7 +24,9 @@
 namespace silkworm::rpc {
 
 //! LocalChainStorage must be used when blockchain data is local with respect to the running component, i.e. it is
-//! in local database (accessed via MDBX API) or local snapshot files (accessed via custom snapshot API)
+//! in local database (accessed via MDBX API) or local snapshot files (accessed via custom snapshot API).
+//! Blocks in the range covered by snapshots are served directly from the memory-mapped segments through their
+//! recsplit indexes, without touching the database.
 class LocalChainStorage : public ChainStorage {
   public:
     explicit LocalChainStorage(db::ROTxn& txn);
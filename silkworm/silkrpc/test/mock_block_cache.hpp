@@ -26,12 +26,13 @@
 
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
+#include <silkworm/silkrpc/core/block_cache.hpp>
 #include <silkworm/silkrpc/ethdb/kv/state_cache.hpp>
 #include <silkworm/silkrpc/ethdb/transaction.hpp>
 
 namespace silkworm::rpc::test {
 
-class MockBlockCache : public silkworm::BlockCache {
+class MockBlockCache : public BlockCache {
   public:
     MOCK_METHOD((std::optional<std::shared_ptr<silkworm::BlockWithHash>>), get, (const evmc::bytes32&), ());
     MOCK_METHOD((void), insert, (const evmc::bytes32&, const std::shared_ptr<silkworm::BlockWithHash>), ());
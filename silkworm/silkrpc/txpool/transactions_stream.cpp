@@ -0,0 +1,121 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "transactions_stream.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include <boost/asio/experimental/as_tuple.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/use_future.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <silkworm/core/common/cast.hpp>
+#include <silkworm/core/crypto/keccak.hpp>
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/co_spawn_sw.hpp>
+#include <silkworm/infra/concurrency/shared_service.hpp>
+
+namespace silkworm::rpc::txpool {
+
+//! Define Asio coroutine-based completion token using error codes instead of exceptions for errors
+constexpr auto use_nothrow_awaitable = boost::asio::as_tuple(boost::asio::use_awaitable);
+
+TransactionsStream::TransactionsStream(ClientContext& context, const std::shared_ptr<grpc::Channel>& channel)
+    : TransactionsStream(context, ::txpool::Txpool::NewStub(channel)) {}
+
+TransactionsStream::TransactionsStream(ClientContext& context, std::unique_ptr<::txpool::Txpool::StubInterface> stub)
+    : scheduler_(*context.io_context()),
+      grpc_context_(*context.grpc_context()),
+      stub_(std::move(stub)),
+      subscription_manager_(must_use_shared_service<SubscriptionManager>(scheduler_)),
+      retry_timer_{scheduler_} {}
+
+std::future<void> TransactionsStream::open() {
+    return concurrency::co_spawn_sw(scheduler_, run(), boost::asio::use_future);
+}
+
+void TransactionsStream::close() {
+    std::lock_guard lock{cancellation_mutex_};
+    SILK_DEBUG << "Close txpool transactions stream: emitting cancellation";
+    cancellation_signal_.emit(boost::asio::cancellation_type::all);
+}
+
+Task<void> TransactionsStream::run() {
+    SILK_TRACE << "TransactionsStream::run START";
+
+    auto cancellation_slot = cancellation_signal_.slot();
+
+    bool cancelled{false};
+    while (!cancelled) {
+        auto on_add_rpc{std::make_shared<OnAddRpc>(*stub_, grpc_context_)};
+
+        {
+            std::lock_guard lock{cancellation_mutex_};
+            cancellation_slot.assign([&, on_add_rpc](boost::asio::cancellation_type /*type*/) {
+                retry_timer_.cancel();
+                on_add_rpc->cancel();
+                SILK_WARN << "Txpool transactions stream cancelled";
+            });
+        }
+
+        const ::txpool::OnAddRequest request;
+        const auto [req_ec] = co_await on_add_rpc->request_on(scheduler_.get_executor(), request, use_nothrow_awaitable);
+        std::error_code ec{req_ec};
+        if (!ec) {
+            SILK_INFO << "Txpool transactions stream opened";
+        }
+
+        ::txpool::OnAddReply reply;
+        std::vector<ByteView> transactions;
+        std::vector<ethash::hash256> hashes;
+        while (!ec) {
+            std::tie(ec, reply) = co_await on_add_rpc->read_on(scheduler_.get_executor(), use_nothrow_awaitable);
+            if (ec) break;
+
+            // Hash all the new transactions at once, they are notified to newPendingTransactions subscribers by hash
+            transactions.clear();
+            for (const auto& rlp_tx : reply.rpl_txs()) {
+                transactions.push_back(string_view_to_byte_view(rlp_tx));
+            }
+            hashes.resize(transactions.size());
+            keccak256_many(transactions, hashes);
+
+            std::vector<evmc::bytes32> transaction_hashes(hashes.size());
+            for (size_t i{0}; i < hashes.size(); ++i) {
+                std::memcpy(transaction_hashes[i].bytes, hashes[i].bytes, kHashLength);
+            }
+            subscription_manager_->on_new_transactions(transaction_hashes);
+        }
+
+        if (ec.value() == grpc::StatusCode::CANCELLED) {
+            cancelled = true;
+            SILK_DEBUG << "Txpool transactions stream cancelled";
+        } else {
+            SILK_WARN << "Txpool transactions stream error [" << ec.message() << "], schedule reopen";
+            retry_timer_.expires_after(kDefaultOnAddRetryInterval);
+            const auto [timer_ec] = co_await retry_timer_.async_wait(use_nothrow_awaitable);
+            if (timer_ec == boost::asio::error::operation_aborted) {
+                cancelled = true;
+            }
+        }
+    }
+
+    SILK_TRACE << "TransactionsStream::run END";
+}
+
+}  // namespace silkworm::rpc::txpool
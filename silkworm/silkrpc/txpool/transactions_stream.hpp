@@ -0,0 +1,81 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/cancellation_signal.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <grpcpp/grpcpp.h>
+
+#include <silkworm/infra/grpc/client/client_context_pool.hpp>
+#include <silkworm/interfaces/txpool/txpool.grpc.pb.h>
+#include <silkworm/silkrpc/core/subscription_manager.hpp>
+#include <silkworm/silkrpc/grpc/server_streaming_rpc.hpp>
+
+namespace silkworm::rpc::txpool {
+
+using OnAddRpc = ServerStreamingRpc<&::txpool::Txpool::StubInterface::PrepareAsyncOnAdd>;
+
+//! The default retry interval between successive OnAdd registration attempts
+constexpr std::chrono::milliseconds kDefaultOnAddRetryInterval{10'000};
+
+//! End-point of the stream of transactions added to the txpool, feeding the newPendingTransactions subscriptions
+class TransactionsStream {
+  public:
+    explicit TransactionsStream(ClientContext& context, const std::shared_ptr<grpc::Channel>& channel);
+    explicit TransactionsStream(ClientContext& context, std::unique_ptr<::txpool::Txpool::StubInterface> stub);
+
+    //! Open up the stream, starting the register-and-receive loop
+    std::future<void> open();
+
+    //! Close down the stream, stopping the register-and-receive loop
+    void close();
+
+    //! The register-and-receive asynchronous loop
+    Task<void> run();
+
+  private:
+    //! Asio execution scheduler running the register-and-receive asynchronous loop
+    boost::asio::io_context& scheduler_;
+
+    //! gRPC execution scheduler running the register-and-receive asynchronous loop
+    agrpc::GrpcContext& grpc_context_;
+
+    //! The gRPC stub for remote txpool interface
+    std::unique_ptr<::txpool::Txpool::StubInterface> stub_;
+
+    //! The subscriptions notified about the new transactions
+    SubscriptionManager* subscription_manager_;
+
+    //! The signal used to cancel the register-and-receive stream loop
+    boost::asio::cancellation_signal cancellation_signal_;
+
+    //! The timer to schedule retries for stream opening
+    boost::asio::steady_timer retry_timer_;
+
+    //! The mutual exclusion access to the cancellation signal
+    std::mutex cancellation_mutex_;
+};
+
+}  // namespace silkworm::rpc::txpool
@@ -0,0 +1,236 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "connection.hpp"
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <string_view>
+#include <utility>
+
+#include <absl/strings/match.h>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/beast/core/buffers_to_string.hpp>
+#include <boost/beast/http/empty_body.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/beast/websocket/error.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/awaitable_wait_for_one.hpp>
+#include <silkworm/silkrpc/http/methods.hpp>
+#include <silkworm/silkrpc/http/reply.hpp>
+#include <silkworm/silkrpc/json/filter.hpp>
+#include <silkworm/silkrpc/json/types.hpp>
+
+namespace silkworm::rpc::ws {
+
+using namespace concurrency::awaitable_wait_for_one;
+
+//! The notification frame is written as prefix + shared payload + suffix, so that the payload is never copied
+constexpr std::string_view kNotificationPrefix{R"({"jsonrpc":"2.0","method":"eth_subscription","params":{"subscription":")"};
+constexpr std::string_view kNotificationResult{R"(","result":)"};
+constexpr std::string_view kNotificationSuffix{"}}"};
+
+//! Check if the upgrade request may open a WebSocket: browsers always send the Origin header, so any web page could
+//! otherwise open a socket to the daemon (i.e. cross-site WebSocket hijacking). Non-browser clients send no Origin.
+static bool is_origin_allowed(const http::Request& upgrade_request, const std::vector<std::string>& allowed_origins) {
+    for (const auto& header : upgrade_request.headers) {
+        if (absl::EqualsIgnoreCase(header.name, "Origin")) {
+            return std::any_of(allowed_origins.cbegin(), allowed_origins.cend(), [&](const auto& allowed_origin) {
+                return allowed_origin == "*" || absl::EqualsIgnoreCase(allowed_origin, header.value);
+            });
+        }
+    }
+    return true;
+}
+
+Connection::Connection(boost::asio::ip::tcp::socket&& socket,
+                       commands::RpcApi& api,
+                       const commands::RpcApiTable& handler_table,
+                       const std::vector<std::string>& allowed_origins,
+                       SubscriptionManager& subscription_manager)
+    : stream_{std::move(socket)},
+      request_handler_{stream_.next_layer(), api, handler_table, allowed_origins, /*jwt_secret=*/std::nullopt},
+      handler_table_{handler_table},
+      allowed_origins_{allowed_origins},
+      subscription_manager_{subscription_manager},
+      outbox_{stream_.get_executor(), kMaxPendingNotifications} {
+    SILK_DEBUG << "ws::Connection::Connection socket " << &stream_.next_layer() << " created";
+}
+
+Connection::~Connection() {
+    SILK_DEBUG << "ws::Connection::~Connection socket " << &stream_.next_layer() << " deleted";
+}
+
+Task<void> Connection::run(const http::Request& upgrade_request) {
+    namespace beast_http = boost::beast::http;
+    beast_http::request<beast_http::empty_body> handshake_request{beast_http::verb::get, upgrade_request.uri, 11};
+    for (const auto& header : upgrade_request.headers) {
+        handshake_request.set(header.name, header.value);
+    }
+
+    try {
+        if (!is_origin_allowed(upgrade_request, allowed_origins_)) {
+            SILK_WARN << "ws::Connection::run upgrade refused: origin not allowed";
+            const auto reply = http::Reply::stock_reply(http::StatusType::forbidden);
+            co_await boost::asio::async_write(stream_.next_layer(), reply.to_buffers(), boost::asio::use_awaitable);
+            co_return;
+        }
+
+        co_await stream_.async_accept(handshake_request, boost::asio::use_awaitable);
+        SILK_DEBUG << "ws::Connection::run handshake completed";
+
+        co_await (read_loop() || write_loop());
+    } catch (const boost::system::system_error& se) {
+        if (se.code() == boost::beast::websocket::error::closed || se.code() == boost::asio::error::eof ||
+            se.code() == boost::asio::error::connection_reset || se.code() == boost::asio::error::broken_pipe) {
+            SILK_DEBUG << "ws::Connection::run close from client with code: " << se.code();
+        } else if (se.code() != boost::asio::error::operation_aborted) {
+            SILK_WARN << "ws::Connection::run system_error: " << se.what();
+        }
+    } catch (const std::exception& e) {
+        SILK_ERROR << "ws::Connection::run exception: " << e.what();
+    }
+
+    outbox_.close();
+    subscription_manager_.unsubscribe_all(this);
+}
+
+bool Connection::notify(const SubscriptionId& subscription_id, NotificationPayload payload) {
+    return outbox_.try_send(OutboundMessage{{}, subscription_id, std::move(payload)});
+}
+
+Task<void> Connection::read_loop() {
+    while (true) {
+        buffer_.clear();
+        co_await stream_.async_read(buffer_, boost::asio::use_awaitable);
+        const auto message{boost::beast::buffers_to_string(buffer_.data())};
+        SILK_TRACE << "ws::Connection::read_loop message: " << message;
+
+        const auto reply_content = co_await handle_message(message);
+        if (reply_content) {
+            co_await outbox_.send(OutboundMessage{*reply_content, {}, {}});
+        }
+    }
+}
+
+Task<void> Connection::write_loop() {
+    while (true) {
+        const auto message = co_await outbox_.receive();
+        stream_.text(true);
+        if (message.payload) {
+            const std::array<boost::asio::const_buffer, 5> buffers{
+                boost::asio::buffer(kNotificationPrefix),
+                boost::asio::buffer(message.subscription_id),
+                boost::asio::buffer(kNotificationResult),
+                boost::asio::buffer(*message.payload),
+                boost::asio::buffer(kNotificationSuffix),
+            };
+            co_await stream_.async_write(buffers, boost::asio::use_awaitable);
+        } else {
+            co_await stream_.async_write(boost::asio::buffer(message.content), boost::asio::use_awaitable);
+        }
+    }
+}
+
+Task<std::optional<std::string>> Connection::handle_message(const std::string& message) {
+    const auto request_json = nlohmann::json::parse(message, /*cb=*/nullptr, /*allow_exceptions=*/false);
+    if (request_json.is_discarded()) {
+        co_return make_json_error(0, -32700, "parse error").dump();
+    }
+
+    if (request_json.is_object()) {
+        if (!request_json.contains("id")) {
+            co_return std::nullopt;
+        }
+        co_return co_await handle_request(request_json);
+    }
+
+    // Replies are already serialized, so the batch reply is built by joining them
+    std::string batch_reply{"["};
+    for (const auto& item_json : request_json) {
+        if (item_json.is_object() && item_json.contains("id")) {
+            if (batch_reply.size() > 1) {
+                batch_reply += ',';
+            }
+            batch_reply += co_await handle_request(item_json);
+        }
+    }
+    batch_reply += ']';
+    co_return batch_reply;
+}
+
+Task<std::string> Connection::handle_request(const nlohmann::json& request_json) {
+    const auto request_id = request_json["id"].get<uint32_t>();
+    if (!request_json.contains("method") || !request_json["method"].is_string()) {
+        co_return make_json_error(request_id, -32600, "invalid request").dump();
+    }
+    const auto method = request_json["method"].get<std::string>();
+    const auto params = request_json.value("params", nlohmann::json::array());
+
+    if (method == http::method::k_eth_subscribe) {
+        co_return handle_subscribe(request_id, params).dump();
+    }
+    if (method == http::method::k_eth_unsubscribe) {
+        co_return handle_unsubscribe(request_id, params).dump();
+    }
+    if (handler_table_.find_stream_handler(method)) {
+        // Streaming handlers write chunked HTTP directly to the socket, hence they cannot be framed
+        co_return make_json_error(request_id, -32601, "the method " + method + " is not available over WebSocket").dump();
+    }
+
+    // The reply content is already the serialized JSON reply, hence it is framed as it is
+    http::Reply reply;
+    co_await request_handler_.handle_request_and_create_reply(request_json, reply);
+    co_return std::move(reply.content);
+}
+
+nlohmann::json Connection::handle_subscribe(uint32_t request_id, const nlohmann::json& params) {
+    if (params.empty() || !params[0].is_string()) {
+        return make_json_error(request_id, -32602, "invalid eth_subscribe params");
+    }
+    const auto kind = parse_subscription_kind(params[0].get<std::string>());
+    if (!kind) {
+        return make_json_error(request_id, -32602, "unsupported subscription: " + params[0].get<std::string>());
+    }
+    Filter filter;
+    if (*kind == SubscriptionKind::kLogs && params.size() > 1) {
+        try {
+            filter = params[1].get<Filter>();
+        } catch (const std::exception& e) {
+            return make_json_error(request_id, -32602, e.what());
+        }
+    }
+    const auto subscription_id = subscription_manager_.subscribe(shared_from_this(), *kind, std::move(filter));
+    subscription_ids_.insert(subscription_id);
+    return make_json_content(request_id, subscription_id);
+}
+
+nlohmann::json Connection::handle_unsubscribe(uint32_t request_id, const nlohmann::json& params) {
+    if (params.empty() || !params[0].is_string()) {
+        return make_json_error(request_id, -32602, "invalid eth_unsubscribe params");
+    }
+    const auto subscription_id = params[0].get<std::string>();
+    // Only the subscriptions created on this connection can be cancelled
+    const bool removed = subscription_ids_.erase(subscription_id) > 0 && subscription_manager_.unsubscribe(subscription_id);
+    return make_json_content(request_id, removed);
+}
+
+}  // namespace silkworm::rpc::ws
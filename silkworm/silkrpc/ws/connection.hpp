@@ -0,0 +1,109 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/websocket/stream.hpp>
+#include <nlohmann/json.hpp>
+
+#include <silkworm/infra/concurrency/channel.hpp>
+#include <silkworm/silkrpc/commands/rpc_api.hpp>
+#include <silkworm/silkrpc/commands/rpc_api_table.hpp>
+#include <silkworm/silkrpc/core/subscription_manager.hpp>
+#include <silkworm/silkrpc/http/request.hpp>
+#include <silkworm/silkrpc/http/request_handler.hpp>
+
+namespace silkworm::rpc::ws {
+
+//! The max number of outbound messages queued per connection before dropping its subscriptions
+constexpr std::size_t kMaxPendingNotifications{4096};
+
+//! A WebSocket connection from a client, upgraded from HTTP, serving both JSON RPC requests and eth_subscribe
+class Connection : public Subscriber, public std::enable_shared_from_this<Connection> {
+  public:
+    Connection(boost::asio::ip::tcp::socket&& socket,
+               commands::RpcApi& api,
+               const commands::RpcApiTable& handler_table,
+               const std::vector<std::string>& allowed_origins,
+               SubscriptionManager& subscription_manager);
+    ~Connection() override;
+
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+
+    //! Complete the opening handshake for the given HTTP upgrade request and serve the connection until closed
+    //! The upgrade is refused with 403 Forbidden if the request comes from a web page whose origin is not allowed
+    Task<void> run(const http::Request& upgrade_request);
+
+    //! Enqueue the notification for the client, without ever waiting for the socket
+    bool notify(const SubscriptionId& subscription_id, NotificationPayload payload) override;
+
+  private:
+    //! One message to be written: either a reply (content) or a notification (subscription_id + shared payload)
+    struct OutboundMessage {
+        std::string content;
+        SubscriptionId subscription_id;
+        NotificationPayload payload;
+    };
+
+    //! Read the incoming JSON RPC requests (single or batch) and enqueue their replies
+    Task<void> read_loop();
+
+    //! Write the outbound messages in order
+    Task<void> write_loop();
+
+    //! Handle one incoming message and return the reply content, if any
+    Task<std::optional<std::string>> handle_message(const std::string& message);
+
+    //! Handle one JSON RPC request and return the serialized reply
+    Task<std::string> handle_request(const nlohmann::json& request_json);
+
+    nlohmann::json handle_subscribe(uint32_t request_id, const nlohmann::json& params);
+    nlohmann::json handle_unsubscribe(uint32_t request_id, const nlohmann::json& params);
+
+    boost::beast::websocket::stream<boost::asio::ip::tcp::socket> stream_;
+
+    //! The handler used to process any request except eth_subscribe/eth_unsubscribe
+    http::RequestHandler request_handler_;
+
+    const commands::RpcApiTable& handler_table_;
+
+    //! The origins allowed to open a WebSocket from a browser
+    const std::vector<std::string>& allowed_origins_;
+
+    SubscriptionManager& subscription_manager_;
+
+    //! The subscriptions created on this connection, the only ones it can cancel
+    std::set<SubscriptionId> subscription_ids_;
+
+    //! The queue of replies and notifications waiting to be written
+    concurrency::Channel<OutboundMessage> outbox_;
+
+    //! Buffer for incoming messages
+    boost::beast::flat_buffer buffer_;
+};
+
+}  // namespace silkworm::rpc::ws
@@ -0,0 +1,211 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "connection.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/beast/core/buffers_to_string.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/status.hpp>
+#include <boost/beast/websocket/error.hpp>
+#include <boost/beast/websocket/stream.hpp>
+#include <boost/system/system_error.hpp>
+#include <catch2/catch.hpp>
+#include <evmc/evmc.hpp>
+#include <nlohmann/json.hpp>
+
+#include <silkworm/silkrpc/commands/rpc_api.hpp>
+#include <silkworm/silkrpc/commands/rpc_api_table.hpp>
+#include <silkworm/silkrpc/common/constants.hpp>
+#include <silkworm/silkrpc/common/execution_lanes.hpp>
+#include <silkworm/silkrpc/http/connection.hpp>
+#include <silkworm/silkrpc/json/types.hpp>
+#include <silkworm/silkrpc/test/context_test_base.hpp>
+
+namespace silkworm::rpc::ws {
+
+namespace websocket = boost::beast::websocket;
+using boost::asio::ip::tcp;
+using evmc::literals::operator""_bytes32;
+
+//! Server accepting HTTP connections on a local ephemeral port, which can be upgraded to WebSocket
+class WebSocketTestBase : public test::ContextTestBase {
+  public:
+    explicit WebSocketTestBase(std::vector<std::string> allowed_origins)
+        : workers_{1},
+          rpc_api_{io_context_, workers_, execution_lanes_},
+          rpc_api_table_{kDefaultEth1ApiSpec},
+          allowed_origins_{std::move(allowed_origins)},
+          acceptor_{io_context_, tcp::endpoint{boost::asio::ip::make_address("127.0.0.1"), 0}} {
+        boost::asio::co_spawn(io_context_, accept_loop(), boost::asio::detached);
+    }
+
+    ~WebSocketTestBase() {
+        // Stop serving before the API and the subscriptions are gone
+        context_.stop();
+        context_thread_.join();
+    }
+
+    //! Open a WebSocket to the server as a client having the given origin, if any
+    void handshake(websocket::stream<tcp::socket>& client, const std::optional<std::string>& origin,
+                   websocket::response_type& response) {
+        client.next_layer().connect(acceptor_.local_endpoint());
+        if (origin) {
+            client.set_option(websocket::stream_base::decorator([origin = *origin](websocket::request_type& request) {
+                request.set(boost::beast::http::field::origin, origin);
+            }));
+        }
+        client.handshake(response, "localhost", "/");
+    }
+
+    boost::asio::io_context client_context;
+    SubscriptionManager subscription_manager;
+
+  private:
+    Task<void> accept_loop() {
+        while (true) {
+            auto connection = std::make_shared<http::Connection>(io_context_, rpc_api_, rpc_api_table_, allowed_origins_,
+                                                                 /*jwt_secret=*/std::nullopt, &subscription_manager);
+            co_await acceptor_.async_accept(connection->socket(), boost::asio::use_awaitable);
+            boost::asio::co_spawn(io_context_, serve(connection), boost::asio::detached);
+        }
+    }
+
+    static Task<void> serve(std::shared_ptr<http::Connection> connection) {
+        co_await connection->read_loop();
+    }
+
+    boost::asio::thread_pool workers_;
+    ExecutionLanes execution_lanes_;
+    commands::RpcApi rpc_api_;
+    commands::RpcApiTable rpc_api_table_;
+    std::vector<std::string> allowed_origins_;
+    tcp::acceptor acceptor_;
+};
+
+static nlohmann::json read_message(websocket::stream<tcp::socket>& client) {
+    boost::beast::flat_buffer buffer;
+    client.read(buffer);
+    return nlohmann::json::parse(boost::beast::buffers_to_string(buffer.data()));
+}
+
+// Exclude gRPC tests from sanitizer builds due to data race warnings inside gRPC library
+#ifndef SILKWORM_SANITIZE
+TEST_CASE("ws::Connection handshake", "[silkrpc][ws][connection]") {
+    websocket::response_type response;
+
+    SECTION("no origin") {
+        WebSocketTestBase server{{}};
+        websocket::stream<tcp::socket> client{server.client_context};
+        CHECK_NOTHROW(server.handshake(client, std::nullopt, response));
+        CHECK(response.result() == boost::beast::http::status::switching_protocols);
+    }
+
+    SECTION("allowed origin") {
+        WebSocketTestBase server{{"http://localhost:3000"}};
+        websocket::stream<tcp::socket> client{server.client_context};
+        CHECK_NOTHROW(server.handshake(client, "http://localhost:3000", response));
+        CHECK(response.result() == boost::beast::http::status::switching_protocols);
+    }
+
+    SECTION("any origin allowed") {
+        WebSocketTestBase server{{"*"}};
+        websocket::stream<tcp::socket> client{server.client_context};
+        CHECK_NOTHROW(server.handshake(client, "http://example.com", response));
+        CHECK(response.result() == boost::beast::http::status::switching_protocols);
+    }
+
+    SECTION("origin not allowed") {
+        WebSocketTestBase server{{"http://localhost:3000"}};
+        websocket::stream<tcp::socket> client{server.client_context};
+        CHECK_THROWS_AS(server.handshake(client, "http://example.com", response), boost::system::system_error);
+        CHECK(response.result() == boost::beast::http::status::forbidden);
+    }
+
+    SECTION("origin without allowed origins") {
+        WebSocketTestBase server{{}};
+        websocket::stream<tcp::socket> client{server.client_context};
+        CHECK_THROWS_AS(server.handshake(client, "http://localhost:3000", response), boost::system::system_error);
+        CHECK(response.result() == boost::beast::http::status::forbidden);
+    }
+}
+
+TEST_CASE("ws::Connection framing", "[silkrpc][ws][connection]") {
+    static constexpr auto kTransactionHash{0x3763e4f6e4198413383534c763f3f5dac5c5e939f0a81724e3beb96d6e2ad0d5_bytes32};
+
+    WebSocketTestBase server{{}};
+    websocket::stream<tcp::socket> client{server.client_context};
+    websocket::response_type response;
+    server.handshake(client, std::nullopt, response);
+
+    client.text(true);
+    client.write(boost::asio::buffer(std::string{R"({"jsonrpc":"2.0","id":1,"method":"eth_subscribe","params":["newPendingTransactions"]})"}));
+    const auto subscribe_reply{read_message(client)};
+    CHECK(subscribe_reply["jsonrpc"] == "2.0");
+    CHECK(subscribe_reply["id"] == 1);
+    REQUIRE(subscribe_reply["result"].is_string());
+    const auto subscription_id{subscribe_reply["result"].get<std::string>()};
+
+    SECTION("notification") {
+        server.spawn_and_wait([&]() -> Task<void> {
+            server.subscription_manager.on_new_transactions({kTransactionHash});
+            co_return;
+        });
+        const auto notification{read_message(client)};
+        CHECK(notification["jsonrpc"] == "2.0");
+        CHECK(notification["method"] == "eth_subscription");
+        CHECK(notification["params"]["subscription"] == subscription_id);
+        CHECK(notification["params"]["result"] == nlohmann::json(kTransactionHash));
+    }
+
+    SECTION("batch request") {
+        const nlohmann::json batch_request{
+            {{"jsonrpc", "2.0"}, {"id", 2}, {"method", "eth_unsubscribe"}, {"params", {subscription_id}}},
+            {{"jsonrpc", "2.0"}, {"method", "eth_unsubscribe"}, {"params", {subscription_id}}},  // notification: no reply
+            {{"jsonrpc", "2.0"}, {"id", 3}, {"method", "eth_unsubscribe"}, {"params", {subscription_id}}},
+        };
+        client.write(boost::asio::buffer(batch_request.dump()));
+        const auto batch_reply{read_message(client)};
+        REQUIRE(batch_reply.is_array());
+        REQUIRE(batch_reply.size() == 2);
+        CHECK(batch_reply[0]["id"] == 2);
+        CHECK(batch_reply[0]["result"] == true);
+        CHECK(batch_reply[1]["id"] == 3);
+        CHECK(batch_reply[1]["result"] == false);
+        CHECK(server.subscription_manager.size() == 0);
+    }
+
+    SECTION("parse error") {
+        client.write(boost::asio::buffer(std::string{"{not json"}));
+        const auto reply{read_message(client)};
+        CHECK(reply["error"]["code"] == -32700);
+    }
+}
+#endif  // SILKWORM_SANITIZE
+
+}  // namespace silkworm::rpc::ws
@@ -39,6 +39,8 @@ BlockExchange::BlockExchange(SentryClient& sentry, const db::ROAccess& dba, cons
       chain_config_{chain_config},
       header_chain_{chain_config},
       body_sequence_{} {
+    header_chain_.set_verification_pool(&verification_pool_);
+    body_sequence_.set_verification_pool(&verification_pool_);
 }
 
 BlockExchange::~BlockExchange() {
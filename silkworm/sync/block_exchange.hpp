@@ -22,6 +22,7 @@
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/infra/concurrency/active_component.hpp>
 #include <silkworm/infra/concurrency/containers.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/sentry/api/common/message_from_peer.hpp>
 #include <silkworm/sync/internals/body_sequence.hpp>
@@ -79,6 +80,7 @@ class BlockExchange : public ActiveComponent {
     db::ROAccess db_access_;  // only to reply remote peer's requests
     SentryClient& sentry_;
     const ChainConfig& chain_config_;
+    ThreadPool verification_pool_;  // workers for header seal and body root verification, shared by chain and sequence
     HeaderChain header_chain_;
     BodySequence body_sequence_;
     Network_Statistics statistics_;
@@ -69,9 +69,11 @@ Penalty BodySequence::accept_requested_bodies(BlockBodiesPacket66& packet, const
     // Find matching requests and completing BodyRequest
     auto matching_requests = body_requests_.find_by_request_id(packet.requestId);
 
-    for (auto& body : packet.request) {
-        Hash oh = protocol::compute_ommers_hash(body);
-        Hash tr = protocol::compute_transaction_root(body);
+    const auto body_roots = compute_body_roots(packet.request);
+    for (size_t i = 0; i < packet.request.size(); ++i) {
+        auto& body = packet.request[i];
+        const Hash& oh = body_roots[i].ommers_hash;
+        const Hash& tr = body_roots[i].transactions_root;
 
         auto exact_request = body_requests_.end();  // = no request
 
@@ -307,6 +309,33 @@ bool BodySequence::is_valid_body(const BlockHeader& header, const BlockBody& bod
     return true;
 }
 
+std::vector<BodySequence::BodyRoots> BodySequence::compute_body_roots(const std::vector<BlockBody>& bodies) {
+    std::vector<BodyRoots> body_roots(bodies.size());
+    const auto compute_roots = [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            body_roots[i].ommers_hash = protocol::compute_ommers_hash(bodies[i]);
+            body_roots[i].transactions_root = protocol::compute_transaction_root(bodies[i]);
+        }
+    };
+
+    if (!verification_pool_ || bodies.size() < 2) {
+        compute_roots(0, bodies.size());
+        return body_roots;
+    }
+
+    // Transaction root computation dominates body validation, so split the bodies among the workers
+    const size_t num_workers = verification_pool_->get_thread_count();
+    const size_t chunk_size = (bodies.size() + num_workers - 1) / num_workers;
+    std::vector<std::future<void>> computations;
+    for (size_t start = 0; start < bodies.size(); start += chunk_size) {
+        computations.push_back(verification_pool_->submit(compute_roots, start, std::min(start + chunk_size, bodies.size())));
+    }
+    for (auto& computation : computations) {
+        computation.get();
+    }
+    return body_roots;
+}
+
 Blocks BodySequence::withdraw_ready_bodies() {
     Blocks ready_bodies;
 
@@ -18,6 +18,7 @@
 
 #include <list>
 
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/sync/messages/outbound_get_block_bodies.hpp>
 #include <silkworm/sync/packets/block_bodies_packet.hpp>
@@ -89,6 +90,9 @@ class BodySequence {
 
     [[nodiscard]] const Download_Statistics& statistics() const;
 
+    //! performance: compute body roots in parallel on the specified workers (nullptr means sequential computation)
+    void set_verification_pool(ThreadPool* pool) { verification_pool_ = pool; }
+
     // downloading process tuning parameters
     static constexpr size_t kMaxInMemoryRequests = 400000;
     static constexpr BlockNum kMaxBlocksPerMessage = 128;  // go-ethereum client acceptance limit
@@ -101,6 +105,12 @@ class BodySequence {
 
     static bool is_valid_body(const BlockHeader&, const BlockBody&);
 
+    struct BodyRoots {
+        Hash ommers_hash;
+        Hash transactions_root;
+    };
+    std::vector<BodyRoots> compute_body_roots(const std::vector<BlockBody>&);
+
     struct BodyRequest {
         uint64_t request_id{0};
         Hash block_hash;
@@ -144,6 +154,7 @@ class BodySequence {
     size_t ready_bodies_{0};
     Download_Statistics statistics_;
     std::string retrieval_condition_;
+    ThreadPool* verification_pool_{nullptr};
 };
 
 }  // namespace silkworm
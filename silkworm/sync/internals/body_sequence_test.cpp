@@ -248,6 +248,48 @@ TEST_CASE("body downloading", "[silkworm][sync][BodySequence]") {
         REQUIRE(statistic.reject_causes.not_requested == 1);
     }
 
+    SECTION("should verify bodies in parallel") {
+        ThreadPool verification_pool{2};
+        bs.set_verification_pool(&verification_pool);
+
+        // requesting
+        std::shared_ptr<OutboundMessage> message = bs.request_bodies(tp);
+        REQUIRE(message != nullptr);
+
+        auto get_bodies_msg = std::dynamic_pointer_cast<OutboundGetBlockBodies>(message);
+        REQUIRE(get_bodies_msg != nullptr);
+
+        auto& packet = get_bodies_msg->packet();
+
+        auto rs = bs.body_requests_.find(header1.number);
+        REQUIRE(rs != bs.body_requests_.end());
+        BodySequence_ForTest::BodyRequest& request_status = rs->second;
+
+        // accepting one wrong and one right body
+        Block block1tampered = block1;
+        block1tampered.transactions.resize(1);
+        block1tampered.transactions[0].nonce = 172339;
+
+        PeerId peer_id{byte_ptr_cast("1")};
+        BlockBodiesPacket66 response_packet;
+        response_packet.requestId = packet.requestId;
+        response_packet.request.push_back(block1tampered);
+        response_packet.request.push_back(block1);
+
+        auto penalty = bs.accept_requested_bodies(response_packet, peer_id);
+
+        REQUIRE(penalty == NoPenalty);
+        REQUIRE(request_status.ready);
+        REQUIRE(request_status.body == block1);
+
+        auto& statistic = bs.statistics();
+        REQUIRE(statistic.received_items == 2);
+        REQUIRE(statistic.accepted_items == 1);
+        REQUIRE(statistic.reject_causes.not_requested == 1);
+
+        bs.set_verification_pool(nullptr);
+    }
+
     SECTION("should ignore response with already received bodies") {
         // requesting
         std::shared_ptr<OutboundMessage> message = bs.request_bodies(tp);
@@ -119,6 +119,9 @@ size_t HeaderChain::outstanding_requests(time_point_t tp) const {
 
 void HeaderChain::add_bad_headers(const std::set<Hash>& bads) {
     bad_headers_.insert(bads.begin(), bads.end());  // todo: use set_union or merge?
+    for (const auto& bad : bads) {
+        rule_set_->forget_seal(bad);  // unwound headers must not be served from the seal memo
+    }
 }
 
 void HeaderChain::initial_state(const std::vector<BlockHeader>& last_headers) {
@@ -151,11 +154,20 @@ Headers HeaderChain::withdraw_stable_headers() {
     OldestFirstLinkQueue assessing_list = insert_list_;  // use move() operation if it is assured that after the move
     insert_list_.clear();                                // the container is empty and can be reused
 
+    BlockNum seals_verified_up_to{0};
     while (!assessing_list.empty()) {
         // Choose a link at top
         auto link = assessing_list.top();  // from lower block numbers to higher block numbers
         assessing_list.pop();
 
+        // Verify the seals of the next window of links in parallel ahead of their sequential verification
+        if (verification_pool_ && link->blockHeight >= seals_verified_up_to && link->blockHeight > last_preverified_hash_) {
+            seals_verified_up_to = link->blockHeight + seal_verification_window;
+            std::vector<std::shared_ptr<Link>> window{assessing_list.begin(), assessing_list.end()};
+            window.push_back(link);
+            verify_seals(std::move(window), seals_verified_up_to);
+        }
+
         // If it is in the pre-verified headers range do not verify it, wait for pre-verification
         if (link->blockHeight <= last_preverified_hash_ && !link->preverified) {
             insert_list_.push(link);
@@ -249,6 +261,40 @@ HeaderChain::VerificationResult HeaderChain::verify(const Link& link) {
     return Accept;
 }
 
+void HeaderChain::verify_seals(std::vector<std::shared_ptr<Link>> links, BlockNum up_to_height) {
+    // Collect the links in the window: the given ones and their descendants not yet in the assessing queue
+    std::vector<std::shared_ptr<Link>> to_verify;
+    std::vector<std::shared_ptr<Link>> to_visit{std::move(links)};
+    while (!to_visit.empty()) {
+        auto link = std::move(to_visit.back());
+        to_visit.pop_back();
+        if (link->blockHeight >= up_to_height) continue;
+        if (!link->preverified && link->blockHeight > last_preverified_hash_ && !bad_headers_.contains(link->hash)) {
+            to_verify.push_back(link);
+        }
+        to_visit.insert(to_visit.end(), link->next.begin(), link->next.end());
+    }
+    if (to_verify.empty()) return;
+
+    // The rule set memoizes the seal verification results, so verify() will not repeat the work done here
+    const size_t num_workers{verification_pool_->get_thread_count()};
+    const size_t chunk_size{(to_verify.size() + num_workers - 1) / num_workers};
+    std::vector<std::future<void>> verifications;
+    for (size_t start{0}; start < to_verify.size(); start += chunk_size) {
+        const size_t end{std::min(start + chunk_size, to_verify.size())};
+        verifications.push_back(verification_pool_->submit([&, start, end]() {
+            for (size_t i{start}; i < end; ++i) {
+                rule_set_->validate_seal(*to_verify[i]->header);
+            }
+        }));
+    }
+    for (auto& verification : verifications) {
+        verification.get();
+    }
+
+    SILK_TRACE << "HeaderChain: " << to_verify.size() << " seals verified in parallel up to height " << up_to_height;
+}
+
 // reduce persistedLinksQueue and remove links
 void HeaderChain::reduce_persisted_links_to(size_t limit) {
     if (persisted_link_queue_.size() <= limit) return;
@@ -502,6 +548,7 @@ void HeaderChain::invalidate(std::shared_ptr<Anchor> anchor) {
         auto removal = link_to_remove.back();
         link_to_remove.pop_back();
         links_.erase(removal->hash);
+        rule_set_->forget_seal(removal->hash);
         move_at_end(link_to_remove, removal->next);
     }
 }
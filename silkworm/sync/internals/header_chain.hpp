@@ -20,6 +20,7 @@
 
 #include <silkworm/core/common/lru_cache.hpp>
 #include <silkworm/core/protocol/rule_set.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/node/common/preverified_hashes.hpp>
 #include <silkworm/sync/messages/outbound_get_block_headers.hpp>
 
@@ -102,6 +103,9 @@ class HeaderChain {
     void add_bad_headers(const std::set<Hash>& bads);
     void set_preverified_hashes(PreverifiedHashes&);
 
+    // performance: verify header seals in parallel on the specified workers (nullptr means sequential verification)
+    void set_verification_pool(ThreadPool* pool) { verification_pool_ = pool; }
+
   protected:
     static constexpr BlockNum max_len = 192;
     static constexpr BlockNum stride = 8 * max_len;
@@ -111,6 +115,7 @@ class HeaderChain {
     static constexpr size_t link_limit = link_total - persistent_link_limit;
     static constexpr seconds_t skeleton_req_interval{30};
     static constexpr seconds_t extension_req_timeout{30};
+    static constexpr BlockNum seal_verification_window = 4 * 1024;
 
     // anchor collection: to collect headers more quickly we request headers in a wide range, as seed to grow later
     std::shared_ptr<OutboundMessage> anchor_skeleton_request(time_point_t);
@@ -153,6 +158,9 @@ class HeaderChain {
     };
     VerificationResult verify(const Link& link);
 
+    // verify in parallel the seals of the links reachable from the given ones, up to the specified height
+    void verify_seals(std::vector<std::shared_ptr<Link>> links, BlockNum up_to_height);
+
     void connect(std::shared_ptr<Link>, Segment::Slice, std::shared_ptr<Anchor>);
     RequestMoreHeaders extend_down(Segment::Slice, std::shared_ptr<Anchor>);
     void extend_up(std::shared_ptr<Link>, Segment::Slice);
@@ -173,6 +181,7 @@ class HeaderChain {
     lru_cache<Hash, Ignore> seen_announces_;
     std::vector<Announce> announces_to_do_;
     protocol::RuleSetPtr rule_set_;
+    ThreadPool* verification_pool_{nullptr};
     CustomHeaderOnlyChainState chain_state_;
     time_point_t last_skeleton_request_;
     time_point_t last_nack_;
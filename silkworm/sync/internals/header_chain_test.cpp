@@ -21,6 +21,7 @@
 #include <catch2/catch.hpp>
 
 #include <silkworm/core/common/cast.hpp>
+#include <silkworm/core/protocol/ethash_rule_set.hpp>
 #include <silkworm/infra/test_util/log.hpp>
 
 namespace silkworm {
@@ -1598,4 +1599,31 @@ TEST_CASE("HeaderChain - process_segment - (8) sibling with anchor invalidation
     }
 }
 
+TEST_CASE("HeaderChain - seal memo dropped on unwind") {
+    using namespace std;
+    test_util::SetLogVerbosityGuard guard{log::Level::kNone};
+
+    auto rule_set = make_unique<protocol::EthashRuleSet>(kMainnetConfig);
+    auto& ethash_rule_set = *rule_set;
+    HeaderChainForTest chain(std::move(rule_set));
+
+    BlockHeader header1;
+    header1.number = 1;
+    header1.difficulty = 1;
+    BlockHeader header2;
+    header2.number = 2;
+    header2.difficulty = 1;
+    header2.parent_hash = header1.hash();
+
+    REQUIRE(ethash_rule_set.validate_seal(header1) == ethash_rule_set.validate_seal(header1));
+    REQUIRE(ethash_rule_set.validate_seal(header2) == ethash_rule_set.validate_seal(header2));
+    REQUIRE(ethash_rule_set.verified_seals() == 2);
+
+    // unwinding marks the headers of the invalid chain as bad
+    chain.add_bad_headers({Hash{header2.hash()}});
+    CHECK(ethash_rule_set.verified_seals() == 1);
+    chain.add_bad_headers({Hash{header1.hash()}});
+    CHECK(ethash_rule_set.verified_seals() == 0);
+}
+
 }  // namespace silkworm